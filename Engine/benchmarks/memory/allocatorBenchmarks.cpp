@@ -0,0 +1,423 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include <benchmark/benchmark.h>
+
+#include "axr/common/defines.h"
+#include "memory/doubleStackAllocator.h"
+#include "memory/dynamicAllocator.h"
+#include "memory/poolAllocator.h"
+#include "memory/ringAllocator.h"
+#include "memory/slabAllocator.h"
+#include "memory/stackAllocator.h"
+#include "memory/tlsfAllocator.h"
+
+#include <cstdlib>
+#include <memory_resource>
+
+// ----------------------------------------- //
+// Shared Types
+// ----------------------------------------- //
+
+/// A typical small engine object
+struct BenchmarkData_Large {
+    uint32_t ID{};
+    uint32_t Data[15]{};
+};
+
+using BenchmarkData_Small = uint8_t;
+
+// ----------------------------------------- //
+// Shared Constants
+// ----------------------------------------- //
+
+/// Number of bytes requested per allocation in the fixed size benchmarks
+static constexpr size_t AllocationSize = sizeof(BenchmarkData_Large);
+/// Upper bound on the per allocation overhead of any allocator benchmarked here
+static constexpr size_t MaxAllocationOverhead = 64;
+
+// ----------------------------------------- //
+// Shared Data
+// ----------------------------------------- //
+
+static AxrHandleTable HandleTable;
+
+// ----------------------------------------- //
+// Shared Functions
+// ----------------------------------------- //
+
+static void deallocateCallback(void*& memory) {
+    free(memory);
+    memory = nullptr;
+};
+
+/// Create a malloc backed memory block
+/// @param size Size in bytes
+/// @return The memory block
+static AxrMemoryBlock createMemoryBlock(const size_t size) {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    return AxrMemoryBlock{
+        .Memory = malloc(size),
+        .Size = size,
+        .Deallocator = callback,
+    };
+}
+
+/// Make sure the handle table can hold at least the given number of handles
+/// @param maxHandleCount Max number of handles
+static void initializeHandleTable(const uint32_t maxHandleCount) {
+    if (HandleTable.handleCapacity() >= maxHandleCount) {
+        return;
+    }
+
+    HandleTable = AxrHandleTable(createMemoryBlock(AxrHandleTable::getAllocatorSize(maxHandleCount)));
+}
+
+// ----------------------------------------- //
+// Baselines
+// ----------------------------------------- //
+
+static void BM_Malloc_AllocateFree(benchmark::State& state) {
+    const auto allocationCount = static_cast<size_t>(state.range(0));
+    void* allocations[4096]{};
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < allocationCount; ++i) {
+            allocations[i] = malloc(AllocationSize);
+            benchmark::DoNotOptimize(allocations[i]);
+        }
+        for (size_t i = 0; i < allocationCount; ++i) {
+            free(allocations[i]);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * allocationCount));
+}
+BENCHMARK(BM_Malloc_AllocateFree)->Arg(64)->Arg(4096);
+
+static void BM_PmrMonotonic_AllocateRelease(benchmark::State& state) {
+    const auto allocationCount = static_cast<size_t>(state.range(0));
+    const AxrMemoryBlock memoryBlock = createMemoryBlock(allocationCount * (AllocationSize + MaxAllocationOverhead));
+    std::pmr::monotonic_buffer_resource resource(memoryBlock.Memory,
+                                                 memoryBlock.Size,
+                                                 std::pmr::null_memory_resource());
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < allocationCount; ++i) {
+            benchmark::DoNotOptimize(resource.allocate(AllocationSize, alignof(BenchmarkData_Large)));
+        }
+        resource.release();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * allocationCount));
+    free(memoryBlock.Memory);
+}
+BENCHMARK(BM_PmrMonotonic_AllocateRelease)->Arg(64)->Arg(4096);
+
+static void BM_PmrUnsynchronizedPool_AllocateFree(benchmark::State& state) {
+    const auto allocationCount = static_cast<size_t>(state.range(0));
+    std::pmr::unsynchronized_pool_resource resource;
+    void* allocations[4096]{};
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < allocationCount; ++i) {
+            allocations[i] = resource.allocate(AllocationSize, alignof(BenchmarkData_Large));
+            benchmark::DoNotOptimize(allocations[i]);
+        }
+        for (size_t i = 0; i < allocationCount; ++i) {
+            resource.deallocate(allocations[i], AllocationSize, alignof(BenchmarkData_Large));
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * allocationCount));
+}
+BENCHMARK(BM_PmrUnsynchronizedPool_AllocateFree)->Arg(64)->Arg(4096);
+
+// ----------------------------------------- //
+// Stack Allocator
+// ----------------------------------------- //
+
+static void BM_StackAllocator_AllocateClear(benchmark::State& state) {
+    const auto allocationCount = static_cast<size_t>(state.range(0));
+    AxrStackAllocator allocator(createMemoryBlock(allocationCount * (AllocationSize + MaxAllocationOverhead)));
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < allocationCount; ++i) {
+            BenchmarkData_Large* memory = nullptr;
+            AxrStackAllocator::MarkerID markerID{};
+            if (AXR_FAILED(allocator.allocate(1, memory, markerID))) [[unlikely]] {
+                state.SkipWithError("Stack allocator ran out of memory.");
+                return;
+            }
+            benchmark::DoNotOptimize(memory);
+        }
+        allocator.clear();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * allocationCount));
+}
+BENCHMARK(BM_StackAllocator_AllocateClear)->Arg(64)->Arg(4096);
+
+static void BM_StackAllocator_AllocateDeallocate(benchmark::State& state) {
+    const auto allocationCount = static_cast<size_t>(state.range(0));
+    AxrStackAllocator allocator(createMemoryBlock(allocationCount * (AllocationSize + MaxAllocationOverhead)));
+    AxrStackAllocator::MarkerID markerIDs[4096]{};
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < allocationCount; ++i) {
+            BenchmarkData_Large* memory = nullptr;
+            if (AXR_FAILED(allocator.allocate(1, memory, markerIDs[i]))) [[unlikely]] {
+                state.SkipWithError("Stack allocator ran out of memory.");
+                return;
+            }
+            benchmark::DoNotOptimize(memory);
+        }
+        // Pop in reverse order, the way scoped temporaries are released
+        for (size_t i = allocationCount; i > 0; --i) {
+            allocator.deallocate(markerIDs[i - 1]);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * allocationCount));
+}
+BENCHMARK(BM_StackAllocator_AllocateDeallocate)->Arg(64)->Arg(4096);
+
+// ----------------------------------------- //
+// Double Stack Allocator
+// ----------------------------------------- //
+
+static void BM_DoubleStackAllocator_AllocateBothEndsClear(benchmark::State& state) {
+    const auto allocationCount = static_cast<size_t>(state.range(0));
+    AxrDoubleStackAllocator allocator(createMemoryBlock(allocationCount * (AllocationSize + MaxAllocationOverhead)));
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < allocationCount; ++i) {
+            BenchmarkData_Large* memory = nullptr;
+            AxrDoubleStackAllocator::MarkerID markerID{};
+            const AxrResult axrResult = i % 2 == 0 ? allocator.allocateLower(1, memory, markerID)
+                                                   : allocator.allocateUpper(1, memory, markerID);
+            if (AXR_FAILED(axrResult)) [[unlikely]] {
+                state.SkipWithError("Double stack allocator ran out of memory.");
+                return;
+            }
+            benchmark::DoNotOptimize(memory);
+        }
+        allocator.clear();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * allocationCount));
+}
+BENCHMARK(BM_DoubleStackAllocator_AllocateBothEndsClear)->Arg(64)->Arg(4096);
+
+// ----------------------------------------- //
+// Ring Allocator
+// ----------------------------------------- //
+
+static void BM_RingAllocator_AllocateReleaseFence(benchmark::State& state) {
+    // Number of frames kept in flight before their fence is released
+    constexpr size_t frameCount = 3;
+    const auto allocationCount = static_cast<size_t>(state.range(0));
+    // One extra frame of room for the space skipped over when an allocation wraps around
+    AxrRingAllocator allocator(
+        createMemoryBlock((frameCount + 1) * allocationCount * (AllocationSize + MaxAllocationOverhead)));
+
+    AxrRingAllocator::Fence fences[frameCount]{};
+    size_t frameIndex = 0;
+    for (auto _ : state) {
+        allocator.release(fences[frameIndex]);
+
+        for (size_t i = 0; i < allocationCount; ++i) {
+            BenchmarkData_Large* memory = nullptr;
+            if (AXR_FAILED(allocator.allocate(1, memory))) [[unlikely]] {
+                state.SkipWithError("Ring allocator ran out of memory.");
+                return;
+            }
+            benchmark::DoNotOptimize(memory);
+        }
+
+        fences[frameIndex] = allocator.getFence();
+        frameIndex = (frameIndex + 1) % frameCount;
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * allocationCount));
+}
+BENCHMARK(BM_RingAllocator_AllocateReleaseFence)->Arg(64)->Arg(4096);
+
+// ----------------------------------------- //
+// Pool Allocator
+// ----------------------------------------- //
+
+template<typename DataType>
+static void BM_PoolAllocator_AllocateFree(benchmark::State& state) {
+    const auto allocationCount = static_cast<uint32_t>(state.range(0));
+    AxrPoolAllocator<DataType> allocator(
+        createMemoryBlock(AxrPoolAllocator<DataType>::getAllocatorSize(allocationCount)));
+    DataType* allocations[4096]{};
+
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < allocationCount; ++i) {
+            if (AXR_FAILED(allocator.allocate(allocations[i]))) [[unlikely]] {
+                state.SkipWithError("Pool allocator ran out of memory.");
+                return;
+            }
+            benchmark::DoNotOptimize(allocations[i]);
+        }
+        for (uint32_t i = 0; i < allocationCount; ++i) {
+            allocator.deallocate(allocations[i]);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * allocationCount));
+}
+BENCHMARK(BM_PoolAllocator_AllocateFree<BenchmarkData_Large>)->Arg(64)->Arg(4096);
+// Types smaller than a pointer store free chunk indices in the chunk itself, which limits the chunk count
+BENCHMARK(BM_PoolAllocator_AllocateFree<BenchmarkData_Small>)->Arg(64)->Arg(255);
+
+static void BM_PoolAllocator_AllocateFreeBatch(benchmark::State& state) {
+    const auto allocationCount = static_cast<uint32_t>(state.range(0));
+    AxrPoolAllocator<BenchmarkData_Large> allocator(
+        createMemoryBlock(AxrPoolAllocator<BenchmarkData_Large>::getAllocatorSize(allocationCount)));
+    BenchmarkData_Large* allocations[4096]{};
+
+    for (auto _ : state) {
+        if (AXR_FAILED(allocator.allocateBatch(allocations, allocationCount))) [[unlikely]] {
+            state.SkipWithError("Pool allocator ran out of memory.");
+            return;
+        }
+        benchmark::DoNotOptimize(allocations[0]);
+        allocator.deallocateBatch(allocations, allocationCount);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * allocationCount));
+}
+BENCHMARK(BM_PoolAllocator_AllocateFreeBatch)->Arg(64)->Arg(4096);
+
+// ----------------------------------------- //
+// Dynamic Allocator
+// ----------------------------------------- //
+
+static void BM_DynamicAllocator_AllocateFree(benchmark::State& state) {
+    const auto allocationCount = static_cast<uint32_t>(state.range(0));
+    initializeHandleTable(allocationCount);
+    AxrDynamicAllocator allocator(createMemoryBlock(allocationCount * (AllocationSize + MaxAllocationOverhead)),
+                                  &HandleTable);
+    AxrHandle<BenchmarkData_Large> allocations[4096]{};
+
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < allocationCount; ++i) {
+            if (AXR_FAILED(allocator.allocate(1, allocations[i]))) [[unlikely]] {
+                state.SkipWithError("Dynamic allocator ran out of memory.");
+                return;
+            }
+            benchmark::DoNotOptimize(allocations[i].getDataPtr());
+        }
+        for (uint32_t i = 0; i < allocationCount; ++i) {
+            allocator.deallocate(allocations[i]);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * allocationCount));
+}
+BENCHMARK(BM_DynamicAllocator_AllocateFree)->Arg(64)->Arg(4096);
+
+static void BM_DynamicAllocator_AllocateFreeBatch(benchmark::State& state) {
+    const auto allocationCount = static_cast<uint32_t>(state.range(0));
+    initializeHandleTable(allocationCount);
+    AxrDynamicAllocator allocator(createMemoryBlock(allocationCount * (AllocationSize + MaxAllocationOverhead)),
+                                  &HandleTable);
+    AxrHandle<BenchmarkData_Large> allocations[4096]{};
+
+    for (auto _ : state) {
+        if (AXR_FAILED(allocator.allocateBatch(1, allocations, allocationCount))) [[unlikely]] {
+            state.SkipWithError("Dynamic allocator ran out of memory.");
+            return;
+        }
+        benchmark::DoNotOptimize(allocations[0].getDataPtr());
+        allocator.deallocateBatch(allocations, allocationCount);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * allocationCount));
+}
+BENCHMARK(BM_DynamicAllocator_AllocateFreeBatch)->Arg(64)->Arg(4096);
+
+// ----------------------------------------- //
+// TLSF Allocator
+// ----------------------------------------- //
+
+static void BM_TlsfAllocator_AllocateFree(benchmark::State& state) {
+    const auto allocationCount = static_cast<uint32_t>(state.range(0));
+    AxrTlsfAllocator allocator(createMemoryBlock(allocationCount * (AllocationSize + MaxAllocationOverhead)));
+    AxrHandle<BenchmarkData_Large> allocations[4096]{};
+
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < allocationCount; ++i) {
+            if (AXR_FAILED(allocator.allocate(1, allocations[i]))) [[unlikely]] {
+                state.SkipWithError("TLSF allocator ran out of memory.");
+                return;
+            }
+            benchmark::DoNotOptimize(allocations[i].getDataPtr());
+        }
+        for (uint32_t i = 0; i < allocationCount; ++i) {
+            allocator.deallocate(allocations[i]);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * allocationCount));
+}
+BENCHMARK(BM_TlsfAllocator_AllocateFree)->Arg(64)->Arg(4096);
+
+// ----------------------------------------- //
+// Slab Allocator
+// ----------------------------------------- //
+
+static void BM_SlabAllocator_AllocateFree(benchmark::State& state) {
+    const auto allocationCount = static_cast<uint32_t>(state.range(0));
+    const auto pageCount =
+        static_cast<uint32_t>(allocationCount * AllocationSize / AxrSlabAllocator::PageSize + 1);
+    AxrSlabAllocator allocator(createMemoryBlock(AxrSlabAllocator::getAllocatorSize(pageCount)));
+    BenchmarkData_Large* allocations[4096]{};
+
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < allocationCount; ++i) {
+            if (AXR_FAILED(allocator.allocate(allocations[i]))) [[unlikely]] {
+                state.SkipWithError("Slab allocator ran out of memory.");
+                return;
+            }
+            benchmark::DoNotOptimize(allocations[i]);
+        }
+        for (uint32_t i = 0; i < allocationCount; ++i) {
+            allocator.deallocate(allocations[i]);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * allocationCount));
+}
+BENCHMARK(BM_SlabAllocator_AllocateFree)->Arg(64)->Arg(4096);
+
+/// Mixed small sizes, the case the slab allocator is meant for
+static void BM_SlabAllocator_AllocateFreeMixedSizes(benchmark::State& state) {
+    const auto allocationCount = static_cast<uint32_t>(state.range(0));
+    const auto pageCount = static_cast<uint32_t>(allocationCount * AxrSlabAllocator::MaxAllocationSize /
+                                                     AxrSlabAllocator::PageSize +
+                                                 AxrSlabAllocator::SizeClassCount);
+    AxrSlabAllocator allocator(createMemoryBlock(AxrSlabAllocator::getAllocatorSize(pageCount)));
+    void* allocations[4096]{};
+
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < allocationCount; ++i) {
+            if (AXR_FAILED(allocator.allocateBlock(8 + (i * 24) % 200, 8, allocations[i]))) [[unlikely]] {
+                state.SkipWithError("Slab allocator ran out of memory.");
+                return;
+            }
+            benchmark::DoNotOptimize(allocations[i]);
+        }
+        for (uint32_t i = 0; i < allocationCount; ++i) {
+            allocator.deallocateBlock(allocations[i]);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * allocationCount));
+}
+BENCHMARK(BM_SlabAllocator_AllocateFreeMixedSizes)->Arg(64)->Arg(4096);
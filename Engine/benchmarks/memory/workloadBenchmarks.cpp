@@ -0,0 +1,460 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include <benchmark/benchmark.h>
+
+#include "axr/common/defines.h"
+#include "memory/dynamicAllocator.h"
+#include "memory/poolAllocator.h"
+#include "memory/stackAllocator.h"
+#include "memory/tlsfAllocator.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <memory_resource>
+
+// ----------------------------------------- //
+// Shared Types
+// ----------------------------------------- //
+
+/// A typical small engine object
+struct BenchmarkData_Large {
+    uint32_t ID{};
+    uint32_t Data[15]{};
+};
+
+/// A single step of the fragmentation workload.
+/// If the slot is empty, allocate `Size` bytes into it. Otherwise, free it.
+struct FragmentationOp {
+    uint16_t Slot;
+    uint16_t Size;
+};
+
+// ----------------------------------------- //
+// Shared Constants
+// ----------------------------------------- //
+
+/// Seed for all generated workloads, so every run performs the exact same operations
+static constexpr uint64_t WorkloadSeed = 0x9E3779B97F4A7C15;
+
+/// Number of allocations that can be alive at once in the fragmentation workload
+static constexpr uint32_t FragmentationSlotCount = 512;
+/// Number of operations per fragmentation workload iteration
+static constexpr uint32_t FragmentationOpCount = 8192;
+/// Smallest allocation size in the fragmentation workload
+static constexpr uint16_t FragmentationMinSize = 16;
+/// Largest allocation size in the fragmentation workload
+static constexpr uint16_t FragmentationMaxSize = 1024;
+
+/// Number of buffers grown at the same time in the reallocate workload
+static constexpr uint32_t GrowthBufferCount = 8;
+/// Number of bytes each buffer grows by per step in the reallocate workload
+static constexpr size_t GrowthStepSize = 64;
+/// Final size of each buffer in the reallocate workload
+static constexpr size_t GrowthMaxSize = 8192;
+
+/// Number of frame allocations per frame in the mixed frame workload
+static constexpr uint32_t FrameAllocationCount = 256;
+/// Number of entities alive at once in the mixed frame workload
+static constexpr uint32_t FrameEntityCount = 1024;
+/// Number of entities replaced per frame in the mixed frame workload
+static constexpr uint32_t FrameEntityChurnCount = 32;
+/// Number of buffers resized per frame in the mixed frame workload
+static constexpr uint32_t FrameBufferCount = 8;
+
+/// Size in bytes of the memory given to the general purpose allocators
+static constexpr size_t GeneralAllocatorSize = 4'194'304;
+
+// ----------------------------------------- //
+// Shared Data
+// ----------------------------------------- //
+
+static AxrHandleTable HandleTable;
+
+// ----------------------------------------- //
+// Shared Functions
+// ----------------------------------------- //
+
+static void deallocateCallback(void*& memory) {
+    free(memory);
+    memory = nullptr;
+};
+
+/// Create a malloc backed memory block
+/// @param size Size in bytes
+/// @return The memory block
+static AxrMemoryBlock createMemoryBlock(const size_t size) {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    return AxrMemoryBlock{
+        .Memory = malloc(size),
+        .Size = size,
+        .Deallocator = callback,
+    };
+}
+
+/// Make sure the handle table can hold at least the given number of handles
+/// @param maxHandleCount Max number of handles
+static void initializeHandleTable(const uint32_t maxHandleCount) {
+    if (HandleTable.handleCapacity() >= maxHandleCount) {
+        return;
+    }
+
+    HandleTable = AxrHandleTable(createMemoryBlock(AxrHandleTable::getAllocatorSize(maxHandleCount)));
+}
+
+/// Get the next value from a xorshift random number generator.
+/// Used instead of the standard library distributions so the sequence is identical on every platform.
+/// @param state Generator state
+/// @return The next random value
+static uint64_t nextRandom(uint64_t& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+/// Get the operations for the fragmentation workload
+/// @return The fragmentation workload operations
+static const FragmentationOp* getFragmentationOps() {
+    static FragmentationOp ops[FragmentationOpCount]{};
+    static bool isGenerated = false;
+
+    if (!isGenerated) {
+        uint64_t randomState = WorkloadSeed;
+        for (FragmentationOp& op : ops) {
+            op.Slot = static_cast<uint16_t>(nextRandom(randomState) % FragmentationSlotCount);
+            const uint64_t sizeRange = FragmentationMaxSize - FragmentationMinSize + 1;
+            op.Size = static_cast<uint16_t>(FragmentationMinSize + nextRandom(randomState) % sizeRange);
+        }
+        isGenerated = true;
+    }
+
+    return ops;
+}
+
+// ----------------------------------------- //
+// Fragmentation Workload
+// ----------------------------------------- //
+
+static void BM_Fragmentation_Malloc(benchmark::State& state) {
+    const FragmentationOp* ops = getFragmentationOps();
+    void* slots[FragmentationSlotCount]{};
+
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < FragmentationOpCount; ++i) {
+            void*& slot = slots[ops[i].Slot];
+            if (slot == nullptr) {
+                slot = malloc(ops[i].Size);
+                benchmark::DoNotOptimize(slot);
+            } else {
+                free(slot);
+                slot = nullptr;
+            }
+        }
+        for (void*& slot : slots) {
+            free(slot);
+            slot = nullptr;
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * FragmentationOpCount));
+}
+BENCHMARK(BM_Fragmentation_Malloc);
+
+static void BM_Fragmentation_PmrUnsynchronizedPool(benchmark::State& state) {
+    const FragmentationOp* ops = getFragmentationOps();
+    std::pmr::unsynchronized_pool_resource resource;
+    void* slots[FragmentationSlotCount]{};
+    uint16_t slotSizes[FragmentationSlotCount]{};
+
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < FragmentationOpCount; ++i) {
+            const uint16_t slotIndex = ops[i].Slot;
+            if (slots[slotIndex] == nullptr) {
+                slots[slotIndex] = resource.allocate(ops[i].Size);
+                slotSizes[slotIndex] = ops[i].Size;
+                benchmark::DoNotOptimize(slots[slotIndex]);
+            } else {
+                resource.deallocate(slots[slotIndex], slotSizes[slotIndex]);
+                slots[slotIndex] = nullptr;
+            }
+        }
+        for (uint32_t i = 0; i < FragmentationSlotCount; ++i) {
+            if (slots[i] != nullptr) {
+                resource.deallocate(slots[i], slotSizes[i]);
+                slots[i] = nullptr;
+            }
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * FragmentationOpCount));
+}
+BENCHMARK(BM_Fragmentation_PmrUnsynchronizedPool);
+
+/// Run the fragmentation workload on a handle based allocator
+/// @tparam AllocatorType The allocator type
+/// @param state Benchmark state
+/// @param allocator Allocator to use
+template<typename AllocatorType>
+static void runFragmentationWorkload(benchmark::State& state, AllocatorType& allocator) {
+    const FragmentationOp* ops = getFragmentationOps();
+    AxrHandle<uint8_t> slots[FragmentationSlotCount]{};
+
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < FragmentationOpCount; ++i) {
+            AxrHandle<uint8_t>& slot = slots[ops[i].Slot];
+            if (slot == nullptr) {
+                if (AXR_FAILED(allocator.allocate(ops[i].Size, slot))) [[unlikely]] {
+                    state.SkipWithError("Allocator ran out of memory.");
+                    return;
+                }
+                benchmark::DoNotOptimize(slot.getDataPtr());
+            } else {
+                allocator.deallocate(slot);
+            }
+        }
+        for (AxrHandle<uint8_t>& slot : slots) {
+            allocator.deallocate(slot);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * FragmentationOpCount));
+}
+
+static void BM_Fragmentation_DynamicAllocator(benchmark::State& state) {
+    initializeHandleTable(FragmentationSlotCount);
+    AxrDynamicAllocator allocator(createMemoryBlock(GeneralAllocatorSize), &HandleTable);
+    runFragmentationWorkload(state, allocator);
+}
+BENCHMARK(BM_Fragmentation_DynamicAllocator);
+
+static void BM_Fragmentation_TlsfAllocator(benchmark::State& state) {
+    AxrTlsfAllocator allocator(createMemoryBlock(GeneralAllocatorSize));
+    runFragmentationWorkload(state, allocator);
+}
+BENCHMARK(BM_Fragmentation_TlsfAllocator);
+
+// ----------------------------------------- //
+// Reallocate Growth Workload
+// ----------------------------------------- //
+
+static void BM_ReallocateGrowth_Malloc(benchmark::State& state) {
+    void* buffers[GrowthBufferCount]{};
+    uint64_t reallocateCount = 0;
+
+    for (auto _ : state) {
+        // Grow all buffers round robin, so growing one buffer is often blocked by another
+        for (size_t size = GrowthStepSize; size <= GrowthMaxSize; size += GrowthStepSize) {
+            for (void*& buffer : buffers) {
+                buffer = realloc(buffer, size);
+                benchmark::DoNotOptimize(buffer);
+                ++reallocateCount;
+            }
+        }
+        for (void*& buffer : buffers) {
+            free(buffer);
+            buffer = nullptr;
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(reallocateCount));
+}
+BENCHMARK(BM_ReallocateGrowth_Malloc);
+
+/// Run the reallocate growth workload on a handle based allocator
+/// @tparam AllocatorType The allocator type
+/// @param state Benchmark state
+/// @param allocator Allocator to use
+template<typename AllocatorType>
+static void runReallocateGrowthWorkload(benchmark::State& state, AllocatorType& allocator) {
+    AxrHandle<uint8_t> buffers[GrowthBufferCount]{};
+    uint64_t reallocateCount = 0;
+
+    for (auto _ : state) {
+        for (AxrHandle<uint8_t>& buffer : buffers) {
+            if (AXR_FAILED(allocator.allocate(GrowthStepSize, buffer))) [[unlikely]] {
+                state.SkipWithError("Allocator ran out of memory.");
+                return;
+            }
+        }
+        // Grow all buffers round robin, so growing one buffer is often blocked by another
+        for (size_t size = GrowthStepSize * 2; size <= GrowthMaxSize; size += GrowthStepSize) {
+            for (AxrHandle<uint8_t>& buffer : buffers) {
+                if (AXR_FAILED(allocator.reallocate(size, buffer))) [[unlikely]] {
+                    state.SkipWithError("Allocator ran out of memory.");
+                    return;
+                }
+                benchmark::DoNotOptimize(buffer.getDataPtr());
+                ++reallocateCount;
+            }
+        }
+        for (AxrHandle<uint8_t>& buffer : buffers) {
+            allocator.deallocate(buffer);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(reallocateCount));
+}
+
+static void BM_ReallocateGrowth_DynamicAllocator(benchmark::State& state) {
+    initializeHandleTable(GrowthBufferCount * 2);
+    AxrDynamicAllocator allocator(createMemoryBlock(GeneralAllocatorSize), &HandleTable);
+    runReallocateGrowthWorkload(state, allocator);
+}
+BENCHMARK(BM_ReallocateGrowth_DynamicAllocator);
+
+static void BM_ReallocateGrowth_TlsfAllocator(benchmark::State& state) {
+    AxrTlsfAllocator allocator(createMemoryBlock(GeneralAllocatorSize));
+    runReallocateGrowthWorkload(state, allocator);
+}
+BENCHMARK(BM_ReallocateGrowth_TlsfAllocator);
+
+// ----------------------------------------- //
+// Defragment Workload
+// ----------------------------------------- //
+
+static void BM_Defragment_DynamicAllocator(benchmark::State& state) {
+    const auto blockCount = static_cast<uint32_t>(state.range(0));
+    constexpr size_t blockSize = 256;
+
+    initializeHandleTable(blockCount);
+    AxrDynamicAllocator allocator(createMemoryBlock(GeneralAllocatorSize), &HandleTable);
+    AxrHandle<uint8_t> blocks[4096]{};
+    uint64_t bytesMoved = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        // Free every other block, leaving a gap in front of every remaining block
+        for (uint32_t i = 0; i < blockCount; ++i) {
+            if (AXR_FAILED(allocator.allocate(blockSize, blocks[i]))) [[unlikely]] {
+                state.SkipWithError("Dynamic allocator ran out of memory.");
+                return;
+            }
+        }
+        for (uint32_t i = 0; i < blockCount; i += 2) {
+            allocator.deallocate(blocks[i]);
+        }
+        state.ResumeTiming();
+
+        const AxrDynamicAllocator::DefragmentProgress progress = allocator.defragment(
+            AxrDynamicAllocator::DefragmentBudget{
+                .MaxMicroseconds = 0,
+                .MaxBytes = 0,
+            });
+        bytesMoved += progress.BytesMoved;
+
+        state.PauseTiming();
+        for (uint32_t i = 0; i < blockCount; ++i) {
+            allocator.deallocate(blocks[i]);
+        }
+        state.ResumeTiming();
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(bytesMoved));
+}
+BENCHMARK(BM_Defragment_DynamicAllocator)->Arg(256)->Arg(4096);
+
+// ----------------------------------------- //
+// Mixed Frame Workload
+// ----------------------------------------- //
+
+static void BM_MixedFrame_Malloc(benchmark::State& state) {
+    void* frameAllocations[FrameAllocationCount]{};
+    BenchmarkData_Large* entities[FrameEntityCount]{};
+    void* buffers[FrameBufferCount]{};
+    uint64_t randomState = WorkloadSeed;
+
+    for (BenchmarkData_Large*& entity : entities) {
+        entity = new BenchmarkData_Large();
+    }
+
+    for (auto _ : state) {
+        for (void*& frameAllocation : frameAllocations) {
+            frameAllocation = malloc(16 + nextRandom(randomState) % 497);
+            benchmark::DoNotOptimize(frameAllocation);
+        }
+        for (uint32_t i = 0; i < FrameEntityChurnCount; ++i) {
+            BenchmarkData_Large*& entity = entities[nextRandom(randomState) % FrameEntityCount];
+            delete entity;
+            entity = new BenchmarkData_Large();
+            benchmark::DoNotOptimize(entity);
+        }
+        for (void*& buffer : buffers) {
+            buffer = realloc(buffer, 256 + nextRandom(randomState) % 3841);
+            benchmark::DoNotOptimize(buffer);
+        }
+        for (void*& frameAllocation : frameAllocations) {
+            free(frameAllocation);
+        }
+    }
+
+    for (BenchmarkData_Large*& entity : entities) {
+        delete entity;
+    }
+    for (void*& buffer : buffers) {
+        free(buffer);
+    }
+}
+BENCHMARK(BM_MixedFrame_Malloc);
+
+static void BM_MixedFrame_AxrAllocators(benchmark::State& state) {
+    initializeHandleTable(FrameBufferCount);
+    AxrStackAllocator frameAllocator(createMemoryBlock(FrameAllocationCount * 1024));
+    AxrPoolAllocator<BenchmarkData_Large> entityAllocator(
+        createMemoryBlock(AxrPoolAllocator<BenchmarkData_Large>::getAllocatorSize(FrameEntityCount)));
+    AxrDynamicAllocator bufferAllocator(createMemoryBlock(GeneralAllocatorSize), &HandleTable);
+
+    BenchmarkData_Large* entities[FrameEntityCount]{};
+    AxrHandle<uint8_t> buffers[FrameBufferCount]{};
+    uint64_t randomState = WorkloadSeed;
+
+    for (BenchmarkData_Large*& entity : entities) {
+        if (AXR_FAILED(entityAllocator.allocate(entity, true))) [[unlikely]] {
+            state.SkipWithError("Pool allocator ran out of memory.");
+            return;
+        }
+    }
+    for (AxrHandle<uint8_t>& buffer : buffers) {
+        if (AXR_FAILED(bufferAllocator.allocate(256, buffer))) [[unlikely]] {
+            state.SkipWithError("Dynamic allocator ran out of memory.");
+            return;
+        }
+    }
+
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < FrameAllocationCount; ++i) {
+            uint8_t* frameAllocation = nullptr;
+            AxrStackAllocator::MarkerID markerID{};
+            if (AXR_FAILED(frameAllocator.allocate(16 + nextRandom(randomState) % 497, frameAllocation, markerID)))
+                [[unlikely]] {
+                state.SkipWithError("Stack allocator ran out of memory.");
+                return;
+            }
+            benchmark::DoNotOptimize(frameAllocation);
+        }
+        for (uint32_t i = 0; i < FrameEntityChurnCount; ++i) {
+            BenchmarkData_Large*& entity = entities[nextRandom(randomState) % FrameEntityCount];
+            entityAllocator.deallocate(entity);
+            if (AXR_FAILED(entityAllocator.allocate(entity, true))) [[unlikely]] {
+                state.SkipWithError("Pool allocator ran out of memory.");
+                return;
+            }
+            benchmark::DoNotOptimize(entity);
+        }
+        for (AxrHandle<uint8_t>& buffer : buffers) {
+            if (AXR_FAILED(bufferAllocator.reallocate(256 + nextRandom(randomState) % 3841, buffer))) [[unlikely]] {
+                state.SkipWithError("Dynamic allocator ran out of memory.");
+                return;
+            }
+            benchmark::DoNotOptimize(buffer.getDataPtr());
+        }
+        frameAllocator.clear();
+    }
+
+    for (AxrHandle<uint8_t>& buffer : buffers) {
+        bufferAllocator.deallocate(buffer);
+    }
+}
+BENCHMARK(BM_MixedFrame_AxrAllocators);
@@ -0,0 +1,549 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "axr/common/defines.h"
+#include "memory/allocationTrace.h"
+#include "memory/dynamicAllocator.h"
+#include "memory/tlsfAllocator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+// ----------------------------------------- //
+// Shared Constants
+// ----------------------------------------- //
+
+/// Each replayed allocator gets this many times the capacity it was recorded with, so allocators with more per block
+/// overhead than the recorded one don't run out of memory partway through
+static constexpr size_t CapacityScale = 2;
+
+// ----------------------------------------- //
+// Shared Functions
+// ----------------------------------------- //
+
+static void deallocateCallback(void*& memory) {
+    free(memory);
+    memory = nullptr;
+};
+
+/// Create a malloc backed memory block
+/// @param size Size in bytes
+/// @return The memory block
+static AxrMemoryBlock createMemoryBlock(const size_t size) {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    return AxrMemoryBlock{
+        .Memory = malloc(size),
+        .Size = size,
+        .Deallocator = callback,
+    };
+}
+
+// ----------------------------------------- //
+// Replay Targets
+// ----------------------------------------- //
+
+namespace {
+    /// Replays a trace through an `AxrDynamicAllocator`
+    class ReplayTarget_Dynamic {
+    public:
+        using Allocation = AxrHandle<void>;
+
+        static constexpr const char* Name = "Dynamic";
+
+        void setup(const size_t capacity, const uint32_t maxHandleCount) {
+            m_HandleTable = AxrHandleTable(createMemoryBlock(AxrHandleTable::getAllocatorSize(maxHandleCount)));
+            m_Allocator = AxrDynamicAllocator(createMemoryBlock(capacity), &m_HandleTable);
+        }
+
+        bool allocate(const size_t size, const uint8_t alignment, Allocation& allocation) {
+            return AXR_SUCCEEDED(m_Allocator.allocateBlock(size, alignment, allocation));
+        }
+
+        bool reallocate(const size_t size, const uint8_t alignment, Allocation& allocation) {
+            return AXR_SUCCEEDED(m_Allocator.reallocateBlock(size, alignment, allocation));
+        }
+
+        void deallocate(Allocation& allocation) {
+            m_Allocator.deallocateHandle(allocation);
+        }
+
+        void defragment(const uint32_t blockCount) {
+            m_Allocator.defragment(blockCount);
+        }
+
+        [[nodiscard]] size_t size() const {
+            return m_Allocator.size();
+        }
+
+        [[nodiscard]] bool hasFragmentationRatio() const {
+            return true;
+        }
+
+        [[nodiscard]] float getFragmentationRatio() const {
+            return m_Allocator.getFragmentationRatio();
+        }
+
+    private:
+        AxrHandleTable m_HandleTable;
+        AxrDynamicAllocator m_Allocator;
+    };
+
+    /// Replays a trace through an `AxrTlsfAllocator`. Defragment events are ignored since it never relocates data
+    class ReplayTarget_Tlsf {
+    public:
+        using Allocation = AxrHandle<void>;
+
+        static constexpr const char* Name = "TLSF";
+
+        void setup(const size_t capacity, [[maybe_unused]] const uint32_t maxHandleCount) {
+            m_Allocator = AxrTlsfAllocator(createMemoryBlock(capacity));
+        }
+
+        bool allocate(const size_t size, const uint8_t alignment, Allocation& allocation) {
+            return AXR_SUCCEEDED(m_Allocator.allocateBlock(size, alignment, allocation));
+        }
+
+        bool reallocate(const size_t size, const uint8_t alignment, Allocation& allocation) {
+            return AXR_SUCCEEDED(m_Allocator.reallocateBlock(size, alignment, allocation));
+        }
+
+        void deallocate(Allocation& allocation) {
+            m_Allocator.deallocateHandle(allocation);
+        }
+
+        void defragment([[maybe_unused]] const uint32_t blockCount) {
+        }
+
+        [[nodiscard]] size_t size() const {
+            return m_Allocator.size();
+        }
+
+        [[nodiscard]] bool hasFragmentationRatio() const {
+            return false;
+        }
+
+        [[nodiscard]] float getFragmentationRatio() const {
+            return 0.0f;
+        }
+
+    private:
+        AxrTlsfAllocator m_Allocator;
+    };
+
+    /// Replays a trace through the system heap. Used as a baseline
+    class ReplayTarget_Malloc {
+    public:
+        struct Allocation {
+            void* Memory;
+            size_t Size;
+            uint8_t Alignment;
+        };
+
+        static constexpr const char* Name = "Malloc";
+
+        void setup([[maybe_unused]] const size_t capacity, [[maybe_unused]] const uint32_t maxHandleCount) {
+        }
+
+        bool allocate(const size_t size, const uint8_t alignment, Allocation& allocation) {
+            allocation = Allocation{
+                .Memory = ::operator new(std::max<size_t>(size, 1), std::align_val_t(alignment), std::nothrow),
+                .Size = size,
+                .Alignment = alignment,
+            };
+            if (allocation.Memory == nullptr) [[unlikely]] {
+                return false;
+            }
+
+            m_Size += size;
+            return true;
+        }
+
+        bool reallocate(const size_t size, const uint8_t alignment, Allocation& allocation) {
+            Allocation newAllocation{};
+            if (!allocate(size, alignment, newAllocation)) [[unlikely]] {
+                return false;
+            }
+
+            std::memcpy(newAllocation.Memory, allocation.Memory, std::min(size, allocation.Size));
+            deallocate(allocation);
+
+            allocation = newAllocation;
+            return true;
+        }
+
+        void deallocate(Allocation& allocation) {
+            ::operator delete(allocation.Memory, std::align_val_t(allocation.Alignment));
+            m_Size -= allocation.Size;
+            allocation.Memory = nullptr;
+        }
+
+        void defragment([[maybe_unused]] const uint32_t blockCount) {
+        }
+
+        /// The heap doesn't report its own overhead, so this is only the requested size
+        [[nodiscard]] size_t size() const {
+            return m_Size;
+        }
+
+        [[nodiscard]] bool hasFragmentationRatio() const {
+            return false;
+        }
+
+        [[nodiscard]] float getFragmentationRatio() const {
+            return 0.0f;
+        }
+
+    private:
+        size_t m_Size{};
+    };
+} // namespace
+
+// ----------------------------------------- //
+// Replay
+// ----------------------------------------- //
+
+namespace {
+    /// A recorded allocator and everything replayed into it
+    template<typename Target>
+    struct ReplayAllocator {
+        AxrAllocationTraceAllocatorEnum Type;
+        Target ReplayTarget;
+        /// Live allocations by allocation ID. Kept in order so stack markers can be popped
+        std::map<uint64_t, typename Target::Allocation> Allocations;
+        /// Requested size of each live allocation by allocation ID
+        std::map<uint64_t, uint64_t> AllocationSizes;
+    };
+
+    /// The results of replaying a trace
+    struct ReplayResult {
+        /// Time spent inside the allocator, in nanoseconds
+        uint64_t Nanoseconds;
+        uint64_t EventCount;
+        uint64_t FailedEventCount;
+        /// Peak number of bytes requested and alive at one time, across all allocators
+        uint64_t PeakRequestedSize;
+        /// Peak number of bytes the allocators reported in use at one time, across all allocators
+        uint64_t PeakUsedSize;
+        /// Fragmentation ratio at the end of each frame, summed across all allocators
+        double FragmentationRatioSum;
+        uint64_t FragmentationSampleCount;
+        float MaxFragmentationRatio;
+        bool HasFragmentationRatio;
+    };
+
+    /// Replays a trace through a single allocator implementation
+    template<typename Target>
+    class TraceReplayer {
+    public:
+        explicit TraceReplayer(const std::vector<AxrAllocationTraceEvent>& events) :
+            m_Events(events) {
+        }
+
+        ReplayResult replay() {
+            countAllocations();
+
+            uint32_t frameIndex = m_Events.empty() ? 0 : m_Events.front().FrameIndex;
+            for (const AxrAllocationTraceEvent& event : m_Events) {
+                if (event.FrameIndex != frameIndex) {
+                    sampleFragmentation();
+                    frameIndex = event.FrameIndex;
+                }
+
+                replayEvent(event);
+
+                m_Result.PeakRequestedSize = std::max(m_Result.PeakRequestedSize, m_RequestedSize);
+                m_Result.PeakUsedSize = std::max(m_Result.PeakUsedSize, getUsedSize());
+            }
+            sampleFragmentation();
+
+            // Give everything back so the allocators can be destroyed
+            for (auto& [allocatorIndex, allocator] : m_Allocators) {
+                for (auto& [allocationID, allocation] : allocator.Allocations) {
+                    allocator.ReplayTarget.deallocate(allocation);
+                }
+            }
+
+            return m_Result;
+        }
+
+    private:
+        const std::vector<AxrAllocationTraceEvent>& m_Events;
+        std::unordered_map<uint16_t, ReplayAllocator<Target>> m_Allocators;
+        /// Number of allocate events per allocator. The most handles an allocator could ever need
+        std::unordered_map<uint16_t, uint32_t> m_AllocationCounts;
+        uint64_t m_RequestedSize{};
+        ReplayResult m_Result{};
+
+        void countAllocations() {
+            for (const AxrAllocationTraceEvent& event : m_Events) {
+                if (event.Type == AXR_ALLOCATION_TRACE_EVENT_ALLOCATE) {
+                    uint32_t& allocationCount = m_AllocationCounts[event.AllocatorIndex];
+                    allocationCount = std::min<uint32_t>(allocationCount + 1, AxrDynamicAllocator::MaxHandleCount);
+                }
+            }
+        }
+
+        void replayEvent(const AxrAllocationTraceEvent& event) {
+            if (event.Type == AXR_ALLOCATION_TRACE_EVENT_CREATE) {
+                ReplayAllocator<Target>& allocator = m_Allocators[event.AllocatorIndex];
+                allocator.Type = static_cast<AxrAllocationTraceAllocatorEnum>(event.AllocationID);
+                allocator.ReplayTarget.setup(event.Size * CapacityScale,
+                                             std::max<uint32_t>(m_AllocationCounts[event.AllocatorIndex], 1));
+                return;
+            }
+
+            const auto foundAllocator = m_Allocators.find(event.AllocatorIndex);
+            if (foundAllocator == m_Allocators.end()) [[unlikely]] {
+                return;
+            }
+            ReplayAllocator<Target>& allocator = foundAllocator->second;
+
+            ++m_Result.EventCount;
+
+            switch (event.Type) {
+                case AXR_ALLOCATION_TRACE_EVENT_ALLOCATE: {
+                    // Allocations that were released in bulk without an event are still here
+                    deallocateRange(allocator, event.AllocationID, event.AllocationID + 1);
+
+                    typename Target::Allocation allocation{};
+                    const auto allocate = [&] {
+                        return allocator.ReplayTarget.allocate(event.Size, event.Alignment, allocation);
+                    };
+                    if (!timed(allocate)) {
+                        ++m_Result.FailedEventCount;
+                        break;
+                    }
+
+                    allocator.Allocations.emplace(event.AllocationID, std::move(allocation));
+                    allocator.AllocationSizes[event.AllocationID] = event.Size;
+                    m_RequestedSize += event.Size;
+                    break;
+                }
+                case AXR_ALLOCATION_TRACE_EVENT_REALLOCATE: {
+                    const auto foundAllocation = allocator.Allocations.find(event.PreviousAllocationID);
+                    if (foundAllocation == allocator.Allocations.end()) [[unlikely]] {
+                        ++m_Result.FailedEventCount;
+                        break;
+                    }
+
+                    typename Target::Allocation allocation = std::move(foundAllocation->second);
+                    allocator.Allocations.erase(foundAllocation);
+                    m_RequestedSize -= allocator.AllocationSizes[event.PreviousAllocationID];
+                    allocator.AllocationSizes.erase(event.PreviousAllocationID);
+
+                    if (!timed([&] {
+                            return allocator.ReplayTarget.reallocate(event.Size, event.Alignment, allocation);
+                        })) {
+                        ++m_Result.FailedEventCount;
+                        timed([&] {
+                            allocator.ReplayTarget.deallocate(allocation);
+                            return true;
+                        });
+                        break;
+                    }
+
+                    allocator.Allocations.emplace(event.AllocationID, std::move(allocation));
+                    allocator.AllocationSizes[event.AllocationID] = event.Size;
+                    m_RequestedSize += event.Size;
+                    break;
+                }
+                case AXR_ALLOCATION_TRACE_EVENT_DEALLOCATE: {
+                    // Deallocating a stack marker also deallocates everything allocated after it
+                    const uint64_t endAllocationID = allocator.Type == AXR_ALLOCATION_TRACE_ALLOCATOR_STACK
+                                                         ? UINT64_MAX
+                                                         : event.AllocationID + 1;
+                    deallocateRange(allocator, event.AllocationID, endAllocationID);
+                    break;
+                }
+                case AXR_ALLOCATION_TRACE_EVENT_CLEAR: {
+                    deallocateRange(allocator, 0, UINT64_MAX);
+                    break;
+                }
+                case AXR_ALLOCATION_TRACE_EVENT_DEFRAGMENT: {
+                    timed([&] {
+                        allocator.ReplayTarget.defragment(static_cast<uint32_t>(event.Size));
+                        return true;
+                    });
+                    break;
+                }
+                default: {
+                    ++m_Result.FailedEventCount;
+                    break;
+                }
+            }
+        }
+
+        /// Deallocate every live allocation with an ID in the range [startAllocationID, endAllocationID)
+        void deallocateRange(ReplayAllocator<Target>& allocator,
+                             const uint64_t startAllocationID,
+                             const uint64_t endAllocationID) {
+            const auto begin = allocator.Allocations.lower_bound(startAllocationID);
+            const auto end = allocator.Allocations.lower_bound(endAllocationID);
+
+            for (auto allocation = begin; allocation != end; ++allocation) {
+                timed([&] {
+                    allocator.ReplayTarget.deallocate(allocation->second);
+                    return true;
+                });
+                m_RequestedSize -= allocator.AllocationSizes[allocation->first];
+                allocator.AllocationSizes.erase(allocation->first);
+            }
+            allocator.Allocations.erase(begin, end);
+        }
+
+        template<typename Function>
+        bool timed(Function&& function) {
+            const auto startTime = std::chrono::steady_clock::now();
+            const bool succeeded = function();
+            m_Result.Nanoseconds += static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime)
+                    .count());
+            return succeeded;
+        }
+
+        [[nodiscard]] uint64_t getUsedSize() const {
+            uint64_t usedSize = 0;
+            for (const auto& [allocatorIndex, allocator] : m_Allocators) {
+                usedSize += allocator.ReplayTarget.size();
+            }
+            return usedSize;
+        }
+
+        void sampleFragmentation() {
+            for (const auto& [allocatorIndex, allocator] : m_Allocators) {
+                if (!allocator.ReplayTarget.hasFragmentationRatio()) {
+                    continue;
+                }
+
+                const float fragmentationRatio = allocator.ReplayTarget.getFragmentationRatio();
+                m_Result.HasFragmentationRatio = true;
+                m_Result.FragmentationRatioSum += fragmentationRatio;
+                ++m_Result.FragmentationSampleCount;
+                m_Result.MaxFragmentationRatio = std::max(m_Result.MaxFragmentationRatio, fragmentationRatio);
+            }
+        }
+    };
+} // namespace
+
+// ----------------------------------------- //
+// Main
+// ----------------------------------------- //
+
+/// Read all events from the given trace file
+/// @param filePath Trace file path
+/// @param events Output events
+/// @return True if the trace was read successfully
+static bool readTrace(const char* filePath, std::vector<AxrAllocationTraceEvent>& events) {
+    std::FILE* file = std::fopen(filePath, "rb");
+    if (file == nullptr) {
+        std::fprintf(stderr, "Failed to open trace file: %s.\n", filePath);
+        return false;
+    }
+
+    AxrAllocationTraceHeader header{};
+    if (std::fread(&header, sizeof(header), 1, file) != 1 || header.Magic != AxrAllocationTraceHeader::MagicNumber ||
+        header.Version != AxrAllocationTraceHeader::CurrentVersion) {
+        std::fprintf(stderr, "%s isn't an allocation trace or is from a different engine version.\n", filePath);
+        std::fclose(file);
+        return false;
+    }
+
+    AxrAllocationTraceEvent event{};
+    while (std::fread(&event, sizeof(event), 1, file) == 1) {
+        events.push_back(event);
+    }
+
+    std::fclose(file);
+    return true;
+}
+
+/// Replay the trace through the given allocator implementation and print the results
+/// @param events Trace events
+template<typename Target>
+static void replayAndReport(const std::vector<AxrAllocationTraceEvent>& events) {
+    TraceReplayer<Target> replayer(events);
+    const ReplayResult result = replayer.replay();
+
+    std::printf("%-8s %12.3f %10llu %8llu %16llu %16llu",
+                Target::Name,
+                static_cast<double>(result.Nanoseconds) / 1'000'000.0,
+                static_cast<unsigned long long>(result.EventCount),
+                static_cast<unsigned long long>(result.FailedEventCount),
+                static_cast<unsigned long long>(result.PeakRequestedSize),
+                static_cast<unsigned long long>(result.PeakUsedSize));
+
+    if (result.HasFragmentationRatio && result.FragmentationSampleCount != 0) {
+        std::printf(" %10.3f %10.3f\n",
+                    result.FragmentationRatioSum / static_cast<double>(result.FragmentationSampleCount),
+                    result.MaxFragmentationRatio);
+    } else {
+        std::printf(" %10s %10s\n", "-", "-");
+    }
+}
+
+int main(const int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "Usage: %s <trace file> [dynamic|tlsf|malloc|all]\n", argv[0]);
+        return 1;
+    }
+
+    const char* target = argc > 2 ? argv[2] : "all";
+    const bool replayAll = std::strcmp(target, "all") == 0;
+    if (!replayAll && std::strcmp(target, "dynamic") != 0 && std::strcmp(target, "tlsf") != 0 &&
+        std::strcmp(target, "malloc") != 0) {
+        std::fprintf(stderr, "Unknown replay target: %s.\n", target);
+        return 1;
+    }
+
+    std::vector<AxrAllocationTraceEvent> events;
+    if (!readTrace(argv[1], events)) {
+        return 1;
+    }
+
+    uint32_t allocatorCounts[AXR_ALLOCATION_TRACE_ALLOCATOR_END]{};
+    for (const AxrAllocationTraceEvent& event : events) {
+        if (event.Type == AXR_ALLOCATION_TRACE_EVENT_CREATE &&
+            event.AllocationID < AXR_ALLOCATION_TRACE_ALLOCATOR_END) {
+            ++allocatorCounts[event.AllocationID];
+        }
+    }
+
+    std::printf("Replaying %zu events over %u frames.",
+                events.size(),
+                events.empty() ? 0 : events.back().FrameIndex - events.front().FrameIndex + 1);
+    for (uint32_t i = 0; i < AXR_ALLOCATION_TRACE_ALLOCATOR_END; ++i) {
+        std::printf(" %s allocators: %u.",
+                    axrAllocationTraceAllocatorToString(static_cast<AxrAllocationTraceAllocatorEnum>(i)),
+                    allocatorCounts[i]);
+    }
+    std::printf("\n%-8s %12s %10s %8s %16s %16s %10s %10s\n",
+                "Target",
+                "Time (ms)",
+                "Events",
+                "Failed",
+                "Peak Requested",
+                "Peak Used",
+                "Avg Frag",
+                "Max Frag");
+
+    if (replayAll || std::strcmp(target, "dynamic") == 0) {
+        replayAndReport<ReplayTarget_Dynamic>(events);
+    }
+    if (replayAll || std::strcmp(target, "tlsf") == 0) {
+        replayAndReport<ReplayTarget_Tlsf>(events);
+    }
+    if (replayAll || std::strcmp(target, "malloc") == 0) {
+        replayAndReport<ReplayTarget_Malloc>(events);
+    }
+
+    return 0;
+}
@@ -109,6 +109,14 @@ public:
         m_Function = nullptr;
     }
 
+    /// Visit the instance and function pointers, so they can be updated in place
+    /// @param visitor Function to call with the address of each pointer, as a `void*`
+    template<typename Visitor_T>
+    void forEachPointerSlot(Visitor_T& visitor) {
+        visitor(static_cast<void*>(&m_Instance));
+        visitor(static_cast<void*>(&m_Function));
+    }
+
 private:
     // ----------------------------------------- //
     // Private Variables
@@ -40,6 +40,9 @@ struct AxrEngineConfig {
     AxrApplicationConfig ApplicationConfig;
     AxrWindowConfig WindowConfig;
     AxrRendererConfig RendererConfig;
+    /// File to save the persistent allocator memory to after asset registration, so the next startup can restore it
+    /// and skip that work. nullptr disables allocator snapshots. Delete the file to force a cold start
+    const char* AllocatorSnapshotFilePath;
 };
 
 // ----------------------------------------- //
@@ -52,4 +55,8 @@ extern "C" {
     AXR_API AxrResult axrSetup(const AxrEngineConfig* config);
     /// Shut down the AmethystXR engine
     AXR_API void axrShutdown();
+    /// Shut down the AmethystXR engine as fast as possible, for when the process is about to exit or restart.
+    /// External resources such as the window and renderer are still released properly, but engine memory is freed all
+    /// at once instead of being destroyed object by object
+    AXR_API void axrShutdownFast();
 }
@@ -2,7 +2,9 @@
 // Headers
 // ----------------------------------------- //
 #include "application.h"
+#include "../memory/allocationTracker.h"
 #include "../memory/allocator.h"
+#include "../memory/heapAllocationChecker.h"
 #include "../platform/platform.h"
 #include "../renderer/renderer.h"
 #include "axr/logging.h"
@@ -59,10 +61,19 @@ bool AxrApplication::isRunning() const {
 
 #define AXR_FUNCTION_FAILED_STRING "Failed to start new frame. "
 AxrResult AxrApplication::startNewFrame() const {
-    // Clear the frame allocator at the start of each frame
-    AxrAllocator::get().FrameAllocator.clear();
-
-    AxrResult axrResult = processEvents();
+    // Everything in the frame loop should go through AxrAllocator. Reports any system heap allocations when enabled
+    const AxrHeapAllocationFrameScope heapAllocationFrameScope;
+
+    // Clear the frame allocators at the start of each frame
+    AxrAllocator::get().clearFrameAllocators();
+    // Spread defragmentation out over frames so allocations don't have to stall to do it
+    AxrAllocator::get().defragmentPersistentAllocators();
+
+    AxrResult axrResult;
+    {
+        const AxrAllocationSubsystemScope allocationSubsystemScope(AXR_ALLOCATION_SUBSYSTEM_PLATFORM);
+        axrResult = processEvents();
+    }
     if (axrResult == AXR_EVENT_APPLICATION_CLOSED) [[unlikely]] {
         return axrResult;
     }
@@ -71,7 +82,10 @@ AxrResult AxrApplication::startNewFrame() const {
         return axrResult;
     }
 
-    axrResult = AxrRenderer::get().renderScene();
+    {
+        const AxrAllocationSubsystemScope allocationSubsystemScope(AXR_ALLOCATION_SUBSYSTEM_RENDERER);
+        axrResult = AxrRenderer::get().renderScene();
+    }
     if (AXR_FAILED(axrResult)) [[unlikely]] {
         axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to render scene.");
         return axrResult;
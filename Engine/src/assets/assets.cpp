@@ -42,6 +42,18 @@ AxrAssets& AxrAssets::get() {
 AxrResult AxrAssets::setup(const Config& config) {
     assert(!m_IsSetup);
 
+    // The registries already hold the engine assets if they were restored from an allocator snapshot. The asset files
+    // could have changed since the snapshot was saved, so they're still checked
+    if (AxrAllocator::get().registerSnapshotRoot(AXR_SNAPSHOT_ROOT_SHADER_REGISTRY, m_ShaderRegistry)) {
+        if (areEngineAssetsValid()) {
+            m_IsSetup = true;
+            return AXR_SUCCESS;
+        }
+
+        axrLogWarning("Restored engine assets are out of date. Registering them again.");
+        cleanupRegistries();
+    }
+
     AxrResult axrResult = setupRegistries();
     if (AXR_FAILED(axrResult)) [[unlikely]] {
         axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to initialize registries.");
@@ -64,6 +76,13 @@ void AxrAssets::shutDown() {
     m_IsSetup = false;
 }
 
+void AxrAssets::shutDownFast() {
+    // The registries only hold engine data memory, which gets freed all at once
+    m_SceneRegistry.release();
+    m_ShaderRegistry.release();
+    m_IsSetup = false;
+}
+
 const AxrUnorderedMap_Dynamic<AxrID, AxrSceneAsset>& AxrAssets::getSceneAssetRegistry() const {
     return m_SceneRegistry;
 }
@@ -160,6 +179,18 @@ AxrResult AxrAssets::registerEngineAssets() {
 }
 #undef AXR_FUNCTION_FAILED_STRING
 
+bool AxrAssets::areEngineAssetsValid() const {
+    // Start at 1 since 0 is an undefined asset
+    for (int engineAsset = 1; engineAsset <= AXR_ENGINE_ASSET_SHADERS_END; ++engineAsset) {
+        const AxrShaderAssetConfig config = getEngineAssetShaderConfig(static_cast<AxrEngineAssetEnum>(engineAsset));
+        if (!m_ShaderRegistry.exists(config.ID) || AXR_FAILED(isShaderAssetConfigValid(config))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 AxrResult AxrAssets::isSceneAssetConfigValid(const AxrSceneAssetConfig& config) {
     const bool pathExists = AxrPlatform::pathExists(config.FilePath);
     if (!pathExists) [[unlikely]] {
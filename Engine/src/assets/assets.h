@@ -72,6 +72,9 @@ public:
     [[nodiscard]] AxrResult setup(const Config& config);
     /// Shut down the assets
     void shutDown();
+    /// Shut down the assets without destroying each registered asset.
+    /// Only use this right before `AxrAllocator::shutDownFast()`.
+    void shutDownFast();
 
     /// Get the scene asset registry
     /// @return The scene asset registry
@@ -110,6 +113,10 @@ private:
     /// Register all engine assets
     /// @return AXR_SUCCESS if the function succeeded
     [[nodiscard]] AxrResult registerEngineAssets();
+    /// Check that every engine asset is registered and its config is still valid.
+    /// Used when the registries are restored from an allocator snapshot instead of registering the assets
+    /// @return True if every engine asset is registered and valid
+    [[nodiscard]] bool areEngineAssetsValid() const;
 
     // ---- Scene Asset ----
 
@@ -42,7 +42,13 @@ public:
     // ----------------------------------------- //
     // Public Functions
     // ----------------------------------------- //
-    
+
+    /// Shader assets don't hold any pointers yet. Only here so the shader registry can be passed to
+    /// `axrForEachPointerSlot()`
+    template<typename Visitor_T>
+    void forEachPointerSlot([[maybe_unused]] Visitor_T& visitor) {
+    }
+
 private:
     // ----------------------------------------- //
     // Private Functions
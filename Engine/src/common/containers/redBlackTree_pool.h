@@ -480,6 +480,14 @@ public:
         m_Size = 0;
     }
 
+    /// Forget all nodes without deallocating them.
+    /// Only use this when the pool allocator the nodes live in is about to be freed as a whole.
+    void release() {
+        m_PoolAllocator = nullptr;
+        m_RootNode = nullptr;
+        m_Size = 0;
+    }
+
     /// Get the beginning iterator
     /// @return The beginning iterator
     [[nodiscard]] Node::Iterator begin() const {
@@ -3,8 +3,11 @@
 // ----------------------------------------- //
 // Headers
 // ----------------------------------------- //
-#include "../../memory/dynamicAllocator.h"
+#include "../../memory/persistentAllocator.h"
 #include "../../utils.h"
+#include "axr/logging.h"
+
+#include <type_traits>
 
 // Resources used/referenced:
 // https://www.sebastiansylvan.com/post/robin-hood-hashing-should-be-your-default-hash-table-implementation
@@ -242,7 +245,7 @@ public:
     /// Constructor
     /// @param capacity The max number of items this map can hold. This value MUST be a power of two.
     /// @param allocator Dynamic allocator to use
-    explicit AxrUnorderedMap_Dynamic(const size_t capacity, AxrDynamicAllocator* allocator) :
+    explicit AxrUnorderedMap_Dynamic(const size_t capacity, AxrPersistentAllocator_T* allocator) :
         m_DynamicAllocator(allocator),
         m_Capacity(capacity),
         m_IndexWraparoundMask(capacity - 1) {
@@ -433,6 +436,36 @@ public:
         m_Size = 0;
     }
 
+    /// Forget all items without destroying them or deallocating their memory.
+    /// Only use this when the allocator the map lives in is about to free all of its memory at once.
+    void release() {
+        m_DataHandle.release();
+
+        m_DynamicAllocator = nullptr;
+        m_Capacity = {};
+        m_Size = {};
+    }
+
+    /// Visit the allocator pointer, the data handle and every item's pointers, so they can be updated in place
+    /// @param visitor Function to call with the address of each pointer, as a `void*`
+    template<typename Visitor_T>
+    void forEachPointerSlot(Visitor_T& visitor) {
+        visitor(static_cast<void*>(&m_DynamicAllocator));
+        // Visit the handle first so the items are reached through the updated pointer
+        m_DataHandle.forEachPointerSlot(visitor);
+        if (empty()) {
+            return;
+        }
+
+        for (size_t i = 0; i < m_Capacity; ++i) {
+            if (m_DataHandle[i].Hash == Item::UninitializedHashValue) {
+                continue;
+            }
+            axrForEachPointerSlot(m_DataHandle[i].Key, visitor);
+            axrForEachPointerSlot(m_DataHandle[i].Value, visitor);
+        }
+    }
+
     static constexpr size_t getItemSize() {
         return sizeof(Item);
     }
@@ -445,7 +478,7 @@ private:
     // ----------------------------------------- //
     // Private Variables
     // ----------------------------------------- //
-    AxrDynamicAllocator* m_DynamicAllocator{};
+    AxrPersistentAllocator_T* m_DynamicAllocator{};
     AxrHandle<Item> m_DataHandle{};
     size_t m_Capacity{};
     size_t m_Size{};
@@ -453,7 +486,10 @@ private:
 
     /// Clean up this class
     void cleanup() {
-        clear();
+        // The data is about to be deallocated, so there's no need to walk every slot if there's nothing to destroy
+        if constexpr (!std::is_trivially_destructible_v<Key_T> || !std::is_trivially_destructible_v<Value_T>) {
+            clear();
+        }
         deallocateData();
 
         m_DynamicAllocator = nullptr;
@@ -556,7 +592,8 @@ private:
             return AXR_SUCCESS;
         }
 
-        const AxrResult axrResult = m_DynamicAllocator->allocate(m_Capacity, m_DataHandle);
+        // Empty slots are found by their zero hash, so the memory must be zeroed out
+        const AxrResult axrResult = m_DynamicAllocator->allocate(m_Capacity, m_DataHandle, true);
         if (AXR_FAILED(axrResult)) [[unlikely]] {
             axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to allocate memory.");
             return axrResult;
@@ -3,7 +3,7 @@
 // ----------------------------------------- //
 // Headers
 // ----------------------------------------- //
-#include "../../memory/dynamicAllocator.h"
+#include "../../memory/persistentAllocator.h"
 #include "vectorBase.h"
 
 /// A vector that uses a dynamic allocator
@@ -30,7 +30,7 @@ public:
     /// Constructor
     /// @param capacity The max number of objects that this vector can hold
     /// @param dynamicAllocator The dynamic allocator to use
-    AxrVector_Dynamic(const size_t capacity, AxrDynamicAllocator* dynamicAllocator) :
+    AxrVector_Dynamic(const size_t capacity, AxrPersistentAllocator_T* dynamicAllocator) :
         AxrVectorBase<Type>(capacity) {
         m_DynamicAllocator = dynamicAllocator;
 
@@ -45,7 +45,7 @@ public:
     /// Constructor
     /// @param list The list of items to set for this vector
     /// @param dynamicAllocator The dynamic allocator to use
-    AxrVector_Dynamic(const std::initializer_list<Type>& list, AxrDynamicAllocator* dynamicAllocator) :
+    AxrVector_Dynamic(const std::initializer_list<Type>& list, AxrPersistentAllocator_T* dynamicAllocator) :
         AxrVectorBase<Type>(list) {
         m_DynamicAllocator = dynamicAllocator;
 
@@ -143,13 +143,15 @@ public:
         return AxrVectorBase<Type>::end(m_DataHandle.getDataPtr());
     }
 
-    /// Get the vector data
+    /// Get the vector data.
+    /// Defragmentation can relocate the data, so only hold on to it while the allocator's relocation is locked.
     /// @return The vector data
     Type* data() {
         return m_DataHandle.getDataPtr();
     }
 
-    /// Get the vector data
+    /// Get the vector data.
+    /// Defragmentation can relocate the data, so only hold on to it while the allocator's relocation is locked.
     /// @return The vector data
     const Type* data() const {
         return m_DataHandle.getDataPtr();
@@ -248,11 +250,32 @@ public:
         AxrVectorBase<Type>::clear();
     }
 
+    /// Forget all items without destroying them or deallocating their memory.
+    /// Only use this when the allocator the vector lives in is about to free all of its memory at once.
+    void release() {
+        m_DataHandle.release();
+        m_DynamicAllocator = nullptr;
+
+        AxrVectorBase<Type>::cleanup();
+    }
+
+    /// Visit the allocator pointer, the data handle and every item's pointers, so they can be updated in place
+    /// @param visitor Function to call with the address of each pointer, as a `void*`
+    template<typename Visitor_T>
+    void forEachPointerSlot(Visitor_T& visitor) {
+        visitor(static_cast<void*>(&m_DynamicAllocator));
+        // Visit the handle first so the items are reached through the updated pointer
+        m_DataHandle.forEachPointerSlot(visitor);
+        for (size_t i = 0; i < AxrVectorBase<Type>::m_Size; ++i) {
+            axrForEachPointerSlot(m_DataHandle[i], visitor);
+        }
+    }
+
 protected:
     // ----------------------------------------- //
     // Protected Variables
     // ----------------------------------------- //
-    AxrDynamicAllocator* m_DynamicAllocator{};
+    AxrPersistentAllocator_T* m_DynamicAllocator{};
     AxrHandle<Type> m_DataHandle{};
 
     // ----------------------------------------- //
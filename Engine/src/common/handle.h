@@ -5,10 +5,13 @@
 // ----------------------------------------- //
 #include "axr/common/callback.h"
 
+#include <cstdint>
+
 // ----------------------------------------- //
 // Forward Declarations
 // ----------------------------------------- //
 class AxrDynamicAllocator;
+class AxrTlsfAllocator;
 
 /// A pointer handle.
 /// Used in memory allocators where the original pointer may be relocated due to factors like defragmentation.
@@ -20,6 +23,7 @@ public:
     // Friends
     // ----------------------------------------- //
     friend AxrDynamicAllocator;
+    friend AxrTlsfAllocator;
 
     // ----------------------------------------- //
     // Types
@@ -38,9 +42,11 @@ public:
     /// Constructor
     /// @param data The data handle
     /// @param deallocator The function callback to deallocate the given data
-    explicit AxrHandle(Type* const* data, const Deallocator_T& deallocator) :
+    /// @param generation The generation of the handle slot the data handle belongs to. Used to detect stale handles
+    explicit AxrHandle(Type* const* data, const Deallocator_T& deallocator, const uint32_t generation = 0) :
         m_Data(data),
-        m_Deallocator(deallocator) {
+        m_Deallocator(deallocator),
+        m_Generation(generation) {
     }
 
     /// Copy Constructor
@@ -159,12 +165,28 @@ public:
         return *m_Data;
     }
 
+    /// Forget the data without deallocating it.
+    /// Only use this when the allocator the data lives in is about to free all of its memory at once.
+    void release() {
+        m_Data = nullptr;
+    }
+
+    /// Visit the handle table slot pointer and the deallocator's pointers, so they can be updated in place.
+    /// The data isn't visited since the handle doesn't know how many items it holds.
+    /// @param visitor Function to call with the address of each pointer, as a `void*`
+    template<typename Visitor_T>
+    void forEachPointerSlot(Visitor_T& visitor) {
+        visitor(static_cast<void*>(&m_Data));
+        m_Deallocator.forEachPointerSlot(visitor);
+    }
+
 private:
     // ----------------------------------------- //
     // Private Variables
     // ----------------------------------------- //
     Type* const* m_Data{};
     Deallocator_T m_Deallocator{};
+    uint32_t m_Generation{};
 
     // ----------------------------------------- //
     // Private Functions
@@ -192,6 +214,7 @@ private:
         }
 
         m_Data = src.m_Data;
+        m_Generation = src.m_Generation;
 
         src.m_Data = nullptr;
     }
@@ -206,6 +229,7 @@ public:
     // Friends
     // ----------------------------------------- //
     friend AxrDynamicAllocator;
+    friend AxrTlsfAllocator;
 
     // ----------------------------------------- //
     // Types
@@ -224,9 +248,11 @@ public:
     /// Constructor
     /// @param data The data handle
     /// @param deallocator The function callback to deallocate the given data
-    explicit AxrHandle(void* const* data, const Deallocator_T& deallocator) :
+    /// @param generation The generation of the handle slot the data handle belongs to. Used to detect stale handles
+    explicit AxrHandle(void* const* data, const Deallocator_T& deallocator, const uint32_t generation = 0) :
         m_Data(data),
-        m_Deallocator(deallocator) {
+        m_Deallocator(deallocator),
+        m_Generation(generation) {
     }
 
     /// Copy Constructor
@@ -305,12 +331,28 @@ public:
         return *m_Data;
     }
 
+    /// Forget the data without deallocating it.
+    /// Only use this when the allocator the data lives in is about to free all of its memory at once.
+    void release() {
+        m_Data = nullptr;
+    }
+
+    /// Visit the handle table slot pointer and the deallocator's pointers, so they can be updated in place.
+    /// The data isn't visited since the handle doesn't know how many items it holds.
+    /// @param visitor Function to call with the address of each pointer, as a `void*`
+    template<typename Visitor_T>
+    void forEachPointerSlot(Visitor_T& visitor) {
+        visitor(static_cast<void*>(&m_Data));
+        m_Deallocator.forEachPointerSlot(visitor);
+    }
+
 private:
     // ----------------------------------------- //
     // Private Variables
     // ----------------------------------------- //
     void* const* m_Data{};
     Deallocator_T m_Deallocator{};
+    uint32_t m_Generation{};
 
     // ----------------------------------------- //
     // Private Functions
@@ -338,6 +380,7 @@ private:
         }
 
         m_Data = src.m_Data;
+        m_Generation = src.m_Generation;
 
         src.m_Data = nullptr;
     }
@@ -65,6 +65,11 @@ public:
     /// @return The name of the given ID. Or an empty string if no name for the ID was found.
     [[nodiscard]] static const char8_t* getIDName(AxrID_T id);
 
+    /// IDs don't hold any pointers. Only here so containers of IDs can be passed to `axrForEachPointerSlot()`
+    template<typename Visitor_T>
+    void forEachPointerSlot([[maybe_unused]] Visitor_T& visitor) {
+    }
+
 private:
     // ----------------------------------------- //
     // Private Variables
@@ -12,7 +12,7 @@ AxrPath::AxrPath() :
     AxrString() {
 }
 
-AxrPath::AxrPath(AxrDynamicAllocator* dynamicAllocator) :
+AxrPath::AxrPath(AxrPersistentAllocator_T* dynamicAllocator) :
     AxrString(dynamicAllocator) {
 }
 
@@ -24,13 +24,13 @@ public:
     AxrPath();
     /// Constructor
     /// @param dynamicAllocator Dynamic allocator to use
-    explicit AxrPath(AxrDynamicAllocator* dynamicAllocator);
+    explicit AxrPath(AxrPersistentAllocator_T* dynamicAllocator);
 
     /// Constructor
     /// @param path Path to initialize with
     /// @param dynamicAllocator Dynamic allocator to use
     template<AxrIsCharStringLike Char_T>
-    AxrPath(Char_T path, AxrDynamicAllocator* dynamicAllocator) :
+    AxrPath(Char_T path, AxrPersistentAllocator_T* dynamicAllocator) :
         AxrString(dynamicAllocator) {
         AxrString::buildFromCharString(path);
         correctPathSeparators(AxrString::begin(), AxrString::end());
@@ -40,7 +40,7 @@ public:
     /// @param path Path to initialize with
     /// @param dynamicAllocator Dynamic allocator to use
     template<AxrIsChar8StringLike Char_T>
-    AxrPath(Char_T path, AxrDynamicAllocator* dynamicAllocator) :
+    AxrPath(Char_T path, AxrPersistentAllocator_T* dynamicAllocator) :
         AxrString(path, dynamicAllocator) {
         correctPathSeparators(AxrString::begin(), AxrString::end());
     }
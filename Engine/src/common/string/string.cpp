@@ -13,7 +13,7 @@ AxrString::AxrString() :
     m_StackString() {
 }
 
-AxrString::AxrString(AxrDynamicAllocator* dynamicAllocator) :
+AxrString::AxrString(AxrPersistentAllocator_T* dynamicAllocator) :
     m_DynamicAllocator(dynamicAllocator),
     m_StackString() {
 }
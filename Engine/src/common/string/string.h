@@ -3,7 +3,7 @@
 // ----------------------------------------- //
 // Headers
 // ----------------------------------------- //
-#include "../../memory/dynamicAllocator.h"
+#include "../../memory/persistentAllocator.h"
 #include "../../utils.h"
 #include "stringIterator.h"
 #include "stringView.h"
@@ -54,12 +54,12 @@ public:
     AxrString();
     /// Constructor
     /// @param dynamicAllocator Dynamic allocator to use
-    explicit AxrString(AxrDynamicAllocator* dynamicAllocator);
+    explicit AxrString(AxrPersistentAllocator_T* dynamicAllocator);
     /// Constructor
     /// @param string String to initialize with
     /// @param dynamicAllocator Dynamic allocator to use
     template<AxrIsChar8StringLike Char_T>
-    AxrString(Char_T string, AxrDynamicAllocator* dynamicAllocator) :
+    AxrString(Char_T string, AxrPersistentAllocator_T* dynamicAllocator) :
         m_DynamicAllocator(dynamicAllocator),
         m_StackString() {
         buildString(string);
@@ -298,6 +298,17 @@ public:
     /// Clear this string
     void clear();
 
+    /// Visit the allocator pointer and any heap data handle, so they can be updated in place
+    /// @param visitor Function to call with the address of each pointer, as a `void*`
+    template<typename Visitor_T>
+    void forEachPointerSlot(Visitor_T& visitor) {
+        visitor(static_cast<void*>(&m_DynamicAllocator));
+        // The stack string's characters aren't pointers, even if their bytes happen to look like one
+        if (m_IsHeapAllocated) {
+            m_HeapString.Data.forEachPointerSlot(visitor);
+        }
+    }
+
 protected:
     // ----------------------------------------- //
     // Protected Structs
@@ -327,7 +338,7 @@ protected:
     // ----------------------------------------- //
     // Protected Variables
     // ----------------------------------------- //
-    AxrDynamicAllocator* m_DynamicAllocator{};
+    AxrPersistentAllocator_T* m_DynamicAllocator{};
     bool m_IsHeapAllocated{};
     union {
         HeapStorage m_HeapString;
@@ -36,7 +36,11 @@ AxrDebugInfo& AxrDebugInfo::get() {
 AxrResult AxrDebugInfo::setup(const Config& config) {
     assert(!m_IsSetup);
 
-    IDNames = AxrUnorderedMap_Dynamic<AxrID, AxrString>(config.MaxIDCount, &AxrAllocator::get().DebugInfoAllocator);
+    // ID names are restored as they were if the allocator was set up from a snapshot
+    if (!AxrAllocator::get().registerSnapshotRoot(AXR_SNAPSHOT_ROOT_DEBUG_ID_NAMES, IDNames)) {
+        IDNames = AxrUnorderedMap_Dynamic<AxrID, AxrString>(config.MaxIDCount,
+                                                            &AxrAllocator::get().DebugInfoAllocator);
+    }
 
     m_IsSetup = true;
     return AXR_SUCCESS;
@@ -48,4 +52,10 @@ void AxrDebugInfo::shutDown() {
     m_IsSetup = false;
 }
 
+void AxrDebugInfo::shutDownFast() {
+    // The ID names only hold debug info memory, which gets freed all at once
+    IDNames.release();
+    m_IsSetup = false;
+}
+
 #endif
@@ -79,6 +79,9 @@ public:
     [[nodiscard]] AxrResult setup(const Config& config);
     /// Shut down the debug info
     void shutDown();
+    /// Shut down the debug info without destroying each ID name.
+    /// Only use this right before `AxrAllocator::shutDownFast()`.
+    void shutDownFast();
 
 private:
     // ----------------------------------------- //
@@ -6,11 +6,67 @@
 #include "assets/assets.h"
 #include "axr/logging.h"
 #include "debugInfo/debugInfo.h"
+#include "memory/allocationTracker.h"
 #include "memory/allocator.h"
+#include "memory/allocatorProfile.h"
 #include "platform/platform.h"
 #include "renderer/renderer.h"
 #include "server/server.h"
 
+#include <iterator>
+
+// ----------------------------------------- //
+// Constants
+// ----------------------------------------- //
+
+/// Peak allocator usage recorded at shut down, used to size the allocator budgets on the next startup
+constexpr const char* AxrAllocatorProfileFilePath = "axrAllocatorProfile.toml";
+/// Optional allocator config overrides. Applied after the allocator profile
+constexpr const char* AxrAllocatorConfigFilePath = "axrAllocator.toml";
+/// Extra space to give each allocator on top of its recorded peak usage
+constexpr uint32_t AxrAllocatorProfileHeadroomPercent = 25;
+
+// ----------------------------------------- //
+// Static Helper Functions
+// ----------------------------------------- //
+
+/// Save the allocator's peak usage so the next startup can size its allocators to fit
+static void saveAllocatorProfile() {
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    if (AxrAllocator::get().isSetup()) {
+        const AxrResult axrResult =
+            axrSaveAllocatorProfile(AxrAllocatorProfileFilePath, AxrAllocator::get().getUsageProfile());
+        if (AXR_FAILED(axrResult)) [[unlikely]] {
+            axrLogWarning("Failed to save the allocator profile. The next startup won't use this session's peaks.");
+        }
+    }
+#endif
+}
+
+/// Set up the allocator from a snapshot file.
+/// The snapshot's budgets are used as long as they have room for the given config's budgets.
+/// @param filePath Snapshot file path
+/// @param config Allocator config to use
+/// @return AXR_SUCCESS if the function succeeded.
+/// AXR_ERROR_NOT_FOUND if the file doesn't exist.
+/// AXR_ERROR_VALIDATION_FAILED if the snapshot can't be used with the given config or this engine build.
+/// AXR_ERROR_NOT_SUPPORTED if the persistent allocator doesn't support snapshots.
+static AxrResult restoreAllocatorSnapshot(const char* filePath, const AxrAllocator::Config& config) {
+    AxrAllocator::Config snapshotConfig;
+    const AxrResult axrResult = AxrAllocator::get().readSnapshotConfig(filePath, snapshotConfig);
+    if (AXR_FAILED(axrResult)) {
+        return axrResult;
+    }
+
+    AxrAllocator::Config restoreConfig = config;
+    if (!axrUseSnapshotAllocatorBudgets(snapshotConfig, restoreConfig)) {
+        axrLogInfo("The allocator snapshot is too small for the current allocator budgets.");
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    return AxrAllocator::get().restoreSnapshot(filePath, restoreConfig);
+}
+
 // ----------------------------------------- //
 // External Function Definitions
 // ----------------------------------------- //
@@ -22,18 +78,75 @@ AxrResult axrSetup(const AxrEngineConfig* config) {
 
     AxrResult axrResult = AXR_SUCCESS;
 
-    constexpr AxrAllocator::Config allocatorConfig{
+    constexpr AxrAllocator::ArenaConfig allocatorArenas[] = {
+        AxrAllocator::ArenaConfig{
+            /// Swapchain resources. These get recreated whenever the window is resized
+            .Name = u8"Renderer",
+            .Type = AXR_ARENA_TYPE_PERSISTENT,
+            /// 256 Kibibytes
+            .Size = 262'144,
+            .MaxHandleCount = 256,
+        },
+        AxrAllocator::ArenaConfig{
+            /// Data that lives exactly as long as the loaded scene, along with its load time temporaries
+            .Name = u8"Scene",
+            .Type = AXR_ARENA_TYPE_SCENE,
+            /// 1 Mebibyte
+            .Size = 1'048'576,
+            .MaxHandleCount = 0,
+        },
+    };
+
+    AxrAllocator::Config allocatorConfig{
         /// 128 Kibibytes
         .FrameAllocatorSize = 131'072,
+        .WorkerThreadCount = 4,
+        /// 32 Kibibytes
+        .WorkerFrameAllocatorSize = 32'768,
+        /// Matches the vulkan renderer's max frames in flight
+        .FramesInFlight = 2,
+        /// 64 Kibibytes
+        .FrameInFlightAllocatorSize = 65'536,
         .MaxHandleCount = 10'000,
         /// 1 Mebibyte
         .EngineDataAllocatorMainMemorySize = 1'048'576,
         .MaxDebugHandleCount = 100,
         /// 2 Mebibytes
         .DebugInfoAllocatorMainMemorySize = 2'097'152,
+        /// 0.1 Milliseconds. About 1% of a 90 Hz frame
+        .DefragmentMicrosecondsPerFrame = 100,
+        /// 64 Kibibytes
+        .DefragmentBytesPerFrame = 65'536,
+        .EngineDataAllocatorHighWaterMark = 0.9f,
+        .DebugInfoAllocatorHighWaterMark = 0.9f,
+        .UseHugePages = true,
+        .PrefaultFrameAllocators = true,
+        .Arenas = allocatorArenas,
+        .ArenaCount = static_cast<uint32_t>(std::size(allocatorArenas)),
     };
 
-    axrResult = AxrAllocator::get().setup(allocatorConfig);
+    AxrAllocator::UsageProfile allocatorProfile;
+    if (AXR_SUCCEEDED(axrLoadAllocatorProfile(AxrAllocatorProfileFilePath, allocatorProfile))) {
+        axrApplyAllocatorProfile(allocatorProfile, AxrAllocatorProfileHeadroomPercent, allocatorConfig);
+    }
+
+    axrResult = axrLoadAllocatorConfigOverrides(AxrAllocatorConfigFilePath, allocatorConfig);
+    if (AXR_FAILED(axrResult) && axrResult != AXR_ERROR_NOT_FOUND) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "axrLoadAllocatorConfigOverrides() failed.");
+        return axrResult;
+    }
+
+    // Warm start from the snapshot if there is one. Otherwise start cold
+    axrResult = AXR_ERROR_NOT_FOUND;
+    if (config->AllocatorSnapshotFilePath != nullptr) {
+        axrResult = restoreAllocatorSnapshot(config->AllocatorSnapshotFilePath, allocatorConfig);
+        if (AXR_FAILED(axrResult) && axrResult != AXR_ERROR_NOT_FOUND) {
+            axrLogWarning("Failed to restore the allocator snapshot. Starting cold.");
+        }
+    }
+    if (AXR_FAILED(axrResult)) {
+        axrResult = AxrAllocator::get().setup(allocatorConfig);
+    }
     if (AXR_FAILED(axrResult)) [[unlikely]] {
         axrShutdown();
         axrLogError(AXR_FUNCTION_FAILED_STRING "AxrAllocator.setup() failed.");
@@ -45,7 +158,10 @@ AxrResult axrSetup(const AxrEngineConfig* config) {
         .MaxIDCount = 16'384,
     };
 
-    axrResult = AxrDebugInfo::get().setup(debugInfoConfig);
+    {
+        const AxrAllocationSubsystemScope allocationSubsystemScope(AXR_ALLOCATION_SUBSYSTEM_DEBUG_INFO);
+        axrResult = AxrDebugInfo::get().setup(debugInfoConfig);
+    }
     if (AXR_FAILED(axrResult)) [[unlikely]] {
         axrShutdown();
         axrLogError(AXR_FUNCTION_FAILED_STRING "AxrDebugInfo.setup() failed.");
@@ -55,7 +171,10 @@ AxrResult axrSetup(const AxrEngineConfig* config) {
     AxrAllocator::get().logAllAllocatorUsage("Debug Info Setup");
 #endif
 
-    axrResult = AxrServer::get().setup(AxrServer::Config{});
+    {
+        const AxrAllocationSubsystemScope allocationSubsystemScope(AXR_ALLOCATION_SUBSYSTEM_SERVER);
+        axrResult = AxrServer::get().setup(AxrServer::Config{});
+    }
     if (AXR_FAILED(axrResult)) [[unlikely]] {
         axrShutdown();
         axrLogError(AXR_FUNCTION_FAILED_STRING "AxrServer.setup() failed.");
@@ -69,7 +188,10 @@ AxrResult axrSetup(const AxrEngineConfig* config) {
         .RendererApiType = config->RendererConfig.ApiType,
     };
 
-    axrResult = AxrPlatform::get().setup(platformConfig);
+    {
+        const AxrAllocationSubsystemScope allocationSubsystemScope(AXR_ALLOCATION_SUBSYSTEM_PLATFORM);
+        axrResult = AxrPlatform::get().setup(platformConfig);
+    }
     if (AXR_FAILED(axrResult)) [[unlikely]] {
         axrShutdown();
         axrLogError(AXR_FUNCTION_FAILED_STRING "AxrPlatform.setup() failed.");
@@ -78,7 +200,10 @@ AxrResult axrSetup(const AxrEngineConfig* config) {
 
     AxrAllocator::get().logAllAllocatorUsage("Platform Setup");
 
-    axrResult = AxrAssets::get().setup(AxrAssets::Config{});
+    {
+        const AxrAllocationSubsystemScope allocationSubsystemScope(AXR_ALLOCATION_SUBSYSTEM_ASSETS);
+        axrResult = AxrAssets::get().setup(AxrAssets::Config{});
+    }
     if (AXR_FAILED(axrResult)) [[unlikely]] {
         axrShutdown();
         axrLogError(AXR_FUNCTION_FAILED_STRING "AxrAssets.setup() failed.");
@@ -87,6 +212,16 @@ AxrResult axrSetup(const AxrEngineConfig* config) {
 
     AxrAllocator::get().logAllAllocatorUsage("Assets Setup");
 
+    // Everything up to here is the same on every startup, so save it for the next one
+#ifndef AXR_TLSF_ALLOCATOR_ENABLED
+    if (config->AllocatorSnapshotFilePath != nullptr && !AxrAllocator::get().isRestoredFromSnapshot()) {
+        axrResult = AxrAllocator::get().saveSnapshot(config->AllocatorSnapshotFilePath);
+        if (AXR_FAILED(axrResult)) [[unlikely]] {
+            axrLogWarning("Failed to save the allocator snapshot. The next startup will be a cold start.");
+        }
+    }
+#endif
+
     AxrRenderer::Config rendererConfig{
         .RendererConfig = &config->RendererConfig,
         .ApplicationVersion = config->ApplicationConfig.ApplicationVersion,
@@ -97,7 +232,10 @@ AxrResult axrSetup(const AxrEngineConfig* config) {
                  config->ApplicationConfig.ApplicationName,
                  AXR_MAX_APPLICATION_NAME_SIZE);
 
-    axrResult = AxrRenderer::get().setup(rendererConfig);
+    {
+        const AxrAllocationSubsystemScope allocationSubsystemScope(AXR_ALLOCATION_SUBSYSTEM_RENDERER);
+        axrResult = AxrRenderer::get().setup(rendererConfig);
+    }
     if (AXR_FAILED(axrResult)) [[unlikely]] {
         axrShutdown();
         axrLogError(AXR_FUNCTION_FAILED_STRING "AxrRenderer.setup() failed.");
@@ -106,7 +244,10 @@ AxrResult axrSetup(const AxrEngineConfig* config) {
 
     AxrAllocator::get().logAllAllocatorUsage("Renderer Setup");
 
-    axrResult = AxrApplication::get().setup(AxrApplication::Config{});
+    {
+        const AxrAllocationSubsystemScope allocationSubsystemScope(AXR_ALLOCATION_SUBSYSTEM_APPLICATION);
+        axrResult = AxrApplication::get().setup(AxrApplication::Config{});
+    }
     if (AXR_FAILED(axrResult)) [[unlikely]] {
         axrShutdown();
         axrLogError(AXR_FUNCTION_FAILED_STRING "AxrApplication.setup() failed.");
@@ -128,5 +269,24 @@ void axrShutdown() {
 #ifdef AXR_DEBUG_INFO_ENABLED
     AxrDebugInfo::get().shutDown();
 #endif
+
+    saveAllocatorProfile();
     AxrAllocator::get().shutDown();
 }
+
+void axrShutdownFast() {
+    // These own resources outside of the engine's memory, so they still need to be shut down properly
+    AxrApplication::get().shutDown();
+    AxrRenderer::get().shutDown();
+    AxrPlatform::get().shutDown();
+    AxrServer::get().shutDown();
+
+    // Everything else only holds engine memory, which gets freed all at once
+    AxrAssets::get().shutDownFast();
+#ifdef AXR_DEBUG_INFO_ENABLED
+    AxrDebugInfo::get().shutDownFast();
+#endif
+
+    saveAllocatorProfile();
+    AxrAllocator::get().shutDownFast();
+}
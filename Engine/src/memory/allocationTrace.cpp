@@ -0,0 +1,196 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "allocationTrace.h"
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+#include "axr/logging.h"
+
+#include <cassert>
+#endif
+
+// ----------------------------------------- //
+// Internal Function Definitions
+// ----------------------------------------- //
+
+const char* axrAllocationTraceAllocatorToString(const AxrAllocationTraceAllocatorEnum allocatorType) {
+    switch (allocatorType) {
+        case AXR_ALLOCATION_TRACE_ALLOCATOR_STACK: {
+            return "Stack";
+        }
+        case AXR_ALLOCATION_TRACE_ALLOCATOR_POOL: {
+            return "Pool";
+        }
+        case AXR_ALLOCATION_TRACE_ALLOCATOR_DYNAMIC: {
+            return "Dynamic";
+        }
+        case AXR_ALLOCATION_TRACE_ALLOCATOR_END:
+        default: {
+            return "Undefined";
+        }
+    }
+}
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+
+// ----------------------------------------- //
+// Special Functions
+// ----------------------------------------- //
+
+AxrAllocationTraceRecorder::AxrAllocationTraceRecorder() = default;
+
+AxrAllocationTraceRecorder::~AxrAllocationTraceRecorder() {
+    stop();
+}
+
+// ----------------------------------------- //
+// Public Functions
+// ----------------------------------------- //
+
+AxrAllocationTraceRecorder& AxrAllocationTraceRecorder::get() {
+    static AxrAllocationTraceRecorder singleton;
+    return singleton;
+}
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to start recording allocation trace. "
+AxrResult AxrAllocationTraceRecorder::start(const char* filePath) {
+    assert(filePath != nullptr);
+
+    const std::lock_guard lock(m_Mutex);
+
+    if (m_File != nullptr) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "A trace is already being recorded.");
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    m_File = std::fopen(filePath, "wb");
+    if (m_File == nullptr) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to open file: {}.", filePath);
+        return AXR_ERROR_UNKNOWN;
+    }
+
+    constexpr AxrAllocationTraceHeader header{
+        .Magic = AxrAllocationTraceHeader::MagicNumber,
+        .Version = AxrAllocationTraceHeader::CurrentVersion,
+    };
+    m_HasWriteFailed = std::fwrite(&header, sizeof(header), 1, m_File) != 1;
+
+    m_BufferedEventCount = 0;
+    m_EventCount = 0;
+    m_FrameIndex = 0;
+    m_FirstAllocatorIndex = m_AllocatorCount;
+
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to stop recording allocation trace. "
+AxrResult AxrAllocationTraceRecorder::stop() {
+    const std::lock_guard lock(m_Mutex);
+
+    if (m_File == nullptr) {
+        return AXR_SUCCESS;
+    }
+
+    flush();
+    const bool succeeded = !m_HasWriteFailed && std::ferror(m_File) == 0;
+    std::fclose(m_File);
+    m_File = nullptr;
+
+    if (!succeeded) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to write to the trace file.");
+        return AXR_ERROR_UNKNOWN;
+    }
+
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+bool AxrAllocationTraceRecorder::isRecording() const {
+    const std::lock_guard lock(m_Mutex);
+    return m_File != nullptr;
+}
+
+uint16_t AxrAllocationTraceRecorder::registerAllocator(const AxrAllocationTraceAllocatorEnum allocatorType,
+                                                       const size_t capacity) {
+    const std::lock_guard lock(m_Mutex);
+
+    if (m_File == nullptr || m_AllocatorCount == InvalidAllocatorIndex) [[unlikely]] {
+        return InvalidAllocatorIndex;
+    }
+
+    const uint16_t allocatorIndex = m_AllocatorCount++;
+    pushEvent(AxrAllocationTraceEvent{
+        .AllocationID = static_cast<uint64_t>(allocatorType),
+        .PreviousAllocationID = 0,
+        .Size = capacity,
+        .FrameIndex = m_FrameIndex,
+        .AllocatorIndex = allocatorIndex,
+        .Type = AXR_ALLOCATION_TRACE_EVENT_CREATE,
+        .Alignment = 0,
+    });
+
+    return allocatorIndex;
+}
+
+void AxrAllocationTraceRecorder::recordEvent(const uint16_t allocatorIndex,
+                                             const AxrAllocationTraceEventEnum type,
+                                             const uint64_t allocationID,
+                                             const uint64_t previousAllocationID,
+                                             const uint64_t size,
+                                             const uint8_t alignment) {
+    const std::lock_guard lock(m_Mutex);
+
+    // The allocator may still be registered to a trace that has since stopped
+    if (m_File == nullptr || allocatorIndex < m_FirstAllocatorIndex || allocatorIndex >= m_AllocatorCount)
+        [[unlikely]] {
+        return;
+    }
+
+    pushEvent(AxrAllocationTraceEvent{
+        .AllocationID = allocationID,
+        .PreviousAllocationID = previousAllocationID,
+        .Size = size,
+        .FrameIndex = m_FrameIndex,
+        .AllocatorIndex = allocatorIndex,
+        .Type = static_cast<uint8_t>(type),
+        .Alignment = alignment,
+    });
+}
+
+void AxrAllocationTraceRecorder::nextFrame() {
+    const std::lock_guard lock(m_Mutex);
+    ++m_FrameIndex;
+}
+
+uint64_t AxrAllocationTraceRecorder::getEventCount() const {
+    const std::lock_guard lock(m_Mutex);
+    return m_EventCount;
+}
+
+// ----------------------------------------- //
+// Private Functions
+// ----------------------------------------- //
+
+void AxrAllocationTraceRecorder::flush() {
+    if (m_BufferedEventCount == 0) {
+        return;
+    }
+
+    if (std::fwrite(m_Events, sizeof(AxrAllocationTraceEvent), m_BufferedEventCount, m_File) != m_BufferedEventCount)
+        [[unlikely]] {
+        m_HasWriteFailed = true;
+    }
+    m_BufferedEventCount = 0;
+}
+
+void AxrAllocationTraceRecorder::pushEvent(const AxrAllocationTraceEvent& event) {
+    if (m_BufferedEventCount == EventBufferSize) [[unlikely]] {
+        flush();
+    }
+
+    m_Events[m_BufferedEventCount++] = event;
+    ++m_EventCount;
+}
+
+#endif
@@ -0,0 +1,209 @@
+#pragma once
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "axr/common/enums.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+#include <cstdio>
+#include <mutex>
+#endif
+
+// ----------------------------------------- //
+// Enums
+// ----------------------------------------- //
+
+/// The kind of allocator an allocation trace was recorded from
+enum AxrAllocationTraceAllocatorEnum {
+    AXR_ALLOCATION_TRACE_ALLOCATOR_STACK = 0,
+    AXR_ALLOCATION_TRACE_ALLOCATOR_POOL,
+    AXR_ALLOCATION_TRACE_ALLOCATOR_DYNAMIC,
+    AXR_ALLOCATION_TRACE_ALLOCATOR_END,
+};
+
+/// Allocation trace event types
+enum AxrAllocationTraceEventEnum {
+    /// An allocator started recording. `AllocationID` holds the `AxrAllocationTraceAllocatorEnum` and `Size` holds
+    /// the allocator's capacity in bytes
+    AXR_ALLOCATION_TRACE_EVENT_CREATE = 0,
+    AXR_ALLOCATION_TRACE_EVENT_ALLOCATE,
+    /// `PreviousAllocationID` holds the ID the allocation had before it was reallocated
+    AXR_ALLOCATION_TRACE_EVENT_REALLOCATE,
+    /// For stack allocators, this deallocates the given marker and everything allocated after it
+    AXR_ALLOCATION_TRACE_EVENT_DEALLOCATE,
+    /// Deallocate everything in the allocator
+    AXR_ALLOCATION_TRACE_EVENT_CLEAR,
+    /// `Size` holds the number of blocks that were moved
+    AXR_ALLOCATION_TRACE_EVENT_DEFRAGMENT,
+    AXR_ALLOCATION_TRACE_EVENT_END,
+};
+
+/// Get the given allocation trace allocator type as a string
+/// @param allocatorType Allocator type to use
+/// @return The allocator type name
+[[nodiscard]] const char* axrAllocationTraceAllocatorToString(AxrAllocationTraceAllocatorEnum allocatorType);
+
+// ----------------------------------------- //
+// Structs
+// ----------------------------------------- //
+
+/// The header at the start of every allocation trace file. Followed by nothing but `AxrAllocationTraceEvent`s
+struct AxrAllocationTraceHeader {
+    /// Should always be `AxrAllocationTraceHeader::MagicNumber`
+    uint32_t Magic;
+    /// Should always be `AxrAllocationTraceHeader::CurrentVersion`
+    uint32_t Version;
+
+    static constexpr uint32_t MagicNumber = 0x54'52'58'41; // "AXRT"
+    static constexpr uint32_t CurrentVersion = 1;
+};
+
+/// A single allocation trace event
+struct AxrAllocationTraceEvent {
+    /// Identifies the allocation until it's deallocated. Chunk address for pool allocators, handle address for dynamic
+    /// allocators and the marker ID for stack allocators
+    uint64_t AllocationID;
+    uint64_t PreviousAllocationID;
+    /// Size in bytes
+    uint64_t Size;
+    uint32_t FrameIndex;
+    /// Index of the allocator that recorded this event. Matches the allocator's create event
+    uint16_t AllocatorIndex;
+    /// `AxrAllocationTraceEventEnum`
+    uint8_t Type;
+    uint8_t Alignment;
+};
+
+static_assert(sizeof(AxrAllocationTraceEvent) == 32);
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+
+// ----------------------------------------- //
+// Allocation Trace Recorder
+// ----------------------------------------- //
+
+/// Records allocator events to a binary trace file so allocation patterns can be replayed offline against other
+/// allocator implementations.
+/// Allocators only report to this after calling their `startTraceRecording()` function while a trace is being recorded.
+class AxrAllocationTraceRecorder {
+public:
+    // ----------------------------------------- //
+    // Public Constants
+    // ----------------------------------------- //
+
+    /// Allocator index for allocators that aren't recording
+    static constexpr uint16_t InvalidAllocatorIndex = UINT16_MAX;
+    /// Number of events to buffer before writing them to the file
+    static constexpr uint32_t EventBufferSize = 4'096;
+
+private:
+    // ----------------------------------------- //
+    // Special Functions
+    // ----------------------------------------- //
+
+    // ---- Constructors ----
+
+    /// Constructor
+    AxrAllocationTraceRecorder();
+    /// Copy Constructor
+    /// @param src Source AxrAllocationTraceRecorder to copy from
+    AxrAllocationTraceRecorder(const AxrAllocationTraceRecorder& src) = delete;
+    /// Move Constructor
+    /// @param src Source AxrAllocationTraceRecorder to move from
+    AxrAllocationTraceRecorder(AxrAllocationTraceRecorder&& src) noexcept = delete;
+
+    // ---- Destructor ----
+
+    /// Destructor
+    ~AxrAllocationTraceRecorder();
+
+    // ---- Operator Overloads ----
+
+    /// Copy Assignment Operator
+    /// @param src Source AxrAllocationTraceRecorder to copy from
+    AxrAllocationTraceRecorder& operator=(const AxrAllocationTraceRecorder& src) = delete;
+    /// Move Assignment Operator
+    /// @param src Source AxrAllocationTraceRecorder to move from
+    AxrAllocationTraceRecorder& operator=(AxrAllocationTraceRecorder&& src) noexcept = delete;
+
+public:
+    // ----------------------------------------- //
+    // Public Functions
+    // ----------------------------------------- //
+
+    /// Get the AxrAllocationTraceRecorder singleton
+    /// @return A reference to the AxrAllocationTraceRecorder singleton
+    static AxrAllocationTraceRecorder& get();
+
+    /// Start recording a new trace to the given file
+    /// @param filePath File path to write to
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_VALIDATION_FAILED if a trace is already being recorded.
+    /// AXR_ERROR_UNKNOWN if the file couldn't be opened.
+    [[nodiscard]] AxrResult start(const char* filePath);
+    /// Write any buffered events and close the trace file.
+    /// Allocators that were recording are ignored from then on, so they need to start recording again for the next
+    /// trace.
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_UNKNOWN if the trace couldn't be written.
+    AxrResult stop();
+    /// Check if a trace is currently being recorded
+    /// @return True if a trace is currently being recorded
+    [[nodiscard]] bool isRecording() const;
+
+    /// Register an allocator with the current trace
+    /// @param allocatorType Type of allocator
+    /// @param capacity Allocator capacity in bytes
+    /// @return The allocator index to record events with. `InvalidAllocatorIndex` if no trace is being recorded
+    [[nodiscard]] uint16_t registerAllocator(AxrAllocationTraceAllocatorEnum allocatorType, size_t capacity);
+    /// Record an event
+    /// @param allocatorIndex Allocator index from `registerAllocator()`
+    /// @param type Event type
+    /// @param allocationID Allocation ID
+    /// @param previousAllocationID Allocation ID before a reallocation
+    /// @param size Size in bytes
+    /// @param alignment Alignment in bytes
+    void recordEvent(uint16_t allocatorIndex,
+                     AxrAllocationTraceEventEnum type,
+                     uint64_t allocationID,
+                     uint64_t previousAllocationID,
+                     uint64_t size,
+                     uint8_t alignment);
+    /// Move on to the next frame. All events recorded after this get the new frame index
+    void nextFrame();
+
+    /// Get the number of events recorded in the current trace
+    /// @return The number of events recorded in the current trace
+    [[nodiscard]] uint64_t getEventCount() const;
+
+private:
+    // ----------------------------------------- //
+    // Private Variables
+    // ----------------------------------------- //
+    mutable std::mutex m_Mutex;
+    std::FILE* m_File{};
+    AxrAllocationTraceEvent m_Events[EventBufferSize]{};
+    uint32_t m_BufferedEventCount{};
+    uint64_t m_EventCount{};
+    uint32_t m_FrameIndex{};
+    /// Allocator indices are never reused, so allocators registered with a previous trace can be told apart
+    uint16_t m_FirstAllocatorIndex{};
+    uint16_t m_AllocatorCount{};
+    bool m_HasWriteFailed{};
+
+    // ----------------------------------------- //
+    // Private Functions
+    // ----------------------------------------- //
+
+    /// Write all buffered events to the file
+    void flush();
+    /// Add an event to the buffer, writing the buffer to the file if it's full
+    /// @param event Event to add
+    void pushEvent(const AxrAllocationTraceEvent& event);
+};
+
+#endif
@@ -0,0 +1,456 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "allocationTracker.h"
+
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+#include "axr/logging.h"
+
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#endif
+
+// ----------------------------------------- //
+// Thread Local Variables
+// ----------------------------------------- //
+
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+/// The subsystem used for untagged allocations on this thread
+static thread_local AxrAllocationSubsystemEnum CurrentSubsystem = AXR_ALLOCATION_SUBSYSTEM_UNKNOWN;
+#endif
+
+// ----------------------------------------- //
+// Internal Function Definitions
+// ----------------------------------------- //
+
+const char* axrAllocationSubsystemToString(const AxrAllocationSubsystemEnum subsystem) {
+    switch (subsystem) {
+        case AXR_ALLOCATION_SUBSYSTEM_UNKNOWN: {
+            return "Unknown";
+        }
+        case AXR_ALLOCATION_SUBSYSTEM_APPLICATION: {
+            return "Application";
+        }
+        case AXR_ALLOCATION_SUBSYSTEM_ASSETS: {
+            return "Assets";
+        }
+        case AXR_ALLOCATION_SUBSYSTEM_DEBUG_INFO: {
+            return "Debug Info";
+        }
+        case AXR_ALLOCATION_SUBSYSTEM_PLATFORM: {
+            return "Platform";
+        }
+        case AXR_ALLOCATION_SUBSYSTEM_RENDERER: {
+            return "Renderer";
+        }
+        case AXR_ALLOCATION_SUBSYSTEM_SERVER: {
+            return "Server";
+        }
+        case AXR_ALLOCATION_SUBSYSTEM_END:
+        default: {
+            return "Undefined";
+        }
+    }
+}
+
+// ----------------------------------------- //
+// AxrAllocationSubsystemScope
+// ----------------------------------------- //
+
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+AxrAllocationSubsystemScope::AxrAllocationSubsystemScope(const AxrAllocationSubsystemEnum subsystem) :
+    m_PreviousSubsystem(CurrentSubsystem) {
+    CurrentSubsystem = subsystem;
+}
+
+AxrAllocationSubsystemScope::~AxrAllocationSubsystemScope() {
+    CurrentSubsystem = m_PreviousSubsystem;
+}
+#else
+AxrAllocationSubsystemScope::AxrAllocationSubsystemScope(const AxrAllocationSubsystemEnum subsystem) {
+}
+
+AxrAllocationSubsystemScope::~AxrAllocationSubsystemScope() = default;
+#endif
+
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+
+// ----------------------------------------- //
+// Static Helper Functions
+// ----------------------------------------- //
+
+/// Hash the given bytes with FNV-1a
+/// @param hash Hash to continue from
+/// @param data Data to hash
+/// @param size Size of the data in bytes
+/// @return The new hash
+static uint64_t hashBytes(uint64_t hash, const void* data, const size_t size) {
+    const auto bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1'099'511'628'211ULL;
+    }
+    return hash;
+}
+
+/// Hash the given pointer
+/// @param pointer Pointer to hash
+/// @return The hash
+static uint64_t hashPointer(const void* pointer) {
+    // Fibonacci hashing. Allocations are at least 8 byte aligned so the low bits carry no information
+    return (reinterpret_cast<uintptr_t>(pointer) >> 3) * 11'400'714'819'323'198'485ULL;
+}
+
+/// Write the given string to the given file as a JSON string
+/// @param file File to write to
+/// @param string String to write
+static void writeJsonString(std::FILE* file, const char* string) {
+    std::fputc('"', file);
+    for (const char* character = string; *character != '\0'; ++character) {
+        if (*character == '"' || *character == '\\') {
+            std::fputc('\\', file);
+        }
+        std::fputc(*character, file);
+    }
+    std::fputc('"', file);
+}
+
+/// Write the given stats to the given file as JSON fields
+/// @param file File to write to
+/// @param stats Stats to write
+static void writeJsonStats(std::FILE* file, const AxrAllocationTracker::Stats& stats) {
+    std::fprintf(file,
+                 "\"allocationCount\": %llu, \"deallocationCount\": %llu, \"totalBytes\": %llu, \"liveBytes\": %zu, "
+                 "\"peakLiveBytes\": %zu, \"lifetimeHistogram\": [",
+                 static_cast<unsigned long long>(stats.AllocationCount),
+                 static_cast<unsigned long long>(stats.DeallocationCount),
+                 static_cast<unsigned long long>(stats.TotalBytes),
+                 stats.LiveBytes,
+                 stats.PeakLiveBytes);
+    for (uint32_t i = 0; i < AxrAllocationTracker::LifetimeBucketCount; ++i) {
+        std::fprintf(file, i == 0 ? "%llu" : ", %llu", static_cast<unsigned long long>(stats.LifetimeHistogram[i]));
+    }
+    std::fputc(']', file);
+}
+
+// ----------------------------------------- //
+// Special Functions
+// ----------------------------------------- //
+
+AxrAllocationTracker::AxrAllocationTracker() = default;
+
+AxrAllocationTracker::~AxrAllocationTracker() = default;
+
+// ----------------------------------------- //
+// Public Functions
+// ----------------------------------------- //
+
+AxrAllocationTracker& AxrAllocationTracker::get() {
+    static AxrAllocationTracker singleton;
+    return singleton;
+}
+
+void AxrAllocationTracker::recordAllocation(const void* key,
+                                            const size_t size,
+                                            const AxrAllocationTag& tag,
+                                            bool isTransient) {
+    const std::lock_guard lock(m_Mutex);
+
+    const uint32_t callSiteIndex = findCallSite(tag);
+    CallSite& callSite = m_CallSites[callSiteIndex];
+
+    if (!isTransient && m_LiveAllocationCount >= MaxLiveAllocationCount) [[unlikely]] {
+        isTransient = true;
+    }
+
+    addAllocation(m_SubsystemStats[callSite.Subsystem], size, isTransient);
+    addAllocation(callSite.CallSiteStats, size, isTransient);
+
+    if (isTransient) {
+        return;
+    }
+
+    // The previous allocation at this address was released in bulk, e.g. by clearing a pool, so retire it now
+    if (const uint32_t staleSlotIndex = findLiveAllocation(key); staleSlotIndex != UINT32_MAX) [[unlikely]] {
+        retireLiveAllocation(staleSlotIndex);
+    }
+
+    uint32_t slotIndex = hashPointer(key) % std::size(m_LiveAllocations);
+    while (m_LiveAllocations[slotIndex].Key != nullptr) {
+        slotIndex = (slotIndex + 1) % std::size(m_LiveAllocations);
+    }
+
+    m_LiveAllocations[slotIndex] = LiveAllocation{
+        .Key = key,
+        .Size = size,
+        .CallSiteIndex = callSiteIndex,
+        .StartTime = getTime(),
+    };
+    ++m_LiveAllocationCount;
+}
+
+void AxrAllocationTracker::recordResize(const void* key, const size_t size) {
+    const std::lock_guard lock(m_Mutex);
+
+    const uint32_t slotIndex = findLiveAllocation(key);
+    if (slotIndex == UINT32_MAX) [[unlikely]] {
+        return;
+    }
+
+    LiveAllocation& liveAllocation = m_LiveAllocations[slotIndex];
+    CallSite& callSite = m_CallSites[liveAllocation.CallSiteIndex];
+
+    for (Stats* stats : {&m_SubsystemStats[callSite.Subsystem], &callSite.CallSiteStats}) {
+        stats->LiveBytes = stats->LiveBytes - liveAllocation.Size + size;
+        if (size > liveAllocation.Size) {
+            stats->TotalBytes += size - liveAllocation.Size;
+        }
+        if (stats->LiveBytes > stats->PeakLiveBytes) {
+            stats->PeakLiveBytes = stats->LiveBytes;
+        }
+    }
+
+    liveAllocation.Size = size;
+}
+
+void AxrAllocationTracker::recordDeallocation(const void* key) {
+    const std::lock_guard lock(m_Mutex);
+
+    const uint32_t slotIndex = findLiveAllocation(key);
+    if (slotIndex == UINT32_MAX) {
+        // Either not tracked individually or allocated before tracking was reset
+        return;
+    }
+
+    retireLiveAllocation(slotIndex);
+}
+
+AxrAllocationTracker::Stats AxrAllocationTracker::getSubsystemStats(const AxrAllocationSubsystemEnum subsystem) const {
+    assert(subsystem < AXR_ALLOCATION_SUBSYSTEM_END);
+
+    const std::lock_guard lock(m_Mutex);
+    return m_SubsystemStats[subsystem];
+}
+
+uint32_t AxrAllocationTracker::getCallSiteCount() const {
+    const std::lock_guard lock(m_Mutex);
+    return m_CallSiteCount;
+}
+
+void AxrAllocationTracker::logUsage(const char* message) const {
+    const std::lock_guard lock(m_Mutex);
+
+    for (uint32_t i = 0; i < AXR_ALLOCATION_SUBSYSTEM_END; ++i) {
+        const Stats& stats = m_SubsystemStats[i];
+        if (stats.AllocationCount == 0) {
+            continue;
+        }
+
+        axrLogDebug("{}: {} allocations. {} Allocations made. {} Bytes allocated in total. {} Bytes live. Peak live "
+                    "bytes reached {}.",
+                    message,
+                    axrAllocationSubsystemToString(static_cast<AxrAllocationSubsystemEnum>(i)),
+                    stats.AllocationCount,
+                    stats.TotalBytes,
+                    stats.LiveBytes,
+                    stats.PeakLiveBytes);
+    }
+}
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to export allocation stats. "
+AxrResult AxrAllocationTracker::exportJson(const char* filePath) const {
+    assert(filePath != nullptr);
+
+    std::FILE* file = std::fopen(filePath, "w");
+    if (file == nullptr) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to open file: {}.", filePath);
+        return AXR_ERROR_UNKNOWN;
+    }
+
+    const std::lock_guard lock(m_Mutex);
+
+    std::fputs("{\n  \"lifetimeBucketLimitsMicroseconds\": [", file);
+    for (uint32_t i = 0; i < LifetimeBucketCount - 1; ++i) {
+        std::fprintf(file, i == 0 ? "%llu" : ", %llu", static_cast<unsigned long long>(LifetimeBucketLimits[i]));
+    }
+
+    std::fputs("],\n  \"subsystems\": [", file);
+    for (uint32_t i = 0; i < AXR_ALLOCATION_SUBSYSTEM_END; ++i) {
+        std::fputs(i == 0 ? "\n    {\"name\": " : ",\n    {\"name\": ", file);
+        writeJsonString(file, axrAllocationSubsystemToString(static_cast<AxrAllocationSubsystemEnum>(i)));
+        std::fputs(", ", file);
+        writeJsonStats(file, m_SubsystemStats[i]);
+        std::fputc('}', file);
+    }
+
+    std::fputs("\n  ],\n  \"callSites\": [", file);
+    for (uint32_t i = 0; i < m_CallSiteCount; ++i) {
+        const CallSite& callSite = m_CallSites[i];
+
+        std::fputs(i == 0 ? "\n    {\"subsystem\": " : ",\n    {\"subsystem\": ", file);
+        writeJsonString(file, axrAllocationSubsystemToString(callSite.Subsystem));
+        std::fputs(", \"file\": ", file);
+        writeJsonString(file, callSite.FileName);
+        std::fprintf(file, ", \"line\": %u, \"function\": ", callSite.Line);
+        writeJsonString(file, callSite.FunctionName);
+        std::fputs(", ", file);
+        writeJsonStats(file, callSite.CallSiteStats);
+        std::fputc('}', file);
+    }
+    std::fputs("\n  ]\n}\n", file);
+
+    const bool succeeded = std::ferror(file) == 0;
+    std::fclose(file);
+
+    if (!succeeded) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to write to file: {}.", filePath);
+        return AXR_ERROR_UNKNOWN;
+    }
+
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+void AxrAllocationTracker::reset() {
+    const std::lock_guard lock(m_Mutex);
+
+    std::memset(m_SubsystemStats, 0, sizeof(m_SubsystemStats));
+    std::memset(m_CallSites, 0, sizeof(m_CallSites));
+    std::memset(m_CallSiteTable, 0, sizeof(m_CallSiteTable));
+    std::memset(m_LiveAllocations, 0, sizeof(m_LiveAllocations));
+    m_CallSiteCount = 0;
+    m_LiveAllocationCount = 0;
+}
+
+// ----------------------------------------- //
+// Private Functions
+// ----------------------------------------- //
+
+uint32_t AxrAllocationTracker::findCallSite(const AxrAllocationTag& tag) {
+    const AxrAllocationSubsystemEnum subsystem = tag.Subsystem == AXR_ALLOCATION_SUBSYSTEM_UNKNOWN ? CurrentSubsystem
+                                                                                                   : tag.Subsystem;
+    const char* fileName = tag.Location.file_name();
+    const uint32_t line = tag.Location.line();
+
+    // Hash the file name contents rather than the pointer. Call sites in headers get a different copy of the file name
+    // for each translation unit.
+    uint64_t hash = hashBytes(14'695'981'039'346'656'037ULL, fileName, std::strlen(fileName));
+    hash = hashBytes(hash, &line, sizeof(line));
+    hash = hashBytes(hash, &subsystem, sizeof(subsystem));
+
+    uint32_t slotIndex = hash % std::size(m_CallSiteTable);
+    while (m_CallSiteTable[slotIndex] != 0) {
+        const uint32_t callSiteIndex = m_CallSiteTable[slotIndex] - 1;
+        const CallSite& callSite = m_CallSites[callSiteIndex];
+        if (callSite.Hash == hash && callSite.Line == line && callSite.Subsystem == subsystem &&
+            std::strcmp(callSite.FileName, fileName) == 0) {
+            return callSiteIndex;
+        }
+
+        slotIndex = (slotIndex + 1) % std::size(m_CallSiteTable);
+    }
+
+    if (m_CallSiteCount == MaxCallSiteCount) [[unlikely]] {
+        return MaxCallSiteCount - 1;
+    }
+
+    const uint32_t callSiteIndex = m_CallSiteCount++;
+    m_CallSites[callSiteIndex] = CallSite{
+        .FileName = fileName,
+        .FunctionName = tag.Location.function_name(),
+        .Line = line,
+        .Subsystem = subsystem,
+        .Hash = hash,
+        .CallSiteStats = {},
+    };
+    m_CallSiteTable[slotIndex] = callSiteIndex + 1;
+
+    return callSiteIndex;
+}
+
+uint32_t AxrAllocationTracker::findLiveAllocation(const void* key) const {
+    uint32_t slotIndex = hashPointer(key) % std::size(m_LiveAllocations);
+    while (m_LiveAllocations[slotIndex].Key != nullptr) {
+        if (m_LiveAllocations[slotIndex].Key == key) {
+            return slotIndex;
+        }
+
+        slotIndex = (slotIndex + 1) % std::size(m_LiveAllocations);
+    }
+
+    return UINT32_MAX;
+}
+
+void AxrAllocationTracker::retireLiveAllocation(const uint32_t slotIndex) {
+    const LiveAllocation& liveAllocation = m_LiveAllocations[slotIndex];
+    CallSite& callSite = m_CallSites[liveAllocation.CallSiteIndex];
+    const uint32_t lifetimeBucket = getLifetimeBucket(getTime() - liveAllocation.StartTime);
+
+    addDeallocation(m_SubsystemStats[callSite.Subsystem], liveAllocation.Size, lifetimeBucket);
+    addDeallocation(callSite.CallSiteStats, liveAllocation.Size, lifetimeBucket);
+
+    removeLiveAllocation(slotIndex);
+}
+
+void AxrAllocationTracker::removeLiveAllocation(uint32_t slotIndex) {
+    constexpr uint32_t slotCount = MaxLiveAllocationCount * 2;
+
+    // Backward shift deletion. Move any following entries that would have wanted this slot back into it, so lookups
+    // never hit a gap partway through their probe sequence.
+    uint32_t nextSlotIndex = (slotIndex + 1) % slotCount;
+    while (m_LiveAllocations[nextSlotIndex].Key != nullptr) {
+        const uint32_t idealSlotIndex = hashPointer(m_LiveAllocations[nextSlotIndex].Key) % slotCount;
+        const uint32_t distanceFromIdeal = (nextSlotIndex + slotCount - idealSlotIndex) % slotCount;
+        const uint32_t distanceToGap = (nextSlotIndex + slotCount - slotIndex) % slotCount;
+
+        if (distanceFromIdeal >= distanceToGap) {
+            m_LiveAllocations[slotIndex] = m_LiveAllocations[nextSlotIndex];
+            slotIndex = nextSlotIndex;
+        }
+
+        nextSlotIndex = (nextSlotIndex + 1) % slotCount;
+    }
+
+    m_LiveAllocations[slotIndex] = {};
+    --m_LiveAllocationCount;
+}
+
+void AxrAllocationTracker::addAllocation(Stats& stats, const size_t size, const bool isTransient) {
+    ++stats.AllocationCount;
+    stats.TotalBytes += size;
+
+    if (isTransient) {
+        return;
+    }
+
+    stats.LiveBytes += size;
+    if (stats.LiveBytes > stats.PeakLiveBytes) {
+        stats.PeakLiveBytes = stats.LiveBytes;
+    }
+}
+
+void AxrAllocationTracker::addDeallocation(Stats& stats, const size_t size, const uint32_t lifetimeBucket) {
+    ++stats.DeallocationCount;
+    stats.LiveBytes -= size;
+    ++stats.LifetimeHistogram[lifetimeBucket];
+}
+
+uint32_t AxrAllocationTracker::getLifetimeBucket(const uint64_t lifetime) {
+    for (uint32_t i = 0; i < LifetimeBucketCount - 1; ++i) {
+        if (lifetime < LifetimeBucketLimits[i]) {
+            return i;
+        }
+    }
+    return LifetimeBucketCount - 1;
+}
+
+uint64_t AxrAllocationTracker::getTime() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+#endif
@@ -0,0 +1,317 @@
+#pragma once
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "axr/common/enums.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+#include <mutex>
+#include <source_location>
+#endif
+
+// ----------------------------------------- //
+// Enums
+// ----------------------------------------- //
+
+/// The engine subsystem an allocation belongs to
+enum AxrAllocationSubsystemEnum {
+    AXR_ALLOCATION_SUBSYSTEM_UNKNOWN = 0,
+    AXR_ALLOCATION_SUBSYSTEM_APPLICATION,
+    AXR_ALLOCATION_SUBSYSTEM_ASSETS,
+    AXR_ALLOCATION_SUBSYSTEM_DEBUG_INFO,
+    AXR_ALLOCATION_SUBSYSTEM_PLATFORM,
+    AXR_ALLOCATION_SUBSYSTEM_RENDERER,
+    AXR_ALLOCATION_SUBSYSTEM_SERVER,
+    AXR_ALLOCATION_SUBSYSTEM_END,
+};
+
+/// Get the given subsystem as a string
+/// @param subsystem Subsystem to use
+/// @return The subsystem name
+[[nodiscard]] const char* axrAllocationSubsystemToString(AxrAllocationSubsystemEnum subsystem);
+
+// ----------------------------------------- //
+// Structs
+// ----------------------------------------- //
+
+/// Describes who made an allocation.
+/// When allocation tracking is disabled, this is empty and costs nothing to pass around.
+struct AxrAllocationTag {
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+    /// Constructor
+    /// @param subsystem The subsystem the allocation belongs to. If unknown, the current
+    /// `AxrAllocationSubsystemScope` is used instead
+    /// @param location The call site of the allocation. Defaults to wherever this tag was created
+    AxrAllocationTag(const AxrAllocationSubsystemEnum subsystem = AXR_ALLOCATION_SUBSYSTEM_UNKNOWN,
+                     const std::source_location& location = std::source_location::current()) :
+        Subsystem(subsystem),
+        Location(location) {
+    }
+
+    AxrAllocationSubsystemEnum Subsystem;
+    std::source_location Location;
+#else
+    /// Constructor
+    /// @param subsystem The subsystem the allocation belongs to
+    constexpr AxrAllocationTag(AxrAllocationSubsystemEnum subsystem = AXR_ALLOCATION_SUBSYSTEM_UNKNOWN) {
+    }
+#endif
+};
+
+/// Sets the subsystem for all untagged allocations made on this thread for as long as it's alive
+class AxrAllocationSubsystemScope {
+public:
+    // ----------------------------------------- //
+    // Special Functions
+    // ----------------------------------------- //
+
+    // ---- Constructors ----
+
+    /// Constructor
+    /// @param subsystem The subsystem to use for untagged allocations
+    explicit AxrAllocationSubsystemScope(AxrAllocationSubsystemEnum subsystem);
+    /// Copy Constructor
+    /// @param src Source AxrAllocationSubsystemScope to copy from
+    AxrAllocationSubsystemScope(const AxrAllocationSubsystemScope& src) = delete;
+    /// Move Constructor
+    /// @param src Source AxrAllocationSubsystemScope to move from
+    AxrAllocationSubsystemScope(AxrAllocationSubsystemScope&& src) noexcept = delete;
+
+    // ---- Destructor ----
+
+    /// Destructor
+    ~AxrAllocationSubsystemScope();
+
+    // ---- Operator Overloads ----
+
+    /// Copy Assignment Operator
+    /// @param src Source AxrAllocationSubsystemScope to copy from
+    AxrAllocationSubsystemScope& operator=(const AxrAllocationSubsystemScope& src) = delete;
+    /// Move Assignment Operator
+    /// @param src Source AxrAllocationSubsystemScope to move from
+    AxrAllocationSubsystemScope& operator=(AxrAllocationSubsystemScope&& src) noexcept = delete;
+
+private:
+    // ----------------------------------------- //
+    // Private Variables
+    // ----------------------------------------- //
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+    AxrAllocationSubsystemEnum m_PreviousSubsystem;
+#endif
+};
+
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+
+// ----------------------------------------- //
+// Allocation Tracker
+// ----------------------------------------- //
+
+/// Keeps track of allocation statistics per subsystem and per call site.
+/// Allocators report to this when `AXR_ALLOCATION_TRACKING_ENABLED` is defined.
+///
+/// Stack and ring allocators release memory in bulk by marker, fence or by clearing, so their allocations only count
+/// towards the allocation count and total bytes. All other allocators are tracked individually, including live bytes, peak and
+/// how long each allocation lived for.
+class AxrAllocationTracker {
+public:
+    // ----------------------------------------- //
+    // Public Constants
+    // ----------------------------------------- //
+
+    /// The max number of unique call sites to keep track of. Any more are counted under the last call site
+    static constexpr uint32_t MaxCallSiteCount = 1024;
+    /// The max number of individually tracked allocations alive at once. Any more are treated as transient
+    static constexpr uint32_t MaxLiveAllocationCount = 16'384;
+    /// Number of lifetime histogram buckets
+    static constexpr uint32_t LifetimeBucketCount = 8;
+    /// Upper bound of each lifetime histogram bucket in microseconds. The last bucket has no upper bound
+    static constexpr uint64_t LifetimeBucketLimits[LifetimeBucketCount - 1]{
+        10,
+        100,
+        1'000,
+        10'000,
+        100'000,
+        1'000'000,
+        10'000'000,
+    };
+
+    // ----------------------------------------- //
+    // Public Structs
+    // ----------------------------------------- //
+
+    /// Allocation statistics
+    struct Stats {
+        uint64_t AllocationCount;
+        uint64_t DeallocationCount;
+        /// Total number of bytes ever allocated
+        uint64_t TotalBytes;
+        /// Number of bytes currently allocated
+        size_t LiveBytes;
+        /// The peak number of bytes allocated at one time
+        size_t PeakLiveBytes;
+        /// Number of deallocated allocations within each lifetime bucket
+        uint64_t LifetimeHistogram[LifetimeBucketCount];
+    };
+
+private:
+    // ----------------------------------------- //
+    // Special Functions
+    // ----------------------------------------- //
+
+    // ---- Constructors ----
+
+    /// Constructor
+    AxrAllocationTracker();
+    /// Copy Constructor
+    /// @param src Source AxrAllocationTracker to copy from
+    AxrAllocationTracker(const AxrAllocationTracker& src) = delete;
+    /// Move Constructor
+    /// @param src Source AxrAllocationTracker to move from
+    AxrAllocationTracker(AxrAllocationTracker&& src) noexcept = delete;
+
+    // ---- Destructor ----
+
+    /// Destructor
+    ~AxrAllocationTracker();
+
+    // ---- Operator Overloads ----
+
+    /// Copy Assignment Operator
+    /// @param src Source AxrAllocationTracker to copy from
+    AxrAllocationTracker& operator=(const AxrAllocationTracker& src) = delete;
+    /// Move Assignment Operator
+    /// @param src Source AxrAllocationTracker to move from
+    AxrAllocationTracker& operator=(AxrAllocationTracker&& src) noexcept = delete;
+
+public:
+    // ----------------------------------------- //
+    // Public Functions
+    // ----------------------------------------- //
+
+    /// Get the AxrAllocationTracker singleton
+    /// @return A reference to the AxrAllocationTracker singleton
+    static AxrAllocationTracker& get();
+
+    /// Record a new allocation
+    /// @param key Address that identifies this allocation until it's deallocated
+    /// @param size Size in bytes
+    /// @param tag Allocation tag
+    /// @param isTransient If true, the allocation won't be individually tracked. Used for stack allocators
+    void recordAllocation(const void* key, size_t size, const AxrAllocationTag& tag, bool isTransient = false);
+    /// Record that an allocation was resized in place
+    /// @param key Address that identifies the allocation
+    /// @param size New size in bytes
+    void recordResize(const void* key, size_t size);
+    /// Record a deallocation
+    /// @param key Address that identifies the allocation
+    void recordDeallocation(const void* key);
+
+    /// Get the statistics for the given subsystem
+    /// @param subsystem Subsystem to use
+    /// @return The statistics for the given subsystem
+    [[nodiscard]] Stats getSubsystemStats(AxrAllocationSubsystemEnum subsystem) const;
+    /// Get the key to use for an allocation made through a handle.
+    /// Handles can live inside pool chunks that are tracked themselves, so the lowest bit is set to keep them apart.
+    /// @param handleData The handle's data pointer
+    /// @return The key to use
+    [[nodiscard]] static const void* getHandleKey(const void* handleData) {
+        return reinterpret_cast<const void*>(reinterpret_cast<uintptr_t>(handleData) | 1);
+    }
+
+    /// Get the number of unique call sites recorded
+    /// @return The number of unique call sites recorded
+    [[nodiscard]] uint32_t getCallSiteCount() const;
+
+    /// Log the statistics for each subsystem
+    /// @param message Message to prefix the log with
+    void logUsage(const char* message) const;
+    /// Write all statistics to the given file as JSON
+    /// @param filePath File path to write to
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_UNKNOWN if the file couldn't be written.
+    [[nodiscard]] AxrResult exportJson(const char* filePath) const;
+
+    /// Clear all statistics
+    void reset();
+
+private:
+    // ----------------------------------------- //
+    // Private Structs
+    // ----------------------------------------- //
+
+    /// A unique allocation call site
+    struct CallSite {
+        const char* FileName;
+        const char* FunctionName;
+        uint32_t Line;
+        AxrAllocationSubsystemEnum Subsystem;
+        uint64_t Hash;
+        Stats CallSiteStats;
+    };
+
+    /// An allocation that's currently alive
+    struct LiveAllocation {
+        /// nullptr if this slot is empty
+        const void* Key;
+        size_t Size;
+        uint32_t CallSiteIndex;
+        /// Time of allocation in microseconds
+        uint64_t StartTime;
+    };
+
+    // ----------------------------------------- //
+    // Private Variables
+    // ----------------------------------------- //
+    mutable std::mutex m_Mutex;
+    Stats m_SubsystemStats[AXR_ALLOCATION_SUBSYSTEM_END]{};
+    CallSite m_CallSites[MaxCallSiteCount]{};
+    uint32_t m_CallSiteCount{};
+    /// Open addressing hash table of call site indices + 1. 0 means empty
+    uint32_t m_CallSiteTable[MaxCallSiteCount * 2]{};
+    /// Open addressing hash table keyed by allocation address
+    LiveAllocation m_LiveAllocations[MaxLiveAllocationCount * 2]{};
+    uint32_t m_LiveAllocationCount{};
+
+    // ----------------------------------------- //
+    // Private Functions
+    // ----------------------------------------- //
+
+    /// Find or add the call site for the given tag
+    /// @param tag Allocation tag
+    /// @return The call site index
+    [[nodiscard]] uint32_t findCallSite(const AxrAllocationTag& tag);
+    /// Find the live allocation slot for the given key
+    /// @param key Allocation key
+    /// @return The slot index. Or `UINT32_MAX` if it wasn't found
+    [[nodiscard]] uint32_t findLiveAllocation(const void* key) const;
+    /// Count the live allocation in the given slot as deallocated and remove it
+    /// @param slotIndex Slot index to retire
+    void retireLiveAllocation(uint32_t slotIndex);
+    /// Remove the live allocation in the given slot, shifting back any following entries in the same probe sequence
+    /// @param slotIndex Slot index to remove
+    void removeLiveAllocation(uint32_t slotIndex);
+
+    /// Add an allocation to the given stats
+    /// @param stats Stats to update
+    /// @param size Size in bytes
+    /// @param isTransient If true, don't count towards live bytes
+    static void addAllocation(Stats& stats, size_t size, bool isTransient);
+    /// Add a deallocation to the given stats
+    /// @param stats Stats to update
+    /// @param size Size in bytes
+    /// @param lifetimeBucket Lifetime histogram bucket
+    static void addDeallocation(Stats& stats, size_t size, uint32_t lifetimeBucket);
+    /// Get the lifetime histogram bucket for the given lifetime
+    /// @param lifetime Lifetime in microseconds
+    /// @return The lifetime histogram bucket
+    [[nodiscard]] static uint32_t getLifetimeBucket(uint64_t lifetime);
+    /// Get the current time in microseconds
+    /// @return The current time in microseconds
+    [[nodiscard]] static uint64_t getTime();
+};
+
+#endif
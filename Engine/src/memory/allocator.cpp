@@ -2,10 +2,154 @@
 // Headers
 // ----------------------------------------- //
 #include "allocator.h"
+#include "allocatorSnapshot.h"
 #include "axr/logging.h"
+#include "memoryUtils.h"
+#include "virtualMemory.h"
+
+#include <xxhash.h>
 
 #include <cassert>
+#include <chrono>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <new>
+
+// ----------------------------------------- //
+// Thread Local Variables
+// ----------------------------------------- //
+
+/// The frame allocator that belongs to a worker thread
+struct ThreadFrameAllocatorSlot {
+    AxrStackAllocator* Allocator;
+    /// The `AxrAllocator` setup this slot was assigned in. Slots from an older setup are no longer valid
+    uint32_t SetupGeneration;
+};
+
+static thread_local ThreadFrameAllocatorSlot ThreadFrameAllocator{};
+
+// ----------------------------------------- //
+// Named Arena Helpers
+// ----------------------------------------- //
+
+/// Alignment of each named arena's handle table and allocator memory
+constexpr size_t AxrArenaAlignment = alignof(std::max_align_t);
+
+/// Get the total memory size in bytes that a named arena needs
+/// @param arenaConfig Named arena config to use
+/// @return The total memory size in bytes that the named arena needs
+static size_t getArenaMemorySize(const AxrAllocator::ArenaConfig& arenaConfig) {
+    const size_t allocatorSize = axrAlignAddress(arenaConfig.Size, AxrArenaAlignment);
+    if (arenaConfig.Type != AXR_ARENA_TYPE_PERSISTENT) {
+        return allocatorSize;
+    }
+
+    return axrAlignAddress(AxrHandleTable::getAllocatorSize(arenaConfig.MaxHandleCount), AxrArenaAlignment) +
+           allocatorSize;
+}
+
+#ifndef AXR_TLSF_ALLOCATOR_ENABLED
+// ----------------------------------------- //
+// Snapshot File Format
+// ----------------------------------------- //
+
+/// "AXRS" in little endian
+constexpr uint32_t AxrSnapshotMagic = 0x53525841;
+/// Bump whenever the snapshot file layout changes
+constexpr uint32_t AxrSnapshotVersion = 2;
+
+/// Snapshot file header. Followed by the data of each root with a non zero size, in `AxrSnapshotRootEnum` order. And
+/// then the persistent memory.
+struct AxrSnapshotHeader {
+    uint32_t Magic;
+    uint32_t Version;
+    AxrAllocator::Config Config;
+    bool IsDebugInfoEnabled;
+    /// Where the allocator memory was in the process that saved the snapshot
+    uintptr_t ArenaAddress;
+    size_t ArenaSize;
+    /// Where the engine image was in the process that saved the snapshot
+    uintptr_t ImageAddress;
+    size_t ImageSize;
+    /// Address of the `AxrAllocator` singleton. Its offset within the image must match as well as the build ID
+    uintptr_t AnchorAddress;
+    /// Build ID of the engine image that saved the snapshot. Only the exact same build can restore it
+    AxrImageBuildID BuildID;
+    size_t PersistentMemoryOffset;
+    size_t PersistentMemorySize;
+    AxrHandleTable::SnapshotState HandleTableState;
+    AxrDynamicAllocator::SnapshotState EngineDataAllocatorState;
+    AxrHandleTable::SnapshotState DebugHandleTableState;
+    AxrDynamicAllocator::SnapshotState DebugInfoAllocatorState;
+    size_t RootSizes[AXR_SNAPSHOT_ROOT_END];
+};
+
+// ----------------------------------------- //
+// Static Helper Functions
+// ----------------------------------------- //
+
+/// Check if the given configs lay out the persistent memory the same way.
+/// Named arenas aren't saved in snapshots and come after the persistent memory, so they're ignored. So are settings
+/// that don't change the layout, like the defragment budgets and high water marks.
+/// @param config1 First config to compare
+/// @param config2 Second config to compare
+/// @return True if every config value that affects the persistent memory layout is the same
+static bool isConfigEqual(const AxrAllocator::Config& config1, const AxrAllocator::Config& config2) {
+    return config1.FrameAllocatorSize == config2.FrameAllocatorSize &&
+           config1.WorkerThreadCount == config2.WorkerThreadCount &&
+           config1.WorkerFrameAllocatorSize == config2.WorkerFrameAllocatorSize &&
+           config1.FramesInFlight == config2.FramesInFlight &&
+           config1.FrameInFlightAllocatorSize == config2.FrameInFlightAllocatorSize &&
+           config1.MaxHandleCount == config2.MaxHandleCount &&
+           config1.EngineDataAllocatorMainMemorySize == config2.EngineDataAllocatorMainMemorySize &&
+           config1.MaxDebugHandleCount == config2.MaxDebugHandleCount &&
+           config1.DebugInfoAllocatorMainMemorySize == config2.DebugInfoAllocatorMainMemorySize;
+}
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to read allocator snapshot header. "
+/// Read a snapshot file header and check that it was saved by this engine build
+/// @param file Snapshot file to read from
+/// @param filePath Snapshot file path. Only used for logging
+/// @param anchor Address of the `AxrAllocator` singleton
+/// @param header Output snapshot header
+/// @param imageAddress Output start address of the engine image in this process
+/// @param imageSize Output size in bytes of the engine image in this process
+/// @return AXR_SUCCESS if the function succeeded.
+/// AXR_ERROR_VALIDATION_FAILED if the file isn't a snapshot or was saved by a different engine build.
+static AxrResult readSnapshotHeader(std::FILE* file,
+                                    const char* filePath,
+                                    const void* anchor,
+                                    AxrSnapshotHeader& header,
+                                    uintptr_t& imageAddress,
+                                    size_t& imageSize) {
+    if (std::fread(&header, sizeof(header), 1, file) != 1 || header.Magic != AxrSnapshotMagic ||
+        header.Version != AxrSnapshotVersion || header.BuildID.Size > AxrMaxImageBuildIDSize) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "{} isn't a valid snapshot file.", filePath);
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    for (const size_t rootSize : header.RootSizes) {
+        if (rootSize > AxrAllocator::MaxSnapshotRootSize) [[unlikely]] {
+            axrLogError(AXR_FUNCTION_FAILED_STRING "{} isn't a valid snapshot file.", filePath);
+            return AXR_ERROR_VALIDATION_FAILED;
+        }
+    }
+
+    // Static addresses are only rebased as a whole, so the image must be the exact same build
+    AxrImageBuildID buildID{};
+    if (!axrGetImageBuildID(anchor, buildID) || !axrGetImageAddressRange(anchor, imageAddress, imageSize) ||
+        buildID.Size != header.BuildID.Size || std::memcmp(buildID.Data, header.BuildID.Data, buildID.Size) != 0 ||
+        imageSize != header.ImageSize ||
+        reinterpret_cast<uintptr_t>(anchor) - imageAddress != header.AnchorAddress - header.ImageAddress) {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "The snapshot was saved by a different engine build.");
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
+#endif
 
 // ----------------------------------------- //
 // Special Functions
@@ -29,19 +173,128 @@ AxrAllocator& AxrAllocator::get() {
 AxrResult AxrAllocator::setup(const Config& config) {
     assert(!m_IsSetup);
 
+    if (config.WorkerThreadCount > MaxWorkerThreadCount) [[unlikely]] {
+        axrLogError("Failed to set up allocator. Worker thread count of {} exceeds the max of {}.",
+                    config.WorkerThreadCount,
+                    MaxWorkerThreadCount);
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+    if (config.FramesInFlight == 0 || config.FramesInFlight > MaxFramesInFlight) [[unlikely]] {
+        axrLogError("Failed to set up allocator. Frames in flight must be between 1 and {}. Got {}.",
+                    MaxFramesInFlight,
+                    config.FramesInFlight);
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+    if (config.EngineDataAllocatorHighWaterMark < 0.0f || config.EngineDataAllocatorHighWaterMark > 1.0f ||
+        config.DebugInfoAllocatorHighWaterMark < 0.0f || config.DebugInfoAllocatorHighWaterMark > 1.0f) [[unlikely]] {
+        axrLogError("Failed to set up allocator. High water marks must be between 0 and 1.");
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+    if (config.EngineDataAllocatorMainMemorySize > AxrPersistentAllocator_T::MaxCapacity ||
+        config.DebugInfoAllocatorMainMemorySize > AxrPersistentAllocator_T::MaxCapacity) [[unlikely]] {
+        axrLogError("Failed to set up allocator. Engine data and debug info allocator sizes can't exceed {} bytes.",
+                    AxrPersistentAllocator_T::MaxCapacity);
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+    // Checked even when the TLSF allocator is used, so the same config works with either persistent allocator
+    if (config.MaxHandleCount > AxrDynamicAllocator::MaxHandleCount ||
+        config.MaxDebugHandleCount > AxrDynamicAllocator::MaxHandleCount) [[unlikely]] {
+        axrLogError("Failed to set up allocator. Max handle counts can't exceed {}.",
+                    AxrDynamicAllocator::MaxHandleCount);
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+    if (config.ArenaCount > MaxArenaCount || (config.ArenaCount != 0 && config.Arenas == nullptr)) [[unlikely]] {
+        axrLogError("Failed to set up allocator. Arena count of {} is invalid. The max is {}.",
+                    config.ArenaCount,
+                    MaxArenaCount);
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    AxrID_T arenaIDs[MaxArenaCount]{};
+    size_t arenasSize = 0;
+    for (uint32_t i = 0; i < config.ArenaCount; ++i) {
+        const ArenaConfig& arenaConfig = config.Arenas[i];
+        if (arenaConfig.Name == nullptr ||
+            std::strlen(reinterpret_cast<const char*>(arenaConfig.Name)) >= MaxArenaNameLength) [[unlikely]] {
+            axrLogError("Failed to set up allocator. Arena {} needs a name shorter than {} characters.",
+                        i,
+                        MaxArenaNameLength);
+            return AXR_ERROR_VALIDATION_FAILED;
+        }
+        if (arenaConfig.Type >= AXR_ARENA_TYPE_END) [[unlikely]] {
+            axrLogError("Failed to set up allocator. Arena {} has an invalid type.",
+                        reinterpret_cast<const char*>(arenaConfig.Name));
+            return AXR_ERROR_VALIDATION_FAILED;
+        }
+        if (arenaConfig.Type == AXR_ARENA_TYPE_PERSISTENT && arenaConfig.Size > AxrPersistentAllocator_T::MaxCapacity)
+            [[unlikely]] {
+            axrLogError("Failed to set up allocator. Persistent arena {} can't be bigger than {} bytes.",
+                        reinterpret_cast<const char*>(arenaConfig.Name),
+                        AxrPersistentAllocator_T::MaxCapacity);
+            return AXR_ERROR_VALIDATION_FAILED;
+        }
+        if (arenaConfig.Type == AXR_ARENA_TYPE_PERSISTENT &&
+            arenaConfig.MaxHandleCount > AxrDynamicAllocator::MaxHandleCount) [[unlikely]] {
+            axrLogError("Failed to set up allocator. Persistent arena {} can't have more than {} handles.",
+                        reinterpret_cast<const char*>(arenaConfig.Name),
+                        AxrDynamicAllocator::MaxHandleCount);
+            return AXR_ERROR_VALIDATION_FAILED;
+        }
+
+        arenaIDs[i] = getArenaID(arenaConfig.Name);
+        for (uint32_t j = 0; j < i; ++j) {
+            if (arenaIDs[j] == arenaIDs[i]) [[unlikely]] {
+                axrLogError("Failed to set up allocator. Arena {} has been declared more than once.",
+                            reinterpret_cast<const char*>(arenaConfig.Name));
+                return AXR_ERROR_DUPLICATE;
+            }
+        }
+
+        arenasSize += getArenaMemorySize(arenaConfig);
+    }
+
     const size_t frameAllocatorSize = config.FrameAllocatorSize;
-    const size_t handlesAllocatorSize = AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node>::getAllocatorSize(
-        config.MaxHandleCount);
+    const size_t workerFrameAllocatorsSize = config.WorkerFrameAllocatorSize * config.WorkerThreadCount;
+    const size_t frameInFlightAllocatorsSize = config.FrameInFlightAllocatorSize * config.FramesInFlight;
+    const size_t handleTableSize = AxrHandleTable::getAllocatorSize(config.MaxHandleCount);
     const size_t engineDataAllocatorSize = config.EngineDataAllocatorMainMemorySize;
-    const size_t debugHandlesAllocatorSize =
-        AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node>::getAllocatorSize(config.MaxDebugHandleCount);
+    const size_t debugHandleTableSize = AxrHandleTable::getAllocatorSize(config.MaxDebugHandleCount);
     [[maybe_unused]] const size_t debugInfoAllocatorSize = config.DebugInfoAllocatorMainMemorySize;
 
-    m_MemorySize = frameAllocatorSize + handlesAllocatorSize + engineDataAllocatorSize;
+    m_PersistentMemoryOffset = frameAllocatorSize + workerFrameAllocatorsSize + frameInFlightAllocatorsSize;
+    m_PersistentMemorySize = handleTableSize + engineDataAllocatorSize;
 #ifdef AXR_DEBUG_INFO_ENABLED
-    m_MemorySize += debugHandlesAllocatorSize + debugInfoAllocatorSize;
+    m_PersistentMemorySize += debugHandleTableSize + debugInfoAllocatorSize;
 #endif
+    // Named arenas aren't saved in snapshots, so they come after the persistent memory
+    const size_t arenasOffset = axrAlignAddress(m_PersistentMemoryOffset + m_PersistentMemorySize, AxrArenaAlignment);
+    m_MemorySize = arenasOffset + arenasSize;
+#ifdef AXR_VIRTUAL_MEMORY_ENABLED
+    // Reserve and commit the whole range up front. The OS only gives us physical pages as they're first touched, so
+    // generous budgets don't cost anything until they're actually used.
+    const size_t memoryAlignment = config.UseHugePages ? axrGetHugePageSize() : axrGetPageSize();
+    m_MemorySize = axrAlignAddress(m_MemorySize, memoryAlignment);
+    m_Memory = axrReserveVirtualMemory(m_MemorySize, memoryAlignment);
+    if (m_Memory == nullptr) [[unlikely]] {
+        m_MemorySize = {};
+        m_PersistentMemoryOffset = {};
+        m_PersistentMemorySize = {};
+        return AXR_ERROR_OUT_OF_MEMORY;
+    }
+    if (!axrCommitVirtualMemory(m_Memory, m_MemorySize)) [[unlikely]] {
+        axrReleaseVirtualMemory(m_Memory, m_MemorySize);
+        m_Memory = nullptr;
+        m_MemorySize = {};
+        m_PersistentMemoryOffset = {};
+        m_PersistentMemorySize = {};
+        return AXR_ERROR_OUT_OF_MEMORY;
+    }
+    if (config.UseHugePages) {
+        axrAdviseHugePages(m_Memory, m_MemorySize);
+    }
+#else
     m_Memory = malloc(m_MemorySize);
+#endif
 
     // ---- Frame Allocator ----
     AxrDeallocateBlock frameAllocatorDeallocateCallback;
@@ -53,86 +306,836 @@ AxrResult AxrAllocator::setup(const Config& config) {
         .Deallocator = frameAllocatorDeallocateCallback,
     });
 
-    // ---- Handles Allocator ----
-    AxrDeallocateBlock handlesAllocatorDeallocateCallback;
-    handlesAllocatorDeallocateCallback.connect<&AxrAllocator::deallocateHandlesAllocatorCallback>();
-    const auto handlesAllocatorMemory = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(frameAllocatorMemory) +
-                                                                frameAllocatorSize);
-    HandlesAllocator = AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node>(AxrMemoryBlock{
-        .Memory = handlesAllocatorMemory,
-        .Size = handlesAllocatorSize,
-        .Deallocator = handlesAllocatorDeallocateCallback,
+    // ---- Worker Frame Allocators ----
+    const auto workerFrameAllocatorsMemory = reinterpret_cast<void*>(
+        reinterpret_cast<uintptr_t>(frameAllocatorMemory) + frameAllocatorSize);
+    for (uint32_t i = 0; i < config.WorkerThreadCount; ++i) {
+        WorkerFrameAllocators[i] = AxrStackAllocator(AxrMemoryBlock{
+            .Memory = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(workerFrameAllocatorsMemory) +
+                                              config.WorkerFrameAllocatorSize * i),
+            .Size = config.WorkerFrameAllocatorSize,
+            .Deallocator = frameAllocatorDeallocateCallback,
+        });
+    }
+    m_WorkerThreadCount = config.WorkerThreadCount;
+    m_RegisteredWorkerThreadCount = 0;
+    ++m_SetupGeneration;
+
+    // ---- Frame In Flight Allocators ----
+    const auto frameInFlightAllocatorsMemory = reinterpret_cast<void*>(
+        reinterpret_cast<uintptr_t>(workerFrameAllocatorsMemory) + workerFrameAllocatorsSize);
+    for (uint32_t i = 0; i < config.FramesInFlight; ++i) {
+        FrameInFlightAllocators[i] = AxrStackAllocator(AxrMemoryBlock{
+            .Memory = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(frameInFlightAllocatorsMemory) +
+                                              config.FrameInFlightAllocatorSize * i),
+            .Size = config.FrameInFlightAllocatorSize,
+            .Deallocator = frameAllocatorDeallocateCallback,
+        });
+    }
+    m_FramesInFlight = config.FramesInFlight;
+    m_CurrentFrameInFlightIndex = 0;
+
+#ifdef AXR_VIRTUAL_MEMORY_ENABLED
+    if (config.PrefaultFrameAllocators) {
+        // The frame allocators are all next to each other and get touched every frame
+        axrPrefaultVirtualMemory(frameAllocatorMemory,
+                                 frameAllocatorSize + workerFrameAllocatorsSize + frameInFlightAllocatorsSize);
+    }
+#endif
+
+    // ---- Handle Table ----
+    AxrDeallocateBlock handleTableDeallocateCallback;
+    handleTableDeallocateCallback.connect<&AxrAllocator::deallocateHandleTableCallback>();
+    const auto handleTableMemory = reinterpret_cast<void*>(
+        reinterpret_cast<uintptr_t>(frameInFlightAllocatorsMemory) + frameInFlightAllocatorsSize);
+    HandleTable = AxrHandleTable(AxrMemoryBlock{
+        .Memory = handleTableMemory,
+        .Size = handleTableSize,
+        .Deallocator = handleTableDeallocateCallback,
     });
 
     // ---- Engine Data Allocator ----
     AxrDeallocateBlock engineDataAllocatorDeallocateCallback;
     engineDataAllocatorDeallocateCallback.connect<&AxrAllocator::deallocateEngineDataAllocatorCallback>();
-    const auto engineDataAllocatorMemory = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(handlesAllocatorMemory) +
-                                                                   handlesAllocatorSize);
+    const auto engineDataAllocatorMemory = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(handleTableMemory) +
+                                                                   handleTableSize);
+#ifdef AXR_TLSF_ALLOCATOR_ENABLED
+    EngineDataAllocator = AxrTlsfAllocator(AxrMemoryBlock{
+        .Memory = engineDataAllocatorMemory,
+        .Size = engineDataAllocatorSize,
+        .Deallocator = engineDataAllocatorDeallocateCallback,
+    });
+#else
     EngineDataAllocator = AxrDynamicAllocator(
         AxrMemoryBlock{
             .Memory = engineDataAllocatorMemory,
             .Size = engineDataAllocatorSize,
             .Deallocator = engineDataAllocatorDeallocateCallback,
         },
-        &HandlesAllocator);
+        &HandleTable);
+#endif
+    EngineDataAllocator.getMemoryPressureMonitor().setHighWaterMark(static_cast<size_t>(
+        static_cast<double>(EngineDataAllocator.capacity()) * config.EngineDataAllocatorHighWaterMark));
 
-    // ---- Debug Handles Allocator ----
-    const auto debugHandlesAllocatorMemory = reinterpret_cast<void*>(
+    // ---- Debug Handle Table ----
+    const auto debugHandleTableMemory = reinterpret_cast<void*>(
         reinterpret_cast<uintptr_t>(engineDataAllocatorMemory) + engineDataAllocatorSize);
 #ifdef AXR_DEBUG_INFO_ENABLED
-    AxrDeallocateBlock debugHandlesAllocatorDeallocateCallback;
-    debugHandlesAllocatorDeallocateCallback.connect<&AxrAllocator::deallocateDebugHandlesAllocatorCallback>();
-    DebugHandlesAllocator = AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node>(AxrMemoryBlock{
-        .Memory = debugHandlesAllocatorMemory,
-        .Size = debugHandlesAllocatorSize,
-        .Deallocator = debugHandlesAllocatorDeallocateCallback,
+    AxrDeallocateBlock debugHandleTableDeallocateCallback;
+    debugHandleTableDeallocateCallback.connect<&AxrAllocator::deallocateDebugHandleTableCallback>();
+    DebugHandleTable = AxrHandleTable(AxrMemoryBlock{
+        .Memory = debugHandleTableMemory,
+        .Size = debugHandleTableSize,
+        .Deallocator = debugHandleTableDeallocateCallback,
     });
 #endif
 
     // ---- Debug Info Allocator ----
     [[maybe_unused]] const auto debugInfoAllocatorMemory = reinterpret_cast<void*>(
-        reinterpret_cast<uintptr_t>(debugHandlesAllocatorMemory) + debugHandlesAllocatorSize);
+        reinterpret_cast<uintptr_t>(debugHandleTableMemory) + debugHandleTableSize);
 #ifdef AXR_DEBUG_INFO_ENABLED
     AxrDeallocateBlock debugInfoAllocatorDeallocateCallback;
     debugInfoAllocatorDeallocateCallback.connect<&AxrAllocator::deallocateDebugInfoAllocatorCallback>();
+#ifdef AXR_TLSF_ALLOCATOR_ENABLED
+    DebugInfoAllocator = AxrTlsfAllocator(AxrMemoryBlock{
+        .Memory = debugInfoAllocatorMemory,
+        .Size = debugInfoAllocatorSize,
+        .Deallocator = debugInfoAllocatorDeallocateCallback,
+    });
+#else
     DebugInfoAllocator = AxrDynamicAllocator(
         AxrMemoryBlock{
             .Memory = debugInfoAllocatorMemory,
             .Size = debugInfoAllocatorSize,
             .Deallocator = debugInfoAllocatorDeallocateCallback,
         },
-        &DebugHandlesAllocator);
+        &DebugHandleTable);
+#endif
+    DebugInfoAllocator.getMemoryPressureMonitor().setHighWaterMark(static_cast<size_t>(
+        static_cast<double>(DebugInfoAllocator.capacity()) * config.DebugInfoAllocatorHighWaterMark));
+#endif
+
+    // ---- Named Arenas ----
+    AxrDeallocateBlock arenaDeallocateCallback;
+    arenaDeallocateCallback.connect<&AxrAllocator::deallocateArenaCallback>();
+    uintptr_t arenaMemory = reinterpret_cast<uintptr_t>(m_Memory) + arenasOffset;
+    for (uint32_t i = 0; i < config.ArenaCount; ++i) {
+        const ArenaConfig& arenaConfig = config.Arenas[i];
+        Arena& arena = m_Arenas[i];
+        arena.ID = arenaIDs[i];
+        std::memcpy(arena.Name, arenaConfig.Name, std::strlen(reinterpret_cast<const char*>(arenaConfig.Name)) + 1);
+        arena.Type = arenaConfig.Type;
+
+        switch (arenaConfig.Type) {
+            case AXR_ARENA_TYPE_PERSISTENT: {
+                const size_t arenaHandleTableSize = AxrHandleTable::getAllocatorSize(arenaConfig.MaxHandleCount);
+                arena.HandleTable = AxrHandleTable(AxrMemoryBlock{
+                    .Memory = reinterpret_cast<void*>(arenaMemory),
+                    .Size = arenaHandleTableSize,
+                    .Deallocator = arenaDeallocateCallback,
+                });
+                arenaMemory += axrAlignAddress(arenaHandleTableSize, AxrArenaAlignment);
+
+#ifdef AXR_TLSF_ALLOCATOR_ENABLED
+                arena.PersistentAllocator = AxrTlsfAllocator(AxrMemoryBlock{
+                    .Memory = reinterpret_cast<void*>(arenaMemory),
+                    .Size = arenaConfig.Size,
+                    .Deallocator = arenaDeallocateCallback,
+                });
+#else
+                arena.PersistentAllocator = AxrDynamicAllocator(
+                    AxrMemoryBlock{
+                        .Memory = reinterpret_cast<void*>(arenaMemory),
+                        .Size = arenaConfig.Size,
+                        .Deallocator = arenaDeallocateCallback,
+                    },
+                    &arena.HandleTable);
 #endif
+                break;
+            }
+            case AXR_ARENA_TYPE_STACK: {
+                arena.StackAllocator = AxrStackAllocator(AxrMemoryBlock{
+                    .Memory = reinterpret_cast<void*>(arenaMemory),
+                    .Size = arenaConfig.Size,
+                    .Deallocator = arenaDeallocateCallback,
+                });
+                break;
+            }
+            case AXR_ARENA_TYPE_SCENE: {
+                arena.SceneArena = AxrSceneArena(AxrMemoryBlock{
+                    .Memory = reinterpret_cast<void*>(arenaMemory),
+                    .Size = arenaConfig.Size,
+                    .Deallocator = arenaDeallocateCallback,
+                });
+                break;
+            }
+            case AXR_ARENA_TYPE_END:
+            default: {
+                // Already validated above
+                break;
+            }
+        }
+        arenaMemory += axrAlignAddress(arenaConfig.Size, AxrArenaAlignment);
+    }
+    m_ArenaCount = config.ArenaCount;
+
+    m_DefragmentBudget = AxrDynamicAllocator::DefragmentBudget{
+        .MaxMicroseconds = config.DefragmentMicrosecondsPerFrame,
+        .MaxBytes = config.DefragmentBytesPerFrame,
+    };
+    m_Config = config;
+    // The arena configs only need to stay valid until setup returns
+    m_Config.Arenas = nullptr;
 
     m_IsSetup = true;
     return AXR_SUCCESS;
 }
 
 void AxrAllocator::shutDown() {
+    for (Arena& arena : m_Arenas) {
+        arena.SceneArena.~AxrSceneArena();
+        arena.StackAllocator.~AxrStackAllocator();
+        arena.PersistentAllocator.~AxrPersistentAllocator_T();
+        arena.HandleTable.~AxrHandleTable();
+    }
 #ifdef AXR_DEBUG_INFO_ENABLED
-    DebugInfoAllocator.~AxrDynamicAllocator();
-    DebugHandlesAllocator.~AxrPoolAllocator();
+    DebugInfoAllocator.~AxrPersistentAllocator_T();
+    DebugHandleTable.~AxrHandleTable();
 #endif
-    EngineDataAllocator.~AxrDynamicAllocator();
-    HandlesAllocator.~AxrPoolAllocator();
+    EngineDataAllocator.~AxrPersistentAllocator_T();
+    HandleTable.~AxrHandleTable();
+    for (AxrStackAllocator& frameInFlightAllocator : FrameInFlightAllocators) {
+        frameInFlightAllocator.~AxrStackAllocator();
+    }
+    for (AxrStackAllocator& workerFrameAllocator : WorkerFrameAllocators) {
+        workerFrameAllocator.~AxrStackAllocator();
+    }
     FrameAllocator.~AxrStackAllocator();
 
-    if (m_Memory != nullptr) {
-        free(m_Memory);
-        m_Memory = nullptr;
+    releaseMemory();
+}
+
+void AxrAllocator::shutDownFast() {
+    // Every sub-allocator only holds pointers into the one memory block, so there's nothing to clean up before it's
+    // freed. Reset them in place so they're ready for the next setup
+    for (Arena& arena : m_Arenas) {
+        new (&arena.SceneArena) AxrSceneArena();
+        new (&arena.StackAllocator) AxrStackAllocator();
+        new (&arena.PersistentAllocator) AxrPersistentAllocator_T();
+        new (&arena.HandleTable) AxrHandleTable();
     }
-    m_MemorySize = {};
+#ifdef AXR_DEBUG_INFO_ENABLED
+    new (&DebugInfoAllocator) AxrPersistentAllocator_T();
+    new (&DebugHandleTable) AxrHandleTable();
+#endif
+    new (&EngineDataAllocator) AxrPersistentAllocator_T();
+    new (&HandleTable) AxrHandleTable();
+    for (AxrStackAllocator& frameInFlightAllocator : FrameInFlightAllocators) {
+        new (&frameInFlightAllocator) AxrStackAllocator();
+    }
+    for (AxrStackAllocator& workerFrameAllocator : WorkerFrameAllocators) {
+        new (&workerFrameAllocator) AxrStackAllocator();
+    }
+    new (&FrameAllocator) AxrStackAllocator();
 
-    m_IsSetup = false;
+    releaseMemory();
+}
+
+bool AxrAllocator::isSetup() const {
+    return m_IsSetup;
+}
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to register worker thread. "
+AxrResult AxrAllocator::registerWorkerThread() {
+    assert(m_IsSetup);
+
+    if (isThreadFrameAllocatorValid()) {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "This thread has already been registered.");
+        return AXR_ERROR_DUPLICATE;
+    }
+
+    const uint32_t workerIndex = m_RegisteredWorkerThreadCount.fetch_add(1, std::memory_order_relaxed);
+    if (workerIndex >= m_WorkerThreadCount) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "All {} worker frame allocators are already in use.",
+                    m_WorkerThreadCount);
+        return AXR_ERROR_OUT_OF_MEMORY;
+    }
+
+    ThreadFrameAllocator = ThreadFrameAllocatorSlot{
+        .Allocator = &WorkerFrameAllocators[workerIndex],
+        .SetupGeneration = m_SetupGeneration,
+    };
+
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+AxrStackAllocator& AxrAllocator::getThreadFrameAllocator() {
+    if (!isThreadFrameAllocatorValid()) [[unlikely]] {
+        return FrameAllocator;
+    }
+
+    return *ThreadFrameAllocator.Allocator;
 }
+
+AxrStackAllocator& AxrAllocator::getFrameInFlightAllocator() {
+    assert(m_IsSetup);
+
+    return FrameInFlightAllocators[m_CurrentFrameInFlightIndex];
+}
+
+void AxrAllocator::clearFrameAllocators() {
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    AxrAllocationTraceRecorder::get().nextFrame();
+#endif
+
+    FrameAllocator.clear();
+    for (uint32_t i = 0; i < m_WorkerThreadCount; ++i) {
+        WorkerFrameAllocators[i].clear();
+    }
+
+    // The frame is over, so the relocation lock from it is too
+    if (m_IsPersistentRelocationLocked) {
+#ifndef AXR_TLSF_ALLOCATOR_ENABLED
+        EngineDataAllocator.unlockRelocation();
+#ifdef AXR_DEBUG_INFO_ENABLED
+        DebugInfoAllocator.unlockRelocation();
+#endif
+        for (uint32_t i = 0; i < m_ArenaCount; ++i) {
+            if (m_Arenas[i].Type == AXR_ARENA_TYPE_PERSISTENT) {
+                m_Arenas[i].PersistentAllocator.unlockRelocation();
+            }
+        }
+#endif
+        m_IsPersistentRelocationLocked = false;
+    }
+
+    if (m_FramesInFlight == 0) [[unlikely]] {
+        return;
+    }
+
+    // The next allocator was last used `m_FramesInFlight` frames ago, so that frame has now retired
+    m_CurrentFrameInFlightIndex = (m_CurrentFrameInFlightIndex + 1) % m_FramesInFlight;
+    FrameInFlightAllocators[m_CurrentFrameInFlightIndex].clear();
+}
+
+void AxrAllocator::defragmentPersistentAllocators() {
+#ifndef AXR_TLSF_ALLOCATOR_ENABLED
+    if (m_DefragmentBudget.MaxMicroseconds == 0 && m_DefragmentBudget.MaxBytes == 0) {
+        return;
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+    size_t bytesMoved = 0;
+    // Get whatever is left of the budget for the next allocator
+    const auto getRemainingBudget = [&](AxrDynamicAllocator::DefragmentBudget& remainingBudget) {
+        remainingBudget = m_DefragmentBudget;
+        if (remainingBudget.MaxMicroseconds != 0) {
+            const auto elapsedMicroseconds = static_cast<uint32_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime)
+                    .count());
+            if (elapsedMicroseconds >= remainingBudget.MaxMicroseconds) {
+                return false;
+            }
+            remainingBudget.MaxMicroseconds -= elapsedMicroseconds;
+        }
+        if (remainingBudget.MaxBytes != 0) {
+            if (bytesMoved >= remainingBudget.MaxBytes) {
+                return false;
+            }
+            remainingBudget.MaxBytes -= bytesMoved;
+        }
+        return true;
+    };
+
+    m_EngineDataDefragmentProgress = EngineDataAllocator.defragment(m_DefragmentBudget);
+    bytesMoved += m_EngineDataDefragmentProgress.BytesMoved;
+    if (m_EngineDataDefragmentProgress.BlocksMoved != 0 && m_EngineDataDefragmentProgress.IsComplete) {
+        axrLogDebug("Engine Data Allocator defragmentation complete.");
+    }
+
+    AxrDynamicAllocator::DefragmentBudget remainingBudget{};
+#ifdef AXR_DEBUG_INFO_ENABLED
+    if (!getRemainingBudget(remainingBudget)) {
+        return;
+    }
+
+    m_DebugInfoDefragmentProgress = DebugInfoAllocator.defragment(remainingBudget);
+    bytesMoved += m_DebugInfoDefragmentProgress.BytesMoved;
+    if (m_DebugInfoDefragmentProgress.BlocksMoved != 0 && m_DebugInfoDefragmentProgress.IsComplete) {
+        axrLogDebug("Debug Info Allocator defragmentation complete.");
+    }
+#endif
+
+    for (uint32_t i = 0; i < m_ArenaCount; ++i) {
+        Arena& arena = m_Arenas[i];
+        if (arena.Type != AXR_ARENA_TYPE_PERSISTENT) {
+            continue;
+        }
+        if (!getRemainingBudget(remainingBudget)) {
+            return;
+        }
+
+        bytesMoved += arena.PersistentAllocator.defragment(remainingBudget).BytesMoved;
+    }
+#endif
+}
+
+void AxrAllocator::lockPersistentRelocationForFrame() {
+    if (m_IsPersistentRelocationLocked) {
+        return;
+    }
+
+    // The TLSF allocator never relocates data, so there's nothing to lock
+#ifndef AXR_TLSF_ALLOCATOR_ENABLED
+    EngineDataAllocator.lockRelocation();
+#ifdef AXR_DEBUG_INFO_ENABLED
+    DebugInfoAllocator.lockRelocation();
+#endif
+    for (uint32_t i = 0; i < m_ArenaCount; ++i) {
+        if (m_Arenas[i].Type == AXR_ARENA_TYPE_PERSISTENT) {
+            m_Arenas[i].PersistentAllocator.lockRelocation();
+        }
+    }
+#endif
+    m_IsPersistentRelocationLocked = true;
+}
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+AxrResult AxrAllocator::startAllocationTrace(const char* filePath) {
+    assert(m_IsSetup);
+
+    const AxrResult axrResult = AxrAllocationTraceRecorder::get().start(filePath);
+    if (AXR_FAILED(axrResult)) [[unlikely]] {
+        return axrResult;
+    }
+
+    FrameAllocator.startTraceRecording();
+    for (uint32_t i = 0; i < m_WorkerThreadCount; ++i) {
+        WorkerFrameAllocators[i].startTraceRecording();
+    }
+    for (uint32_t i = 0; i < m_FramesInFlight; ++i) {
+        FrameInFlightAllocators[i].startTraceRecording();
+    }
+#ifndef AXR_TLSF_ALLOCATOR_ENABLED
+    EngineDataAllocator.startTraceRecording();
+#endif
+    for (uint32_t i = 0; i < m_ArenaCount; ++i) {
+        if (m_Arenas[i].Type == AXR_ARENA_TYPE_STACK) {
+            m_Arenas[i].StackAllocator.startTraceRecording();
+            continue;
+        }
+#ifndef AXR_TLSF_ALLOCATOR_ENABLED
+        // Scene arenas aren't recorded
+        if (m_Arenas[i].Type == AXR_ARENA_TYPE_PERSISTENT) {
+            m_Arenas[i].PersistentAllocator.startTraceRecording();
+        }
+#endif
+    }
+
+    return AXR_SUCCESS;
+}
+
+AxrResult AxrAllocator::stopAllocationTrace() {
+    FrameAllocator.stopTraceRecording();
+    for (uint32_t i = 0; i < m_WorkerThreadCount; ++i) {
+        WorkerFrameAllocators[i].stopTraceRecording();
+    }
+    for (uint32_t i = 0; i < m_FramesInFlight; ++i) {
+        FrameInFlightAllocators[i].stopTraceRecording();
+    }
+    EngineDataAllocator.stopTraceRecording();
+    for (uint32_t i = 0; i < m_ArenaCount; ++i) {
+        m_Arenas[i].StackAllocator.stopTraceRecording();
+        m_Arenas[i].PersistentAllocator.stopTraceRecording();
+    }
+
+    return AxrAllocationTraceRecorder::get().stop();
+}
+#endif
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to save allocator snapshot. "
+AxrResult AxrAllocator::saveSnapshot(const char* filePath) const {
+    assert(m_IsSetup);
+    assert(filePath != nullptr);
+
+#ifdef AXR_TLSF_ALLOCATOR_ENABLED
+    axrLogError(AXR_FUNCTION_FAILED_STRING "The TLSF allocator doesn't support snapshots.");
+    return AXR_ERROR_NOT_SUPPORTED;
+#else
+    AxrSnapshotHeader header{
+        .Magic = AxrSnapshotMagic,
+        .Version = AxrSnapshotVersion,
+        .Config = m_Config,
+#ifdef AXR_DEBUG_INFO_ENABLED
+        .IsDebugInfoEnabled = true,
+#else
+        .IsDebugInfoEnabled = false,
+#endif
+        .ArenaAddress = reinterpret_cast<uintptr_t>(m_Memory),
+        .ArenaSize = m_MemorySize,
+        .ImageAddress = 0,
+        .ImageSize = 0,
+        .AnchorAddress = reinterpret_cast<uintptr_t>(this),
+        .BuildID = {},
+        .PersistentMemoryOffset = m_PersistentMemoryOffset,
+        .PersistentMemorySize = m_PersistentMemorySize,
+        .HandleTableState = HandleTable.getSnapshotState(),
+        .EngineDataAllocatorState = EngineDataAllocator.getSnapshotState(),
+        .DebugHandleTableState = {},
+        .DebugInfoAllocatorState = {},
+        .RootSizes = {},
+    };
+#ifdef AXR_DEBUG_INFO_ENABLED
+    header.DebugHandleTableState = DebugHandleTable.getSnapshotState();
+    header.DebugInfoAllocatorState = DebugInfoAllocator.getSnapshotState();
+#endif
+    for (uint32_t i = 0; i < AXR_SNAPSHOT_ROOT_END; ++i) {
+        header.RootSizes[i] = m_SnapshotRoots[i].Size;
+    }
+
+    if (!axrGetImageAddressRange(this, header.ImageAddress, header.ImageSize)) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to find the engine image.");
+        return AXR_ERROR_UNKNOWN;
+    }
+    // Without a build ID there's no way to tell if a later process is the same engine build
+    if (!axrGetImageBuildID(this, header.BuildID)) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "The engine image has no build ID.");
+        return AXR_ERROR_NOT_SUPPORTED;
+    }
+
+    std::FILE* file = std::fopen(filePath, "wb");
+    if (file == nullptr) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to open file: {}.", filePath);
+        return AXR_ERROR_UNKNOWN;
+    }
+
+    bool wasWritten = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    for (const SnapshotRoot& snapshotRoot : m_SnapshotRoots) {
+        if (wasWritten && snapshotRoot.Size != 0) {
+            wasWritten = std::fwrite(snapshotRoot.Object, snapshotRoot.Size, 1, file) == 1;
+        }
+    }
+    if (wasWritten) {
+        wasWritten = std::fwrite(getPersistentMemory(), m_PersistentMemorySize, 1, file) == 1;
+    }
+
+    if (std::fclose(file) != 0 || !wasWritten) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to write file: {}.", filePath);
+        std::remove(filePath);
+        return AXR_ERROR_UNKNOWN;
+    }
+
+    return AXR_SUCCESS;
+#endif
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to read allocator snapshot config. "
+AxrResult AxrAllocator::readSnapshotConfig(const char* filePath, [[maybe_unused]] Config& config) const {
+    assert(filePath != nullptr);
+
+#ifdef AXR_TLSF_ALLOCATOR_ENABLED
+    axrLogError(AXR_FUNCTION_FAILED_STRING "The TLSF allocator doesn't support snapshots.");
+    return AXR_ERROR_NOT_SUPPORTED;
+#else
+    std::FILE* file = std::fopen(filePath, "rb");
+    if (file == nullptr) {
+        return AXR_ERROR_NOT_FOUND;
+    }
+
+    AxrSnapshotHeader header;
+    uintptr_t imageAddress = 0;
+    size_t imageSize = 0;
+    const AxrResult axrResult = readSnapshotHeader(file, filePath, this, header, imageAddress, imageSize);
+    std::fclose(file);
+    if (AXR_FAILED(axrResult)) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to read snapshot header.");
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    config = header.Config;
+    return AXR_SUCCESS;
+#endif
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to restore allocator snapshot. "
+AxrResult AxrAllocator::restoreSnapshot(const char* filePath, [[maybe_unused]] const Config& config) {
+    assert(!m_IsSetup);
+    assert(filePath != nullptr);
+
+#ifdef AXR_TLSF_ALLOCATOR_ENABLED
+    axrLogError(AXR_FUNCTION_FAILED_STRING "The TLSF allocator doesn't support snapshots.");
+    return AXR_ERROR_NOT_SUPPORTED;
+#else
+    std::FILE* file = std::fopen(filePath, "rb");
+    if (file == nullptr) {
+        return AXR_ERROR_NOT_FOUND;
+    }
+
+    AxrSnapshotHeader header;
+    uintptr_t imageAddress = 0;
+    size_t imageSize = 0;
+    AxrResult axrResult = readSnapshotHeader(file, filePath, this, header, imageAddress, imageSize);
+    if (AXR_FAILED(axrResult)) [[unlikely]] {
+        std::fclose(file);
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to read snapshot header.");
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+#ifdef AXR_DEBUG_INFO_ENABLED
+    constexpr bool isDebugInfoEnabled = true;
+#else
+    constexpr bool isDebugInfoEnabled = false;
+#endif
+    if (!isConfigEqual(header.Config, config) || header.IsDebugInfoEnabled != isDebugInfoEnabled) {
+        std::fclose(file);
+        axrLogError(AXR_FUNCTION_FAILED_STRING "The snapshot was saved with a different allocator config.");
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    // Settings that don't change the memory layout come from the given config, not the snapshot
+    axrResult = setup(config);
+    if (AXR_FAILED(axrResult)) [[unlikely]] {
+        std::fclose(file);
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to set up allocator.");
+        return AXR_ERROR_UNKNOWN;
+    }
+
+    bool wasRead = header.PersistentMemoryOffset == m_PersistentMemoryOffset &&
+                   header.PersistentMemorySize == m_PersistentMemorySize;
+    for (uint32_t i = 0; i < AXR_SNAPSHOT_ROOT_END; ++i) {
+        if (wasRead && header.RootSizes[i] != 0) {
+            wasRead = std::fread(m_RestoredSnapshotRoots[i].Data, header.RootSizes[i], 1, file) == 1;
+            m_RestoredSnapshotRoots[i].Size = header.RootSizes[i];
+        }
+    }
+    // Read straight into the allocator memory. Everything in there was just set up from scratch, so nothing is lost
+    if (wasRead) {
+        wasRead = std::fread(getPersistentMemory(), m_PersistentMemorySize, 1, file) == 1;
+    }
+    std::fclose(file);
+
+    if (!wasRead) [[unlikely]] {
+        shutDown();
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to read file: {}.", filePath);
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    HandleTable.restoreSnapshotState(header.HandleTableState);
+    EngineDataAllocator.restoreSnapshotState(header.EngineDataAllocatorState);
+#ifdef AXR_DEBUG_INFO_ENABLED
+    DebugHandleTable.restoreSnapshotState(header.DebugHandleTableState);
+    DebugInfoAllocator.restoreSnapshotState(header.DebugInfoAllocatorState);
+#endif
+
+    m_SnapshotRebase = AxrSnapshotRebase{
+        .Arena =
+            AxrSnapshotAddressRange{
+                .OldAddress = header.ArenaAddress,
+                .NewAddress = reinterpret_cast<uintptr_t>(m_Memory),
+                .Size = header.ArenaSize,
+            },
+        .Image =
+            AxrSnapshotAddressRange{
+                .OldAddress = header.ImageAddress,
+                .NewAddress = imageAddress,
+                .Size = imageSize,
+            },
+    };
+    // Handle table slots are the only pointers with a known layout here. Everything else is reached through the
+    // snapshot roots, which are rebased by type as they're registered
+    if (axrIsSnapshotRebaseNeeded(m_SnapshotRebase)) {
+        const auto arenaOffset =
+            static_cast<ptrdiff_t>(m_SnapshotRebase.Arena.NewAddress - m_SnapshotRebase.Arena.OldAddress);
+        HandleTable.offsetAllData(arenaOffset);
+#ifdef AXR_DEBUG_INFO_ENABLED
+        DebugHandleTable.offsetAllData(arenaOffset);
+#endif
+    }
+
+    m_IsRestoredFromSnapshot = true;
+    return AXR_SUCCESS;
+#endif
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+bool AxrAllocator::isRestoredFromSnapshot() const {
+    return m_IsRestoredFromSnapshot;
+}
+
+bool AxrAllocator::registerSnapshotRootObject(const AxrSnapshotRootEnum root,
+                                              void* object,
+                                              const size_t size,
+                                              const RebaseSnapshotRoot_T rebaseRoot) {
+    assert(root < AXR_SNAPSHOT_ROOT_END);
+    assert(object != nullptr);
+    assert(size <= MaxSnapshotRootSize);
+    assert(rebaseRoot != nullptr);
+
+    m_SnapshotRoots[root] = SnapshotRoot{
+        .Object = object,
+        .Size = size,
+    };
+
+    RestoredSnapshotRoot& restoredSnapshotRoot = m_RestoredSnapshotRoots[root];
+    if (restoredSnapshotRoot.Size == 0) {
+        return false;
+    }
+    if (restoredSnapshotRoot.Size != size) [[unlikely]] {
+        axrLogWarning("Ignoring snapshot root {}. It was saved with a different size.", static_cast<int>(root));
+        restoredSnapshotRoot.Size = 0;
+        return false;
+    }
+
+    std::memcpy(object, restoredSnapshotRoot.Data, size);
+    restoredSnapshotRoot.Size = 0;
+    if (axrIsSnapshotRebaseNeeded(m_SnapshotRebase)) {
+        rebaseRoot(m_SnapshotRebase, object);
+    }
+    return true;
+}
+
+AxrID_T AxrAllocator::getArenaID(const char8_t* name) {
+    assert(name != nullptr);
+
+    // Same hash as `AxrID::generateID()`
+    return XXH3_64bits(name, std::strlen(reinterpret_cast<const char*>(name)));
+}
+
+AxrPersistentAllocator_T* AxrAllocator::getPersistentArena(const AxrID_T id) {
+    Arena* arena = findArena(id);
+    if (arena == nullptr || arena->Type != AXR_ARENA_TYPE_PERSISTENT) [[unlikely]] {
+        return nullptr;
+    }
+
+    return &arena->PersistentAllocator;
+}
+
+AxrStackAllocator* AxrAllocator::getStackArena(const AxrID_T id) {
+    Arena* arena = findArena(id);
+    if (arena == nullptr || arena->Type != AXR_ARENA_TYPE_STACK) [[unlikely]] {
+        return nullptr;
+    }
+
+    return &arena->StackAllocator;
+}
+
+AxrSceneArena* AxrAllocator::getSceneArena(const AxrID_T id) {
+    Arena* arena = findArena(id);
+    if (arena == nullptr || arena->Type != AXR_ARENA_TYPE_SCENE) [[unlikely]] {
+        return nullptr;
+    }
+
+    return &arena->SceneArena;
+}
+
+AxrResult AxrAllocator::getArenaUsage(const AxrID_T id, ArenaUsage& usage) const {
+    const Arena* arena = findArena(id);
+    if (arena == nullptr) [[unlikely]] {
+        return AXR_ERROR_NOT_FOUND;
+    }
+
+    usage = ArenaUsage{
+        .Type = arena->Type,
+        .Size = 0,
+        .Capacity = 0,
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+        .PeakSize = 0,
+#endif
+        .HandleCount = 0,
+        .HandleCapacity = 0,
+    };
+
+    switch (arena->Type) {
+        case AXR_ARENA_TYPE_PERSISTENT: {
+            usage.Size = arena->PersistentAllocator.size();
+            usage.Capacity = arena->PersistentAllocator.capacity();
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+            usage.PeakSize = arena->PersistentAllocator.peakSize();
+#endif
+            usage.HandleCount = arena->HandleTable.size();
+            usage.HandleCapacity = arena->HandleTable.handleCapacity();
+            break;
+        }
+        case AXR_ARENA_TYPE_STACK: {
+            usage.Size = arena->StackAllocator.size();
+            usage.Capacity = arena->StackAllocator.capacity();
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+            usage.PeakSize = arena->StackAllocator.peakSize();
+#endif
+            break;
+        }
+        case AXR_ARENA_TYPE_SCENE: {
+            usage.Size = arena->SceneArena.size();
+            usage.Capacity = arena->SceneArena.capacity();
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+            usage.PeakSize = arena->SceneArena.peakSize();
+#endif
+            break;
+        }
+        case AXR_ARENA_TYPE_END:
+        default: {
+            break;
+        }
+    }
+
+    return AXR_SUCCESS;
+}
+
+#ifndef AXR_TLSF_ALLOCATOR_ENABLED
+const AxrDynamicAllocator::DefragmentProgress& AxrAllocator::getEngineDataDefragmentProgress() const {
+    return m_EngineDataDefragmentProgress;
+}
+
+const AxrDynamicAllocator::DefragmentProgress& AxrAllocator::getDebugInfoDefragmentProgress() const {
+    return m_DebugInfoDefragmentProgress;
+}
+#endif
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+AxrAllocator::UsageProfile AxrAllocator::getUsageProfile() const {
+    UsageProfile profile{
+        .FrameAllocatorPeakSize = FrameAllocator.peakSize(),
+        .WorkerFrameAllocatorPeakSize = 0,
+        .FrameInFlightAllocatorPeakSize = 0,
+        .PeakHandleCount = static_cast<uint32_t>(HandleTable.peakHandleCount()),
+        .EngineDataAllocatorPeakSize = EngineDataAllocator.peakSize(),
+        .PeakDebugHandleCount = 0,
+        .DebugInfoAllocatorPeakSize = 0,
+    };
+
+    for (uint32_t i = 0; i < m_WorkerThreadCount; ++i) {
+        if (WorkerFrameAllocators[i].peakSize() > profile.WorkerFrameAllocatorPeakSize) {
+            profile.WorkerFrameAllocatorPeakSize = WorkerFrameAllocators[i].peakSize();
+        }
+    }
+    for (uint32_t i = 0; i < m_FramesInFlight; ++i) {
+        if (FrameInFlightAllocators[i].peakSize() > profile.FrameInFlightAllocatorPeakSize) {
+            profile.FrameInFlightAllocatorPeakSize = FrameInFlightAllocators[i].peakSize();
+        }
+    }
+
+#ifdef AXR_DEBUG_INFO_ENABLED
+    profile.PeakDebugHandleCount = static_cast<uint32_t>(DebugHandleTable.peakHandleCount());
+    profile.DebugInfoAllocatorPeakSize = DebugInfoAllocator.peakSize();
+#endif
+
+    return profile;
+}
+#endif
+
 void AxrAllocator::logAllAllocatorUsage(const char* message) const {
     axrLogDebug("----------------------------------------------------------------");
     logFrameAllocatorUsage(message);
-    logHandlesAllocatorUsage(message);
+    logHandleTableUsage(message);
     logEngineDataAllocatorUsage(message);
-    logDebugHandlesAllocatorUsage(message);
+    logDebugHandleTableUsage(message);
     logDebugInfoAllocatorUsage(message);
+    logArenaUsage(message);
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+    AxrAllocationTracker::get().logUsage(message);
+#endif
     axrLogDebug("----------------------------------------------------------------");
 }
 
@@ -159,14 +1162,14 @@ void AxrAllocator::logFrameAllocatorUsage(const char* message) const {
     );
 }
 
-void AxrAllocator::logHandlesAllocatorUsage(const char* message) const {
-    const size_t size = HandlesAllocator.size();
-    const size_t capacity = HandlesAllocator.chunkCapacity();
+void AxrAllocator::logHandleTableUsage(const char* message) const {
+    const size_t size = HandleTable.size();
+    const size_t capacity = HandleTable.handleCapacity();
 #ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
-    const size_t peakSize = HandlesAllocator.peakChunkCount();
+    const size_t peakSize = HandleTable.peakHandleCount();
 #endif
 
-    axrLogDebug("{}: Handles Allocator memory usage."
+    axrLogDebug("{}: Handle Table memory usage."
                 " {:.2f}% Handles used currently. {} Handles used out of {}."
 #ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
                 " Peak handles usage reached {:.2f}%."
@@ -207,15 +1210,15 @@ void AxrAllocator::logEngineDataAllocatorUsage(const char* message) const {
     );
 }
 
-void AxrAllocator::logDebugHandlesAllocatorUsage(const char* message) const {
+void AxrAllocator::logDebugHandleTableUsage(const char* message) const {
 #ifdef AXR_DEBUG_INFO_ENABLED
-    const size_t size = DebugHandlesAllocator.size();
-    const size_t capacity = DebugHandlesAllocator.chunkCapacity();
+    const size_t size = DebugHandleTable.size();
+    const size_t capacity = DebugHandleTable.handleCapacity();
 #ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
-    const size_t peakSize = DebugHandlesAllocator.peakChunkCount();
+    const size_t peakSize = DebugHandleTable.peakHandleCount();
 #endif
 
-    axrLogDebug("{}: Debug Handles Allocator memory usage."
+    axrLogDebug("{}: Debug Handle Table memory usage."
                 " {:.2f}% Handles used currently. {} Handles used out of {}."
 #ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
                 " Peak handles usage reached {:.2f}%."
@@ -259,15 +1262,113 @@ void AxrAllocator::logDebugInfoAllocatorUsage(const char* message) const {
 #endif
 }
 
+void AxrAllocator::logArenaUsage(const char* message) const {
+    for (uint32_t i = 0; i < m_ArenaCount; ++i) {
+        const Arena& arena = m_Arenas[i];
+        ArenaUsage usage{};
+        if (AXR_FAILED(getArenaUsage(arena.ID, usage))) [[unlikely]] {
+            continue;
+        }
+
+        axrLogDebug("{}: {} Arena memory usage."
+                    " {:.2f}% Memory used currently. {} Bytes used out of {}."
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+                    " Peak memory usage reached {:.2f}%."
+#endif
+                    ,
+                    message,
+                    reinterpret_cast<const char*>(arena.Name),
+                    static_cast<float>(usage.Size) / static_cast<float>(usage.Capacity) * 100,
+                    usage.Size,
+                    usage.Capacity
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+                    ,
+                    static_cast<float>(usage.PeakSize) / static_cast<float>(usage.Capacity) * 100
+#endif
+        );
+    }
+}
+
 // ----------------------------------------- //
 // Private Functions
 // ----------------------------------------- //
 
+bool AxrAllocator::isThreadFrameAllocatorValid() const {
+    return ThreadFrameAllocator.Allocator != nullptr && ThreadFrameAllocator.SetupGeneration == m_SetupGeneration;
+}
+
+void AxrAllocator::releaseMemory() {
+    for (Arena& arena : m_Arenas) {
+        arena.ID = {};
+        arena.Name[0] = u8'\0';
+        arena.Type = {};
+    }
+    m_ArenaCount = 0;
+
+    if (m_Memory != nullptr) {
+#ifdef AXR_VIRTUAL_MEMORY_ENABLED
+        axrReleaseVirtualMemory(m_Memory, m_MemorySize);
+#else
+        free(m_Memory);
+#endif
+        m_Memory = nullptr;
+    }
+    m_MemorySize = {};
+    m_Config = {};
+    m_PersistentMemoryOffset = {};
+    m_PersistentMemorySize = {};
+    for (SnapshotRoot& snapshotRoot : m_SnapshotRoots) {
+        snapshotRoot = {};
+    }
+    for (RestoredSnapshotRoot& restoredSnapshotRoot : m_RestoredSnapshotRoots) {
+        restoredSnapshotRoot.Size = 0;
+    }
+    m_SnapshotRebase = {};
+    m_IsRestoredFromSnapshot = false;
+    m_WorkerThreadCount = 0;
+    m_RegisteredWorkerThreadCount = 0;
+    m_FramesInFlight = 0;
+    m_CurrentFrameInFlightIndex = 0;
+    ++m_SetupGeneration;
+    m_DefragmentBudget = {};
+#ifndef AXR_TLSF_ALLOCATOR_ENABLED
+    m_EngineDataDefragmentProgress = {};
+    m_DebugInfoDefragmentProgress = {};
+#endif
+    m_IsPersistentRelocationLocked = false;
+
+    m_IsSetup = false;
+}
+
+void* AxrAllocator::getPersistentMemory() const {
+    return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(m_Memory) + m_PersistentMemoryOffset);
+}
+
+AxrAllocator::Arena* AxrAllocator::findArena(const AxrID_T id) {
+    for (uint32_t i = 0; i < m_ArenaCount; ++i) {
+        if (m_Arenas[i].ID == id) {
+            return &m_Arenas[i];
+        }
+    }
+
+    return nullptr;
+}
+
+const AxrAllocator::Arena* AxrAllocator::findArena(const AxrID_T id) const {
+    for (uint32_t i = 0; i < m_ArenaCount; ++i) {
+        if (m_Arenas[i].ID == id) {
+            return &m_Arenas[i];
+        }
+    }
+
+    return nullptr;
+}
+
 void AxrAllocator::deallocateFrameAllocatorCallback(void*& memory) {
     memory = nullptr;
 }
 
-void AxrAllocator::deallocateHandlesAllocatorCallback(void*& memory) {
+void AxrAllocator::deallocateHandleTableCallback(void*& memory) {
     memory = nullptr;
 }
 
@@ -275,10 +1376,14 @@ void AxrAllocator::deallocateEngineDataAllocatorCallback(void*& memory) {
     memory = nullptr;
 }
 
-void AxrAllocator::deallocateDebugHandlesAllocatorCallback(void*& memory) {
+void AxrAllocator::deallocateDebugHandleTableCallback(void*& memory) {
     memory = nullptr;
 }
 
 void AxrAllocator::deallocateDebugInfoAllocatorCallback(void*& memory) {
     memory = nullptr;
 }
+
+void AxrAllocator::deallocateArenaCallback(void*& memory) {
+    memory = nullptr;
+}
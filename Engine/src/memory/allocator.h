@@ -3,10 +3,41 @@
 // ----------------------------------------- //
 // Headers
 // ----------------------------------------- //
+#include "../utils.h"
+#include "allocatorSnapshot.h"
 #include "axr/common/enums.h"
+#include "axr/common/types.h"
 #include "dynamicAllocator.h"
+#include "persistentAllocator.h"
+#include "sceneArena.h"
 #include "stackAllocator.h"
 
+#include <atomic>
+#include <cstddef>
+
+// ----------------------------------------- //
+// Enums
+// ----------------------------------------- //
+
+/// Objects outside of the allocator memory that hold handles to persistent data. E.g. registries.
+/// These are saved along with the persistent data in allocator snapshots.
+enum AxrSnapshotRootEnum {
+    AXR_SNAPSHOT_ROOT_DEBUG_ID_NAMES = 0,
+    AXR_SNAPSHOT_ROOT_SHADER_REGISTRY,
+    AXR_SNAPSHOT_ROOT_END,
+};
+
+/// Named arena allocator types
+enum AxrArenaTypeEnum {
+    /// Persistent allocator with its own handle table
+    AXR_ARENA_TYPE_PERSISTENT = 0,
+    /// Stack allocator. Never cleared by the engine, the subsystem that owns it decides when to clear it
+    AXR_ARENA_TYPE_STACK,
+    /// Scene arena. Scene data and load time temporaries share a double-ended stack that's released all at once
+    AXR_ARENA_TYPE_SCENE,
+    AXR_ARENA_TYPE_END,
+};
+
 /// Axr Main Allocator singleton
 class AxrAllocator {
 public:
@@ -48,22 +79,119 @@ private:
     ~AxrAllocator();
 
 public:
+    // ----------------------------------------- //
+    // Public Constants
+    // ----------------------------------------- //
+
+    /// The max number of worker threads that can have their own frame allocator
+    static constexpr uint32_t MaxWorkerThreadCount = 16;
+    /// The max number of frames that can be in flight at once
+    static constexpr uint32_t MaxFramesInFlight = 4;
+    /// The max size in bytes of a single snapshot root object
+    static constexpr size_t MaxSnapshotRootSize = 128;
+    /// The max number of named arenas
+    static constexpr uint32_t MaxArenaCount = 16;
+    /// The max length of a named arena's name, including the null terminator
+    static constexpr uint32_t MaxArenaNameLength = 32;
+
     // ----------------------------------------- //
     // Public Structs
     // ----------------------------------------- //
 
+    /// Named arena config
+    struct ArenaConfig {
+        /// Arena name. The arena is resolved with the `AxrID` of this name. Must be shorter than
+        /// `MaxArenaNameLength`
+        const char8_t* Name;
+        /// Allocator type
+        AxrArenaTypeEnum Type;
+        /// Size in bytes. This is the arena's budget
+        size_t Size;
+        /// The max number of handles to allow for. Only used by persistent arenas. Unused by `AxrTlsfAllocator`
+        uint32_t MaxHandleCount;
+    };
+
     /// AxrAllocator Config
     struct Config {
         /// Size in bytes
         size_t FrameAllocatorSize;
-        /// The max number of dynamic allocator handles to allow for
+        /// The number of worker threads that get their own frame allocator. Must not exceed `MaxWorkerThreadCount`
+        uint32_t WorkerThreadCount;
+        /// Size in bytes of each worker thread's frame allocator
+        size_t WorkerFrameAllocatorSize;
+        /// The number of frames that can be in flight at once. Should match the renderer's frames in flight.
+        /// Must be between 1 and `MaxFramesInFlight`
+        uint32_t FramesInFlight;
+        /// Size in bytes of each frame in flight allocator
+        size_t FrameInFlightAllocatorSize;
+        /// The max number of dynamic allocator handles to allow for. Unused by `AxrTlsfAllocator`
         uint32_t MaxHandleCount;
         /// Size in bytes
         size_t EngineDataAllocatorMainMemorySize;
-        /// The max number of debug related dynamic allocator handles to allow for
+        /// The max number of debug related dynamic allocator handles to allow for. Unused by `AxrTlsfAllocator`
         uint32_t MaxDebugHandleCount;
         /// Size in bytes
         size_t DebugInfoAllocatorMainMemorySize;
+        /// The max amount of time to spend defragmenting persistent allocators each frame, in microseconds.
+        /// 0 for no time limit
+        uint32_t DefragmentMicrosecondsPerFrame;
+        /// The max number of bytes to move while defragmenting persistent allocators each frame. 0 for no byte limit.
+        /// If both this and `DefragmentMicrosecondsPerFrame` are 0, per frame defragmentation is disabled
+        size_t DefragmentBytesPerFrame;
+        /// The fraction of `EngineDataAllocatorMainMemorySize` that can be in use before the engine data allocator's
+        /// memory pressure callbacks are notified. Between 0 and 1. 0 to disable
+        float EngineDataAllocatorHighWaterMark;
+        /// The fraction of `DebugInfoAllocatorMainMemorySize` that can be in use before the debug info allocator's
+        /// memory pressure callbacks are notified. Between 0 and 1. 0 to disable
+        float DebugInfoAllocatorHighWaterMark;
+        /// Align the allocator memory to huge pages and ask the OS to back it with transparent huge pages.
+        /// Only used when `AXR_VIRTUAL_MEMORY_ENABLED` is defined
+        bool UseHugePages;
+        /// Fault in all frame allocator pages during setup so the frame loop never takes a first touch page fault.
+        /// Only used when `AXR_VIRTUAL_MEMORY_ENABLED` is defined
+        bool PrefaultFrameAllocators;
+        /// Named arenas for subsystems that shouldn't share `EngineDataAllocator` with everyone else. Each arena gets
+        /// its own memory, so one subsystem running out of memory or fragmenting its arena doesn't affect any other.
+        /// Only needs to stay valid until setup returns
+        const ArenaConfig* Arenas;
+        /// The number of named arenas in `Arenas`. Must not exceed `MaxArenaCount`
+        uint32_t ArenaCount;
+    };
+
+    /// Current usage of a named arena
+    struct ArenaUsage {
+        /// Allocator type
+        AxrArenaTypeEnum Type;
+        /// Size in bytes currently in use
+        size_t Size;
+        /// Size in bytes of the arena's budget
+        size_t Capacity;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+        /// Peak size in bytes in use at one time
+        size_t PeakSize;
+#endif
+        /// Number of handles currently in use. Always 0 for stack and scene arenas
+        size_t HandleCount;
+        /// Number of handles available. Always 0 for stack and scene arenas
+        size_t HandleCapacity;
+    };
+
+    /// Peak usage of each allocator. Used to size the next session's `Config`
+    struct UsageProfile {
+        /// Peak size in bytes of the main frame allocator
+        size_t FrameAllocatorPeakSize;
+        /// Highest peak size in bytes out of all worker frame allocators
+        size_t WorkerFrameAllocatorPeakSize;
+        /// Highest peak size in bytes out of all frame in flight allocators
+        size_t FrameInFlightAllocatorPeakSize;
+        /// Peak number of handles used in the handle table
+        uint32_t PeakHandleCount;
+        /// Peak size in bytes of the engine data allocator
+        size_t EngineDataAllocatorPeakSize;
+        /// Peak number of handles used in the debug handle table
+        uint32_t PeakDebugHandleCount;
+        /// Peak size in bytes of the debug info allocator
+        size_t DebugInfoAllocatorPeakSize;
     };
 
     // ----------------------------------------- //
@@ -72,17 +200,21 @@ public:
 
     /// Allocator for temporary data. This allocator clears all data at the beginning of each frame
     AxrStackAllocator FrameAllocator{};
-    /// Allocator for all dynamic allocator handles
-    AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node> HandlesAllocator{};
+    /// Per worker thread allocators for temporary data. These are cleared at the beginning of each frame along with
+    /// `FrameAllocator`. Use `getThreadFrameAllocator()` to get the one for the current thread
+    AxrStackAllocator WorkerFrameAllocators[MaxWorkerThreadCount]{};
+    /// One allocator per frame in flight. Data allocated for frame N lives until frame N + `FramesInFlight` starts.
+    /// Use `getFrameInFlightAllocator()` to get the one for the current frame
+    AxrStackAllocator FrameInFlightAllocators[MaxFramesInFlight]{};
+    /// Table for all dynamic allocator handles
+    AxrHandleTable HandleTable{};
     /// Allocator for any and all persistent engine related data
-    // TODO (Ashe): Defragment this allocator every now and then
-    AxrDynamicAllocator EngineDataAllocator{};
+    AxrPersistentAllocator_T EngineDataAllocator{};
 #ifdef AXR_DEBUG_INFO_ENABLED
-    /// Allocator for all debug related dynamic allocator handles
-    AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node> DebugHandlesAllocator{};
+    /// Table for all debug related dynamic allocator handles
+    AxrHandleTable DebugHandleTable{};
     /// Allocator for all debug related info
-    // TODO (Ashe): Defragment this allocator every now and then
-    AxrDynamicAllocator DebugInfoAllocator{};
+    AxrPersistentAllocator_T DebugInfoAllocator{};
 #endif
 
     // ----------------------------------------- //
@@ -99,6 +231,161 @@ public:
     [[nodiscard]] AxrResult setup(const Config& config);
     /// Shut down the allocator
     void shutDown();
+    /// Shut down the allocator by freeing all of its memory in one call.
+    /// Sub-allocators are reset in place instead of being destroyed, so none of their blocks get walked on the way out.
+    /// Anything still holding memory from this allocator must `release()` it first and never touch it again.
+    void shutDownFast();
+    /// Check if the allocator has been set up
+    /// @return True if the allocator has been set up
+    [[nodiscard]] bool isSetup() const;
+
+    /// Give the calling thread its own frame allocator from `WorkerFrameAllocators`.
+    /// Registrations only last until the allocator is shut down.
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_DUPLICATE if this thread has already been registered.
+    /// AXR_ERROR_OUT_OF_MEMORY if all worker frame allocators are already in use.
+    [[nodiscard]] AxrResult registerWorkerThread();
+    /// Get the frame allocator for the calling thread.
+    /// Threads that haven't been registered with `registerWorkerThread()` get the main `FrameAllocator`.
+    /// @return The frame allocator for the calling thread
+    [[nodiscard]] AxrStackAllocator& getThreadFrameAllocator();
+    /// Get the allocator for data that needs to live until the current frame retires.
+    /// The data stays valid until the frame `FramesInFlight` frames after this one starts.
+    /// @return The frame in flight allocator for the current frame
+    [[nodiscard]] AxrStackAllocator& getFrameInFlightAllocator();
+    /// Get the ID of a named arena. This is the same as the `AxrID` of the name, but it doesn't register the name with
+    /// the debug info. So it can be used before the allocator is set up
+    /// @param name Arena name
+    /// @return The arena ID
+    [[nodiscard]] static AxrID_T getArenaID(const char8_t* name);
+    /// Get the persistent allocator of a named arena
+    /// @param id Arena ID. The `AxrID` of the arena's name
+    /// @return The persistent allocator of the named arena. Or nullptr if there's no persistent arena with the given ID
+    [[nodiscard]] AxrPersistentAllocator_T* getPersistentArena(AxrID_T id);
+    /// Get the stack allocator of a named arena
+    /// @param id Arena ID. The `AxrID` of the arena's name
+    /// @return The stack allocator of the named arena. Or nullptr if there's no stack arena with the given ID
+    [[nodiscard]] AxrStackAllocator* getStackArena(AxrID_T id);
+    /// Get the scene arena of a named arena
+    /// @param id Arena ID. The `AxrID` of the arena's name
+    /// @return The scene arena of the named arena. Or nullptr if there's no scene arena with the given ID
+    [[nodiscard]] AxrSceneArena* getSceneArena(AxrID_T id);
+    /// Get the current usage of a named arena
+    /// @param id Arena ID. The `AxrID` of the arena's name
+    /// @param usage Output arena usage
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_NOT_FOUND if there's no arena with the given ID.
+    [[nodiscard]] AxrResult getArenaUsage(AxrID_T id, ArenaUsage& usage) const;
+    /// Clear the main frame allocator and all worker thread frame allocators. Then move on to the next frame in flight
+    /// allocator, clearing the data from the frame that just retired.
+    /// Must not be called while worker threads are using their frame allocators.
+    void clearFrameAllocators();
+
+    /// Defragment the persistent allocators within the per frame budget set in the config.
+    /// The time and byte budgets are shared between all persistent allocators. Engine data first, then debug info and
+    /// then each persistent named arena in the order they were declared.
+    void defragmentPersistentAllocators();
+    /// Stop the persistent allocators and persistent named arenas from relocating any data for the rest of the frame.
+    /// Hot loops can then resolve handles to data pointers once instead of on every access. The lock ends when
+    /// `clearFrameAllocators()` is called at the start of the next frame.
+    void lockPersistentRelocationForFrame();
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    /// Start recording an allocation trace of the frame allocators, the frame in flight allocators, the engine data
+    /// allocator and every named arena to the given file. Replay it with the `AXR_TraceReplayer` benchmark tool.
+    /// Persistent allocators are only recorded when they're `AxrDynamicAllocator`s.
+    /// @param filePath File path to write to
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_VALIDATION_FAILED if a trace is already being recorded.
+    /// AXR_ERROR_UNKNOWN if the file couldn't be opened.
+    [[nodiscard]] AxrResult startAllocationTrace(const char* filePath);
+    /// Stop recording the allocation trace and write it to its file
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_UNKNOWN if the trace couldn't be written.
+    AxrResult stopAllocationTrace();
+#endif
+
+    /// Save the persistent allocators, their handle tables and all registered snapshot roots to a file.
+    /// A later process can then restore them with `restoreSnapshot()` instead of redoing the work that filled them.
+    /// Frame allocators and named arenas aren't saved. Not supported by `AxrTlsfAllocator`.
+    /// @param filePath File path to write to
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_NOT_SUPPORTED if the persistent allocator doesn't support snapshots, or the engine image has no build
+    /// ID to tell builds apart.
+    [[nodiscard]] AxrResult saveSnapshot(const char* filePath) const;
+    /// Read the allocator config a snapshot file was saved with
+    /// @param filePath File path to read from
+    /// @param config Output allocator config
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_NOT_FOUND if the file doesn't exist.
+    /// AXR_ERROR_VALIDATION_FAILED if the file isn't a snapshot or was saved by a different engine build.
+    /// AXR_ERROR_NOT_SUPPORTED if the persistent allocator doesn't support snapshots.
+    [[nodiscard]] AxrResult readSnapshotConfig(const char* filePath, Config& config) const;
+    /// Set up the allocator from a snapshot file written by `saveSnapshot()`.
+    /// The persistent data is loaded straight into the allocator memory. Handle table slots are rebased to where the
+    /// allocator memory is in this process, and each registered snapshot root is rebased by `registerSnapshotRoot()`.
+    /// Persistent data that isn't reachable from a snapshot root isn't rebased. Named arenas start out empty.
+    /// @param filePath File path to read from
+    /// @param config Allocator config. Its memory layout must match the config the snapshot was saved with. Settings
+    /// that don't change the layout, like the defragment budgets and high water marks, are used as is
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_NOT_FOUND if the file doesn't exist.
+    /// AXR_ERROR_VALIDATION_FAILED if the snapshot is from a different config or engine build.
+    /// AXR_ERROR_NOT_SUPPORTED if the persistent allocator doesn't support snapshots.
+    /// AXR_ERROR_UNKNOWN if the allocator couldn't be set up.
+    [[nodiscard]] AxrResult restoreSnapshot(const char* filePath, const Config& config);
+    /// Check if the allocator was set up from a snapshot
+    /// @return True if the allocator was set up from a snapshot
+    [[nodiscard]] bool isRestoredFromSnapshot() const;
+
+    /// Rebases every pointer within a restored snapshot root object
+    using RebaseSnapshotRoot_T = void (*)(const AxrSnapshotRebase& rebase, void* object);
+
+    /// Register an object that holds handles to persistent data, so it's saved with snapshots.
+    /// If the allocator was restored from a snapshot that holds this root, the object is restored to its saved state.
+    /// @param root Root to register
+    /// @param object Object to register. Must be empty and must outlive the allocator setup
+    /// @param size Size in bytes of the object. Must not exceed `MaxSnapshotRootSize`
+    /// @param rebaseRoot Function to rebase the object's pointers once it's restored
+    /// @return True if the object was restored from a snapshot, so the work to fill it can be skipped
+    [[nodiscard]] bool registerSnapshotRootObject(AxrSnapshotRootEnum root,
+                                                  void* object,
+                                                  size_t size,
+                                                  RebaseSnapshotRoot_T rebaseRoot);
+    /// Register an object that holds handles to persistent data, so it's saved with snapshots.
+    /// If the allocator was restored from a snapshot that holds this root, the object is restored to its saved state.
+    /// Its pointers are found with `axrForEachPointerSlot()`, so every type it holds must support that. Each piece of
+    /// persistent data must only be reachable from one root, or its pointers would be rebased twice.
+    /// @tparam Type Object type
+    /// @param root Root to register
+    /// @param object Object to register. Must be empty and must outlive the allocator setup
+    /// @return True if the object was restored from a snapshot, so the work to fill it can be skipped
+    template<typename Type>
+        requires(sizeof(Type) <= MaxSnapshotRootSize)
+    [[nodiscard]] bool registerSnapshotRoot(const AxrSnapshotRootEnum root, Type& object) {
+        const RebaseSnapshotRoot_T rebaseRoot = [](const AxrSnapshotRebase& rebase, void* rootObject) {
+            const auto rebasePointer = [&rebase](void* pointerSlot) {
+                axrRebaseSnapshotPointer(rebase, pointerSlot);
+            };
+            axrForEachPointerSlot(*static_cast<Type*>(rootObject), rebasePointer);
+        };
+
+        return registerSnapshotRootObject(root, static_cast<void*>(&object), sizeof(Type), rebaseRoot);
+    }
+
+#ifndef AXR_TLSF_ALLOCATOR_ENABLED
+    /// Get the progress of the most recent engine data allocator defragmentation step
+    /// @return The progress of the most recent engine data allocator defragmentation step
+    [[nodiscard]] const AxrDynamicAllocator::DefragmentProgress& getEngineDataDefragmentProgress() const;
+    /// Get the progress of the most recent debug info allocator defragmentation step
+    /// @return The progress of the most recent debug info allocator defragmentation step
+    [[nodiscard]] const AxrDynamicAllocator::DefragmentProgress& getDebugInfoDefragmentProgress() const;
+#endif
+
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    /// Get the peak usage of every allocator since setup
+    /// @return The peak usage of every allocator
+    [[nodiscard]] UsageProfile getUsageProfile() const;
+#endif
 
     /// Log all allocator's usage
     /// @param message Message to prefix log message with
@@ -106,44 +393,120 @@ public:
     /// Log the frame allocator's usage
     /// @param message Message to prefix log message with
     void logFrameAllocatorUsage(const char* message) const;
-    /// Log the handles allocator's usage
+    /// Log the handle table's usage
     /// @param message Message to prefix log message with
-    void logHandlesAllocatorUsage(const char* message) const;
+    void logHandleTableUsage(const char* message) const;
     /// Log the engine data allocator's usage
     /// @param message Message to prefix log message with
     void logEngineDataAllocatorUsage(const char* message) const;
-    /// Log the debug handles allocator's usage
+    /// Log the debug handle table's usage
     /// @param message Message to prefix log message with
-    void logDebugHandlesAllocatorUsage(const char* message) const;
+    void logDebugHandleTableUsage(const char* message) const;
     /// Log the debug info allocator's usage
     /// @param message Message to prefix log message with
     void logDebugInfoAllocatorUsage(const char* message) const;
+    /// Log every named arena's usage
+    /// @param message Message to prefix log message with
+    void logArenaUsage(const char* message) const;
 
 private:
+    // ----------------------------------------- //
+    // Private Structs
+    // ----------------------------------------- //
+
+    /// A registered snapshot root object
+    struct SnapshotRoot {
+        void* Object;
+        size_t Size;
+    };
+
+    /// A snapshot root object's saved state, waiting to be restored by `registerSnapshotRoot()`
+    struct RestoredSnapshotRoot {
+        alignas(std::max_align_t) uint8_t Data[MaxSnapshotRootSize];
+        size_t Size;
+    };
+
+    /// A named arena. Only the allocator that matches the arena type is set up
+    struct Arena {
+        AxrID_T ID;
+        char8_t Name[MaxArenaNameLength];
+        AxrArenaTypeEnum Type;
+        AxrHandleTable HandleTable;
+        AxrPersistentAllocator_T PersistentAllocator;
+        AxrStackAllocator StackAllocator;
+        AxrSceneArena SceneArena;
+    };
+
     // ----------------------------------------- //
     // Private Variables
     // ----------------------------------------- //
     void* m_Memory{};
     size_t m_MemorySize{};
+    Config m_Config{};
+    /// Offset from the start of `m_Memory` to the handle tables and persistent allocators.
+    /// Everything from here to the end of the persistent allocators is saved in snapshots
+    size_t m_PersistentMemoryOffset{};
+    size_t m_PersistentMemorySize{};
+    SnapshotRoot m_SnapshotRoots[AXR_SNAPSHOT_ROOT_END]{};
+    RestoredSnapshotRoot m_RestoredSnapshotRoots[AXR_SNAPSHOT_ROOT_END]{};
+    /// Where the restored snapshot's memory was saved from. Used to rebase snapshot roots as they're registered
+    AxrSnapshotRebase m_SnapshotRebase{};
+    bool m_IsRestoredFromSnapshot = false;
+    Arena m_Arenas[MaxArenaCount]{};
+    uint32_t m_ArenaCount{};
+    uint32_t m_WorkerThreadCount{};
+    std::atomic<uint32_t> m_RegisteredWorkerThreadCount{};
+    uint32_t m_FramesInFlight{};
+    uint32_t m_CurrentFrameInFlightIndex{};
+    /// Incremented on every setup and shut down so that thread frame allocator registrations from a previous setup
+    /// are ignored
+    uint32_t m_SetupGeneration{};
+    AxrDynamicAllocator::DefragmentBudget m_DefragmentBudget{};
+#ifndef AXR_TLSF_ALLOCATOR_ENABLED
+    AxrDynamicAllocator::DefragmentProgress m_EngineDataDefragmentProgress{};
+    AxrDynamicAllocator::DefragmentProgress m_DebugInfoDefragmentProgress{};
+#endif
+    bool m_IsPersistentRelocationLocked = false;
     bool m_IsSetup = false;
 
     // ----------------------------------------- //
     // Private Functions
     // ----------------------------------------- //
 
+    /// Check if the calling thread has a worker frame allocator from the current setup
+    /// @return True if the calling thread has a valid worker frame allocator
+    [[nodiscard]] bool isThreadFrameAllocatorValid() const;
+    /// Free the allocator memory and reset everything other than the sub-allocators
+    void releaseMemory();
+
+    /// Get the persistent memory that's saved in snapshots
+    /// @return The start of the persistent memory
+    [[nodiscard]] void* getPersistentMemory() const;
+    /// Find the named arena with the given ID
+    /// @param id Arena ID
+    /// @return The named arena. Or nullptr if there's no arena with the given ID
+    [[nodiscard]] Arena* findArena(AxrID_T id);
+    /// Find the named arena with the given ID
+    /// @param id Arena ID
+    /// @return The named arena. Or nullptr if there's no arena with the given ID
+    [[nodiscard]] const Arena* findArena(AxrID_T id) const;
+
     /// Callback function for when the frame allocator gets deallocated
     /// @param memory Frame allocator memory block to deallocate
     static void deallocateFrameAllocatorCallback(void*& memory);
-    /// Callback function for when the handles allocator gets deallocated
-    /// @param memory Handles allocator memory block to deallocate
-    static void deallocateHandlesAllocatorCallback(void*& memory);
+    /// Callback function for when the handle table gets deallocated
+    /// @param memory Handle table memory block to deallocate
+    static void deallocateHandleTableCallback(void*& memory);
     /// Callback function for when the engine data allocator gets deallocated
     /// @param memory Engine data allocator memory block to deallocate
     static void deallocateEngineDataAllocatorCallback(void*& memory);
-    /// Callback function for when the debug handles allocator gets deallocated
-    /// @param memory Debug handles allocator memory block to deallocate
-    static void deallocateDebugHandlesAllocatorCallback(void*& memory);
+    /// Callback function for when the debug handle table gets deallocated
+    /// @param memory Debug handle table memory block to deallocate
+    static void deallocateDebugHandleTableCallback(void*& memory);
     /// Callback function for when the debug info allocator gets deallocated
     /// @param memory Debug info allocator memory block to deallocate
     static void deallocateDebugInfoAllocatorCallback(void*& memory);
+    /// Callback function for when a named arena's handle table or allocator gets deallocated
+    /// @param memory Named arena memory block to deallocate
+    static void deallocateArenaCallback(void*& memory);
 };
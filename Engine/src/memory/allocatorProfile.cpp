@@ -0,0 +1,279 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "allocatorProfile.h"
+#include "axr/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <limits>
+#include <tomlc17.h>
+
+// ----------------------------------------- //
+// Static Helper Functions
+// ----------------------------------------- //
+
+/// Parse the given TOML file
+/// @param filePath TOML file path to read from
+/// @param tomlResult Output parse result. Must be freed with `toml_free()` if the function succeeded
+/// @return AXR_SUCCESS if the function succeeded.
+/// AXR_ERROR_NOT_FOUND if the file doesn't exist.
+/// AXR_ERROR_VALIDATION_FAILED if the file couldn't be parsed.
+static AxrResult parseTomlFile(const char* filePath, toml_result_t& tomlResult) {
+    std::FILE* file = std::fopen(filePath, "r");
+    if (file == nullptr) {
+        return AXR_ERROR_NOT_FOUND;
+    }
+
+    tomlResult = toml_parse_file(file);
+    std::fclose(file);
+
+    if (!tomlResult.ok) [[unlikely]] {
+        axrLogError("Failed to parse toml file: {}. {}", filePath, tomlResult.errmsg);
+        toml_free(tomlResult);
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    return AXR_SUCCESS;
+}
+
+/// Read an unsigned integer from the given TOML table.
+/// The value is left untouched if the key is missing, isn't an integer, or is out of range for the type.
+/// @tparam Type Unsigned integer type
+/// @param table TOML table to read from
+/// @param key Key to read
+/// @param value Output value
+template<typename Type>
+static void readTomlUInt(const toml_datum_t table, const char* key, Type& value) {
+    const toml_datum_t datum = toml_get(table, key);
+    if (datum.type != TOML_INT64) {
+        return;
+    }
+
+    if (datum.u.int64 < 0 || static_cast<uint64_t>(datum.u.int64) > std::numeric_limits<Type>::max()) [[unlikely]] {
+        axrLogWarning("Ignoring toml value for `{}`. {} is out of range.", key, datum.u.int64);
+        return;
+    }
+
+    value = static_cast<Type>(datum.u.int64);
+}
+
+/// Read a bool from the given TOML table. The value is left untouched if the key is missing or isn't a bool.
+/// @param table TOML table to read from
+/// @param key Key to read
+/// @param value Output value
+static void readTomlBool(const toml_datum_t table, const char* key, bool& value) {
+    const toml_datum_t datum = toml_get(table, key);
+    if (datum.type != TOML_BOOLEAN) {
+        return;
+    }
+
+    value = datum.u.boolean;
+}
+
+/// Get the budget for an allocator from its peak usage
+/// @tparam Type Unsigned integer type
+/// @param peak Recorded peak usage. 0 to keep the current budget
+/// @param headroomPercent Extra space to add on top of the peak, as a percentage of the peak
+/// @param minBudget Smallest budget to allow
+/// @param budget Budget to update
+template<typename Type>
+static void applyPeakToBudget(const Type peak, const uint32_t headroomPercent, const Type minBudget, Type& budget) {
+    if (peak == 0) {
+        return;
+    }
+
+    const uint64_t headroom = static_cast<uint64_t>(peak) * headroomPercent / 100;
+    const uint64_t newBudget = static_cast<uint64_t>(peak) + headroom;
+    if (newBudget > std::numeric_limits<Type>::max()) [[unlikely]] {
+        budget = std::numeric_limits<Type>::max();
+        return;
+    }
+
+    budget = newBudget < minBudget ? minBudget : static_cast<Type>(newBudget);
+}
+
+// ----------------------------------------- //
+// Internal Function Definitions
+// ----------------------------------------- //
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to load allocator profile. "
+AxrResult axrLoadAllocatorProfile(const char* filePath, AxrAllocator::UsageProfile& profile) {
+    assert(filePath != nullptr);
+
+    profile = {};
+
+    toml_result_t tomlResult;
+    const AxrResult axrResult = parseTomlFile(filePath, tomlResult);
+    if (AXR_FAILED(axrResult)) {
+        if (axrResult != AXR_ERROR_NOT_FOUND) [[unlikely]] {
+            axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to parse file.");
+        }
+        return axrResult;
+    }
+
+    const toml_datum_t table = toml_seek(tomlResult.toptab, "AllocatorProfile");
+    if (table.type == TOML_TABLE) [[likely]] {
+        readTomlUInt(table, "FrameAllocatorPeakSize", profile.FrameAllocatorPeakSize);
+        readTomlUInt(table, "WorkerFrameAllocatorPeakSize", profile.WorkerFrameAllocatorPeakSize);
+        readTomlUInt(table, "FrameInFlightAllocatorPeakSize", profile.FrameInFlightAllocatorPeakSize);
+        readTomlUInt(table, "PeakHandleCount", profile.PeakHandleCount);
+        readTomlUInt(table, "EngineDataAllocatorPeakSize", profile.EngineDataAllocatorPeakSize);
+        readTomlUInt(table, "PeakDebugHandleCount", profile.PeakDebugHandleCount);
+        readTomlUInt(table, "DebugInfoAllocatorPeakSize", profile.DebugInfoAllocatorPeakSize);
+    }
+
+    toml_free(tomlResult);
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to save allocator profile. "
+AxrResult axrSaveAllocatorProfile(const char* filePath, const AxrAllocator::UsageProfile& profile) {
+    assert(filePath != nullptr);
+
+    AxrAllocator::UsageProfile mergedProfile{};
+    if (AXR_FAILED(axrLoadAllocatorProfile(filePath, mergedProfile))) {
+        // Start fresh if there's no previous profile or it's unreadable
+        mergedProfile = {};
+    }
+
+    mergedProfile = AxrAllocator::UsageProfile{
+        .FrameAllocatorPeakSize = std::max(mergedProfile.FrameAllocatorPeakSize, profile.FrameAllocatorPeakSize),
+        .WorkerFrameAllocatorPeakSize =
+            std::max(mergedProfile.WorkerFrameAllocatorPeakSize, profile.WorkerFrameAllocatorPeakSize),
+        .FrameInFlightAllocatorPeakSize =
+            std::max(mergedProfile.FrameInFlightAllocatorPeakSize, profile.FrameInFlightAllocatorPeakSize),
+        .PeakHandleCount = std::max(mergedProfile.PeakHandleCount, profile.PeakHandleCount),
+        .EngineDataAllocatorPeakSize =
+            std::max(mergedProfile.EngineDataAllocatorPeakSize, profile.EngineDataAllocatorPeakSize),
+        .PeakDebugHandleCount = std::max(mergedProfile.PeakDebugHandleCount, profile.PeakDebugHandleCount),
+        .DebugInfoAllocatorPeakSize =
+            std::max(mergedProfile.DebugInfoAllocatorPeakSize, profile.DebugInfoAllocatorPeakSize),
+    };
+
+    std::FILE* file = std::fopen(filePath, "w");
+    if (file == nullptr) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to open file: {}.", filePath);
+        return AXR_ERROR_UNKNOWN;
+    }
+
+    std::fputs("# Peak allocator usage across all recorded sessions. Used to size the allocator budgets on startup.\n"
+               "# Delete this file to start recording again from scratch.\n"
+               "[AllocatorProfile]\n",
+               file);
+    std::fprintf(file,
+                 "FrameAllocatorPeakSize = %llu\n",
+                 static_cast<unsigned long long>(mergedProfile.FrameAllocatorPeakSize));
+    std::fprintf(file,
+                 "WorkerFrameAllocatorPeakSize = %llu\n",
+                 static_cast<unsigned long long>(mergedProfile.WorkerFrameAllocatorPeakSize));
+    std::fprintf(file,
+                 "FrameInFlightAllocatorPeakSize = %llu\n",
+                 static_cast<unsigned long long>(mergedProfile.FrameInFlightAllocatorPeakSize));
+    std::fprintf(file, "PeakHandleCount = %u\n", mergedProfile.PeakHandleCount);
+    std::fprintf(file,
+                 "EngineDataAllocatorPeakSize = %llu\n",
+                 static_cast<unsigned long long>(mergedProfile.EngineDataAllocatorPeakSize));
+    std::fprintf(file, "PeakDebugHandleCount = %u\n", mergedProfile.PeakDebugHandleCount);
+    std::fprintf(file,
+                 "DebugInfoAllocatorPeakSize = %llu\n",
+                 static_cast<unsigned long long>(mergedProfile.DebugInfoAllocatorPeakSize));
+
+    if (std::fclose(file) != 0) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to write file: {}.", filePath);
+        return AXR_ERROR_UNKNOWN;
+    }
+
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+void axrApplyAllocatorProfile(const AxrAllocator::UsageProfile& profile,
+                              const uint32_t headroomPercent,
+                              AxrAllocator::Config& config) {
+    applyPeakToBudget(
+        profile.FrameAllocatorPeakSize, headroomPercent, AxrAllocatorProfileMinBudgetSize, config.FrameAllocatorSize);
+    applyPeakToBudget(profile.WorkerFrameAllocatorPeakSize,
+                      headroomPercent,
+                      AxrAllocatorProfileMinBudgetSize,
+                      config.WorkerFrameAllocatorSize);
+    applyPeakToBudget(profile.FrameInFlightAllocatorPeakSize,
+                      headroomPercent,
+                      AxrAllocatorProfileMinBudgetSize,
+                      config.FrameInFlightAllocatorSize);
+    applyPeakToBudget(
+        profile.PeakHandleCount, headroomPercent, AxrAllocatorProfileMinHandleCount, config.MaxHandleCount);
+    applyPeakToBudget(profile.EngineDataAllocatorPeakSize,
+                      headroomPercent,
+                      AxrAllocatorProfileMinBudgetSize,
+                      config.EngineDataAllocatorMainMemorySize);
+    applyPeakToBudget(
+        profile.PeakDebugHandleCount, headroomPercent, AxrAllocatorProfileMinHandleCount, config.MaxDebugHandleCount);
+    applyPeakToBudget(profile.DebugInfoAllocatorPeakSize,
+                      headroomPercent,
+                      AxrAllocatorProfileMinBudgetSize,
+                      config.DebugInfoAllocatorMainMemorySize);
+}
+
+bool axrUseSnapshotAllocatorBudgets(const AxrAllocator::Config& snapshotConfig, AxrAllocator::Config& config) {
+    // Everything else that isn't a budget doesn't change the memory layout, so it keeps the value from the given config
+    const bool doSettingsMatch = snapshotConfig.WorkerThreadCount == config.WorkerThreadCount &&
+                                 snapshotConfig.FramesInFlight == config.FramesInFlight;
+    const bool doBudgetsFit =
+        snapshotConfig.FrameAllocatorSize >= config.FrameAllocatorSize &&
+        snapshotConfig.WorkerFrameAllocatorSize >= config.WorkerFrameAllocatorSize &&
+        snapshotConfig.FrameInFlightAllocatorSize >= config.FrameInFlightAllocatorSize &&
+        snapshotConfig.MaxHandleCount >= config.MaxHandleCount &&
+        snapshotConfig.EngineDataAllocatorMainMemorySize >= config.EngineDataAllocatorMainMemorySize &&
+        snapshotConfig.MaxDebugHandleCount >= config.MaxDebugHandleCount &&
+        snapshotConfig.DebugInfoAllocatorMainMemorySize >= config.DebugInfoAllocatorMainMemorySize;
+    if (!doSettingsMatch || !doBudgetsFit) {
+        return false;
+    }
+
+    config.FrameAllocatorSize = snapshotConfig.FrameAllocatorSize;
+    config.WorkerFrameAllocatorSize = snapshotConfig.WorkerFrameAllocatorSize;
+    config.FrameInFlightAllocatorSize = snapshotConfig.FrameInFlightAllocatorSize;
+    config.MaxHandleCount = snapshotConfig.MaxHandleCount;
+    config.EngineDataAllocatorMainMemorySize = snapshotConfig.EngineDataAllocatorMainMemorySize;
+    config.MaxDebugHandleCount = snapshotConfig.MaxDebugHandleCount;
+    config.DebugInfoAllocatorMainMemorySize = snapshotConfig.DebugInfoAllocatorMainMemorySize;
+    return true;
+}
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to load allocator config overrides. "
+AxrResult axrLoadAllocatorConfigOverrides(const char* filePath, AxrAllocator::Config& config) {
+    assert(filePath != nullptr);
+
+    toml_result_t tomlResult;
+    const AxrResult axrResult = parseTomlFile(filePath, tomlResult);
+    if (AXR_FAILED(axrResult)) {
+        if (axrResult != AXR_ERROR_NOT_FOUND) [[unlikely]] {
+            axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to parse file.");
+        }
+        return axrResult;
+    }
+
+    const toml_datum_t table = toml_seek(tomlResult.toptab, "Allocator");
+    if (table.type == TOML_TABLE) [[likely]] {
+        readTomlUInt(table, "FrameAllocatorSize", config.FrameAllocatorSize);
+        readTomlUInt(table, "WorkerThreadCount", config.WorkerThreadCount);
+        readTomlUInt(table, "WorkerFrameAllocatorSize", config.WorkerFrameAllocatorSize);
+        readTomlUInt(table, "FramesInFlight", config.FramesInFlight);
+        readTomlUInt(table, "FrameInFlightAllocatorSize", config.FrameInFlightAllocatorSize);
+        readTomlUInt(table, "MaxHandleCount", config.MaxHandleCount);
+        readTomlUInt(table, "EngineDataAllocatorMainMemorySize", config.EngineDataAllocatorMainMemorySize);
+        readTomlUInt(table, "MaxDebugHandleCount", config.MaxDebugHandleCount);
+        readTomlUInt(table, "DebugInfoAllocatorMainMemorySize", config.DebugInfoAllocatorMainMemorySize);
+        readTomlUInt(table, "DefragmentMicrosecondsPerFrame", config.DefragmentMicrosecondsPerFrame);
+        readTomlUInt(table, "DefragmentBytesPerFrame", config.DefragmentBytesPerFrame);
+        readTomlBool(table, "UseHugePages", config.UseHugePages);
+        readTomlBool(table, "PrefaultFrameAllocators", config.PrefaultFrameAllocators);
+    }
+
+    toml_free(tomlResult);
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
@@ -0,0 +1,57 @@
+#pragma once
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "allocator.h"
+
+// ----------------------------------------- //
+// Internal Constants
+// ----------------------------------------- //
+
+/// Smallest size in bytes an allocator budget can be tuned down to
+constexpr size_t AxrAllocatorProfileMinBudgetSize = 4'096;
+/// Smallest handle count a handle table budget can be tuned down to
+constexpr uint32_t AxrAllocatorProfileMinHandleCount = 64;
+
+// ----------------------------------------- //
+// Internal Functions
+// ----------------------------------------- //
+
+/// Load an allocator usage profile that was written by `axrSaveAllocatorProfile()`
+/// @param filePath TOML file path to read from
+/// @param profile Output profile. Any values missing from the file are set to 0
+/// @return AXR_SUCCESS if the function succeeded.
+/// AXR_ERROR_NOT_FOUND if the file doesn't exist.
+[[nodiscard]] AxrResult axrLoadAllocatorProfile(const char* filePath, AxrAllocator::UsageProfile& profile);
+/// Save an allocator usage profile. If the file already holds a profile, each value is merged with it by keeping
+/// the highest peak, so a single light session never shrinks the budgets. Delete the file to start over.
+/// @param filePath TOML file path to write to
+/// @param profile Profile to save
+/// @return AXR_SUCCESS if the function succeeded
+[[nodiscard]] AxrResult axrSaveAllocatorProfile(const char* filePath, const AxrAllocator::UsageProfile& profile);
+/// Size each allocator budget in the given config from its recorded peak plus headroom.
+/// Budgets without a recorded peak keep their current value.
+/// @param profile Allocator usage profile to use
+/// @param headroomPercent Extra space to add on top of each peak, as a percentage of the peak
+/// @param config Allocator config to update
+void axrApplyAllocatorProfile(const AxrAllocator::UsageProfile& profile,
+                              uint32_t headroomPercent,
+                              AxrAllocator::Config& config);
+/// Use the budgets an allocator snapshot was saved with, if they have room for every budget in the given config.
+/// The profile moves the budgets a little every session, so requiring an exact match would throw the snapshot away on
+/// almost every startup. Settings that aren't budgets but change the memory layout must match exactly. Everything else,
+/// like the defragment budgets and high water marks, keeps the value from the given config.
+/// @param snapshotConfig Allocator config the snapshot was saved with
+/// @param config Allocator config to update. Left as is if the snapshot budgets don't fit
+/// @return True if the snapshot budgets fit and were copied to the config
+[[nodiscard]] bool axrUseSnapshotAllocatorBudgets(const AxrAllocator::Config& snapshotConfig,
+                                                  AxrAllocator::Config& config);
+/// Load allocator config overrides from the `[Allocator]` table of a TOML file.
+/// Keys match the `AxrAllocator::Config` member names. Any keys missing from the file keep their current value.
+/// @param filePath TOML file path to read from
+/// @param config Allocator config to update
+/// @return AXR_SUCCESS if the function succeeded.
+/// AXR_ERROR_NOT_FOUND if the file doesn't exist.
+/// AXR_ERROR_VALIDATION_FAILED if the file couldn't be parsed.
+[[nodiscard]] AxrResult axrLoadAllocatorConfigOverrides(const char* filePath, AxrAllocator::Config& config);
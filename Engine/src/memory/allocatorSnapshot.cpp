@@ -0,0 +1,258 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "allocatorSnapshot.h"
+
+#include <cassert>
+#include <cstring>
+
+#ifdef AXR_PLATFORM_WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <link.h>
+#endif
+
+// ----------------------------------------- //
+// Static Helper Functions
+// ----------------------------------------- //
+
+/// Rebase the given address if it falls within the old address range
+/// @param range Address range to use
+/// @param address Address to rebase
+/// @return True if the address was within the old range
+static bool rebaseAddress(const AxrSnapshotAddressRange& range, uintptr_t& address) {
+    if (address - range.OldAddress >= range.Size) {
+        return false;
+    }
+
+    address = address - range.OldAddress + range.NewAddress;
+    return true;
+}
+
+#ifdef AXR_PLATFORM_WIN32
+/// Find the module that holds the given address
+/// @param address Any address within the module
+/// @return The module's base address. Or nullptr if the module wasn't found
+static const uint8_t* findModule(const void* address) {
+    HMODULE module = nullptr;
+    if (!GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                            static_cast<LPCWSTR>(address),
+                            &module)) [[unlikely]] {
+        return nullptr;
+    }
+
+    return reinterpret_cast<const uint8_t*>(module);
+}
+
+/// Get the NT headers of the given module
+/// @param module Module base address
+/// @return The module's NT headers
+static const IMAGE_NT_HEADERS* getModuleHeaders(const uint8_t* module) {
+    const auto* dosHeader = reinterpret_cast<const IMAGE_DOS_HEADER*>(module);
+    return reinterpret_cast<const IMAGE_NT_HEADERS*>(module + dosHeader->e_lfanew);
+}
+#else
+/// Image search info for `dl_iterate_phdr()`
+struct ImageSearch {
+    uintptr_t Address;
+    uintptr_t ImageAddress;
+    size_t ImageSize;
+    /// Optional output build ID. Only searched for if this isn't nullptr
+    AxrImageBuildID* BuildID;
+    bool WasFound;
+};
+
+/// Round the given note field size up to the note alignment
+/// @param size Field size in bytes
+/// @param alignment Note alignment. Either 4 or 8
+/// @return The aligned size
+static size_t alignNoteSize(const size_t size, const size_t alignment) {
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+/// Find the GNU build ID note in the given image
+/// @param info Image info
+/// @param buildID Output build ID
+/// @return True if the build ID was found
+static bool findBuildIDNote(const dl_phdr_info* info, AxrImageBuildID& buildID) {
+    constexpr char noteName[] = "GNU";
+
+    for (ElfW(Half) i = 0; i < info->dlpi_phnum; ++i) {
+        const ElfW(Phdr)& programHeader = info->dlpi_phdr[i];
+        if (programHeader.p_type != PT_NOTE) {
+            continue;
+        }
+
+        // 64 bit notes can be 8 byte aligned, such as the GNU property note. Everything else is 4 byte aligned
+        const size_t noteAlignment = programHeader.p_align == 8 ? 8 : 4;
+        const auto* note = reinterpret_cast<const uint8_t*>(info->dlpi_addr + programHeader.p_vaddr);
+        const uint8_t* notesEnd = note + programHeader.p_memsz;
+        while (note + sizeof(ElfW(Nhdr)) <= notesEnd) {
+            ElfW(Nhdr) noteHeader;
+            std::memcpy(&noteHeader, note, sizeof(noteHeader));
+
+            const uint8_t* name = note + sizeof(noteHeader);
+            const uint8_t* description = name + alignNoteSize(noteHeader.n_namesz, noteAlignment);
+            const uint8_t* nextNote = description + alignNoteSize(noteHeader.n_descsz, noteAlignment);
+            if (nextNote > notesEnd) [[unlikely]] {
+                break;
+            }
+
+            if (noteHeader.n_type == NT_GNU_BUILD_ID && noteHeader.n_namesz == sizeof(noteName) &&
+                std::memcmp(name, noteName, sizeof(noteName)) == 0 && noteHeader.n_descsz != 0 &&
+                noteHeader.n_descsz <= AxrMaxImageBuildIDSize) {
+                std::memcpy(buildID.Data, description, noteHeader.n_descsz);
+                buildID.Size = noteHeader.n_descsz;
+                return true;
+            }
+
+            note = nextNote;
+        }
+    }
+
+    return false;
+}
+
+/// `dl_iterate_phdr()` callback. Checks if the given image holds the address being searched for
+/// @param info Image info
+/// @param size Size of the image info struct
+/// @param data The `ImageSearch` to use
+/// @return 1 to stop iterating once the image has been found
+static int findImageCallback(dl_phdr_info* info, [[maybe_unused]] size_t size, void* data) {
+    auto* search = static_cast<ImageSearch*>(data);
+
+    uintptr_t startAddress = UINTPTR_MAX;
+    uintptr_t endAddress = 0;
+    bool holdsAddress = false;
+    for (ElfW(Half) i = 0; i < info->dlpi_phnum; ++i) {
+        const ElfW(Phdr)& programHeader = info->dlpi_phdr[i];
+        if (programHeader.p_type != PT_LOAD) {
+            continue;
+        }
+
+        const uintptr_t segmentAddress = info->dlpi_addr + programHeader.p_vaddr;
+        const uintptr_t segmentEndAddress = segmentAddress + programHeader.p_memsz;
+        if (segmentAddress < startAddress) {
+            startAddress = segmentAddress;
+        }
+        if (segmentEndAddress > endAddress) {
+            endAddress = segmentEndAddress;
+        }
+        if (search->Address >= segmentAddress && search->Address < segmentEndAddress) {
+            holdsAddress = true;
+        }
+    }
+
+    if (!holdsAddress) {
+        return 0;
+    }
+
+    search->ImageAddress = startAddress;
+    search->ImageSize = endAddress - startAddress;
+    search->WasFound = search->BuildID == nullptr || findBuildIDNote(info, *search->BuildID);
+    return 1;
+}
+#endif
+
+// ----------------------------------------- //
+// Internal Function Definitions
+// ----------------------------------------- //
+
+bool axrGetImageAddressRange(const void* address, uintptr_t& imageAddress, size_t& imageSize) {
+#ifdef AXR_PLATFORM_WIN32
+    const uint8_t* module = findModule(address);
+    if (module == nullptr) [[unlikely]] {
+        return false;
+    }
+
+    imageAddress = reinterpret_cast<uintptr_t>(module);
+    imageSize = getModuleHeaders(module)->OptionalHeader.SizeOfImage;
+    return true;
+#else
+    ImageSearch search{
+        .Address = reinterpret_cast<uintptr_t>(address),
+        .ImageAddress = 0,
+        .ImageSize = 0,
+        .BuildID = nullptr,
+        .WasFound = false,
+    };
+    dl_iterate_phdr(findImageCallback, &search);
+    if (!search.WasFound) [[unlikely]] {
+        return false;
+    }
+
+    imageAddress = search.ImageAddress;
+    imageSize = search.ImageSize;
+    return true;
+#endif
+}
+
+bool axrGetImageBuildID(const void* address, AxrImageBuildID& buildID) {
+#ifdef AXR_PLATFORM_WIN32
+    /// CodeView debug info that links the image to its PDB. Every link gives it a new signature
+    struct CodeViewInfo {
+        uint32_t Format;
+        uint8_t Signature[16];
+        uint32_t Age;
+    };
+    /// "RSDS" in little endian
+    constexpr uint32_t codeViewFormat = 0x53445352;
+
+    const uint8_t* module = findModule(address);
+    if (module == nullptr) [[unlikely]] {
+        return false;
+    }
+
+    const IMAGE_DATA_DIRECTORY& debugDirectory =
+        getModuleHeaders(module)->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_DEBUG];
+    const auto* debugEntries = reinterpret_cast<const IMAGE_DEBUG_DIRECTORY*>(module + debugDirectory.VirtualAddress);
+    const size_t debugEntryCount = debugDirectory.Size / sizeof(IMAGE_DEBUG_DIRECTORY);
+    for (size_t i = 0; i < debugEntryCount; ++i) {
+        const IMAGE_DEBUG_DIRECTORY& debugEntry = debugEntries[i];
+        if (debugEntry.Type != IMAGE_DEBUG_TYPE_CODEVIEW || debugEntry.AddressOfRawData == 0 ||
+            debugEntry.SizeOfData < sizeof(CodeViewInfo)) {
+            continue;
+        }
+
+        CodeViewInfo codeViewInfo;
+        std::memcpy(&codeViewInfo, module + debugEntry.AddressOfRawData, sizeof(codeViewInfo));
+        if (codeViewInfo.Format != codeViewFormat) {
+            continue;
+        }
+
+        static_assert(sizeof(codeViewInfo.Signature) + sizeof(codeViewInfo.Age) <= AxrMaxImageBuildIDSize);
+        std::memcpy(buildID.Data, codeViewInfo.Signature, sizeof(codeViewInfo.Signature));
+        std::memcpy(buildID.Data + sizeof(codeViewInfo.Signature), &codeViewInfo.Age, sizeof(codeViewInfo.Age));
+        buildID.Size = sizeof(codeViewInfo.Signature) + sizeof(codeViewInfo.Age);
+        return true;
+    }
+
+    return false;
+#else
+    ImageSearch search{
+        .Address = reinterpret_cast<uintptr_t>(address),
+        .ImageAddress = 0,
+        .ImageSize = 0,
+        .BuildID = &buildID,
+        .WasFound = false,
+    };
+    dl_iterate_phdr(findImageCallback, &search);
+    return search.WasFound;
+#endif
+}
+
+bool axrIsSnapshotRebaseNeeded(const AxrSnapshotRebase& rebase) {
+    return rebase.Arena.OldAddress != rebase.Arena.NewAddress || rebase.Image.OldAddress != rebase.Image.NewAddress;
+}
+
+void axrRebaseSnapshotPointer(const AxrSnapshotRebase& rebase, void* pointerSlot) {
+    assert(pointerSlot != nullptr);
+
+    uintptr_t address;
+    std::memcpy(&address, pointerSlot, sizeof(address));
+
+    if (rebaseAddress(rebase.Arena, address) || rebaseAddress(rebase.Image, address)) {
+        std::memcpy(pointerSlot, &address, sizeof(address));
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include <cstddef>
+#include <cstdint>
+
+// ----------------------------------------- //
+// Constants
+// ----------------------------------------- //
+
+/// The max size in bytes of an image build ID. GNU build IDs are 20 bytes by default. PDB signatures are 20 bytes
+constexpr size_t AxrMaxImageBuildIDSize = 32;
+
+// ----------------------------------------- //
+// Internal Structs
+// ----------------------------------------- //
+
+/// A range of addresses that moved between the process that saved a snapshot and the one restoring it
+struct AxrSnapshotAddressRange {
+    /// Start of the range in the process that saved the snapshot
+    uintptr_t OldAddress;
+    /// Start of the range in this process
+    uintptr_t NewAddress;
+    /// Size in bytes of the range
+    size_t Size;
+};
+
+/// Everything needed to rebase pointers from a snapshot to this process.
+/// Snapshot data can point into the allocator memory, like handles pointing at their handle table slot. Or into the
+/// engine image, like allocator pointers and callback functions.
+struct AxrSnapshotRebase {
+    AxrSnapshotAddressRange Arena;
+    AxrSnapshotAddressRange Image;
+};
+
+/// Unique ID the linker gave a built executable or shared library
+struct AxrImageBuildID {
+    uint8_t Data[AxrMaxImageBuildIDSize];
+    /// Size in bytes of the ID within `Data`
+    uint32_t Size;
+};
+
+// ----------------------------------------- //
+// Internal Functions
+// ----------------------------------------- //
+
+/// Get the address range of the loaded executable or shared library that holds the given address
+/// @param address Any address within the image. E.g. a function or a static variable
+/// @param imageAddress Output start address of the image
+/// @param imageSize Output size in bytes of the image
+/// @return True if the image was found
+[[nodiscard]] bool axrGetImageAddressRange(const void* address, uintptr_t& imageAddress, size_t& imageSize);
+/// Get the build ID of the loaded executable or shared library that holds the given address.
+/// This is the GNU build ID note on Linux and the PDB signature on Windows.
+/// @param address Any address within the image. E.g. a function or a static variable
+/// @param buildID Output build ID
+/// @return True if the image was found and the linker gave it a build ID
+[[nodiscard]] bool axrGetImageBuildID(const void* address, AxrImageBuildID& buildID);
+
+/// Check if any pointers need to be rebased
+/// @param rebase Rebase info to use
+/// @return True if either the arena or the image has moved
+[[nodiscard]] bool axrIsSnapshotRebaseNeeded(const AxrSnapshotRebase& rebase);
+/// Rebase a single pointer if it points into the old arena or old image. Pointers to anywhere else are left as is
+/// @param rebase Rebase info to use
+/// @param pointerSlot Address of the pointer to rebase
+void axrRebaseSnapshotPointer(const AxrSnapshotRebase& rebase, void* pointerSlot);
@@ -0,0 +1,539 @@
+#pragma once
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "../utils.h"
+#include "axr/common/enums.h"
+#include "axr/logging.h"
+#include "subAllocatorBase.h"
+#include "types.h"
+
+#include <atomic>
+#include <cassert>
+
+// ---------------------------------------------------------------------------------- //
+//                         AxrConcurrentPoolAllocatorChunk                            //
+// ---------------------------------------------------------------------------------- //
+
+/// A single chunk within an AxrConcurrentPoolAllocator.
+/// Big enough to hold either a `Type` or the index of the next free chunk.
+/// @tparam Type The type of object the pool holds
+template<typename Type>
+struct alignas(alignof(Type) > alignof(uint32_t) ? alignof(Type) : alignof(uint32_t))
+    AxrConcurrentPoolAllocatorChunk {
+    std::byte Data[sizeof(Type) > sizeof(uint32_t) ? sizeof(Type) : sizeof(uint32_t)];
+};
+
+// ---------------------------------------------------------------------------------- //
+//                            AxrConcurrentPoolAllocator                              //
+// ---------------------------------------------------------------------------------- //
+
+/// Pool Allocator that can be allocated from and deallocated to from multiple threads at once.
+/// Free chunks are chained together by index, the same as `AxrPoolAllocator` for small types. The head of the chain is
+/// a single atomic that holds both the head index and a tag which is incremented on every change. That way a thread
+/// can't swap the head based on a stale read after another thread has popped and pushed the same chunk (ABA problem).
+///
+/// Threads that allocate a lot can use a `Magazine` to cache chunks locally and only touch the shared free list in
+/// batches.
+/// @tparam Type The type of object this pool holds
+template<typename Type>
+class AxrConcurrentPoolAllocator : public AxrSubAllocatorBase_Aligned<AxrConcurrentPoolAllocatorChunk<Type>> {
+    using Chunk_T = AxrConcurrentPoolAllocatorChunk<Type>;
+    using Base_T = AxrSubAllocatorBase_Aligned<Chunk_T>;
+
+public:
+    // ----------------------------------------- //
+    // Special Functions
+    // ----------------------------------------- //
+
+    // ---- Constructors ----
+
+    /// Default Constructor
+    AxrConcurrentPoolAllocator() = default;
+
+    /// Constructor
+    /// @param memoryBlock Memory block to use
+    explicit AxrConcurrentPoolAllocator(const AxrMemoryBlock& memoryBlock) :
+        Base_T(memoryBlock) {
+        assert(AxrSubAllocatorBase::m_Capacity % sizeof(Chunk_T) == 0);
+
+        m_ChunkCapacity = AxrSubAllocatorBase::m_Capacity / sizeof(Chunk_T);
+        assert(m_ChunkCapacity < NullIndex);
+
+        chainAllChunks();
+    }
+
+    /// Copy Constructor
+    /// @param src Source AxrConcurrentPoolAllocator to copy from
+    AxrConcurrentPoolAllocator(const AxrConcurrentPoolAllocator& src) = delete;
+
+    /// Move Constructor
+    /// @param src Source AxrConcurrentPoolAllocator to move from
+    AxrConcurrentPoolAllocator(AxrConcurrentPoolAllocator&& src) noexcept :
+        Base_T(std::move(src)) {
+        move_internal(std::move(src), true);
+    }
+
+    // ---- Destructor ----
+
+    /// Destructor
+    ~AxrConcurrentPoolAllocator() {
+        cleanup();
+    }
+
+    // ---- Operator Overloads ----
+
+    /// Copy Assignment Operator
+    /// @param src Source AxrConcurrentPoolAllocator to copy from
+    AxrConcurrentPoolAllocator& operator=(const AxrConcurrentPoolAllocator& src) = delete;
+
+    /// Move Assignment Operator
+    /// @param src Source AxrConcurrentPoolAllocator to move from
+    AxrConcurrentPoolAllocator& operator=(AxrConcurrentPoolAllocator&& src) noexcept {
+        if (this != &src) {
+            cleanup();
+
+            Base_T::operator=(std::move(src));
+
+            move_internal(std::move(src), false);
+        }
+        return *this;
+    }
+
+    // ----------------------------------------- //
+    // Magazine
+    // ----------------------------------------- //
+
+    /// A per thread cache of free chunks.
+    /// Allocations and deallocations only touch the shared free list when the magazine is empty or full, and then move
+    /// half a magazine worth of chunks at once. A magazine must only be used by one thread at a time.
+    /// Any cached chunks are given back to the pool when the magazine is destroyed.
+    class Magazine {
+    public:
+        // ----------------------------------------- //
+        // Special Functions
+        // ----------------------------------------- //
+
+        // ---- Constructors ----
+
+        /// Constructor
+        /// @param pool The pool to cache chunks from
+        explicit Magazine(AxrConcurrentPoolAllocator* pool) :
+            m_Pool(pool) {
+            assert(m_Pool != nullptr);
+        }
+
+        /// Copy Constructor
+        /// @param src Source Magazine to copy from
+        Magazine(const Magazine& src) = delete;
+        /// Move Constructor
+        /// @param src Source Magazine to move from
+        Magazine(Magazine&& src) noexcept = delete;
+
+        // ---- Destructor ----
+
+        /// Destructor
+        ~Magazine() {
+            flush();
+        }
+
+        // ---- Operator Overloads ----
+
+        /// Copy Assignment Operator
+        /// @param src Source Magazine to copy from
+        Magazine& operator=(const Magazine& src) = delete;
+        /// Move Assignment Operator
+        /// @param src Source Magazine to move from
+        Magazine& operator=(Magazine&& src) noexcept = delete;
+
+        // ----------------------------------------- //
+        // Public Functions
+        // ----------------------------------------- //
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to allocate memory for AxrConcurrentPoolAllocator::Magazine. "
+        /// Allocate new memory from the magazine, refilling it from the pool if it's empty
+        /// @param memory Output allocated memory
+        /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+        /// @return AXR_SUCCESS if the function succeeded.
+        /// AXR_ERROR_OUT_OF_MEMORY if there isn't any free memory in the pool.
+        [[nodiscard]] AxrResult allocate(Type*& memory, const bool zeroOutMemory = false) {
+            if (m_ChunkCount == 0) [[unlikely]] {
+                refill();
+
+                if (m_ChunkCount == 0) [[unlikely]] {
+                    axrLogError(AXR_FUNCTION_FAILED_STRING "Ran out of chunks to allocate.");
+                    return AXR_ERROR_OUT_OF_MEMORY;
+                }
+            }
+
+            Type* chunk = m_Pool->ptrAt(m_ChunkIndices[--m_ChunkCount]);
+
+            if (zeroOutMemory) {
+                std::memset(static_cast<void*>(chunk), 0, sizeof(Type));
+            }
+
+            memory = chunk;
+            return AXR_SUCCESS;
+        }
+#undef AXR_FUNCTION_FAILED_STRING
+
+        /// Return the given memory back to the magazine, flushing half of the magazine back to the pool if it's full
+        /// @param memory Memory to return
+        void deallocate(Type*& memory) {
+            if (!m_Pool->ownsMemory(memory)) [[unlikely]] {
+                axrLogWarning("Attempted to deallocate data that isn't from this pool allocator.");
+                return;
+            }
+
+            axrCallDestructor(*memory);
+
+            if (m_ChunkCount == Capacity) [[unlikely]] {
+                flush(Capacity / 2);
+            }
+
+            m_ChunkIndices[m_ChunkCount++] = m_Pool->indexOf(memory);
+            memory = nullptr;
+        }
+
+        /// Give all cached chunks back to the pool
+        void flush() {
+            flush(m_ChunkCount);
+        }
+
+        /// Get the number of free chunks currently cached in this magazine
+        /// @return The number of free chunks currently cached in this magazine
+        [[nodiscard]] uint32_t size() const {
+            return m_ChunkCount;
+        }
+
+        /// The max number of free chunks a magazine can cache
+        static constexpr uint32_t Capacity = 32;
+
+    private:
+        // ----------------------------------------- //
+        // Private Variables
+        // ----------------------------------------- //
+        AxrConcurrentPoolAllocator* m_Pool;
+        uint32_t m_ChunkIndices[Capacity]{};
+        uint32_t m_ChunkCount{};
+
+        // ----------------------------------------- //
+        // Private Functions
+        // ----------------------------------------- //
+
+        /// Take up to half a magazine worth of chunks from the pool
+        void refill() {
+            uint32_t chunkIndex = NullIndex;
+            m_ChunkCount = m_Pool->popChain(Capacity / 2, chunkIndex);
+
+            // The popped chain belongs to this thread now, so it's safe to walk it
+            for (uint32_t i = 0; i < m_ChunkCount; ++i) {
+                m_ChunkIndices[i] = chunkIndex;
+                chunkIndex = m_Pool->loadNextIndex(chunkIndex);
+            }
+        }
+
+        /// Give the given number of most recently cached chunks back to the pool
+        /// @param chunkCount Number of chunks to give back
+        void flush(const uint32_t chunkCount) {
+            if (chunkCount == 0) {
+                return;
+            }
+
+            const uint32_t firstIndex = m_ChunkCount - chunkCount;
+            for (uint32_t i = firstIndex; i < m_ChunkCount - 1; ++i) {
+                m_Pool->storeNextIndex(m_ChunkIndices[i], m_ChunkIndices[i + 1]);
+            }
+
+            m_Pool->pushChain(m_ChunkIndices[firstIndex], m_ChunkIndices[m_ChunkCount - 1], chunkCount);
+            m_ChunkCount = firstIndex;
+        }
+    };
+
+    // ----------------------------------------- //
+    // Public Functions
+    // ----------------------------------------- //
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to allocate memory for AxrConcurrentPoolAllocator. "
+    /// Allocate new memory from the pool. Safe to call from multiple threads at once.
+    /// @param memory Output allocated memory
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't any free memory in the pool.
+    [[nodiscard]] AxrResult allocate(Type*& memory, const bool zeroOutMemory = false) {
+        uint32_t chunkIndex = NullIndex;
+        if (popChain(1, chunkIndex) == 0) [[unlikely]] {
+            axrLogError(AXR_FUNCTION_FAILED_STRING "Ran out of chunks to allocate.");
+            return AXR_ERROR_OUT_OF_MEMORY;
+        }
+
+        Type* chunk = ptrAt(chunkIndex);
+
+        if (zeroOutMemory) {
+            std::memset(static_cast<void*>(chunk), 0, sizeof(Type));
+        }
+
+        memory = chunk;
+        return AXR_SUCCESS;
+    }
+#undef AXR_FUNCTION_FAILED_STRING
+
+    /// Return the given memory back to the pool. Safe to call from multiple threads at once.
+    /// @param memory Memory to return to the pool
+    void deallocate(Type*& memory) {
+        // If the given data isn't part of the memory we manage, don't do anything with it
+        if (!ownsMemory(memory)) [[unlikely]] {
+            axrLogWarning("Attempted to deallocate data that isn't from this pool allocator.");
+            return;
+        }
+
+        axrCallDestructor(*memory);
+
+        const uint32_t chunkIndex = indexOf(memory);
+        pushChain(chunkIndex, chunkIndex, 1);
+        memory = nullptr;
+    }
+
+    /// Clear the pool and mark all chunks as free.
+    /// Must not be called while other threads or magazines are using the pool.
+    void clear() {
+        chainAllChunks();
+    }
+
+    /// Get the max number of chunks this allocator can hold
+    /// @return The max number of chunks this allocator can hold
+    [[nodiscard]] size_t chunkCapacity() const {
+        return m_ChunkCapacity;
+    }
+
+    /// Get the number of chunks currently in use. This includes chunks cached in magazines.
+    /// @return the number of chunks currently in use
+    [[nodiscard]] size_t size() const {
+        return m_UsedChunkCount.load(std::memory_order_relaxed);
+    }
+
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    /// Get the peak number of chunks in use at one time
+    /// @return the peak number of chunks in use at one time
+    [[nodiscard]] size_t peakChunkCount() const {
+        return m_PeakUsedChunkCount.load(std::memory_order_relaxed);
+    }
+#endif
+
+    /// Get the empty state of the allocator
+    /// @return True if the allocator is empty and all chunks are free to use
+    [[nodiscard]] bool empty() const {
+        return size() == 0;
+    }
+
+    /// Get the number of bytes this allocator requires for the given number of chunks.
+    /// @param chunkCount Max number of chunks to allow for
+    /// @return Number of bytes required for the given number of chunks
+    [[nodiscard]] static size_t getAllocatorSize(const uint32_t chunkCount) {
+        return (chunkCount * sizeof(Chunk_T)) + alignof(Chunk_T);
+    }
+
+private:
+    // ----------------------------------------- //
+    // Private Variables
+    // ----------------------------------------- //
+
+    /// Chunk index used to mark the end of the free chunks chain
+    static constexpr uint32_t NullIndex = UINT32_MAX;
+
+    /// Low 32 bits are the head chunk index. High 32 bits are the tag
+    std::atomic<uint64_t> m_FreeChunksHead{packHead(NullIndex, 0)};
+    size_t m_ChunkCapacity{};
+    std::atomic<size_t> m_UsedChunkCount{};
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    std::atomic<size_t> m_PeakUsedChunkCount{};
+#endif
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free);
+
+    // ----------------------------------------- //
+    // Private Functions
+    // ----------------------------------------- //
+
+    /// Clean up this class
+    void cleanup() {
+        Base_T::cleanup();
+    }
+
+    /// Move the given AxrConcurrentPoolAllocator to this class.
+    /// Neither allocator may be in use by other threads while moving.
+    /// @param src AxrConcurrentPoolAllocator to move
+    /// @param useConstructor If true, this function will use the move constructor for non-primitive objects instead of
+    /// the move assignment operator when moving variables
+    void move_internal(AxrConcurrentPoolAllocator&& src, [[maybe_unused]] const bool useConstructor) {
+        // Please note that we aren't moving the base class. That should be done before calling this function.
+
+        m_FreeChunksHead.store(src.m_FreeChunksHead.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        m_ChunkCapacity = src.m_ChunkCapacity;
+        m_UsedChunkCount.store(src.m_UsedChunkCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+        m_PeakUsedChunkCount.store(src.m_PeakUsedChunkCount.load(std::memory_order_relaxed),
+                                   std::memory_order_relaxed);
+#endif
+
+        src.m_FreeChunksHead.store(packHead(NullIndex, 0), std::memory_order_relaxed);
+        src.m_ChunkCapacity = 0;
+        src.m_UsedChunkCount.store(0, std::memory_order_relaxed);
+    }
+
+    /// Chain together all chunks, marking them all as free to use
+    void chainAllChunks() {
+        m_UsedChunkCount.store(0, std::memory_order_relaxed);
+
+        if (AxrSubAllocatorBase::m_Memory == nullptr || m_ChunkCapacity == 0) {
+            m_FreeChunksHead.store(packHead(NullIndex, 0), std::memory_order_relaxed);
+            return;
+        }
+
+        for (uint32_t i = 0; i < m_ChunkCapacity - 1; ++i) {
+            storeNextIndex(i, i + 1);
+        }
+        storeNextIndex(static_cast<uint32_t>(m_ChunkCapacity - 1), NullIndex);
+
+        const uint32_t tag = getHeadTag(m_FreeChunksHead.load(std::memory_order_relaxed)) + 1;
+        m_FreeChunksHead.store(packHead(0, tag), std::memory_order_release);
+    }
+
+    /// Pop up to the given number of chunks off the free chunks chain in one go.
+    /// The popped chunks stay chained together in order.
+    /// @param maxChunkCount Max number of chunks to pop
+    /// @param firstChunkIndex Output index of the first popped chunk
+    /// @return The number of chunks popped. 0 if there were no free chunks
+    [[nodiscard]] uint32_t popChain(const uint32_t maxChunkCount, uint32_t& firstChunkIndex) {
+        uint64_t head = m_FreeChunksHead.load(std::memory_order_acquire);
+
+        while (true) {
+            const uint32_t headIndex = getHeadIndex(head);
+            if (headIndex == NullIndex) [[unlikely]] {
+                return 0;
+            }
+
+            // Another thread may pop and reuse these chunks while we walk them, so the indices read here can be
+            // garbage. That's fine as long as we stay in bounds, since the tag will have changed and the swap will
+            // fail.
+            uint32_t lastIndex = headIndex;
+            uint32_t chunkCount = 1;
+            uint32_t nextIndex = loadNextIndex(lastIndex);
+            while (chunkCount < maxChunkCount && nextIndex < m_ChunkCapacity) {
+                lastIndex = nextIndex;
+                nextIndex = loadNextIndex(lastIndex);
+                ++chunkCount;
+            }
+
+            if (nextIndex != NullIndex && nextIndex >= m_ChunkCapacity) [[unlikely]] {
+                head = m_FreeChunksHead.load(std::memory_order_acquire);
+                continue;
+            }
+
+            if (m_FreeChunksHead.compare_exchange_weak(head,
+                                                       packHead(nextIndex, getHeadTag(head) + 1),
+                                                       std::memory_order_acquire,
+                                                       std::memory_order_acquire)) {
+                firstChunkIndex = headIndex;
+                addUsedChunkCount(chunkCount);
+                return chunkCount;
+            }
+        }
+    }
+
+    /// Push a chain of chunks onto the free chunks chain in one go
+    /// @param firstChunkIndex Index of the first chunk in the chain
+    /// @param lastChunkIndex Index of the last chunk in the chain
+    /// @param chunkCount Number of chunks in the chain
+    void pushChain(const uint32_t firstChunkIndex, const uint32_t lastChunkIndex, const uint32_t chunkCount) {
+        uint64_t head = m_FreeChunksHead.load(std::memory_order_relaxed);
+
+        do {
+            storeNextIndex(lastChunkIndex, getHeadIndex(head));
+        } while (!m_FreeChunksHead.compare_exchange_weak(head,
+                                                         packHead(firstChunkIndex, getHeadTag(head) + 1),
+                                                         std::memory_order_release,
+                                                         std::memory_order_relaxed));
+
+        m_UsedChunkCount.fetch_sub(chunkCount, std::memory_order_relaxed);
+    }
+
+    /// Add to the used chunk count and update the peak
+    /// @param chunkCount Number of chunks to add
+    void addUsedChunkCount(const uint32_t chunkCount) {
+        [[maybe_unused]] const size_t usedChunkCount =
+            m_UsedChunkCount.fetch_add(chunkCount, std::memory_order_relaxed) + chunkCount;
+
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+        size_t peakUsedChunkCount = m_PeakUsedChunkCount.load(std::memory_order_relaxed);
+        while (usedChunkCount > peakUsedChunkCount &&
+               !m_PeakUsedChunkCount.compare_exchange_weak(peakUsedChunkCount,
+                                                           usedChunkCount,
+                                                           std::memory_order_relaxed)) {
+        }
+#endif
+    }
+
+    /// Check if the given memory is part of this pool
+    /// @param memory Memory to check
+    /// @return True if the given memory is part of this pool
+    [[nodiscard]] bool ownsMemory(const Type* memory) const {
+        const auto memoryAddress = reinterpret_cast<uintptr_t>(memory);
+        const auto poolAddress = reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory);
+        return memoryAddress >= poolAddress && memoryAddress < poolAddress + m_ChunkCapacity * sizeof(Chunk_T);
+    }
+
+    /// Get the chunk index of the given memory
+    /// @param memory Memory to use. Must be part of this pool
+    /// @return The chunk index
+    [[nodiscard]] uint32_t indexOf(const Type* memory) const {
+        return static_cast<uint32_t>(
+            (reinterpret_cast<uintptr_t>(memory) - reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory)) /
+            sizeof(Chunk_T));
+    }
+
+    /// Get the memory at the given chunk index
+    /// @param index Chunk index
+    /// @return The chunk memory
+    [[nodiscard]] Type* ptrAt(const uint32_t index) const {
+        return reinterpret_cast<Type*>(reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory) +
+                                       (index * sizeof(Chunk_T)));
+    }
+
+    /// Read the next free chunk index stored in the given chunk
+    /// @param index Chunk index
+    /// @return The next free chunk index
+    [[nodiscard]] uint32_t loadNextIndex(const uint32_t index) const {
+        return std::atomic_ref(*reinterpret_cast<uint32_t*>(ptrAt(index))).load(std::memory_order_relaxed);
+    }
+
+    /// Write the next free chunk index to the given chunk
+    /// @param index Chunk index
+    /// @param nextIndex Next free chunk index
+    void storeNextIndex(const uint32_t index, const uint32_t nextIndex) {
+        std::atomic_ref(*reinterpret_cast<uint32_t*>(ptrAt(index))).store(nextIndex, std::memory_order_relaxed);
+    }
+
+    /// Pack the given head index and tag together
+    /// @param index Head chunk index
+    /// @param tag Head tag
+    /// @return The packed head
+    [[nodiscard]] static constexpr uint64_t packHead(const uint32_t index, const uint32_t tag) {
+        return (static_cast<uint64_t>(tag) << 32) | index;
+    }
+
+    /// Get the head chunk index from the given packed head
+    /// @param head Packed head
+    /// @return The head chunk index
+    [[nodiscard]] static constexpr uint32_t getHeadIndex(const uint64_t head) {
+        return static_cast<uint32_t>(head);
+    }
+
+    /// Get the tag from the given packed head
+    /// @param head Packed head
+    /// @return The head tag
+    [[nodiscard]] static constexpr uint32_t getHeadTag(const uint64_t head) {
+        return static_cast<uint32_t>(head >> 32);
+    }
+};
@@ -297,3 +297,88 @@ void AxrDoubleStackAllocator::popUpper() {
     m_SizeUpper -= blockSize;
     // Don't zero out memory
 }
+
+// ----------------------------------------- //
+// Double Stack Allocator Scope
+// ----------------------------------------- //
+
+AxrDoubleStackAllocator::Scope::Scope(AxrDoubleStackAllocator& allocator, const End end) :
+    m_Allocator(&allocator),
+    m_End(end) {
+    m_StartSize = endSize();
+}
+
+AxrDoubleStackAllocator::Scope::Scope(Scope&& src) noexcept :
+    m_Allocator(src.m_Allocator),
+    m_End(src.m_End),
+    m_StartSize(src.m_StartSize) {
+    src.m_Allocator = nullptr;
+}
+
+AxrDoubleStackAllocator::Scope::~Scope() {
+    rewind();
+}
+
+AxrDoubleStackAllocator::Scope& AxrDoubleStackAllocator::Scope::operator=(Scope&& src) noexcept {
+    if (this != &src) {
+        rewind();
+
+        m_Allocator = src.m_Allocator;
+        m_End = src.m_End;
+        m_StartSize = src.m_StartSize;
+        src.m_Allocator = nullptr;
+    }
+    return *this;
+}
+
+AxrResult AxrDoubleStackAllocator::Scope::allocateBlock(const size_t size,
+                                                        const uint8_t alignment,
+                                                        void*& memory,
+                                                        const bool zeroOutMemory) {
+    assert(m_Allocator != nullptr);
+
+    // The whole scope gets rewound at once so we can ignore the markerID
+    MarkerID markerID;
+    if (m_End == End::Lower) {
+        return m_Allocator->allocateLowerBlock(size, alignment, memory, markerID, zeroOutMemory);
+    }
+    return m_Allocator->allocateUpperBlock(size, alignment, memory, markerID, zeroOutMemory);
+}
+
+void AxrDoubleStackAllocator::Scope::rewind() {
+    if (m_Allocator == nullptr) [[unlikely]] {
+        return;
+    }
+
+    // The end may already be smaller if it was cleared while this scope was open. Markers live next to each block's
+    // data, so shrinking the size back is all it takes to restore the top of the stack.
+    size_t& currentSize = endSize();
+    if (currentSize > m_StartSize) {
+        currentSize = m_StartSize;
+    }
+    // Don't zero out memory
+}
+
+AxrDoubleStackAllocator& AxrDoubleStackAllocator::Scope::allocator() const {
+    assert(m_Allocator != nullptr);
+
+    return *m_Allocator;
+}
+
+AxrDoubleStackAllocator::End AxrDoubleStackAllocator::Scope::end() const {
+    return m_End;
+}
+
+size_t AxrDoubleStackAllocator::Scope::size() const {
+    if (m_Allocator == nullptr || endSize() < m_StartSize) [[unlikely]] {
+        return 0;
+    }
+
+    return endSize() - m_StartSize;
+}
+
+size_t& AxrDoubleStackAllocator::Scope::endSize() const {
+    assert(m_Allocator != nullptr);
+
+    return m_End == End::Lower ? m_Allocator->m_SizeLower : m_Allocator->m_SizeUpper;
+}
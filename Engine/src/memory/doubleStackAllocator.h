@@ -19,6 +19,14 @@ public:
     /// Marker ID type
     using MarkerID = uint32_t;
 
+    /// An end of the double-ended stack
+    enum class End : uint8_t {
+        Lower,
+        Upper,
+    };
+
+    class Scope;
+
     // ----------------------------------------- //
     // Special Functions
     // ----------------------------------------- //
@@ -253,3 +261,101 @@ private:
     /// Pop the top of the stack on the upper end
     void popUpper();
 };
+
+// ----------------------------------------- //
+// Double Stack Allocator Scope
+// ----------------------------------------- //
+
+/// Scratch scope for temporary allocations on one end of a double-ended stack allocator.
+/// The top of that end is captured on construction, and everything allocated on it after that is rewound on
+/// destruction. The other end is left alone, so long lived data can keep growing from it while the scope is open.
+/// Scopes nest. Open a new scope on `allocator()` to pass scratch memory into a callee. Inner scopes on the same end
+/// must end before outer scopes.
+class AxrDoubleStackAllocator::Scope {
+public:
+    // ----------------------------------------- //
+    // Special Functions
+    // ----------------------------------------- //
+
+    // ---- Constructors ----
+
+    /// Constructor
+    /// @param allocator Double stack allocator to capture the top of
+    /// @param end The end of the stack to allocate from
+    Scope(AxrDoubleStackAllocator& allocator, End end);
+    /// Copy Constructor
+    /// @param src Source Scope to copy from
+    Scope(const Scope& src) = delete;
+    /// Move Constructor
+    /// @param src Source Scope to move from
+    Scope(Scope&& src) noexcept;
+
+    // ---- Destructor ----
+
+    /// Destructor
+    ~Scope();
+
+    // ---- Operator Overloads ----
+
+    /// Copy Assignment Operator
+    /// @param src Source Scope to copy from
+    Scope& operator=(const Scope& src) = delete;
+    /// Move Assignment Operator
+    /// @param src Source Scope to move from
+    Scope& operator=(Scope&& src) noexcept;
+
+    // ----------------------------------------- //
+    // Public Functions
+    // ----------------------------------------- //
+
+    /// Allocate new memory block within this scope
+    /// @param size Size in bytes for how much memory to allocate
+    /// @param alignment Memory alignment
+    /// @param memory Output allocated memory
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space on the stack for the requested memory.
+    [[nodiscard]] AxrResult allocateBlock(size_t size, uint8_t alignment, void*& memory, bool zeroOutMemory = false);
+
+    /// Allocate new memory within this scope
+    /// @tparam Type The memory data type
+    /// @param size The number of data items of type `Type` to store in memory
+    /// @param memory Output allocated memory
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space on the stack for the requested memory.
+    template<typename Type>
+    [[nodiscard]] AxrResult allocate(const size_t size, Type*& memory, const bool zeroOutMemory = false) {
+        return allocateBlock(sizeof(Type) * size, alignof(Type), reinterpret_cast<void*&>(memory), zeroOutMemory);
+    }
+
+    /// Deallocate everything allocated within this scope. The scope stays open for new allocations
+    void rewind();
+
+    /// Get the double stack allocator this scope belongs to
+    /// @return The double stack allocator this scope belongs to
+    [[nodiscard]] AxrDoubleStackAllocator& allocator() const;
+    /// Get the end of the stack this scope allocates from
+    /// @return The end of the stack this scope allocates from
+    [[nodiscard]] End end() const;
+    /// Get the size of the memory allocated within this scope
+    /// @return The size of the memory allocated within this scope
+    [[nodiscard]] size_t size() const;
+
+private:
+    // ----------------------------------------- //
+    // Private Variables
+    // ----------------------------------------- //
+    AxrDoubleStackAllocator* m_Allocator{};
+    End m_End{};
+    /// Size of this scope's end of the stack when this scope was opened
+    size_t m_StartSize{};
+
+    // ----------------------------------------- //
+    // Private Functions
+    // ----------------------------------------- //
+
+    /// Get the size of this scope's end of the stack
+    /// @return The size of this scope's end of the stack
+    [[nodiscard]] size_t& endSize() const;
+};
@@ -5,7 +5,11 @@
 
 #include "axr/logging.h"
 #include "memoryUtils.h"
-#include "poolAllocator.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <utility>
 
 // ----------------------------------------- //
 // Special Functions
@@ -13,20 +17,28 @@
 
 AxrDynamicAllocator::AxrDynamicAllocator() = default;
 
-AxrDynamicAllocator::AxrDynamicAllocator(const AxrMemoryBlock& memoryBlock,
-                                         AxrPoolAllocator<HandlesTree_T::Node>* handlesAllocator) :
-    AxrSubAllocatorBase(memoryBlock) {
-    m_HandlesTree = HandlesTree_T(handlesAllocator);
-
-    m_FreeBlocksHead = static_cast<FreeBlockHeader*>(AxrSubAllocatorBase::m_Memory);
-    *m_FreeBlocksHead = FreeBlockHeader{
-        .Size = AxrSubAllocatorBase::m_Capacity,
-        .Next = nullptr,
-    };
+AxrDynamicAllocator::AxrDynamicAllocator(const AxrMemoryBlock& memoryBlock, AxrHandleTable* handleTable) :
+    AxrSubAllocatorBase_Aligned(memoryBlock),
+    m_HandleTable(handleTable) {
+    // Block sizes need to be a multiple of `BlockAlignment` so that every data header stays aligned
+    AxrSubAllocatorBase::m_Capacity &= ~(BlockAlignment - 1);
+    // Free block links and data block sizes are stored as 32 bits
+    assert(AxrSubAllocatorBase::m_Capacity <= MaxCapacity);
+    assert(AxrSubAllocatorBase::m_Capacity >= sizeof(FreeBlockHeader));
+    assert(m_HandleTable != nullptr);
+    assert(m_HandleTable->handleCapacity() <= MaxHandleCount);
+
+    const auto baseAddress = reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory);
+    m_FreeBlocksBySize = FreeBlockTree(baseAddress, FreeBlockTree::OrderBy::Size);
+    m_FreeBlocksByAddress = FreeBlockTree(baseAddress, FreeBlockTree::OrderBy::Address);
+
+    const auto freeBlock = static_cast<FreeBlockHeader*>(AxrSubAllocatorBase::m_Memory);
+    freeBlock->Size = AxrSubAllocatorBase::m_Capacity;
+    insertFreeBlock(freeBlock);
 }
 
 AxrDynamicAllocator::AxrDynamicAllocator(AxrDynamicAllocator&& src) noexcept :
-    AxrSubAllocatorBase(std::move(src)) {
+    AxrSubAllocatorBase_Aligned(std::move(src)) {
     move_internal(std::move(src), true);
 }
 
@@ -38,7 +50,7 @@ AxrDynamicAllocator& AxrDynamicAllocator::operator=(AxrDynamicAllocator&& src) n
     if (this != &src) {
         cleanup();
 
-        AxrSubAllocatorBase::operator=(std::move(src));
+        AxrSubAllocatorBase_Aligned::operator=(std::move(src));
 
         move_internal(std::move(src), false);
     }
@@ -49,124 +61,152 @@ AxrDynamicAllocator& AxrDynamicAllocator::operator=(AxrDynamicAllocator&& src) n
 // Public Functions
 // ----------------------------------------- //
 
-#define AXR_FUNCTION_FAILED_STRING "Failed to allocator block for dynamic allocator. "
+#define AXR_FUNCTION_FAILED_STRING "Failed to allocate block for dynamic allocator. "
 AxrResult AxrDynamicAllocator::allocateBlock(const size_t size,
                                              const uint8_t alignment,
                                              AxrHandle<void>& handle,
-                                             const bool zeroOutMemory) {
+                                             const bool zeroOutMemory,
+                                             const AxrAllocationTag& tag) {
     // This should never be null. The only time it's null is if this allocator is empty and wasn't given any data to
     // manage. In such case, we shouldn't be calling this function
     assert(AxrSubAllocatorBase::m_Memory != nullptr);
 
-    size_t blockSize = std::max(m_MinDataItemSize, size) + alignment + sizeof(DataHeader);
+    const size_t requiredBlockSize = getRequiredBlockSize(size, alignment);
+
+    FreeBlockHeader* freeBlock = findFreeBlock(requiredBlockSize);
 
-    FreeBlockHeader* previousFreeBlock = nullptr;
-    FreeBlockHeader* freeBlock = findFreeBlock(blockSize, previousFreeBlock);
+    if (freeBlock == nullptr && m_MemoryPressureMonitor.notifyCritical(m_Size, AxrSubAllocatorBase::m_Capacity, size))
+        [[unlikely]] {
+        // Give subsystems a chance to free some memory before falling back to a forced defragmentation
+        freeBlock = findFreeBlock(requiredBlockSize);
+    }
 
-    if (freeBlock == nullptr && blockSize <= AxrSubAllocatorBase::m_Capacity - m_Size) [[unlikely]] {
-        // If no free block was found, but the `blockSize` is less than or equal to the total amount of memory we have
-        // spare, then it means we have the space, it's just fragmented. So instead of returning that we don't have the
-        // memory, instead, defragment as little as possible until the free block is big enough.
-        while (freeBlock == nullptr) {
-            defragment();
+    if (freeBlock == nullptr && requiredBlockSize <= AxrSubAllocatorBase::m_Capacity - m_Size) [[unlikely]] {
+        // If no free block was found, but the `requiredBlockSize` is less than or equal to the total amount of memory
+        // we have spare, then it means we have the space, it's just fragmented. So instead of returning that we don't
+        // have the memory, instead, defragment as little as possible until the free block is big enough.
+        // Defragmenting can turn small gaps into alignment padding, so stop if there's nothing left to defragment.
+        while (freeBlock == nullptr && defragment() != 0) {
+            freeBlock = findFreeBlock(requiredBlockSize);
+        }
 
-            freeBlock = findFreeBlock(blockSize, previousFreeBlock);
+        if (freeBlock != nullptr) {
+            axrLogWarning("Forced into defragmenting while allocating a memory block of size {}.", requiredBlockSize);
         }
+    }
 
-        axrLogWarning("Forced into defragmenting while allocating a memory block of size {}.", blockSize);
-    } else if (freeBlock == nullptr) [[unlikely]] {
+    if (freeBlock == nullptr) [[unlikely]] {
         axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to find a free block of memory for the requested size.");
         return AXR_ERROR_OUT_OF_MEMORY;
     }
 
-    // Copy the free block header
-    const FreeBlockHeader originalFreeBlockHeader = *freeBlock;
-    const auto originalFreeBlockAddress = reinterpret_cast<uintptr_t>(freeBlock);
-
-    freeBlock->Size -= blockSize;
-    // If there isn't enough space for a new `FreeBlockHeader` to be inserted at the end of this data block, then just
-    // allocate the entire block. We can't keep track of the new free block anyway.
-    // Yes, it does mean that we could end up giving extra space to many blocks of data which could theoretically be
-    // combined into a single free block. But that adds more complexity than it's worth for a few extra bytes.
-    if (freeBlock->Size < sizeof(FreeBlockHeader)) {
-        blockSize += freeBlock->Size;
-        freeBlock->Size = 0;
+    const size_t previousSize = m_Size;
+    const AxrResult axrResult = allocateFromFreeBlock(freeBlock,
+                                                      reinterpret_cast<uintptr_t>(freeBlock),
+                                                      size,
+                                                      alignment,
+                                                      zeroOutMemory,
+                                                      handle,
+                                                      tag);
+    if (AXR_FAILED(axrResult)) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to allocate from free block.");
+        return AXR_ERROR_OUT_OF_MEMORY;
     }
 
-    // ---- Allocate Memory ----
+    m_MemoryPressureMonitor.checkHighWaterMark(previousSize, m_Size, AxrSubAllocatorBase::m_Capacity, size);
 
-    const auto dataHeader = reinterpret_cast<DataHeader*>(freeBlock);
-    // NOTE (Ashe): This header isn't aligned to an optimal address. Don't know how much that matters though.
-    *dataHeader = DataHeader{
-        .Size = blockSize - sizeof(DataHeader),
-        .Alignment = alignment,
-    };
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
 
-    auto allocatedBlock = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(dataHeader) + sizeof(DataHeader));
+#define AXR_FUNCTION_FAILED_STRING "Failed to allocate pinned block for dynamic allocator. "
+AxrResult AxrDynamicAllocator::allocatePinnedBlock(const size_t size,
+                                                   const uint8_t alignment,
+                                                   AxrHandle<void>& handle,
+                                                   const bool zeroOutMemory,
+                                                   const AxrAllocationTag& tag) {
+    // This should never be null. The only time it's null is if this allocator is empty and wasn't given any data to
+    // manage. In such case, we shouldn't be calling this function
+    assert(AxrSubAllocatorBase::m_Memory != nullptr);
 
-    if (zeroOutMemory) {
-        std::memset(allocatedBlock, 0, blockSize - sizeof(DataHeader));
-    }
+    const size_t requiredBlockSize = getRequiredBlockSize(size, alignment);
 
-    allocatedBlock = axrAlignMemory(allocatedBlock, alignment);
+    FreeBlockHeader* freeBlock = findHighestFreeBlock(requiredBlockSize);
 
-    const HandlesTree_T::Node::Iterator allocatedBlockHandleNode = m_HandlesTree.insert(
-        reinterpret_cast<uintptr_t>(allocatedBlock));
-    if (allocatedBlockHandleNode == m_HandlesTree.end()) {
-        *reinterpret_cast<FreeBlockHeader*>(originalFreeBlockAddress) = originalFreeBlockHeader;
-        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to create handle.");
-        return AXR_ERROR_OUT_OF_MEMORY;
+    if (freeBlock == nullptr && m_MemoryPressureMonitor.notifyCritical(m_Size, AxrSubAllocatorBase::m_Capacity, size))
+        [[unlikely]] {
+        freeBlock = findHighestFreeBlock(requiredBlockSize);
     }
 
-    // ---- Create new free block ----
-
-    if (originalFreeBlockHeader.Size - blockSize == 0) {
-        // There's no extra space to create a new free block, just connect the previous free block with the next free
-        // block
-
-        if (previousFreeBlock == nullptr) {
-            m_FreeBlocksHead = originalFreeBlockHeader.Next;
-        } else {
-            previousFreeBlock->Next = originalFreeBlockHeader.Next;
+    if (freeBlock == nullptr && requiredBlockSize <= AxrSubAllocatorBase::m_Capacity - m_Size) [[unlikely]] {
+        // Same as `allocateBlock()`. Defragmenting gathers free memory at the top, which is where we want to be anyway
+        while (freeBlock == nullptr && defragment() != 0) {
+            freeBlock = findHighestFreeBlock(requiredBlockSize);
         }
-    } else {
-        // We don't need to check if there's enough here for the `FreeBlockHeader`. We did that earlier. If we got here,
-        // there's room.
 
-        const auto newFreeBlockAddress = reinterpret_cast<FreeBlockHeader*>(originalFreeBlockAddress + blockSize);
-        *newFreeBlockAddress = originalFreeBlockHeader;
-        newFreeBlockAddress->Size -= blockSize;
-
-        if (previousFreeBlock == nullptr) {
-            m_FreeBlocksHead = newFreeBlockAddress;
-        } else {
-            previousFreeBlock->Next = newFreeBlockAddress;
+        if (freeBlock != nullptr) {
+            axrLogWarning("Forced into defragmenting while allocating a pinned memory block of size {}.",
+                          requiredBlockSize);
         }
     }
 
-    // ---- Set handle ----
+    if (freeBlock == nullptr) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to find a free block of memory for the requested size.");
+        return AXR_ERROR_OUT_OF_MEMORY;
+    }
 
-    AxrHandle<void>::Deallocator_T deallocatorCallback{};
-    deallocatorCallback.connect<&AxrDynamicAllocator::deallocateHandle>(this);
+    // Pinned blocks can't be moved out of the way of defragmentation, so place the data at the very end of the free
+    // block. Everything else can then be defragmented down past it.
+    const uintptr_t freeBlockEndAddress = reinterpret_cast<uintptr_t>(freeBlock) + freeBlock->Size;
+    const uintptr_t dataAddress = (freeBlockEndAddress - getDataSize(size)) & ~(static_cast<uintptr_t>(alignment) - 1);
+
+    const size_t previousSize = m_Size;
+    const AxrResult axrResult = allocateFromFreeBlock(freeBlock,
+                                                      dataAddress - sizeof(DataHeader),
+                                                      size,
+                                                      alignment,
+                                                      zeroOutMemory,
+                                                      handle,
+                                                      tag);
+    if (AXR_FAILED(axrResult)) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to allocate from free block.");
+        return AXR_ERROR_OUT_OF_MEMORY;
+    }
 
-    handle = AxrHandle(reinterpret_cast<void* const*>(&*allocatedBlockHandleNode), deallocatorCallback);
+    findDataHeader(handle)->IsPinned = true;
 
-    m_Size += blockSize;
-#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
-    if (m_Size > m_PeakSize) {
-        m_PeakSize = m_Size;
-    }
-#endif
+    m_MemoryPressureMonitor.checkHighWaterMark(previousSize, m_Size, AxrSubAllocatorBase::m_Capacity, size);
 
     return AXR_SUCCESS;
 }
 #undef AXR_FUNCTION_FAILED_STRING
 
+AxrResult AxrDynamicAllocator::allocateBlockBatch(const size_t* sizes,
+                                                  const uint8_t alignment,
+                                                  AxrHandle<void>* handles,
+                                                  const uint32_t handleCount,
+                                                  const bool zeroOutMemory,
+                                                  const AxrAllocationTag& tag) {
+    assert(sizes != nullptr);
+
+    return allocateBlockBatch_internal(sizes, 0, alignment, handles, handleCount, zeroOutMemory, tag);
+}
+
+AxrResult AxrDynamicAllocator::allocateBlockBatch(const size_t size,
+                                                  const uint8_t alignment,
+                                                  AxrHandle<void>* handles,
+                                                  const uint32_t handleCount,
+                                                  const bool zeroOutMemory,
+                                                  const AxrAllocationTag& tag) {
+    return allocateBlockBatch_internal(nullptr, size, alignment, handles, handleCount, zeroOutMemory, tag);
+}
+
 #define AXR_FUNCTION_FAILED_STRING "Failed to reallocate block for dynamic allocator. "
 AxrResult AxrDynamicAllocator::reallocateBlock(const size_t size,
                                                const uint8_t alignment,
                                                AxrHandle<void>& handle,
-                                               const bool zeroOutNewMemory) {
+                                               const bool zeroOutNewMemory,
+                                               const AxrAllocationTag& tag) {
     // This should never be null. The only time it's null is if this allocator is empty and wasn't given any data to
     // manage. In such case, we shouldn't be calling this function
     assert(AxrSubAllocatorBase::m_Memory != nullptr);
@@ -176,29 +216,128 @@ AxrResult AxrDynamicAllocator::reallocateBlock(const size_t size,
         return AXR_ERROR_VALIDATION_FAILED;
     }
 
-    const auto dataAddress = reinterpret_cast<uintptr_t>(*handle.m_Data);
-    // If the given data isn't part of the memory we manage, don't do anything with it
-    if (dataAddress < reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory) ||
-        dataAddress > reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory) + AxrSubAllocatorBase::m_Capacity)
-        [[unlikely]] {
-        axrLogError(AXR_FUNCTION_FAILED_STRING "Attempted to deallocate data that isn't from this dynamic allocator.");
+    DataHeader* dataHeader = findDataHeader(handle);
+    if (dataHeader == nullptr) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "The given handle is stale or isn't from this dynamic allocator.");
         return AXR_ERROR_VALIDATION_FAILED;
     }
 
-    const DataHeader originalDataHeader = *reinterpret_cast<DataHeader*>(
-        reinterpret_cast<uintptr_t>(axrUnalignMemory(reinterpret_cast<void*>(dataAddress))) - sizeof(DataHeader));
+    const auto dataAddress = reinterpret_cast<uintptr_t>(*handle.m_Data);
+    // The number of bytes of data the original block can hold
+    const size_t originalDataSize = getDataCapacity(dataHeader);
+
+    // ---- Resize in place ----
+
+    // The data can only stay where it is if it's still aligned for the requested alignment
+    if (axrAlignAddress(dataAddress, alignment) == dataAddress) {
+        const uintptr_t blockAddress = getBlockAddress(dataHeader);
+        const size_t blockSize = dataHeader->BlockSize;
+        // The padding before the header stays as is
+        size_t newBlockSize = dataAddress - blockAddress + getDataSize(size);
+
+        if (newBlockSize <= blockSize) {
+            dataHeader->AlignmentShift = static_cast<uint32_t>(std::countr_zero(alignment));
+            shrinkBlock(dataHeader, newBlockSize);
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+            AxrAllocationTracker::get().recordResize(AxrAllocationTracker::getHandleKey(handle.m_Data), size);
+#endif
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+            recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_REALLOCATE,
+                             reinterpret_cast<uintptr_t>(handle.m_Data),
+                             size,
+                             alignment,
+                             reinterpret_cast<uintptr_t>(handle.m_Data));
+#endif
+            return AXR_SUCCESS;
+        }
+
+        FreeBlockHeader* nextFreeBlock = m_FreeBlocksByAddress.findLowerBound(0, blockAddress + blockSize);
+        if (nextFreeBlock != nullptr && reinterpret_cast<uintptr_t>(nextFreeBlock) == blockAddress + blockSize &&
+            blockSize + nextFreeBlock->Size >= newBlockSize) {
+            const size_t combinedBlockSize = blockSize + nextFreeBlock->Size;
+            removeFreeBlock(nextFreeBlock);
+
+            // Same as `allocateBlock()`, if there isn't enough space left over for a `FreeBlockHeader`, the data block
+            // takes the whole thing
+            if (combinedBlockSize - newBlockSize < sizeof(FreeBlockHeader)) {
+                newBlockSize = combinedBlockSize;
+            } else {
+                const auto newFreeBlock = reinterpret_cast<FreeBlockHeader*>(blockAddress + newBlockSize);
+                newFreeBlock->Size = combinedBlockSize - newBlockSize;
+                insertFreeBlock(newFreeBlock);
+            }
+
+            dataHeader->BlockSize = newBlockSize;
+            dataHeader->AlignmentShift = static_cast<uint32_t>(std::countr_zero(alignment));
+
+            if (zeroOutNewMemory) {
+                std::memset(reinterpret_cast<void*>(dataAddress + originalDataSize), 0, newBlockSize - blockSize);
+            }
+
+            m_Size += newBlockSize - blockSize;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+            if (m_Size > m_PeakSize) {
+                m_PeakSize = m_Size;
+            }
+#endif
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+            AxrAllocationTracker::get().recordResize(AxrAllocationTracker::getHandleKey(handle.m_Data), size);
+#endif
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+            recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_REALLOCATE,
+                             reinterpret_cast<uintptr_t>(handle.m_Data),
+                             size,
+                             alignment,
+                             reinterpret_cast<uintptr_t>(handle.m_Data));
+#endif
+
+            m_MemoryPressureMonitor.checkHighWaterMark(m_Size - (newBlockSize - blockSize),
+                                                       m_Size,
+                                                       AxrSubAllocatorBase::m_Capacity,
+                                                       size);
+
+            return AXR_SUCCESS;
+        }
+    }
+
+    // ---- Move to a new block ----
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    // The move gets recorded as a single reallocation instead of the allocation and deallocation it's made of
+    const uint16_t traceAllocatorIndex = std::exchange(m_TraceAllocatorIndex,
+                                                       AxrAllocationTraceRecorder::InvalidAllocatorIndex);
+#endif
 
     AxrHandle<void> newHandle;
-    const AxrResult axrResult = allocateBlock(size, alignment, newHandle, zeroOutNewMemory);
+    const AxrResult axrResult = dataHeader->IsPinned
+                                    ? allocatePinnedBlock(size, alignment, newHandle, zeroOutNewMemory, tag)
+                                    : allocateBlock(size, alignment, newHandle, zeroOutNewMemory, tag);
     if (AXR_FAILED(axrResult)) {
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+        m_TraceAllocatorIndex = traceAllocatorIndex;
+#endif
         axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to allocate new block.");
-        return axrResult;
+        return AXR_ERROR_OUT_OF_MEMORY;
     }
 
-    std::memcpy(newHandle.getDataPtr(), handle.getDataPtr(), originalDataHeader.Size);
+    // NOTE (Ashe): `allocateBlock()` may have defragmented and moved the original data. Always go through the handle.
+    std::memcpy(newHandle.getDataPtr(), handle.getDataPtr(), std::min(originalDataSize, size));
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    const auto previousAllocationID = reinterpret_cast<uintptr_t>(handle.m_Data);
+#endif
 
     deallocateHandle(handle);
 
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    m_TraceAllocatorIndex = traceAllocatorIndex;
+    recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_REALLOCATE,
+                     reinterpret_cast<uintptr_t>(newHandle.m_Data),
+                     size,
+                     alignment,
+                     previousAllocationID);
+#endif
+
     handle = std::move(newHandle);
 
     return AXR_SUCCESS;
@@ -214,62 +353,214 @@ void AxrDynamicAllocator::deallocateHandle(AxrHandle<void>& handle) {
         return;
     }
 
-    const auto dataAddress = reinterpret_cast<uintptr_t>(*handle.m_Data);
-    // If the given data isn't part of the memory we manage, don't do anything with it
-    if (dataAddress < reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory) ||
-        dataAddress > reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory) + AxrSubAllocatorBase::m_Capacity)
-        [[unlikely]] {
-        axrLogWarning("Attempted to deallocate data that isn't from this dynamic allocator.");
+    DataHeader* dataHeader = findDataHeader(handle);
+    if (dataHeader == nullptr) [[unlikely]] {
+        axrLogWarning("Attempted to deallocate a handle that is stale or isn't from this dynamic allocator.");
         return;
     }
 
-    m_HandlesTree.remove(dataAddress);
+    const size_t blockSize = dataHeader->BlockSize;
+    m_HandleTable->destroy(dataHeader->HandleIndex);
 
-    const auto dataHeader = reinterpret_cast<DataHeader*>(
-        reinterpret_cast<uintptr_t>(axrUnalignMemory(reinterpret_cast<void*>(dataAddress))) - sizeof(DataHeader));
-    /// Copy the data header since we're overwriting it and don't want to lose  it's data
-    const DataHeader originalDataHeader = *dataHeader;
+    releaseMemory(getBlockAddress(dataHeader), blockSize);
 
-    // ---- Replace the data with a free block ----
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+    AxrAllocationTracker::get().recordDeallocation(AxrAllocationTracker::getHandleKey(handle.m_Data));
+#endif
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_DEALLOCATE, reinterpret_cast<uintptr_t>(handle.m_Data));
+#endif
 
-    const auto newFreeBlock = reinterpret_cast<FreeBlockHeader*>(dataHeader);
-    *newFreeBlock = FreeBlockHeader{
-        .Size = originalDataHeader.Size + sizeof(DataHeader),
-        .Next = nullptr,
-    };
+    handle.m_Data = nullptr;
+    m_Size -= blockSize;
+}
+
+void AxrDynamicAllocator::deallocateHandleBatch(AxrHandle<void>* handles, const uint32_t handleCount) {
+    // This should never be null. The only time it's null is if this allocator is empty and wasn't given any data to
+    // manage. In such case, we shouldn't be calling this function
+    assert(AxrSubAllocatorBase::m_Memory != nullptr);
+    assert(handles != nullptr || handleCount == 0);
 
-    FreeBlockHeader* adjacentFreeBlock = findAdjacentFreeBlock(dataAddress);
+    // The run of neighbouring blocks that haven't been given back yet
+    uintptr_t runAddress = 0;
+    size_t runSize = 0;
 
-    // Ensure that the order of the free blocks chain remain from lowest to highest addresses.
-    if (adjacentFreeBlock == nullptr) {
-        // There are no free blocks with a lower address, we need to change the head since this is the new lowest
-        // free block
+    for (uint32_t i = 0; i < handleCount; ++i) {
+        AxrHandle<void>& handle = handles[i];
+        if (handle.m_Data == nullptr) {
+            continue;
+        }
 
-        if (m_FreeBlocksHead != nullptr) {
-            newFreeBlock->Next = m_FreeBlocksHead;
+        DataHeader* dataHeader = findDataHeader(handle);
+        if (dataHeader == nullptr) [[unlikely]] {
+            axrLogWarning("Attempted to deallocate a handle that is stale or isn't from this dynamic allocator.");
+            continue;
         }
 
-        m_FreeBlocksHead = newFreeBlock;
-        mergeFreeBlocks(m_FreeBlocksHead);
-    } else {
-        newFreeBlock->Next = adjacentFreeBlock->Next;
-        adjacentFreeBlock->Next = newFreeBlock;
+        const uintptr_t blockAddress = getBlockAddress(dataHeader);
+        const size_t blockSize = dataHeader->BlockSize;
+        m_HandleTable->destroy(dataHeader->HandleIndex);
+
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+        AxrAllocationTracker::get().recordDeallocation(AxrAllocationTracker::getHandleKey(handle.m_Data));
+#endif
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+        recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_DEALLOCATE, reinterpret_cast<uintptr_t>(handle.m_Data));
+#endif
+
+        handle.m_Data = nullptr;
+        m_Size -= blockSize;
+
+        if (runSize != 0 && runAddress + runSize == blockAddress) {
+            runSize += blockSize;
+            continue;
+        }
+
+        if (runSize != 0) {
+            releaseMemory(runAddress, runSize);
+        }
 
-        mergeFreeBlocks(adjacentFreeBlock);
+        runAddress = blockAddress;
+        runSize = blockSize;
     }
 
-    handle.m_Data = nullptr;
-    m_Size -= originalDataHeader.Size + sizeof(DataHeader);
+    if (runSize != 0) {
+        releaseMemory(runAddress, runSize);
+    }
+}
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to pin handle. "
+AxrResult AxrDynamicAllocator::pinHandle(const AxrHandle<void>& handle) {
+    DataHeader* dataHeader = findDataHeader(handle);
+    if (dataHeader == nullptr) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "The given handle is stale or isn't from this dynamic allocator.");
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    dataHeader->IsPinned = true;
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+void AxrDynamicAllocator::unpinHandle(const AxrHandle<void>& handle) {
+    if (handle.m_Data == nullptr) {
+        return;
+    }
+
+    DataHeader* dataHeader = findDataHeader(handle);
+    if (dataHeader == nullptr) [[unlikely]] {
+        axrLogWarning("Attempted to unpin a handle that is stale or isn't from this dynamic allocator.");
+        return;
+    }
+
+    dataHeader->IsPinned = false;
+}
+
+void AxrDynamicAllocator::lockRelocation() {
+    ++m_RelocationLockCount;
+}
+
+void AxrDynamicAllocator::unlockRelocation() {
+    assert(m_RelocationLockCount != 0);
+
+    --m_RelocationLockCount;
+}
+
+bool AxrDynamicAllocator::isRelocationLocked() const {
+    return m_RelocationLockCount != 0;
 }
 
 void AxrDynamicAllocator::defragment(const uint32_t blockCount) {
     for (uint32_t i = 0; i < blockCount; ++i) {
         defragment();
     }
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_DEFRAGMENT, 0, blockCount);
+#endif
+}
+
+AxrDynamicAllocator::DefragmentProgress AxrDynamicAllocator::defragment(const DefragmentBudget& budget) {
+    const auto startTime = std::chrono::steady_clock::now();
+    const auto maxDuration = std::chrono::microseconds(budget.MaxMicroseconds);
+
+    DefragmentProgress progress{};
+    bool hasNothingToMove = false;
+
+    while (true) {
+        if (budget.MaxBytes != 0 && progress.BytesMoved >= budget.MaxBytes) {
+            break;
+        }
+        if (budget.MaxMicroseconds != 0 && std::chrono::steady_clock::now() - startTime >= maxDuration) {
+            break;
+        }
+
+        const size_t bytesMoved = defragment();
+        if (bytesMoved == 0) {
+            hasNothingToMove = !isRelocationLocked();
+            break;
+        }
+
+        ++progress.BlocksMoved;
+        progress.BytesMoved += bytesMoved;
+    }
+
+    const FreeBlockHeader* firstFreeBlock = m_FreeBlocksByAddress.first();
+    progress.IsComplete = hasNothingToMove || firstFreeBlock == nullptr ||
+                          m_FreeBlocksByAddress.next(firstFreeBlock) == nullptr;
+    progress.FragmentationRatio = getFragmentationRatio();
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_DEFRAGMENT, 0, progress.BlocksMoved);
+#endif
+
+    return progress;
+}
+
+float AxrDynamicAllocator::getFragmentationRatio() const {
+    const size_t freeMemorySize = AxrSubAllocatorBase::m_Capacity - m_Size;
+    const FreeBlockHeader* largestFreeBlock = m_FreeBlocksBySize.last();
+    if (freeMemorySize == 0 || largestFreeBlock == nullptr) {
+        return 0.0f;
+    }
+
+    return 1.0f - static_cast<float>(largestFreeBlock->Size) / static_cast<float>(freeMemorySize);
+}
+
+AxrMemoryPressureMonitor& AxrDynamicAllocator::getMemoryPressureMonitor() {
+    return m_MemoryPressureMonitor;
+}
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+void AxrDynamicAllocator::startTraceRecording() {
+    startTraceRecording_internal(AXR_ALLOCATION_TRACE_ALLOCATOR_DYNAMIC);
+}
+#endif
+
+AxrDynamicAllocator::SnapshotState AxrDynamicAllocator::getSnapshotState() const {
+    return SnapshotState{
+        .FreeBlocksBySizeRootOffset = m_FreeBlocksBySize.getRootOffset(),
+        .FreeBlocksByAddressRootOffset = m_FreeBlocksByAddress.getRootOffset(),
+        .Size = m_Size,
+    };
+}
+
+void AxrDynamicAllocator::restoreSnapshotState(const SnapshotState& state) {
+    assert(state.Size <= AxrSubAllocatorBase::m_Capacity);
+
+    m_FreeBlocksBySize.setRootOffset(state.FreeBlocksBySizeRootOffset);
+    m_FreeBlocksByAddress.setRootOffset(state.FreeBlocksByAddressRootOffset);
+    m_Size = state.Size;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    if (m_Size > m_PeakSize) {
+        m_PeakSize = m_Size;
+    }
+#endif
 }
 
 bool AxrDynamicAllocator::empty() const {
-    return m_FreeBlocksHead != nullptr && m_FreeBlocksHead->Size == AxrSubAllocatorBase::m_Capacity;
+    const FreeBlockHeader* firstFreeBlock = m_FreeBlocksByAddress.first();
+    return firstFreeBlock != nullptr && firstFreeBlock->Size == AxrSubAllocatorBase::m_Capacity;
 }
 
 size_t AxrDynamicAllocator::size() const {
@@ -282,155 +573,1100 @@ size_t AxrDynamicAllocator::peakSize() const {
 }
 #endif
 
+#ifdef AXR_TESTING_ENABLED
+bool AxrDynamicAllocator::validateFreeBlockTrees() const {
+    if (!m_FreeBlocksBySize.isValid() || !m_FreeBlocksByAddress.isValid()) {
+        return false;
+    }
+
+    uint32_t sizeTreeCount = 0;
+    for (const FreeBlockHeader* freeBlock = m_FreeBlocksBySize.first(); freeBlock != nullptr;
+         freeBlock = m_FreeBlocksBySize.next(freeBlock)) {
+        if (freeBlock->Size < getRequiredBlockSize(0, 1) || freeBlock->Size % BlockAlignment != 0) {
+            return false;
+        }
+        // Every free block in the size tree must be in the address tree too
+        if (m_FreeBlocksByAddress.findLowerBound(0, reinterpret_cast<uintptr_t>(freeBlock)) != freeBlock) {
+            return false;
+        }
+
+        ++sizeTreeCount;
+    }
+
+    uint32_t addressTreeCount = 0;
+    size_t freeMemorySize = 0;
+    const FreeBlockHeader* previousFreeBlock = nullptr;
+    for (const FreeBlockHeader* freeBlock = m_FreeBlocksByAddress.first(); freeBlock != nullptr;
+         freeBlock = m_FreeBlocksByAddress.next(freeBlock)) {
+        // Neighbouring free blocks must have been merged
+        if (previousFreeBlock != nullptr &&
+            reinterpret_cast<uintptr_t>(previousFreeBlock) + previousFreeBlock->Size >=
+                reinterpret_cast<uintptr_t>(freeBlock)) {
+            return false;
+        }
+
+        freeMemorySize += freeBlock->Size;
+        ++addressTreeCount;
+        previousFreeBlock = freeBlock;
+    }
+
+    return sizeTreeCount == addressTreeCount && freeMemorySize == AxrSubAllocatorBase::m_Capacity - m_Size;
+}
+#endif
+
 // ----------------------------------------- //
 // Private Functions
 // ----------------------------------------- //
 
+size_t AxrDynamicAllocator::getBlockSize(const uintptr_t blockAddress, const size_t size, const uint8_t alignment) {
+    const uintptr_t dataAddress = axrAlignAddress(blockAddress + sizeof(DataHeader), alignment);
+    return dataAddress - blockAddress + getDataSize(size);
+}
+
+AxrDynamicAllocator::DataHeader* AxrDynamicAllocator::getDataHeader(const uintptr_t blockAddress) {
+    const auto dataHeader = reinterpret_cast<DataHeader*>(blockAddress);
+    if (dataHeader->IsPaddingMarker) {
+        return reinterpret_cast<DataHeader*>(blockAddress + dataHeader->BlockSize);
+    }
+
+    return dataHeader;
+}
+
+uintptr_t AxrDynamicAllocator::getBlockAddress(const DataHeader* dataHeader) {
+    return reinterpret_cast<uintptr_t>(dataHeader) - dataHeader->PaddingUnits * BlockAlignment;
+}
+
+size_t AxrDynamicAllocator::getDataCapacity(const DataHeader* dataHeader) {
+    return dataHeader->BlockSize - dataHeader->PaddingUnits * BlockAlignment - sizeof(DataHeader);
+}
+
 void AxrDynamicAllocator::cleanup() {
-    m_HandlesTree.~AxrRedBlackTree_Pool();
+    destroyAllHandles();
+    m_HandleTable = nullptr;
 
-    AxrSubAllocatorBase::cleanup();
+    AxrSubAllocatorBase_Aligned::cleanup();
 }
 
-void AxrDynamicAllocator::move_internal(AxrDynamicAllocator&& src, const bool useConstructor) {
-    // Please note that we aren't moving the base class. That should be done before calling this function.
+void AxrDynamicAllocator::destroyAllHandles() {
+    if (AxrSubAllocatorBase::m_Memory == nullptr || m_HandleTable == nullptr) {
+        return;
+    }
 
-    if (useConstructor) {
-        new (&m_HandlesTree) HandlesTree_T(std::move(src.m_HandlesTree));
-    } else {
-        m_HandlesTree = std::move(src.m_HandlesTree);
+    // Walk every block in address order. Anything that isn't the next free block is a data block
+    const auto endAddress =
+        reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory) + AxrSubAllocatorBase::m_Capacity;
+    const FreeBlockHeader* nextFreeBlock = m_FreeBlocksByAddress.first();
+    uintptr_t blockAddress = reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory);
+
+    while (blockAddress < endAddress) {
+        if (blockAddress == reinterpret_cast<uintptr_t>(nextFreeBlock)) {
+            blockAddress += nextFreeBlock->Size;
+            nextFreeBlock = m_FreeBlocksByAddress.next(nextFreeBlock);
+            continue;
+        }
+
+        const DataHeader* dataHeader = getDataHeader(blockAddress);
+        m_HandleTable->destroy(dataHeader->HandleIndex);
+        blockAddress += dataHeader->BlockSize;
     }
+}
 
-    m_FreeBlocksHead = src.m_FreeBlocksHead;
+void AxrDynamicAllocator::move_internal(AxrDynamicAllocator&& src, const bool useConstructor) {
+    // Please note that we aren't moving the base class. That should be done before calling this function.
+
+    m_HandleTable = src.m_HandleTable;
+    m_FreeBlocksBySize = src.m_FreeBlocksBySize;
+    m_FreeBlocksByAddress = src.m_FreeBlocksByAddress;
     m_Size = src.m_Size;
 #ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
     m_PeakSize = src.m_PeakSize;
 #endif
+    m_RelocationLockCount = src.m_RelocationLockCount;
+    m_MemoryPressureMonitor = src.m_MemoryPressureMonitor;
 }
 
-AxrDynamicAllocator::FreeBlockHeader* AxrDynamicAllocator::findFreeBlock(const size_t size,
-                                                                         FreeBlockHeader*& prevFreeBlock) const {
+#define AXR_FUNCTION_FAILED_STRING "Failed to allocate block batch for dynamic allocator. "
+AxrResult AxrDynamicAllocator::allocateBlockBatch_internal(const size_t* sizes,
+                                                           const size_t size,
+                                                           const uint8_t alignment,
+                                                           AxrHandle<void>* handles,
+                                                           const uint32_t handleCount,
+                                                           const bool zeroOutMemory,
+                                                           [[maybe_unused]] const AxrAllocationTag& tag) {
     // This should never be null. The only time it's null is if this allocator is empty and wasn't given any data to
     // manage. In such case, we shouldn't be calling this function
     assert(AxrSubAllocatorBase::m_Memory != nullptr);
+    assert(handles != nullptr || handleCount == 0);
 
-    if (m_FreeBlocksHead == nullptr) [[unlikely]] {
-        // There are no free blocks and all memory is in use
-        return nullptr;
+    if (handleCount == 0) {
+        return AXR_SUCCESS;
     }
 
-    // Find the next free block that is big enough for the requested size
-    FreeBlockHeader* previousFreeBlock = nullptr;
-    FreeBlockHeader* currentFreeBlock = m_FreeBlocksHead;
-    while (currentFreeBlock->Size < size) {
-        if (currentFreeBlock->Next == nullptr) {
-            // Failed to find any free block that is big enough
-            return nullptr;
-        }
+    if (m_HandleTable->handleCapacity() - m_HandleTable->size() < handleCount) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Not enough handles left for the batch.");
+        return AXR_ERROR_OUT_OF_MEMORY;
+    }
 
-        previousFreeBlock = currentFreeBlock;
-        currentFreeBlock = currentFreeBlock->Next;
+    size_t batchSize = 0;
+    for (uint32_t i = 0; i < handleCount; ++i) {
+        const size_t dataSize = sizes == nullptr ? size : sizes[i];
+        batchSize += getRequiredBlockSize(dataSize, alignment);
     }
 
-    prevFreeBlock = previousFreeBlock;
-    return currentFreeBlock;
-}
+    FreeBlockHeader* freeBlock = findFreeBlock(batchSize);
 
-AxrDynamicAllocator::FreeBlockHeader* AxrDynamicAllocator::findAdjacentFreeBlock(const uintptr_t address) const {
-    // This should never be null. The only time it's null is if this allocator is empty and wasn't given any data to
-    // manage. In such case, we shouldn't be calling this function
-    assert(AxrSubAllocatorBase::m_Memory != nullptr);
+    // ---- Allocate separately ----
 
-    if (m_FreeBlocksHead == nullptr) [[unlikely]] {
-        // There are no free blocks and all memory is in use
-        return nullptr;
-    }
+    // There's no single free block big enough for the whole batch. Fall back to allocating each block on its own, which
+    // also takes care of defragmenting if the memory is there but fragmented.
+    if (freeBlock == nullptr) {
+        for (uint32_t i = 0; i < handleCount; ++i) {
+            const size_t dataSize = sizes == nullptr ? size : sizes[i];
 
-    if (reinterpret_cast<uintptr_t>(m_FreeBlocksHead) > address) {
-        // There are no free blocks with a lower address than the given `address`
-        return nullptr;
-    }
+            const AxrResult axrResult = allocateBlock(dataSize, alignment, handles[i], zeroOutMemory, tag);
+            if (AXR_FAILED(axrResult)) [[unlikely]] {
+                deallocateHandleBatch(handles, i);
+                axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to allocate block {}.", i);
+                return AXR_ERROR_OUT_OF_MEMORY;
+            }
+        }
 
-    FreeBlockHeader* currentFreeBlock = m_FreeBlocksHead;
-    while (currentFreeBlock->Next != nullptr && reinterpret_cast<uintptr_t>(currentFreeBlock->Next) < address) {
-        currentFreeBlock = currentFreeBlock->Next;
+        return AXR_SUCCESS;
     }
 
-    return currentFreeBlock;
-}
+    // ---- Allocate from a single free block ----
 
-void AxrDynamicAllocator::mergeFreeBlocks(FreeBlockHeader* freeBlock) {
-    assert(freeBlock != nullptr);
+    const size_t originalFreeBlockSize = freeBlock->Size;
+    const auto originalFreeBlockAddress = reinterpret_cast<uintptr_t>(freeBlock);
 
-    // Continue to merge free blocks if they are connected
-    while (freeBlock->Next != nullptr &&
-           reinterpret_cast<uintptr_t>(freeBlock) + freeBlock->Size == reinterpret_cast<uintptr_t>(freeBlock->Next)) {
-        freeBlock->Size += freeBlock->Next->Size;
-        freeBlock->Next = freeBlock->Next->Next;
+    // Work out where the batch actually ends. Each block only takes as much padding as its address needs
+    uintptr_t batchEndAddress = originalFreeBlockAddress;
+    for (uint32_t i = 0; i < handleCount; ++i) {
+        const size_t dataSize = sizes == nullptr ? size : sizes[i];
+        batchEndAddress += getBlockSize(batchEndAddress, dataSize, alignment);
     }
-}
 
-#define AXR_FUNCTION_FAILED_STRING "Failed to defragment dynamic allocator. "
-void AxrDynamicAllocator::defragment() {
-    // This should never be null. The only time it's null is if this allocator is empty and wasn't given any data to
-    // manage. In such case, we shouldn't be calling this function
-    assert(AxrSubAllocatorBase::m_Memory != nullptr);
+    // Same as `allocateBlock()`, if there isn't enough space left over for a `FreeBlockHeader`, the last data block
+    // takes the whole thing
+    const size_t leftoverSize = originalFreeBlockSize - (batchEndAddress - originalFreeBlockAddress);
+    const bool hasLeftoverFreeBlock = leftoverSize >= sizeof(FreeBlockHeader);
 
-    if (m_FreeBlocksHead == nullptr) [[unlikely]] {
-        // There are no free blocks and all memory is in use
-        return;
-    }
+    removeFreeBlock(freeBlock);
 
-    if (m_FreeBlocksHead->Next == nullptr) {
-        // There are no gaps in free memory, nothing to defragment
-        return;
-    }
+    uintptr_t blockAddress = originalFreeBlockAddress;
+    for (uint32_t i = 0; i < handleCount; ++i) {
+        const size_t dataSize = sizes == nullptr ? size : sizes[i];
+        size_t blockSize = getBlockSize(blockAddress, dataSize, alignment);
+        if (i == handleCount - 1 && !hasLeftoverFreeBlock) {
+            blockSize += leftoverSize;
+        }
 
-    // Defragment a single block:
-    // [DataHeader1][Item1][---Free Block---][DataHeader2][Item2][---Free Block---]
-    // We want to move DataHeader2 and Item2, to where the free block is, and shift the free block to after Item2.
+        // We already checked that there are enough handles, so this can't fail
+        [[maybe_unused]] const AxrResult axrResult = createDataBlock(blockAddress,
+                                                                     blockSize,
+                                                                     alignment,
+                                                                     zeroOutMemory,
+                                                                     handles[i]);
+        assert(AXR_SUCCEEDED(axrResult));
+
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+        AxrAllocationTracker::get().recordAllocation(AxrAllocationTracker::getHandleKey(handles[i].m_Data),
+                                                     dataSize,
+                                                     tag);
+#endif
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+        recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_ALLOCATE,
+                         reinterpret_cast<uintptr_t>(handles[i].m_Data),
+                         dataSize,
+                         alignment);
+#endif
 
-    const auto dataHeader = reinterpret_cast<DataHeader*>(reinterpret_cast<uintptr_t>(m_FreeBlocksHead) +
-                                                          m_FreeBlocksHead->Size);
+        blockAddress += blockSize;
+    }
 
-    // Find the next address that is after the `dataHeader`. Since the data after the header is aligned, we don't know
-    // exactly what the address of it is. We do know that it will be after the address of the header though. So we just
-    // grab the next address after the header.
-    const HandlesTree_T::Node::Iterator dataAddressIterator = m_HandlesTree.findNextLargest(
-        reinterpret_cast<uintptr_t>(dataHeader));
-    if (dataAddressIterator == m_HandlesTree.end()) {
-        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to find the address for the next block to defragment.");
-        return;
+    if (hasLeftoverFreeBlock) {
+        const auto newFreeBlock = reinterpret_cast<FreeBlockHeader*>(blockAddress);
+        newFreeBlock->Size = leftoverSize;
+        insertFreeBlock(newFreeBlock);
     }
 
-    // If a variable has "block" in its name, it's referring to the entire block, meaning the header and data together.
-    const DataHeader originalDataHeader = *dataHeader;
-    const FreeBlockHeader originalFreeBlockHeader = *m_FreeBlocksHead;
+    m_Size += blockAddress - originalFreeBlockAddress;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    if (m_Size > m_PeakSize) {
+        m_PeakSize = m_Size;
+    }
+#endif
 
-    const auto oldDataAddress = *dataAddressIterator;
-    const auto newDataBlockAddress = reinterpret_cast<uintptr_t>(m_FreeBlocksHead);
-    const uintptr_t newDataAddress = axrAlignAddress(newDataBlockAddress + sizeof(DataHeader),
-                                                     originalDataHeader.Alignment);
-    const size_t dataBlockSize = originalDataHeader.Size + sizeof(DataHeader);
-    const size_t dataSize = originalDataHeader.Size - originalDataHeader.Alignment;
+    m_MemoryPressureMonitor.checkHighWaterMark(m_Size - (blockAddress - originalFreeBlockAddress),
+                                               m_Size,
+                                               AxrSubAllocatorBase::m_Capacity,
+                                               blockAddress - originalFreeBlockAddress);
 
-    const uintptr_t newFreeBlockAddress = newDataBlockAddress + dataBlockSize;
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
 
-    // First, move just the data that was allocated, we'll do the headers after. Since we know their data type, we can
-    // easily just copy them so we don't need to worry about data getting overwritten. We can't do it the other way
-    // around because we can't copy the data as easily.
-    // We don't just copy the entire block (header and data) because the data is aligned to a specific address. If we
-    // moved the whole block, we'd need to move just the data portion of it anyway to realign it.
+#define AXR_FUNCTION_FAILED_STRING "Failed to create data block for dynamic allocator. "
+AxrResult AxrDynamicAllocator::createDataBlock(const uintptr_t blockAddress,
+                                               const size_t blockSize,
+                                               const uint8_t alignment,
+                                               const bool zeroOutMemory,
+                                               AxrHandle<void>& handle) {
+    const uintptr_t dataAddress = axrAlignAddress(blockAddress + sizeof(DataHeader), alignment);
+    const size_t paddingSize = dataAddress - sizeof(DataHeader) - blockAddress;
+    const auto allocatedBlock = reinterpret_cast<void*>(dataAddress);
+
+    uint32_t handleIndex = AxrHandleTable::InvalidIndex;
+    const AxrResult axrResult = m_HandleTable->create(allocatedBlock, handleIndex);
+    if (AXR_FAILED(axrResult)) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to create handle.");
+        return AXR_ERROR_OUT_OF_MEMORY;
+    }
+
+    // Mark the padding so that walking the blocks in address order can find the header
+    if (paddingSize != 0) {
+        *reinterpret_cast<DataHeader*>(blockAddress) = DataHeader{
+            .BlockSize = static_cast<uint32_t>(paddingSize),
+            .HandleIndex = 0,
+            .AlignmentShift = 0,
+            .PaddingUnits = 0,
+            .IsPaddingMarker = true,
+            .IsPinned = false,
+        };
+    }
+
+    *reinterpret_cast<DataHeader*>(dataAddress - sizeof(DataHeader)) = DataHeader{
+        .BlockSize = static_cast<uint32_t>(blockSize),
+        .HandleIndex = handleIndex,
+        .AlignmentShift = static_cast<uint32_t>(std::countr_zero(alignment)),
+        .PaddingUnits = static_cast<uint32_t>(paddingSize / BlockAlignment),
+        .IsPaddingMarker = false,
+        .IsPinned = false,
+    };
 
-    memmove(reinterpret_cast<void*>(newDataAddress), reinterpret_cast<void*>(oldDataAddress), dataSize);
-    *reinterpret_cast<DataHeader*>(newDataBlockAddress) = originalDataHeader;
-    // Don't need to change anything about the free block data. The size and .Next pointer wouldn't change
-    *reinterpret_cast<FreeBlockHeader*>(newFreeBlockAddress) = originalFreeBlockHeader;
+    if (zeroOutMemory) {
+        std::memset(allocatedBlock, 0, blockAddress + blockSize - dataAddress);
+    }
 
-    m_FreeBlocksHead = reinterpret_cast<FreeBlockHeader*>(newFreeBlockAddress);
+    AxrHandle<void>::Deallocator_T deallocatorCallback{};
+    deallocatorCallback.connect<&AxrDynamicAllocator::deallocateHandle>(this);
 
-    mergeFreeBlocks(m_FreeBlocksHead);
+    handle = AxrHandle(m_HandleTable->getDataPtr(handleIndex),
+                       deallocatorCallback,
+                       m_HandleTable->getGeneration(handleIndex));
 
-    m_HandlesTree.replace(oldDataAddress, newDataAddress);
+    return AXR_SUCCESS;
 }
 #undef AXR_FUNCTION_FAILED_STRING
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to allocate from free block for dynamic allocator. "
+AxrResult AxrDynamicAllocator::allocateFromFreeBlock(FreeBlockHeader* freeBlock,
+                                                     uintptr_t blockAddress,
+                                                     const size_t size,
+                                                     const uint8_t alignment,
+                                                     const bool zeroOutMemory,
+                                                     AxrHandle<void>& handle,
+                                                     [[maybe_unused]] const AxrAllocationTag& tag) {
+    const size_t originalFreeBlockSize = freeBlock->Size;
+    const auto originalFreeBlockAddress = reinterpret_cast<uintptr_t>(freeBlock);
+    const uintptr_t originalFreeBlockEndAddress = originalFreeBlockAddress + originalFreeBlockSize;
+
+    // If there isn't enough space for a new `FreeBlockHeader` before or after this data block, then the data block
+    // takes that space too. We can't keep track of the new free block anyway.
+    // Yes, it does mean that we could end up giving extra space to many blocks of data which could theoretically be
+    // combined into a single free block. But that adds more complexity than it's worth for a few extra bytes.
+    if (blockAddress - originalFreeBlockAddress < sizeof(FreeBlockHeader)) {
+        blockAddress = originalFreeBlockAddress;
+    }
+    // Now that we know where the block goes, only take as much padding as its address actually needs
+    size_t blockSize = getBlockSize(blockAddress, size, alignment);
+    if (originalFreeBlockEndAddress - (blockAddress + blockSize) < sizeof(FreeBlockHeader)) {
+        blockSize = originalFreeBlockEndAddress - blockAddress;
+    }
+
+    // The free block gets overwritten from here on, so take it out of the free block trees first
+    removeFreeBlock(freeBlock);
+
+    // ---- Allocate Memory ----
+
+    if (AXR_FAILED(createDataBlock(blockAddress, blockSize, alignment, zeroOutMemory, handle))) [[unlikely]] {
+        freeBlock->Size = originalFreeBlockSize;
+        insertFreeBlock(freeBlock);
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to create data block.");
+        return AXR_ERROR_OUT_OF_MEMORY;
+    }
+
+    // ---- Create new free blocks ----
+
+    // We don't need to check if there's enough space for the `FreeBlockHeader`s here. We did that earlier. If we got
+    // here, there's room.
+    if (blockAddress != originalFreeBlockAddress) {
+        // The original free block header is before the data block, so it's still intact
+        freeBlock->Size = blockAddress - originalFreeBlockAddress;
+        insertFreeBlock(freeBlock);
+    }
+
+    if (blockAddress + blockSize != originalFreeBlockEndAddress) {
+        const auto newFreeBlock = reinterpret_cast<FreeBlockHeader*>(blockAddress + blockSize);
+        newFreeBlock->Size = originalFreeBlockEndAddress - (blockAddress + blockSize);
+        insertFreeBlock(newFreeBlock);
+    }
+
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+    AxrAllocationTracker::get().recordAllocation(AxrAllocationTracker::getHandleKey(handle.m_Data), size, tag);
+#endif
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_ALLOCATE, reinterpret_cast<uintptr_t>(handle.m_Data), size, alignment);
+#endif
+
+    m_Size += blockSize;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    if (m_Size > m_PeakSize) {
+        m_PeakSize = m_Size;
+    }
+#endif
+
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+AxrDynamicAllocator::DataHeader* AxrDynamicAllocator::findDataHeader(const AxrHandle<void>& handle) const {
+    if (handle.m_Data == nullptr) {
+        return nullptr;
+    }
+
+    if (!m_HandleTable->isValid(handle.m_Data, handle.m_Generation)) [[unlikely]] {
+        return nullptr;
+    }
+
+    const auto dataAddress = reinterpret_cast<uintptr_t>(*handle.m_Data);
+    // If the given data isn't part of the memory we manage, don't do anything with it
+    if (dataAddress < reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory) ||
+        dataAddress >= reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory) + AxrSubAllocatorBase::m_Capacity)
+        [[unlikely]] {
+        return nullptr;
+    }
+
+    return reinterpret_cast<DataHeader*>(dataAddress - sizeof(DataHeader));
+}
+
+void AxrDynamicAllocator::releaseMemory(const uintptr_t blockAddress, const size_t blockSize) {
+    auto newFreeBlock = reinterpret_cast<FreeBlockHeader*>(blockAddress);
+    newFreeBlock->Size = blockSize;
+
+    // Merge with the free blocks directly before and after this one, if there are any
+    FreeBlockHeader* nextFreeBlock = m_FreeBlocksByAddress.findLowerBound(0, blockAddress);
+    FreeBlockHeader* previousFreeBlock = nextFreeBlock == nullptr ? m_FreeBlocksByAddress.last()
+                                                                  : m_FreeBlocksByAddress.previous(nextFreeBlock);
+
+    if (previousFreeBlock != nullptr && reinterpret_cast<uintptr_t>(previousFreeBlock) + previousFreeBlock->Size ==
+                                            reinterpret_cast<uintptr_t>(newFreeBlock)) {
+        removeFreeBlock(previousFreeBlock);
+        previousFreeBlock->Size += newFreeBlock->Size;
+        newFreeBlock = previousFreeBlock;
+    }
+
+    if (nextFreeBlock != nullptr && reinterpret_cast<uintptr_t>(newFreeBlock) + newFreeBlock->Size ==
+                                        reinterpret_cast<uintptr_t>(nextFreeBlock)) {
+        removeFreeBlock(nextFreeBlock);
+        newFreeBlock->Size += nextFreeBlock->Size;
+    }
+
+    insertFreeBlock(newFreeBlock);
+}
+
+AxrDynamicAllocator::FreeBlockHeader* AxrDynamicAllocator::findFreeBlock(const size_t size) const {
+    // This should never be null. The only time it's null is if this allocator is empty and wasn't given any data to
+    // manage. In such case, we shouldn't be calling this function
+    assert(AxrSubAllocatorBase::m_Memory != nullptr);
+
+    // Best fit. The smallest free block that is big enough for the requested size, and the lowest address out of those
+    // that are the same size.
+    return m_FreeBlocksBySize.findLowerBound(size, 0);
+}
+
+AxrDynamicAllocator::FreeBlockHeader* AxrDynamicAllocator::findHighestFreeBlock(const size_t size) const {
+    // Linear search, but pinned allocations should be rare and there are usually few free blocks at the top
+    FreeBlockHeader* freeBlock = m_FreeBlocksByAddress.last();
+    while (freeBlock != nullptr && freeBlock->Size < size) {
+        freeBlock = m_FreeBlocksByAddress.previous(freeBlock);
+    }
+
+    return freeBlock;
+}
+
+void AxrDynamicAllocator::shrinkBlock(DataHeader* dataHeader, const size_t blockSize) {
+    const size_t originalBlockSize = dataHeader->BlockSize;
+    assert(blockSize <= originalBlockSize);
+
+    // If there isn't enough space for a new `FreeBlockHeader`, then the block just keeps the extra space
+    if (originalBlockSize - blockSize < sizeof(FreeBlockHeader)) {
+        return;
+    }
+
+    dataHeader->BlockSize = blockSize;
+
+    const uintptr_t newFreeBlockAddress = getBlockAddress(dataHeader) + blockSize;
+    const auto newFreeBlock = reinterpret_cast<FreeBlockHeader*>(newFreeBlockAddress);
+    newFreeBlock->Size = originalBlockSize - blockSize;
+
+    // Merge with the next free block if they are connected
+    FreeBlockHeader* nextFreeBlock = m_FreeBlocksByAddress.findLowerBound(0, newFreeBlockAddress);
+    if (nextFreeBlock != nullptr &&
+        newFreeBlockAddress + newFreeBlock->Size == reinterpret_cast<uintptr_t>(nextFreeBlock)) {
+        removeFreeBlock(nextFreeBlock);
+        newFreeBlock->Size += nextFreeBlock->Size;
+    }
+
+    insertFreeBlock(newFreeBlock);
+
+    m_Size -= originalBlockSize - blockSize;
+}
+
+void AxrDynamicAllocator::insertFreeBlock(FreeBlockHeader* freeBlock) {
+    m_FreeBlocksBySize.insert(freeBlock);
+    m_FreeBlocksByAddress.insert(freeBlock);
+}
+
+void AxrDynamicAllocator::removeFreeBlock(FreeBlockHeader* freeBlock) {
+    m_FreeBlocksBySize.remove(freeBlock);
+    m_FreeBlocksByAddress.remove(freeBlock);
+}
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to defragment dynamic allocator. "
+size_t AxrDynamicAllocator::defragment() {
+    // This should never be null. The only time it's null is if this allocator is empty and wasn't given any data to
+    // manage. In such case, we shouldn't be calling this function
+    assert(AxrSubAllocatorBase::m_Memory != nullptr);
+
+    if (isRelocationLocked()) {
+        return 0;
+    }
+
+    FreeBlockHeader* freeBlock = m_FreeBlocksByAddress.first();
+    if (freeBlock == nullptr) [[unlikely]] {
+        // There are no free blocks and all memory is in use
+        return 0;
+    }
+
+    FreeBlockHeader* nextFreeBlock = m_FreeBlocksByAddress.next(freeBlock);
+    // Pinned blocks can't be moved, so skip over any gap that's directly before one. Neighbouring free blocks are
+    // always merged, so there's always a data block directly after a free block that isn't the last one.
+    while (nextFreeBlock != nullptr &&
+           getDataHeader(reinterpret_cast<uintptr_t>(freeBlock) + freeBlock->Size)->IsPinned) {
+        freeBlock = nextFreeBlock;
+        nextFreeBlock = m_FreeBlocksByAddress.next(freeBlock);
+    }
+
+    if (nextFreeBlock == nullptr) {
+        // There are no gaps in free memory, nothing to defragment
+        return 0;
+    }
+
+    // Defragment a single block:
+    // [DataHeader1][Item1][---Free Block---][Padding2][DataHeader2][Item2][---Free Block---]
+    // We want to move DataHeader2 and Item2, to where the free block is, and shift the free block to after Item2.
+    // The data has to stay aligned, so it can only move by a multiple of its alignment. Whatever's left over becomes
+    // its new padding.
+
+    // If a variable has "block" in its name, it's referring to the entire block, meaning the padding, header and data.
+    const size_t freeBlockSize = freeBlock->Size;
+    const auto newDataBlockAddress = reinterpret_cast<uintptr_t>(freeBlock);
+    const uintptr_t oldDataBlockAddress = newDataBlockAddress + freeBlockSize;
+    const DataHeader originalDataHeader = *getDataHeader(oldDataBlockAddress);
+
+    const size_t oldPaddingSize = originalDataHeader.PaddingUnits * BlockAlignment;
+    const size_t alignment = std::max(size_t(1) << originalDataHeader.AlignmentShift, BlockAlignment);
+    const size_t newPaddingSize = (oldPaddingSize + freeBlockSize) % alignment;
+    const size_t moveDistance = oldPaddingSize + freeBlockSize - newPaddingSize;
+
+    const uintptr_t oldDataAddress = oldDataBlockAddress + oldPaddingSize + sizeof(DataHeader);
+    const uintptr_t newDataAddress = oldDataAddress - moveDistance;
+    const size_t dataSize = getDataCapacity(&originalDataHeader);
+    size_t dataBlockSize = newPaddingSize + sizeof(DataHeader) + dataSize;
+
+    // The free block gets overwritten by the data, so take it out of the free block trees first
+    removeFreeBlock(freeBlock);
+
+    // First, move just the data, we'll do the headers after. We already have a copy of the data header, so it doesn't
+    // matter if the data overwrites it.
+    if (moveDistance != 0) {
+        memmove(reinterpret_cast<void*>(newDataAddress), reinterpret_cast<void*>(oldDataAddress), dataSize);
+    }
+
+    // The space freed up after the data is the same size as the distance it moved
+    const uintptr_t newFreeBlockAddress = newDataBlockAddress + dataBlockSize;
+    if (newFreeBlockAddress + moveDistance == reinterpret_cast<uintptr_t>(nextFreeBlock)) {
+        // Merge with the next free block since they are now connected
+        removeFreeBlock(nextFreeBlock);
+
+        const auto newFreeBlock = reinterpret_cast<FreeBlockHeader*>(newFreeBlockAddress);
+        newFreeBlock->Size = moveDistance + nextFreeBlock->Size;
+        insertFreeBlock(newFreeBlock);
+    } else if (moveDistance >= sizeof(FreeBlockHeader)) {
+        const auto newFreeBlock = reinterpret_cast<FreeBlockHeader*>(newFreeBlockAddress);
+        newFreeBlock->Size = moveDistance;
+        insertFreeBlock(newFreeBlock);
+    } else {
+        // Too small to keep track of, so the data block takes it
+        dataBlockSize += moveDistance;
+    }
+
+    if (newPaddingSize != 0) {
+        *reinterpret_cast<DataHeader*>(newDataBlockAddress) = DataHeader{
+            .BlockSize = static_cast<uint32_t>(newPaddingSize),
+            .HandleIndex = 0,
+            .AlignmentShift = 0,
+            .PaddingUnits = 0,
+            .IsPaddingMarker = true,
+            .IsPinned = false,
+        };
+    }
+
+    DataHeader dataHeader = originalDataHeader;
+    dataHeader.BlockSize = static_cast<uint32_t>(dataBlockSize);
+    dataHeader.PaddingUnits = static_cast<uint32_t>(newPaddingSize / BlockAlignment);
+    *reinterpret_cast<DataHeader*>(newDataAddress - sizeof(DataHeader)) = dataHeader;
+
+    if (moveDistance != 0) {
+        m_HandleTable->relocate(originalDataHeader.HandleIndex, reinterpret_cast<void*>(newDataAddress));
+    }
+
+    // The free space that became padding or was taken by the data block is now in use
+    m_Size += dataBlockSize;
+    m_Size -= originalDataHeader.BlockSize;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    if (m_Size > m_PeakSize) {
+        m_PeakSize = m_Size;
+    }
+#endif
+
+    return dataBlockSize;
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+// ----------------------------------------- //
+// Free Block Tree
+// ----------------------------------------- //
+
+AxrDynamicAllocator::FreeBlockTree::FreeBlockTree() = default;
+
+AxrDynamicAllocator::FreeBlockTree::FreeBlockTree(const uintptr_t baseAddress, const OrderBy orderBy) :
+    m_BaseAddress(baseAddress),
+    m_OrderBy(orderBy) {
+}
+
+void AxrDynamicAllocator::FreeBlockTree::insert(FreeBlockHeader* freeBlock) {
+    assert(freeBlock != nullptr);
+
+    const size_t size = freeBlock->Size;
+    const auto address = reinterpret_cast<uintptr_t>(freeBlock);
+
+    // Standard binary search tree insertion
+    FreeBlockHeader* parent = nullptr;
+    FreeBlockHeader* current = getRoot();
+    bool isLeft = false;
+    while (current != nullptr) {
+        parent = current;
+        isLeft = !isOrderedBefore(current, size, address);
+        current = isLeft ? getLeft(current) : getRight(current);
+    }
+
+    getLinks(freeBlock) = FreeBlockLinks{
+        .Left = InvalidOffset,
+        .Right = InvalidOffset,
+        .Parent = toOffset(parent),
+    };
+    getIsRed(freeBlock) = true;
+
+    if (parent == nullptr) {
+        setRoot(freeBlock);
+    } else if (isLeft) {
+        setLeft(parent, freeBlock);
+    } else {
+        setRight(parent, freeBlock);
+    }
+
+    fixInsertion(freeBlock);
+}
+
+void AxrDynamicAllocator::FreeBlockTree::remove(FreeBlockHeader* freeBlock) {
+    // Red black tree deletion algorithm reference:
+    // Introduction to Algorithms (Cormen et al.), chapter 13.4
+
+    assert(freeBlock != nullptr);
+
+    FreeBlockHeader* replacement = nullptr;
+    FreeBlockHeader* replacementParent = nullptr;
+    bool removedColorIsRed = isRed(freeBlock);
+
+    if (getLeft(freeBlock) == nullptr) {
+        replacement = getRight(freeBlock);
+        replacementParent = getParent(freeBlock);
+        transplant(freeBlock, replacement);
+    } else if (getRight(freeBlock) == nullptr) {
+        replacement = getLeft(freeBlock);
+        replacementParent = getParent(freeBlock);
+        transplant(freeBlock, replacement);
+    } else {
+        FreeBlockHeader* successor = minimum(getRight(freeBlock));
+        removedColorIsRed = isRed(successor);
+        replacement = getRight(successor);
+
+        if (getParent(successor) == freeBlock) {
+            replacementParent = successor;
+        } else {
+            replacementParent = getParent(successor);
+            transplant(successor, replacement);
+            setRight(successor, getRight(freeBlock));
+            setParent(getRight(successor), successor);
+        }
+
+        transplant(freeBlock, successor);
+        setLeft(successor, getLeft(freeBlock));
+        setParent(getLeft(successor), successor);
+        setRed(successor, isRed(freeBlock));
+    }
+
+    if (!removedColorIsRed) {
+        fixRemoval(replacement, replacementParent);
+    }
+}
+
+AxrDynamicAllocator::FreeBlockHeader* AxrDynamicAllocator::FreeBlockTree::findLowerBound(const size_t size,
+                                                                                        const uintptr_t address) const {
+    FreeBlockHeader* lowerBound = nullptr;
+    FreeBlockHeader* current = getRoot();
+
+    while (current != nullptr) {
+        if (isOrderedBefore(current, size, address)) {
+            current = getRight(current);
+        } else {
+            lowerBound = current;
+            current = getLeft(current);
+        }
+    }
+
+    return lowerBound;
+}
+
+AxrDynamicAllocator::FreeBlockHeader* AxrDynamicAllocator::FreeBlockTree::first() const {
+    FreeBlockHeader* root = getRoot();
+    if (root == nullptr) {
+        return nullptr;
+    }
+
+    return minimum(root);
+}
+
+AxrDynamicAllocator::FreeBlockHeader* AxrDynamicAllocator::FreeBlockTree::last() const {
+    FreeBlockHeader* root = getRoot();
+    if (root == nullptr) {
+        return nullptr;
+    }
+
+    return maximum(root);
+}
+
+AxrDynamicAllocator::FreeBlockHeader* AxrDynamicAllocator::FreeBlockTree::next(
+    const FreeBlockHeader* freeBlock) const {
+    assert(freeBlock != nullptr);
+
+    FreeBlockHeader* right = getRight(freeBlock);
+    if (right != nullptr) {
+        return minimum(right);
+    }
+
+    // If there's no right subtree, the next free block is the first parent that we reach from its left subtree
+    FreeBlockHeader* parent = getParent(freeBlock);
+    while (parent != nullptr && freeBlock == getRight(parent)) {
+        freeBlock = parent;
+        parent = getParent(parent);
+    }
+
+    return parent;
+}
+
+AxrDynamicAllocator::FreeBlockHeader* AxrDynamicAllocator::FreeBlockTree::previous(
+    const FreeBlockHeader* freeBlock) const {
+    assert(freeBlock != nullptr);
+
+    FreeBlockHeader* left = getLeft(freeBlock);
+    if (left != nullptr) {
+        return maximum(left);
+    }
+
+    // If there's no left subtree, the previous free block is the first parent that we reach from its right subtree
+    FreeBlockHeader* parent = getParent(freeBlock);
+    while (parent != nullptr && freeBlock == getLeft(parent)) {
+        freeBlock = parent;
+        parent = getParent(parent);
+    }
+
+    return parent;
+}
+
+bool AxrDynamicAllocator::FreeBlockTree::empty() const {
+    return m_RootOffset == InvalidOffset;
+}
+
+#ifdef AXR_TESTING_ENABLED
+bool AxrDynamicAllocator::FreeBlockTree::isValid() const {
+    const FreeBlockHeader* root = getRoot();
+    if (isRed(root) || (root != nullptr && getParent(root) != nullptr)) {
+        return false;
+    }
+
+    uint32_t blackHeight = UINT32_MAX;
+    const FreeBlockHeader* previousFreeBlock = nullptr;
+    for (const FreeBlockHeader* freeBlock = first(); freeBlock != nullptr; freeBlock = next(freeBlock)) {
+        // Links go both ways
+        const FreeBlockHeader* left = getLeft(freeBlock);
+        const FreeBlockHeader* right = getRight(freeBlock);
+        if ((left != nullptr && getParent(left) != freeBlock) || (right != nullptr && getParent(right) != freeBlock)) {
+            return false;
+        }
+
+        // Red free blocks only have black children
+        if (isRed(freeBlock) && (isRed(left) || isRed(right))) {
+            return false;
+        }
+
+        // Every path from the root to a leaf goes through the same number of black free blocks
+        if (left == nullptr || right == nullptr) {
+            uint32_t pathBlackHeight = 0;
+            for (const FreeBlockHeader* ancestor = freeBlock; ancestor != nullptr; ancestor = getParent(ancestor)) {
+                pathBlackHeight += isRed(ancestor) ? 0 : 1;
+            }
+
+            if (blackHeight != UINT32_MAX && pathBlackHeight != blackHeight) {
+                return false;
+            }
+            blackHeight = pathBlackHeight;
+        }
+
+        if (previousFreeBlock != nullptr &&
+            !isOrderedBefore(previousFreeBlock, freeBlock->Size, reinterpret_cast<uintptr_t>(freeBlock))) {
+            return false;
+        }
+        previousFreeBlock = freeBlock;
+    }
+
+    return true;
+}
+#endif
+
+uint32_t AxrDynamicAllocator::FreeBlockTree::getRootOffset() const {
+    return m_RootOffset;
+}
+
+void AxrDynamicAllocator::FreeBlockTree::setRootOffset(const uint32_t rootOffset) {
+    m_RootOffset = rootOffset;
+}
+
+AxrDynamicAllocator::FreeBlockLinks& AxrDynamicAllocator::FreeBlockTree::getLinks(
+    const FreeBlockHeader* freeBlock) const {
+    assert(freeBlock != nullptr);
+
+    // The links are a part of the free block memory that this tree manages. They aren't actually const
+    auto* mutableFreeBlock = const_cast<FreeBlockHeader*>(freeBlock);
+    return m_OrderBy == OrderBy::Size ? mutableFreeBlock->SizeLinks : mutableFreeBlock->AddressLinks;
+}
+
+bool& AxrDynamicAllocator::FreeBlockTree::getIsRed(const FreeBlockHeader* freeBlock) const {
+    assert(freeBlock != nullptr);
+
+    // The colors are a part of the free block memory that this tree manages. They aren't actually const
+    auto* mutableFreeBlock = const_cast<FreeBlockHeader*>(freeBlock);
+    return m_OrderBy == OrderBy::Size ? mutableFreeBlock->IsRedBySize : mutableFreeBlock->IsRedByAddress;
+}
+
+AxrDynamicAllocator::FreeBlockHeader* AxrDynamicAllocator::FreeBlockTree::toFreeBlock(const uint32_t offset) const {
+    if (offset == InvalidOffset) {
+        return nullptr;
+    }
+
+    return reinterpret_cast<FreeBlockHeader*>(m_BaseAddress + offset);
+}
+
+uint32_t AxrDynamicAllocator::FreeBlockTree::toOffset(const FreeBlockHeader* freeBlock) const {
+    if (freeBlock == nullptr) {
+        return InvalidOffset;
+    }
+
+    return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(freeBlock) - m_BaseAddress);
+}
+
+bool AxrDynamicAllocator::FreeBlockTree::isOrderedBefore(const FreeBlockHeader* freeBlock,
+                                                         const size_t size,
+                                                         const uintptr_t address) const {
+    const auto freeBlockAddress = reinterpret_cast<uintptr_t>(freeBlock);
+
+    if (m_OrderBy == OrderBy::Size && freeBlock->Size != size) {
+        return freeBlock->Size < size;
+    }
+
+    return freeBlockAddress < address;
+}
+
+AxrDynamicAllocator::FreeBlockHeader* AxrDynamicAllocator::FreeBlockTree::getRoot() const {
+    return toFreeBlock(m_RootOffset);
+}
+
+AxrDynamicAllocator::FreeBlockHeader* AxrDynamicAllocator::FreeBlockTree::getLeft(
+    const FreeBlockHeader* freeBlock) const {
+    return toFreeBlock(getLinks(freeBlock).Left);
+}
+
+AxrDynamicAllocator::FreeBlockHeader* AxrDynamicAllocator::FreeBlockTree::getRight(
+    const FreeBlockHeader* freeBlock) const {
+    return toFreeBlock(getLinks(freeBlock).Right);
+}
+
+AxrDynamicAllocator::FreeBlockHeader* AxrDynamicAllocator::FreeBlockTree::getParent(
+    const FreeBlockHeader* freeBlock) const {
+    return toFreeBlock(getLinks(freeBlock).Parent);
+}
+
+bool AxrDynamicAllocator::FreeBlockTree::isRed(const FreeBlockHeader* freeBlock) const {
+    return freeBlock != nullptr && getIsRed(freeBlock);
+}
+
+void AxrDynamicAllocator::FreeBlockTree::setRoot(const FreeBlockHeader* freeBlock) {
+    m_RootOffset = toOffset(freeBlock);
+}
+
+void AxrDynamicAllocator::FreeBlockTree::setLeft(const FreeBlockHeader* freeBlock,
+                                                 const FreeBlockHeader* left) const {
+    getLinks(freeBlock).Left = toOffset(left);
+}
+
+void AxrDynamicAllocator::FreeBlockTree::setRight(const FreeBlockHeader* freeBlock,
+                                                  const FreeBlockHeader* right) const {
+    getLinks(freeBlock).Right = toOffset(right);
+}
+
+void AxrDynamicAllocator::FreeBlockTree::setParent(const FreeBlockHeader* freeBlock,
+                                                   const FreeBlockHeader* parent) const {
+    getLinks(freeBlock).Parent = toOffset(parent);
+}
+
+void AxrDynamicAllocator::FreeBlockTree::setRed(const FreeBlockHeader* freeBlock, const bool isRed) const {
+    if (freeBlock == nullptr) {
+        return;
+    }
+
+    getIsRed(freeBlock) = isRed;
+}
+
+AxrDynamicAllocator::FreeBlockHeader* AxrDynamicAllocator::FreeBlockTree::minimum(FreeBlockHeader* freeBlock) const {
+    assert(freeBlock != nullptr);
+
+    FreeBlockHeader* left = getLeft(freeBlock);
+    while (left != nullptr) {
+        freeBlock = left;
+        left = getLeft(freeBlock);
+    }
+
+    return freeBlock;
+}
+
+AxrDynamicAllocator::FreeBlockHeader* AxrDynamicAllocator::FreeBlockTree::maximum(FreeBlockHeader* freeBlock) const {
+    assert(freeBlock != nullptr);
+
+    FreeBlockHeader* right = getRight(freeBlock);
+    while (right != nullptr) {
+        freeBlock = right;
+        right = getRight(freeBlock);
+    }
+
+    return freeBlock;
+}
+
+void AxrDynamicAllocator::FreeBlockTree::rotateLeft(FreeBlockHeader* freeBlock) {
+    assert(freeBlock != nullptr);
+
+    FreeBlockHeader* newParent = getRight(freeBlock);
+    assert(newParent != nullptr);
+
+    setRight(freeBlock, getLeft(newParent));
+    if (getLeft(newParent) != nullptr) {
+        setParent(getLeft(newParent), freeBlock);
+    }
+
+    transplant(freeBlock, newParent);
+
+    setLeft(newParent, freeBlock);
+    setParent(freeBlock, newParent);
+}
+
+void AxrDynamicAllocator::FreeBlockTree::rotateRight(FreeBlockHeader* freeBlock) {
+    assert(freeBlock != nullptr);
+
+    FreeBlockHeader* newParent = getLeft(freeBlock);
+    assert(newParent != nullptr);
+
+    setLeft(freeBlock, getRight(newParent));
+    if (getRight(newParent) != nullptr) {
+        setParent(getRight(newParent), freeBlock);
+    }
+
+    transplant(freeBlock, newParent);
+
+    setRight(newParent, freeBlock);
+    setParent(freeBlock, newParent);
+}
+
+void AxrDynamicAllocator::FreeBlockTree::transplant(const FreeBlockHeader* original, FreeBlockHeader* replacement) {
+    assert(original != nullptr);
+
+    FreeBlockHeader* parent = getParent(original);
+
+    if (parent == nullptr) {
+        setRoot(replacement);
+    } else if (original == getLeft(parent)) {
+        setLeft(parent, replacement);
+    } else {
+        setRight(parent, replacement);
+    }
+
+    if (replacement != nullptr) {
+        setParent(replacement, parent);
+    }
+}
+
+void AxrDynamicAllocator::FreeBlockTree::fixInsertion(FreeBlockHeader* freeBlock) {
+    // Red black tree insertion algorithm reference:
+    // Introduction to Algorithms (Cormen et al.), chapter 13.3
+
+    assert(freeBlock != nullptr);
+
+    // If the parent is red, then it can't be the root. So there's always a grandparent.
+    while (isRed(getParent(freeBlock))) {
+        FreeBlockHeader* parent = getParent(freeBlock);
+        FreeBlockHeader* grandparent = getParent(parent);
+
+        if (parent == getLeft(grandparent)) {
+            FreeBlockHeader* uncle = getRight(grandparent);
+
+            if (isRed(uncle)) {
+                setRed(parent, false);
+                setRed(uncle, false);
+                setRed(grandparent, true);
+
+                // Repeat the loop with the grandparent
+                freeBlock = grandparent;
+                continue;
+            }
+
+            if (freeBlock == getRight(parent)) {
+                freeBlock = parent;
+                rotateLeft(freeBlock);
+                parent = getParent(freeBlock);
+            }
+
+            setRed(parent, false);
+            setRed(grandparent, true);
+            rotateRight(grandparent);
+        } else {
+            FreeBlockHeader* uncle = getLeft(grandparent);
+
+            if (isRed(uncle)) {
+                setRed(parent, false);
+                setRed(uncle, false);
+                setRed(grandparent, true);
+
+                // Repeat the loop with the grandparent
+                freeBlock = grandparent;
+                continue;
+            }
+
+            if (freeBlock == getLeft(parent)) {
+                freeBlock = parent;
+                rotateRight(freeBlock);
+                parent = getParent(freeBlock);
+            }
+
+            setRed(parent, false);
+            setRed(grandparent, true);
+            rotateLeft(grandparent);
+        }
+    }
+
+    // Make sure the root is always black.
+    setRed(getRoot(), false);
+}
+
+void AxrDynamicAllocator::FreeBlockTree::fixRemoval(FreeBlockHeader* freeBlock, FreeBlockHeader* parent) {
+    // Red black tree deletion algorithm reference:
+    // Introduction to Algorithms (Cormen et al.), chapter 13.4
+
+    // Keep in mind, `freeBlock` can be null, and a null free block is considered to be black. That's why we keep track
+    // of the parent separately.
+    while (freeBlock != getRoot() && !isRed(freeBlock)) {
+        // A black free block was removed from this side, so the sibling side must have at least one black free block.
+        // Meaning the sibling can never be null here.
+        if (freeBlock == getLeft(parent)) {
+            FreeBlockHeader* sibling = getRight(parent);
+
+            if (isRed(sibling)) {
+                setRed(sibling, false);
+                setRed(parent, true);
+                rotateLeft(parent);
+                sibling = getRight(parent);
+            }
+
+            if (!isRed(getLeft(sibling)) && !isRed(getRight(sibling))) {
+                setRed(sibling, true);
+                freeBlock = parent;
+                parent = getParent(freeBlock);
+                continue;
+            }
+
+            if (!isRed(getRight(sibling))) {
+                setRed(getLeft(sibling), false);
+                setRed(sibling, true);
+                rotateRight(sibling);
+                sibling = getRight(parent);
+            }
+
+            setRed(sibling, isRed(parent));
+            setRed(parent, false);
+            setRed(getRight(sibling), false);
+            rotateLeft(parent);
+        } else {
+            FreeBlockHeader* sibling = getLeft(parent);
+
+            if (isRed(sibling)) {
+                setRed(sibling, false);
+                setRed(parent, true);
+                rotateRight(parent);
+                sibling = getLeft(parent);
+            }
+
+            if (!isRed(getLeft(sibling)) && !isRed(getRight(sibling))) {
+                setRed(sibling, true);
+                freeBlock = parent;
+                parent = getParent(freeBlock);
+                continue;
+            }
+
+            if (!isRed(getLeft(sibling))) {
+                setRed(getRight(sibling), false);
+                setRed(sibling, true);
+                rotateLeft(sibling);
+                sibling = getLeft(parent);
+            }
+
+            setRed(sibling, isRed(parent));
+            setRed(parent, false);
+            setRed(getLeft(sibling), false);
+            rotateRight(parent);
+        }
+
+        // The tree is balanced again
+        freeBlock = getRoot();
+    }
+
+    setRed(freeBlock, false);
+}
@@ -3,34 +3,92 @@
 // ----------------------------------------- //
 // Headers
 // ----------------------------------------- //
-#include "../common/containers/redBlackTree_pool.h"
 #include "../common/handle.h"
+#include "allocationTracker.h"
+#include "handleTable.h"
+#include "memoryPressure.h"
 #include "subAllocatorBase.h"
 
-// TODO (Ashe): This is implemented as a linked list dynamic allocator. Look into making it a Red Black Tree
-//  (Ref = https://github.com/mtrebi/memory-allocators?tab=readme-ov-file#red-black-tree-data-structure) dynamic
-//  allocator for better performance
+#include <algorithm>
 
-/// Dynamic allocator
-class AxrDynamicAllocator : public AxrSubAllocatorBase {
-public:
-    // ----------------------------------------- //
-    // Types
-    // ----------------------------------------- //
-
-    using HandlesTree_T = AxrRedBlackTree_Pool<uintptr_t>;
+// ----------------------------------------- //
+// Dynamic Allocator
+// ----------------------------------------- //
 
+/// Dynamic allocator.
+/// Free blocks are tracked by two intrusive red black trees
+/// (Ref = https://github.com/mtrebi/memory-allocators?tab=readme-ov-file#red-black-tree-data-structure).
+/// One is ordered by size for O(log n) best fit allocations. The other is ordered by address for O(log n) merging of
+/// neighbouring free blocks.
+/// Defragmentation relocates data, so data must be accessed through its handle. Pinned blocks are never relocated by
+/// defragmentation, and relocation can be locked for a while, to allow holding on to raw data pointers instead.
+class AxrDynamicAllocator : public AxrSubAllocatorBase_Aligned<void*> {
+public:
     // ----------------------------------------- //
     // Public Structs
     // ----------------------------------------- //
 
-    /// Describes the data item that is immediately after this header
+    /// Describes the data item that is immediately after this header.
+    /// Headers sit straight before the data, so they share its alignment of at least `BlockAlignment`. If the data
+    /// needs a bigger alignment, the padding goes before the header, and starts with a padding marker.
     struct DataHeader {
-        /// The size of the data following this header. Does NOT include the size of the header itself
+        /// The size of the whole data block. Includes the size of this header and the padding before it
+        uint32_t BlockSize;
+        /// The handle table slot that points to this data. Lets defragmentation update the handle in O(1)
+        uint32_t HandleIndex : 23;
+        /// Log2 of the data alignment
+        uint32_t AlignmentShift : 3;
+        /// The amount of padding before this header, in multiples of `BlockAlignment`
+        uint32_t PaddingUnits : 4;
+        /// True if this is the padding marker at the start of a block rather than the header of the data.
+        /// For padding markers, `BlockSize` is the size of the padding instead.
+        uint32_t IsPaddingMarker : 1;
+        /// True if defragmentation must never move this data
+        uint32_t IsPinned : 1;
+    };
+
+    /// Limits for a single incremental defragmentation step.
+    /// Defragmentation stops as soon as either limit is reached. A limit of 0 means that limit isn't used.
+    struct DefragmentBudget {
+        /// The max amount of time to spend defragmenting, in microseconds
+        uint32_t MaxMicroseconds;
+        /// The max number of bytes to move. The last block moved may go over this limit
+        size_t MaxBytes;
+    };
+
+    /// Results of a single incremental defragmentation step
+    struct DefragmentProgress {
+        /// The number of data blocks that were moved
+        uint32_t BlocksMoved;
+        /// The number of bytes that were moved, including data headers
+        size_t BytesMoved;
+        /// True if there's nothing left to defragment. All free memory is in a single free block, or the rest is kept
+        /// apart by pinned blocks
+        bool IsComplete;
+        /// The fragmentation ratio after this step. See `getFragmentationRatio()`
+        float FragmentationRatio;
+    };
+
+    /// Allocator state that lives outside of the allocator's memory. Saved along with the memory in allocator snapshots
+    struct SnapshotState {
+        uint32_t FreeBlocksBySizeRootOffset;
+        uint32_t FreeBlocksByAddressRootOffset;
         size_t Size;
-        uint8_t Alignment;
     };
 
+    // ----------------------------------------- //
+    // Public Constants
+    // ----------------------------------------- //
+
+    /// Alignment of every block. All block addresses and sizes are a multiple of this
+    static constexpr size_t BlockAlignment = alignof(void*);
+    /// The max size in bytes of the memory this allocator can manage. Free block links are stored as 32 bit offsets
+    static constexpr size_t MaxCapacity = UINT32_MAX - 1;
+    /// The max number of handles the handle table can have. Limited by the size of `DataHeader::HandleIndex`
+    static constexpr size_t MaxHandleCount = (1 << 23) - 1;
+
+    static_assert(sizeof(DataHeader) == BlockAlignment);
+
     // ----------------------------------------- //
     // Special Functions
     // ----------------------------------------- //
@@ -41,9 +99,8 @@ public:
     AxrDynamicAllocator();
     /// Constructor
     /// @param memoryBlock Memory block to use
-    /// @param handlesAllocator The handles allocator to use
-    /// used to store the handles. Use `getHandlesMemoryBlockCapacity()` and add the result to the `size` parameter.
-    AxrDynamicAllocator(const AxrMemoryBlock& memoryBlock, AxrPoolAllocator<HandlesTree_T::Node>* handlesAllocator);
+    /// @param handleTable The handle table to store the handles in. Must outlive this allocator
+    AxrDynamicAllocator(const AxrMemoryBlock& memoryBlock, AxrHandleTable* handleTable);
     /// Copy Constructor
     /// @param src Source AxrDynamicAllocator to copy from
     AxrDynamicAllocator(const AxrDynamicAllocator& src) = delete;
@@ -74,56 +131,168 @@ public:
     /// @param alignment Memory alignment
     /// @param handle Output allocated memory handle
     /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
     /// @return AXR_SUCCESS if the function succeeded.
     /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space for the requested memory.
     [[nodiscard]] AxrResult allocateBlock(size_t size,
                                           uint8_t alignment,
                                           AxrHandle<void>& handle,
-                                          bool zeroOutMemory = false);
+                                          bool zeroOutMemory = false,
+                                          const AxrAllocationTag& tag = {});
 
     /// Allocate new memory
     /// @tparam Type The memory data type
     /// @param size The number of data items of type `Type` to store in memory
     /// @param handle Output allocated memory handle
     /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
     /// @return AXR_SUCCESS if the function succeeded.
     /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space for the requested memory.
     template<typename Type>
-    [[nodiscard]] AxrResult allocate(const size_t size, AxrHandle<Type>& handle, const bool zeroOutMemory = false) {
+    [[nodiscard]] AxrResult allocate(const size_t size,
+                                     AxrHandle<Type>& handle,
+                                     const bool zeroOutMemory = false,
+                                     const AxrAllocationTag& tag = {}) {
         return allocateBlock(sizeof(Type) * size,
                              alignof(Type),
                              reinterpret_cast<AxrHandle<void>&>(handle),
-                             zeroOutMemory);
+                             zeroOutMemory,
+                             tag);
     }
-    
-    /// Reallocate an existing memory block
+
+    /// Allocate many memory blocks at once.
+    /// The blocks are carved out of a single free block when there's one big enough for all of them, so the free block
+    /// search only happens once. Otherwise, each block is allocated separately. Every block gets its own handle and can
+    /// be deallocated on its own.
+    /// Either all blocks are allocated, or none of them are.
+    /// @param sizes Size in bytes of each memory block. Must contain `handleCount` sizes
+    /// @param alignment Memory alignment for all memory blocks
+    /// @param handles Output allocated memory handles. Must contain `handleCount` handles
+    /// @param handleCount The number of memory blocks to allocate
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space for the requested memory.
+    [[nodiscard]] AxrResult allocateBlockBatch(const size_t* sizes,
+                                               uint8_t alignment,
+                                               AxrHandle<void>* handles,
+                                               uint32_t handleCount,
+                                               bool zeroOutMemory = false,
+                                               const AxrAllocationTag& tag = {});
+    /// Allocate many memory blocks of the same size at once.
+    /// See `allocateBlockBatch()` above for details.
+    /// @param size Size in bytes of each memory block
+    /// @param alignment Memory alignment for all memory blocks
+    /// @param handles Output allocated memory handles. Must contain `handleCount` handles
+    /// @param handleCount The number of memory blocks to allocate
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space for the requested memory.
+    [[nodiscard]] AxrResult allocateBlockBatch(size_t size,
+                                               uint8_t alignment,
+                                               AxrHandle<void>* handles,
+                                               uint32_t handleCount,
+                                               bool zeroOutMemory = false,
+                                               const AxrAllocationTag& tag = {});
+
+    /// Allocate many memory blocks of the same size at once.
+    /// See `allocateBlockBatch()` for details.
+    /// @tparam Type The memory data type
+    /// @param size The number of data items of type `Type` to store in each memory block
+    /// @param handles Output allocated memory handles. Must contain `handleCount` handles
+    /// @param handleCount The number of memory blocks to allocate
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space for the requested memory.
+    template<typename Type>
+    [[nodiscard]] AxrResult allocateBatch(const size_t size,
+                                          AxrHandle<Type>* handles,
+                                          const uint32_t handleCount,
+                                          const bool zeroOutMemory = false,
+                                          const AxrAllocationTag& tag = {}) {
+        return allocateBlockBatch(sizeof(Type) * size,
+                                  alignof(Type),
+                                  reinterpret_cast<AxrHandle<void>*>(handles),
+                                  handleCount,
+                                  zeroOutMemory,
+                                  tag);
+    }
+
+    /// Allocate a new pinned memory block.
+    /// Pinned blocks are never moved by defragmentation, so the data pointer stays valid for as long as the block is
+    /// allocated. They are placed as high up in memory as possible so they get in the way of defragmentation the least.
+    /// @param size Size in bytes for how much memory to allocate
+    /// @param alignment Memory alignment
+    /// @param handle Output allocated memory handle
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't a free block big enough for the requested memory.
+    [[nodiscard]] AxrResult allocatePinnedBlock(size_t size,
+                                                uint8_t alignment,
+                                                AxrHandle<void>& handle,
+                                                bool zeroOutMemory = false,
+                                                const AxrAllocationTag& tag = {});
+
+    /// Allocate new pinned memory.
+    /// See `allocatePinnedBlock()` for details.
+    /// @tparam Type The memory data type
+    /// @param size The number of data items of type `Type` to store in memory
+    /// @param handle Output allocated memory handle
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't a free block big enough for the requested memory.
+    template<typename Type>
+    [[nodiscard]] AxrResult allocatePinned(const size_t size,
+                                           AxrHandle<Type>& handle,
+                                           const bool zeroOutMemory = false,
+                                           const AxrAllocationTag& tag = {}) {
+        return allocatePinnedBlock(sizeof(Type) * size,
+                                   alignof(Type),
+                                   reinterpret_cast<AxrHandle<void>&>(handle),
+                                   zeroOutMemory,
+                                   tag);
+    }
+
+    /// Reallocate an existing memory block.
+    /// The block is shrunk in place, or grown in place if it's followed by a big enough free block. Otherwise, it's
+    /// moved to a new block. This applies to pinned blocks too, and the new block stays pinned.
     /// @param size The new size in bytes for how much memory to reallocate for
     /// @param alignment Memory alignment
     /// @param handle Input/Output allocated memory handle
     /// @param zeroOutNewMemory If true, all newly allocated memory will be zeroed out. This doesn't affect memory from
     /// the existing allocation.
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
     /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_VALIDATION_FAILED if the given handle is stale or isn't from this allocator.
     /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space for the requested memory.
     [[nodiscard]] AxrResult reallocateBlock(size_t size,
                                             uint8_t alignment,
                                             AxrHandle<void>& handle,
-                                            bool zeroOutNewMemory = false);
+                                            bool zeroOutNewMemory = false,
+                                            const AxrAllocationTag& tag = {});
     /// Reallocate an existing memory block
     /// @tparam Type The memory data type
     /// @param size The new number of data items of type `Type` to store in memory
     /// @param handle Input/Output allocated memory handle
     /// @param zeroOutNewMemory If true, all newly allocated memory will be zeroed out. This doesn't affect memory from
     /// the existing allocation.
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
     /// @return AXR_SUCCESS if the function succeeded.
     /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space for the requested memory.
     template<typename Type>
     [[nodiscard]] AxrResult reallocate(const size_t size,
                                        AxrHandle<Type>& handle,
-                                       const bool zeroOutNewMemory = false) {
+                                       const bool zeroOutNewMemory = false,
+                                       const AxrAllocationTag& tag = {}) {
         return reallocateBlock(sizeof(Type) * size,
                                alignof(Type),
                                reinterpret_cast<AxrHandle<void>&>(handle),
-                               zeroOutNewMemory);
+                               zeroOutNewMemory,
+                               tag);
     }
 
     /// Deallocate the given handle
@@ -137,9 +306,87 @@ public:
         deallocateHandle(reinterpret_cast<AxrHandle<void>&>(handle));
     }
 
+    /// Deallocate many handles at once.
+    /// Handles to neighbouring blocks, like those from a single `allocateBlockBatch()` call, are merged into one free
+    /// block before being given back, so the free block trees are only updated once per run of blocks.
+    /// @param handles Handles to deallocate. Must contain `handleCount` handles
+    /// @param handleCount The number of handles to deallocate
+    void deallocateHandleBatch(AxrHandle<void>* handles, uint32_t handleCount);
+
+    /// Deallocate many handles at once.
+    /// See `deallocateHandleBatch()` for details.
+    /// @param handles Handles to deallocate. Must contain `handleCount` handles
+    /// @param handleCount The number of handles to deallocate
+    template<typename Type>
+    void deallocateBatch(AxrHandle<Type>* handles, const uint32_t handleCount) {
+        deallocateHandleBatch(reinterpret_cast<AxrHandle<void>*>(handles), handleCount);
+    }
+
+    /// Pin the given handle's data block so defragmentation never moves it
+    /// @param handle Handle to pin
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_VALIDATION_FAILED if the given handle is stale or isn't from this allocator.
+    [[nodiscard]] AxrResult pinHandle(const AxrHandle<void>& handle);
+    /// Pin the given handle's data block so defragmentation never moves it
+    /// @param handle Handle to pin
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_VALIDATION_FAILED if the given handle is stale or isn't from this allocator.
+    template<typename Type>
+    [[nodiscard]] AxrResult pin(const AxrHandle<Type>& handle) {
+        return pinHandle(reinterpret_cast<const AxrHandle<void>&>(handle));
+    }
+    /// Unpin the given handle's data block so defragmentation can move it again
+    /// @param handle Handle to unpin
+    void unpinHandle(const AxrHandle<void>& handle);
+    /// Unpin the given handle's data block so defragmentation can move it again
+    /// @param handle Handle to unpin
+    template<typename Type>
+    void unpin(const AxrHandle<Type>& handle) {
+        unpinHandle(reinterpret_cast<const AxrHandle<void>&>(handle));
+    }
+
+    /// Stop defragmentation from relocating any data until `unlockRelocation()` is called.
+    /// While locked, data pointers can be resolved from their handles once and held on to. Allocations that would
+    /// need to defragment to fit fail instead. Locks nest, relocation resumes once every lock has been unlocked.
+    void lockRelocation();
+    /// Undo a single `lockRelocation()` call
+    void unlockRelocation();
+    /// Check if relocation is currently locked
+    /// @return True if relocation is currently locked
+    [[nodiscard]] bool isRelocationLocked() const;
+
     /// Defragment the given number of data blocks
     /// @param blockCount The number of blocks to defragment
     void defragment(uint32_t blockCount);
+    /// Defragment data blocks until the given budget is spent or there's nothing left to defragment
+    /// @param budget Limits for how much defragmentation to do
+    /// @return The defragmentation progress
+    DefragmentProgress defragment(const DefragmentBudget& budget);
+
+    /// Get how fragmented the free memory is.
+    /// 0 means all free memory is in a single block. The closer it is to 1, the more scattered the free memory is.
+    /// @return 1 - (largest free block size / total free memory)
+    [[nodiscard]] float getFragmentationRatio() const;
+
+    /// Get the monitor that notifies subsystems when this allocator is running low on memory.
+    /// Critical memory pressure is notified before falling back to a forced defragmentation.
+    /// @return The memory pressure monitor
+    [[nodiscard]] AxrMemoryPressureMonitor& getMemoryPressureMonitor();
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    /// Start recording every allocation, reallocation, deallocation and defragmentation to the allocation trace.
+    /// Pinned allocations are recorded as regular allocations. Does nothing if no trace is being recorded
+    void startTraceRecording();
+#endif
+
+    /// Get the allocator state that isn't stored in the allocator's memory
+    /// @return The allocator state
+    [[nodiscard]] SnapshotState getSnapshotState() const;
+    /// Restore the allocator state from a snapshot.
+    /// The allocator's memory must already hold the memory from the same snapshot. The memory may be at a different
+    /// address than when the snapshot was taken, since free blocks are tracked by offset.
+    /// @param state Allocator state to restore
+    void restoreSnapshotState(const SnapshotState& state);
 
     /// Get the empty state of the allocator
     /// @return True if the allocator is empty
@@ -154,34 +401,259 @@ public:
     [[nodiscard]] size_t peakSize() const;
 #endif
 
+#ifdef AXR_TESTING_ENABLED
+    /// Check that both free block trees are valid red black trees, that they hold the same free blocks, that
+    /// neighbouring free blocks were merged and that the free blocks add up to all the unused memory
+    /// @return True if the free block trees are valid
+    [[nodiscard]] bool validateFreeBlockTrees() const;
+#endif
+
+    /// Get the max number of bytes a data block needs for the given size and alignment.
+    /// The block can end up smaller, depending on how much padding its address needs to be aligned.
+    /// @param size Size in bytes of the data
+    /// @param alignment Memory alignment
+    /// @return The max number of bytes the data block needs, including the header
+    [[nodiscard]] static constexpr size_t getRequiredBlockSize(const size_t size, const uint8_t alignment) {
+        // The header always ends on a `BlockAlignment` boundary. So only alignments greater than that need any padding.
+        const size_t alignmentPadding = alignment > BlockAlignment ? alignment - BlockAlignment : 0;
+        return sizeof(DataHeader) + alignmentPadding + getDataSize(size);
+    }
+
 private:
     // ----------------------------------------- //
     // Private Structs
     // ----------------------------------------- //
 
     /// Memory layout looks like the following:
-    /// [DataHeader][Item1][--FreeBlockHeader--][DataHeader][Item2][DataHeader][Item3][------FreeBlockHeader------]
+    /// [DataHeader][Item1][-FreeBlockHeader-][DataHeader][Item2][PaddingMarker][-][DataHeader][Item3][FreeBlockHeader]
+    /// Padding markers are only present when the data needs more padding than `BlockAlignment` gives it.
     /// Even if there's no data in this allocator, a FreeBlockHeader is present, like so.
     /// [---------------------------------------------FreeBlockHeader---------------------------------------------]
 
-    /// Describes the free block that this header occupies
+    /// Red black tree links for a free block.
+    /// Links are stored as offsets from the start of the allocator's memory instead of pointers. That way both sets of
+    /// links can fit inside the `FreeBlockHeader` without increasing the minimum size of a data block too much.
+    struct FreeBlockLinks {
+        uint32_t Left;
+        uint32_t Right;
+        uint32_t Parent;
+    };
+
+    /// Describes the free block that this header occupies.
+    /// The colors are kept out of `FreeBlockLinks` so that both sets of links and the size pack into 32 bytes.
     struct FreeBlockHeader {
         /// The size of the free block. And since this `FreeBlockHeader` occupies that space, its size is included.
-        size_t Size;
-        FreeBlockHeader* Next;
+        /// 32 bits is enough since the capacity can't exceed `MaxCapacity`
+        uint32_t Size;
+        /// Links for the free blocks tree ordered by size, and then by address
+        FreeBlockLinks SizeLinks;
+        /// Links for the free blocks tree ordered by address
+        FreeBlockLinks AddressLinks;
+        /// True if this free block is red within the free blocks tree ordered by size
+        bool IsRedBySize;
+        /// True if this free block is red within the free blocks tree ordered by address
+        bool IsRedByAddress;
+    };
+
+    static_assert(sizeof(FreeBlockHeader) == 32);
+
+    /// Intrusive red black tree of free blocks.
+    /// The nodes are the `FreeBlockHeader`s themselves, so no extra memory is required to keep track of free blocks.
+    class FreeBlockTree {
+    public:
+        // ----------------------------------------- //
+        // Public Enums
+        // ----------------------------------------- //
+
+        /// The order to sort free blocks in
+        enum class OrderBy : uint8_t {
+            Size,
+            Address,
+        };
+
+        // ----------------------------------------- //
+        // Special Functions
+        // ----------------------------------------- //
+
+        // ---- Constructors ----
+
+        /// Default Constructor
+        FreeBlockTree();
+        /// Constructor
+        /// @param baseAddress The address that all free block offsets are relative to
+        /// @param orderBy The order to sort free blocks in
+        FreeBlockTree(uintptr_t baseAddress, OrderBy orderBy);
+
+        // ----------------------------------------- //
+        // Public Functions
+        // ----------------------------------------- //
+
+        /// Insert the given free block into the tree
+        /// @param freeBlock Free block to insert. Its `Size` must already be set
+        void insert(FreeBlockHeader* freeBlock);
+        /// Remove the given free block from the tree
+        /// @param freeBlock Free block to remove. It must exist within the tree
+        void remove(FreeBlockHeader* freeBlock);
+
+        /// Find the first free block that isn't ordered before the given size and address.
+        /// When ordered by address, the size is ignored.
+        /// @param size Size to search for
+        /// @param address Address to search for
+        /// @return The first free block that isn't ordered before the given values. Or nullptr if none was found
+        [[nodiscard]] FreeBlockHeader* findLowerBound(size_t size, uintptr_t address) const;
+
+        /// Get the first free block in the tree
+        /// @return The first free block in the tree. Or nullptr if the tree is empty
+        [[nodiscard]] FreeBlockHeader* first() const;
+        /// Get the last free block in the tree
+        /// @return The last free block in the tree. Or nullptr if the tree is empty
+        [[nodiscard]] FreeBlockHeader* last() const;
+        /// Get the free block that comes after the given free block in the tree
+        /// @param freeBlock Free block to start from
+        /// @return The next free block. Or nullptr if the given free block is the last one
+        [[nodiscard]] FreeBlockHeader* next(const FreeBlockHeader* freeBlock) const;
+        /// Get the free block that comes before the given free block in the tree
+        /// @param freeBlock Free block to start from
+        /// @return The previous free block. Or nullptr if the given free block is the first one
+        [[nodiscard]] FreeBlockHeader* previous(const FreeBlockHeader* freeBlock) const;
+
+        /// Check if this tree is empty
+        /// @return True if this tree is empty
+        [[nodiscard]] bool empty() const;
+
+#ifdef AXR_TESTING_ENABLED
+        /// Check that this tree is a valid red black tree and that its free blocks are in order
+        /// @return True if this tree is valid
+        [[nodiscard]] bool isValid() const;
+#endif
+
+        /// Get the offset of the root free block
+        /// @return The offset of the root free block
+        [[nodiscard]] uint32_t getRootOffset() const;
+        /// Set the offset of the root free block. Used to restore a tree whose nodes were saved in a snapshot
+        /// @param rootOffset Offset of the root free block
+        void setRootOffset(uint32_t rootOffset);
+
+    private:
+        // ----------------------------------------- //
+        // Private Variables
+        // ----------------------------------------- //
+        static constexpr uint32_t InvalidOffset = UINT32_MAX;
+
+        uintptr_t m_BaseAddress{};
+        uint32_t m_RootOffset = InvalidOffset;
+        OrderBy m_OrderBy{};
+
+        // ----------------------------------------- //
+        // Private Functions
+        // ----------------------------------------- //
+
+        /// Get the tree links for the given free block
+        /// @param freeBlock Free block to use
+        /// @return The tree links for the given free block
+        [[nodiscard]] FreeBlockLinks& getLinks(const FreeBlockHeader* freeBlock) const;
+        /// Get the color of the given free block within this tree
+        /// @param freeBlock Free block to use
+        /// @return True if the free block is red
+        [[nodiscard]] bool& getIsRed(const FreeBlockHeader* freeBlock) const;
+        /// Convert the given offset to a free block
+        /// @param offset Offset to convert
+        /// @return The free block at the given offset. Or nullptr if the offset is invalid
+        [[nodiscard]] FreeBlockHeader* toFreeBlock(uint32_t offset) const;
+        /// Convert the given free block to an offset
+        /// @param freeBlock Free block to convert
+        /// @return The offset of the given free block. Or `InvalidOffset` if the free block is null
+        [[nodiscard]] uint32_t toOffset(const FreeBlockHeader* freeBlock) const;
+
+        /// Check if the given free block is ordered before the given size and address
+        /// @param freeBlock Free block to check
+        /// @param size Size to compare against
+        /// @param address Address to compare against
+        /// @return True if the given free block is ordered before the given size and address
+        [[nodiscard]] bool isOrderedBefore(const FreeBlockHeader* freeBlock, size_t size, uintptr_t address) const;
+
+        /// Get the root free block
+        /// @return The root free block. Or nullptr if the tree is empty
+        [[nodiscard]] FreeBlockHeader* getRoot() const;
+        /// Get the left child of the given free block
+        /// @param freeBlock Free block to use
+        /// @return The left child. Or nullptr if there is none
+        [[nodiscard]] FreeBlockHeader* getLeft(const FreeBlockHeader* freeBlock) const;
+        /// Get the right child of the given free block
+        /// @param freeBlock Free block to use
+        /// @return The right child. Or nullptr if there is none
+        [[nodiscard]] FreeBlockHeader* getRight(const FreeBlockHeader* freeBlock) const;
+        /// Get the parent of the given free block
+        /// @param freeBlock Free block to use
+        /// @return The parent. Or nullptr if the given free block is the root
+        [[nodiscard]] FreeBlockHeader* getParent(const FreeBlockHeader* freeBlock) const;
+        /// Check if the given free block is red. Null free blocks are considered black.
+        /// @param freeBlock Free block to check
+        /// @return True if the given free block is red
+        [[nodiscard]] bool isRed(const FreeBlockHeader* freeBlock) const;
+
+        /// Set the root free block
+        /// @param freeBlock New root free block. Can be null
+        void setRoot(const FreeBlockHeader* freeBlock);
+        /// Set the left child of the given free block
+        /// @param freeBlock Free block to modify
+        /// @param left New left child. Can be null
+        void setLeft(const FreeBlockHeader* freeBlock, const FreeBlockHeader* left) const;
+        /// Set the right child of the given free block
+        /// @param freeBlock Free block to modify
+        /// @param right New right child. Can be null
+        void setRight(const FreeBlockHeader* freeBlock, const FreeBlockHeader* right) const;
+        /// Set the parent of the given free block
+        /// @param freeBlock Free block to modify
+        /// @param parent New parent. Can be null
+        void setParent(const FreeBlockHeader* freeBlock, const FreeBlockHeader* parent) const;
+        /// Set the color of the given free block. Does nothing if the free block is null.
+        /// @param freeBlock Free block to modify
+        /// @param isRed True to make the free block red, false to make it black
+        void setRed(const FreeBlockHeader* freeBlock, bool isRed) const;
+
+        /// Get the free block with the lowest order within the given subtree
+        /// @param freeBlock Root of the subtree
+        /// @return The free block with the lowest order within the given subtree
+        [[nodiscard]] FreeBlockHeader* minimum(FreeBlockHeader* freeBlock) const;
+        /// Get the free block with the highest order within the given subtree
+        /// @param freeBlock Root of the subtree
+        /// @return The free block with the highest order within the given subtree
+        [[nodiscard]] FreeBlockHeader* maximum(FreeBlockHeader* freeBlock) const;
+
+        /// Rotates the given free block to the left
+        /// @param freeBlock Free block to rotate
+        void rotateLeft(FreeBlockHeader* freeBlock);
+        /// Rotates the given free block to the right
+        /// @param freeBlock Free block to rotate
+        void rotateRight(FreeBlockHeader* freeBlock);
+        /// Replace the subtree at `original` with the subtree at `replacement`
+        /// @param original Free block to replace
+        /// @param replacement Free block to replace it with. Can be null
+        void transplant(const FreeBlockHeader* original, FreeBlockHeader* replacement);
+
+        /// Fix all red red violations for the given, newly inserted, free block
+        /// @param freeBlock Newly inserted free block
+        void fixInsertion(FreeBlockHeader* freeBlock);
+        /// Fix all double black violations after removing a black free block
+        /// @param freeBlock Free block that replaced the removed free block. Can be null
+        /// @param parent Parent of `freeBlock`
+        void fixRemoval(FreeBlockHeader* freeBlock, FreeBlockHeader* parent);
     };
 
     // ----------------------------------------- //
     // Private Data
     // ----------------------------------------- //
-    HandlesTree_T m_HandlesTree{};
+    AxrHandleTable* m_HandleTable{};
 
-    /// This head will always point to the lowest address. And each next free block is ordered from lowest to highest.
-    FreeBlockHeader* m_FreeBlocksHead{};
+    FreeBlockTree m_FreeBlocksBySize{};
+    FreeBlockTree m_FreeBlocksByAddress{};
     size_t m_Size{};
 #ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
     size_t m_PeakSize{};
 #endif
+    uint32_t m_RelocationLockCount{};
+    AxrMemoryPressureMonitor m_MemoryPressureMonitor{};
 
     /// Any block must be at least the size of `FreeBlockHeader` because when this memory is freed, there needs to
     /// be enough space to insert a `FreeBlockHeader` in its place.
@@ -192,8 +664,35 @@ private:
     // Private Functions
     // ----------------------------------------- //
 
+    /// Get the number of bytes of data a block holds for the given size
+    /// @param size Size in bytes of the data
+    /// @return The given size, rounded up to the min data item size and `BlockAlignment`
+    [[nodiscard]] static constexpr size_t getDataSize(const size_t size) {
+        return (std::max(m_MinDataItemSize, size) + BlockAlignment - 1) & ~(BlockAlignment - 1);
+    }
+    /// Get the size of a data block placed at the given address
+    /// @param blockAddress Address of the data block
+    /// @param size Size in bytes of the data
+    /// @param alignment Memory alignment
+    /// @return The size of the data block, including the padding and header
+    [[nodiscard]] static size_t getBlockSize(uintptr_t blockAddress, size_t size, uint8_t alignment);
+    /// Get the data header of the data block at the given address, skipping over the padding marker if there is one
+    /// @param blockAddress Address of the data block
+    /// @return The data header
+    [[nodiscard]] static DataHeader* getDataHeader(uintptr_t blockAddress);
+    /// Get the address of the start of the given data block, including any padding
+    /// @param dataHeader Header of the data block
+    /// @return The address of the data block
+    [[nodiscard]] static uintptr_t getBlockAddress(const DataHeader* dataHeader);
+    /// Get the number of bytes of data the given data block can hold
+    /// @param dataHeader Header of the data block
+    /// @return The number of bytes between the end of the header and the end of the block
+    [[nodiscard]] static size_t getDataCapacity(const DataHeader* dataHeader);
+
     /// Clean up this class
     void cleanup();
+    /// Free the handle table slots of all data blocks that are still allocated
+    void destroyAllHandles();
 
     /// Move the given AxrDynamicAllocator to this class
     /// @param src AxrDynamicAllocator to move
@@ -201,24 +700,92 @@ private:
     /// the move assignment operator when moving variables
     void move_internal(AxrDynamicAllocator&& src, bool useConstructor);
 
-    /// Find the first free block that has enough space for the given size
+    /// Allocate many memory blocks at once
+    /// @param sizes Size in bytes of each memory block. If nullptr, every block uses `size` instead
+    /// @param size Size in bytes of each memory block. Only used if `sizes` is nullptr
+    /// @param alignment Memory alignment for all memory blocks
+    /// @param handles Output allocated memory handles. Must contain `handleCount` handles
+    /// @param handleCount The number of memory blocks to allocate
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space for the requested memory.
+    [[nodiscard]] AxrResult allocateBlockBatch_internal(const size_t* sizes,
+                                                        size_t size,
+                                                        uint8_t alignment,
+                                                        AxrHandle<void>* handles,
+                                                        uint32_t handleCount,
+                                                        bool zeroOutMemory,
+                                                        const AxrAllocationTag& tag);
+
+    /// Turn the given memory into a data block and create a handle for it.
+    /// The memory must already be taken out of the free block trees.
+    /// @param blockAddress Address of the data block. The padding, if any, and then the `DataHeader` will go here
+    /// @param blockSize Size of the whole data block, including the padding and header. See `getBlockSize()`
+    /// @param alignment Memory alignment
+    /// @param zeroOutMemory If true, the data will be zeroed out
+    /// @param handle Output allocated memory handle
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if the handle table is full.
+    [[nodiscard]] AxrResult createDataBlock(uintptr_t blockAddress,
+                                            size_t blockSize,
+                                            uint8_t alignment,
+                                            bool zeroOutMemory,
+                                            AxrHandle<void>& handle);
+    /// Get the data header for the given handle.
+    /// Doesn't log anything, so callers can report failures in their own terms.
+    /// @param handle Handle to use
+    /// @return The data header. Or nullptr if the handle is null, stale or isn't from this allocator
+    [[nodiscard]] DataHeader* findDataHeader(const AxrHandle<void>& handle) const;
+    /// Take the given memory out of the given free block, turn it into a data block and create a handle for it.
+    /// Any space left in the free block is given back as free memory.
+    /// @param freeBlock Free block to use. Must be within both free block trees
+    /// @param blockAddress Address of the data block. Must be within the free block
+    /// @param size Size in bytes of the data
+    /// @param alignment Memory alignment
+    /// @param zeroOutMemory If true, the data will be zeroed out
+    /// @param handle Output allocated memory handle
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if the handle table is full.
+    [[nodiscard]] AxrResult allocateFromFreeBlock(FreeBlockHeader* freeBlock,
+                                                  uintptr_t blockAddress,
+                                                  size_t size,
+                                                  uint8_t alignment,
+                                                  bool zeroOutMemory,
+                                                  AxrHandle<void>& handle,
+                                                  const AxrAllocationTag& tag);
+    /// Give the given memory back as free memory, merging it with the free blocks directly before and after it
+    /// @param blockAddress Address of the memory to free
+    /// @param blockSize Size of the memory to free
+    void releaseMemory(uintptr_t blockAddress, size_t blockSize);
+
+    /// Find the smallest free block that has enough space for the given size
+    /// @param size The minimum amount of space requested
+    /// @return A pointer to the free block to use. Or nullptr if no block was found which meets the requirements
+    [[nodiscard]] FreeBlockHeader* findFreeBlock(size_t size) const;
+    /// Find the free block with the highest address that has enough space for the given size
     /// @param size The minimum amount of space requested
-    /// @param prevFreeBlock Output previous free block from the one returned
     /// @return A pointer to the free block to use. Or nullptr if no block was found which meets the requirements
-    [[nodiscard]] FreeBlockHeader* findFreeBlock(size_t size, FreeBlockHeader*& prevFreeBlock) const;
-    /// Find the adjacent free block, with a lower address, to the given address.
-    /// The returned adjacent free block will always have a lower address than the given address. And the .Next pointer
-    /// of the returned free block will always be the free block after the given address.
-    /// @param address The address to use
-    /// @return A pointer to the adjacent free block. Or nullptr no free block with a lower address was found.
-    [[nodiscard]] FreeBlockHeader* findAdjacentFreeBlock(uintptr_t address) const;
-
-    /// Starting from the given free block, recursively check for connecting free blocks that can be merged into one.
-    /// Continue recursively until a free block that isn't connected the given block is found, or if there are no
-    /// more free blocks to check.
-    /// @param freeBlock Starting free block header
-    static void mergeFreeBlocks(FreeBlockHeader* freeBlock);
-
-    /// Defragment a single data block
-    void defragment();
+    [[nodiscard]] FreeBlockHeader* findHighestFreeBlock(size_t size) const;
+
+    /// Shrink the given data block down to the given size, turning the space after it into a free block.
+    /// If the space after it is too small for a `FreeBlockHeader`, the data block is left as is.
+    /// @param dataHeader Header of the data block to shrink
+    /// @param blockSize The new size of the whole data block, including the padding and header
+    void shrinkBlock(DataHeader* dataHeader, size_t blockSize);
+
+    /// Insert the given free block into both free block trees
+    /// @param freeBlock Free block to insert. Its `Size` must already be set
+    void insertFreeBlock(FreeBlockHeader* freeBlock);
+    /// Remove the given free block from both free block trees
+    /// @param freeBlock Free block to remove
+    void removeFreeBlock(FreeBlockHeader* freeBlock);
+
+    /// Defragment a single data block.
+    /// The data is moved down by a multiple of its alignment, so any space left over becomes its new padding.
+    /// Gaps before pinned blocks are skipped over. Does nothing while relocation is locked.
+    /// @return The size of the data block that was moved, including the data header. 0 if there was nothing to
+    /// defragment
+    size_t defragment();
 };
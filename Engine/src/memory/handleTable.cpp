@@ -0,0 +1,260 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "handleTable.h"
+#include "axr/logging.h"
+
+#include <cassert>
+#include <cstddef>
+
+// ----------------------------------------- //
+// Special Functions
+// ----------------------------------------- //
+
+AxrHandleTable::AxrHandleTable() = default;
+
+AxrHandleTable::AxrHandleTable(const AxrMemoryBlock& memoryBlock) :
+    AxrSubAllocatorBase_Aligned(memoryBlock) {
+    assert(AxrSubAllocatorBase::m_Capacity % sizeof(AxrHandleTableSlot) == 0);
+    assert(AxrSubAllocatorBase::m_Capacity / sizeof(AxrHandleTableSlot) < InvalidIndex);
+
+    m_HandleCapacity = static_cast<uint32_t>(AxrSubAllocatorBase::m_Capacity / sizeof(AxrHandleTableSlot));
+
+    for (uint32_t i = 0; i < m_HandleCapacity; ++i) {
+        slotAt(i).Generation = 0;
+    }
+    chainAllSlots();
+}
+
+AxrHandleTable::AxrHandleTable(AxrHandleTable&& src) noexcept :
+    AxrSubAllocatorBase_Aligned(std::move(src)) {
+    move_internal(std::move(src), true);
+}
+
+AxrHandleTable::~AxrHandleTable() {
+    cleanup();
+}
+
+AxrHandleTable& AxrHandleTable::operator=(AxrHandleTable&& src) noexcept {
+    if (this != &src) {
+        cleanup();
+
+        AxrSubAllocatorBase_Aligned::operator=(std::move(src));
+
+        move_internal(std::move(src), false);
+    }
+    return *this;
+}
+
+// ----------------------------------------- //
+// Public Functions
+// ----------------------------------------- //
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to create handle. "
+AxrResult AxrHandleTable::create(void* data, uint32_t& index) {
+    assert(data != nullptr);
+
+    if (m_FreeSlotsHeadIndex == InvalidIndex) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Ran out of handle slots.");
+        return AXR_ERROR_OUT_OF_MEMORY;
+    }
+
+    index = m_FreeSlotsHeadIndex;
+    AxrHandleTableSlot& slot = slotAt(index);
+    m_FreeSlotsHeadIndex = slot.NextFreeIndex;
+
+    slot.Data = data;
+    slot.NextFreeIndex = InvalidIndex;
+
+    ++m_UsedHandleCount;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    if (m_UsedHandleCount > m_PeakUsedHandleCount) {
+        m_PeakUsedHandleCount = m_UsedHandleCount;
+    }
+#endif
+
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+void AxrHandleTable::destroy(const uint32_t index) {
+    assert(index < m_HandleCapacity);
+
+    AxrHandleTableSlot& slot = slotAt(index);
+    assert(slot.Data != nullptr);
+
+    slot.Data = nullptr;
+    ++slot.Generation;
+    slot.NextFreeIndex = m_FreeSlotsHeadIndex;
+    m_FreeSlotsHeadIndex = index;
+
+    --m_UsedHandleCount;
+}
+
+void AxrHandleTable::relocate(const uint32_t index, void* data) {
+    assert(index < m_HandleCapacity);
+    assert(slotAt(index).Data != nullptr);
+    assert(data != nullptr);
+
+    slotAt(index).Data = data;
+}
+
+void AxrHandleTable::clear() {
+    // Bump the generation of every slot that's in use so any handles to them are detected as stale
+    for (uint32_t i = 0; i < m_HandleCapacity; ++i) {
+        AxrHandleTableSlot& slot = slotAt(i);
+        if (slot.Data != nullptr) {
+            ++slot.Generation;
+        }
+    }
+
+    m_UsedHandleCount = 0;
+    chainAllSlots();
+}
+
+void AxrHandleTable::offsetAllData(const ptrdiff_t offset) {
+    for (uint32_t i = 0; i < m_HandleCapacity; ++i) {
+        AxrHandleTableSlot& slot = slotAt(i);
+        if (slot.Data != nullptr) {
+            slot.Data = static_cast<uint8_t*>(slot.Data) + offset;
+        }
+    }
+}
+
+AxrHandleTable::SnapshotState AxrHandleTable::getSnapshotState() const {
+    return SnapshotState{
+        .UsedHandleCount = m_UsedHandleCount,
+        .FreeSlotsHeadIndex = m_FreeSlotsHeadIndex,
+    };
+}
+
+void AxrHandleTable::restoreSnapshotState(const SnapshotState& state) {
+    assert(state.UsedHandleCount <= m_HandleCapacity);
+    assert(state.FreeSlotsHeadIndex == InvalidIndex || state.FreeSlotsHeadIndex < m_HandleCapacity);
+
+    m_UsedHandleCount = state.UsedHandleCount;
+    m_FreeSlotsHeadIndex = state.FreeSlotsHeadIndex;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    if (m_UsedHandleCount > m_PeakUsedHandleCount) {
+        m_PeakUsedHandleCount = m_UsedHandleCount;
+    }
+#endif
+}
+
+void* AxrHandleTable::getData(const uint32_t index) const {
+    assert(index < m_HandleCapacity);
+
+    return slotAt(index).Data;
+}
+
+void* const* AxrHandleTable::getDataPtr(const uint32_t index) const {
+    assert(index < m_HandleCapacity);
+
+    return &slotAt(index).Data;
+}
+
+uint32_t AxrHandleTable::getGeneration(const uint32_t index) const {
+    assert(index < m_HandleCapacity);
+
+    return slotAt(index).Generation;
+}
+
+uint32_t AxrHandleTable::getIndex(void* const* dataPtr) const {
+    const auto dataPtrAddress = reinterpret_cast<uintptr_t>(dataPtr);
+    const auto memoryAddress = reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory);
+    if (dataPtrAddress < memoryAddress || dataPtrAddress >= memoryAddress + AxrSubAllocatorBase::m_Capacity) {
+        return InvalidIndex;
+    }
+
+    const uintptr_t offset = dataPtrAddress - memoryAddress;
+    if (offset % sizeof(AxrHandleTableSlot) != offsetof(AxrHandleTableSlot, Data)) [[unlikely]] {
+        return InvalidIndex;
+    }
+
+    return static_cast<uint32_t>(offset / sizeof(AxrHandleTableSlot));
+}
+
+bool AxrHandleTable::isValid(void* const* dataPtr, const uint32_t generation) const {
+    const uint32_t index = getIndex(dataPtr);
+    if (index == InvalidIndex) {
+        return false;
+    }
+
+    const AxrHandleTableSlot& slot = slotAt(index);
+    return slot.Data != nullptr && slot.Generation == generation;
+}
+
+size_t AxrHandleTable::handleCapacity() const {
+    return m_HandleCapacity;
+}
+
+size_t AxrHandleTable::size() const {
+    return m_UsedHandleCount;
+}
+
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+size_t AxrHandleTable::peakHandleCount() const {
+    return m_PeakUsedHandleCount;
+}
+#endif
+
+bool AxrHandleTable::empty() const {
+    return m_UsedHandleCount == 0;
+}
+
+size_t AxrHandleTable::getAllocatorSize(const uint32_t handleCount) {
+    return (handleCount * sizeof(AxrHandleTableSlot)) + alignof(AxrHandleTableSlot);
+}
+
+// ----------------------------------------- //
+// Private Functions
+// ----------------------------------------- //
+
+void AxrHandleTable::cleanup() {
+    m_HandleCapacity = 0;
+    m_UsedHandleCount = 0;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    m_PeakUsedHandleCount = 0;
+#endif
+    m_FreeSlotsHeadIndex = InvalidIndex;
+
+    AxrSubAllocatorBase_Aligned::cleanup();
+}
+
+void AxrHandleTable::move_internal(AxrHandleTable&& src, [[maybe_unused]] const bool useConstructor) {
+    // Please note that we aren't moving the base class. That should be done before calling this function.
+
+    m_HandleCapacity = src.m_HandleCapacity;
+    m_UsedHandleCount = src.m_UsedHandleCount;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    m_PeakUsedHandleCount = src.m_PeakUsedHandleCount;
+#endif
+    m_FreeSlotsHeadIndex = src.m_FreeSlotsHeadIndex;
+
+    src.m_HandleCapacity = 0;
+    src.m_UsedHandleCount = 0;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    src.m_PeakUsedHandleCount = 0;
+#endif
+    src.m_FreeSlotsHeadIndex = InvalidIndex;
+}
+
+AxrHandleTableSlot& AxrHandleTable::slotAt(const uint32_t index) const {
+    return static_cast<AxrHandleTableSlot*>(AxrSubAllocatorBase::m_Memory)[index];
+}
+
+void AxrHandleTable::chainAllSlots() {
+    if (m_HandleCapacity == 0) {
+        m_FreeSlotsHeadIndex = InvalidIndex;
+        return;
+    }
+
+    for (uint32_t i = 0; i < m_HandleCapacity; ++i) {
+        AxrHandleTableSlot& slot = slotAt(i);
+        slot.Data = nullptr;
+        slot.NextFreeIndex = i + 1;
+    }
+    slotAt(m_HandleCapacity - 1).NextFreeIndex = InvalidIndex;
+
+    m_FreeSlotsHeadIndex = 0;
+}
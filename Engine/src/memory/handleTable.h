@@ -0,0 +1,182 @@
+#pragma once
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "axr/common/enums.h"
+#include "subAllocatorBase.h"
+#include "types.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/// A single handle table slot
+struct AxrHandleTableSlot {
+    /// The data this slot points to. nullptr if this slot is free
+    void* Data;
+    /// Incremented every time this slot is freed, so handles that were made for a previous owner can be detected
+    uint32_t Generation;
+    /// Index of the next free slot. Only used while this slot is free
+    uint32_t NextFreeIndex;
+};
+
+/// Handle table.
+/// Holds the data pointers that `AxrHandle`s point to, so the data can be relocated without invalidating the handles.
+/// Slots are stored in a dense array and free slots are chained together by index, so creating, destroying and
+/// relocating a handle are all O(1).
+class AxrHandleTable : public AxrSubAllocatorBase_Aligned<AxrHandleTableSlot> {
+public:
+    // ----------------------------------------- //
+    // Public Constants
+    // ----------------------------------------- //
+
+    /// Marks the end of the free slots chain
+    static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+    // ----------------------------------------- //
+    // Public Structs
+    // ----------------------------------------- //
+
+    /// Table state that lives outside of the table's memory. Saved along with the memory in allocator snapshots
+    struct SnapshotState {
+        uint32_t UsedHandleCount;
+        uint32_t FreeSlotsHeadIndex;
+    };
+
+    // ----------------------------------------- //
+    // Special Functions
+    // ----------------------------------------- //
+
+    // ---- Constructors ----
+
+    /// Default Constructor
+    AxrHandleTable();
+    /// Constructor
+    /// @param memoryBlock Memory block to use
+    explicit AxrHandleTable(const AxrMemoryBlock& memoryBlock);
+    /// Copy Constructor
+    /// @param src Source AxrHandleTable to copy from
+    AxrHandleTable(const AxrHandleTable& src) = delete;
+    /// Move Constructor
+    /// @param src Source AxrHandleTable to move from
+    AxrHandleTable(AxrHandleTable&& src) noexcept;
+
+    // ---- Destructor ----
+
+    /// Destructor
+    ~AxrHandleTable();
+
+    // ---- Operator Overloads ----
+
+    /// Copy Assignment Operator
+    /// @param src Source AxrHandleTable to copy from
+    AxrHandleTable& operator=(const AxrHandleTable& src) = delete;
+    /// Move Assignment Operator
+    /// @param src Source AxrHandleTable to move from
+    AxrHandleTable& operator=(AxrHandleTable&& src) noexcept;
+
+    // ----------------------------------------- //
+    // Public Functions
+    // ----------------------------------------- //
+
+    /// Create a new handle slot
+    /// @param data The data the slot points to. Must not be nullptr
+    /// @param index Output slot index
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there aren't any free slots left.
+    [[nodiscard]] AxrResult create(void* data, uint32_t& index);
+    /// Free the given handle slot. Any handles that still point to it become stale
+    /// @param index Slot index to free
+    void destroy(uint32_t index);
+    /// Point the given handle slot at new data. Used when the data has been moved
+    /// @param index Slot index to update
+    /// @param data The new data address
+    void relocate(uint32_t index, void* data);
+    /// Free all handle slots
+    void clear();
+    /// Move the data pointer of every slot in use by the given number of bytes.
+    /// Used when all the data this table points to has been moved together, like when restoring a snapshot.
+    /// @param offset Number of bytes to move the data pointers by
+    void offsetAllData(ptrdiff_t offset);
+
+    /// Get the table state that isn't stored in the table's memory
+    /// @return The table state
+    [[nodiscard]] SnapshotState getSnapshotState() const;
+    /// Restore the table state from a snapshot. The table's memory must already hold the memory from the same snapshot
+    /// @param state Table state to restore
+    void restoreSnapshotState(const SnapshotState& state);
+
+    /// Get the data the given slot points to
+    /// @param index Slot index
+    /// @return The data the given slot points to
+    [[nodiscard]] void* getData(uint32_t index) const;
+    /// Get a pointer to the given slot's data pointer. This is what `AxrHandle`s hold on to
+    /// @param index Slot index
+    /// @return A pointer to the given slot's data pointer
+    [[nodiscard]] void* const* getDataPtr(uint32_t index) const;
+    /// Get the current generation of the given slot
+    /// @param index Slot index
+    /// @return The current generation of the given slot
+    [[nodiscard]] uint32_t getGeneration(uint32_t index) const;
+    /// Get the slot index for the given data pointer
+    /// @param dataPtr A pointer returned by `getDataPtr()`
+    /// @return The slot index. Or `InvalidIndex` if the given pointer isn't from this table
+    [[nodiscard]] uint32_t getIndex(void* const* dataPtr) const;
+    /// Check if the given handle data is still valid
+    /// @param dataPtr A pointer returned by `getDataPtr()`
+    /// @param generation The generation the handle was created with
+    /// @return True if the given pointer is from this table, is in use and has the same generation
+    [[nodiscard]] bool isValid(void* const* dataPtr, uint32_t generation) const;
+
+    /// Get the max number of handles this table can hold
+    /// @return The max number of handles this table can hold
+    [[nodiscard]] size_t handleCapacity() const;
+    /// Get the number of handles currently in use
+    /// @return The number of handles currently in use
+    [[nodiscard]] size_t size() const;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    /// Get the peak number of handles in use at one time
+    /// @return The peak number of handles in use at one time
+    [[nodiscard]] size_t peakHandleCount() const;
+#endif
+    /// Get the empty state of the table
+    /// @return True if no handles are in use
+    [[nodiscard]] bool empty() const;
+
+    /// Get the number of bytes a table requires for the given number of handles
+    /// @param handleCount Max number of handles to allow for
+    /// @return Number of bytes required for the given number of handles
+    [[nodiscard]] static size_t getAllocatorSize(uint32_t handleCount);
+
+private:
+    // ----------------------------------------- //
+    // Private Variables
+    // ----------------------------------------- //
+    uint32_t m_HandleCapacity{};
+    uint32_t m_UsedHandleCount{};
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    uint32_t m_PeakUsedHandleCount{};
+#endif
+    uint32_t m_FreeSlotsHeadIndex = InvalidIndex;
+
+    // ----------------------------------------- //
+    // Private Functions
+    // ----------------------------------------- //
+
+    /// Clean up this class
+    void cleanup();
+
+    /// Move the given AxrHandleTable to this class
+    /// @param src AxrHandleTable to move
+    /// @param useConstructor If true, this function will use the move constructor for non-primitive objects instead of
+    /// the move assignment operator when moving variables
+    void move_internal(AxrHandleTable&& src, bool useConstructor);
+
+    /// Get the slot at the given index
+    /// @param index Slot index
+    /// @return The slot at the given index
+    [[nodiscard]] AxrHandleTableSlot& slotAt(uint32_t index) const;
+
+    /// Chain together all slots, marking them all as free to use
+    void chainAllSlots();
+};
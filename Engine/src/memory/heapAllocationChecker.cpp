@@ -0,0 +1,485 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "heapAllocationChecker.h"
+
+#ifdef AXR_HEAP_ALLOCATION_CHECK_ENABLED
+#include "axr/logging.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <thread>
+
+#ifdef AXR_PLATFORM_WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <malloc.h>
+#include <windows.h>
+#else
+#include <execinfo.h>
+#endif
+
+#if defined(__SANITIZE_ADDRESS__)
+#define AXR_ADDRESS_SANITIZER_ENABLED
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define AXR_ADDRESS_SANITIZER_ENABLED
+#endif
+#endif
+
+// Address sanitizer replaces malloc() itself, so only hook it when we're the only ones doing so
+#if defined(__GLIBC__) && !defined(AXR_ADDRESS_SANITIZER_ENABLED)
+#define AXR_HOOK_MALLOC
+#endif
+#endif
+
+// ----------------------------------------- //
+// Static Variables
+// ----------------------------------------- //
+
+#ifdef AXR_HEAP_ALLOCATION_CHECK_ENABLED
+/// Kept outside the singleton so the allocation hooks can check it without constructing the singleton
+static std::atomic<bool> IsFrameActive = false;
+/// Set while the calling thread is inside the allocation hooks, so allocations made by the checker itself (such as
+/// the first stack capture) aren't counted
+static thread_local bool IsInsideHook = false;
+/// The calling thread's record index. `UINT32_MAX` until it makes its first heap allocation in a frame
+static thread_local uint32_t CurrentThreadIndex = UINT32_MAX;
+#endif
+
+// ----------------------------------------- //
+// Heap Allocation Frame Scope
+// ----------------------------------------- //
+
+AxrHeapAllocationFrameScope::AxrHeapAllocationFrameScope() {
+#ifdef AXR_HEAP_ALLOCATION_CHECK_ENABLED
+    AxrHeapAllocationChecker::get().beginFrame();
+#endif
+}
+
+AxrHeapAllocationFrameScope::~AxrHeapAllocationFrameScope() {
+#ifdef AXR_HEAP_ALLOCATION_CHECK_ENABLED
+    AxrHeapAllocationChecker::get().endFrame();
+#endif
+}
+
+#ifdef AXR_HEAP_ALLOCATION_CHECK_ENABLED
+
+// ----------------------------------------- //
+// Static Helper Functions
+// ----------------------------------------- //
+
+/// Allocate from the system heap without going through the malloc() hook
+/// @param size Size in bytes
+/// @return The allocated memory. Or nullptr if it failed
+static void* allocateSystemMemory(size_t size);
+/// Allocate aligned memory from the system heap without going through the malloc() hook
+/// @param size Size in bytes
+/// @param alignment Alignment in bytes
+/// @return The allocated memory. Or nullptr if it failed
+static void* allocateAlignedSystemMemory(size_t size, size_t alignment);
+/// Deallocate memory from `allocateSystemMemory()`
+/// @param memory Memory to deallocate
+static void deallocateSystemMemory(void* memory);
+/// Deallocate memory from `allocateAlignedSystemMemory()`
+/// @param memory Memory to deallocate
+static void deallocateAlignedSystemMemory(void* memory);
+
+/// Record a heap allocation if a frame is being checked
+/// @param size Size in bytes
+static void recordHeapAllocation(const size_t size) {
+    if (!IsFrameActive.load(std::memory_order_relaxed)) [[likely]] {
+        return;
+    }
+
+    AxrHeapAllocationChecker::get().recordAllocation(size);
+}
+
+// ----------------------------------------- //
+// Special Functions
+// ----------------------------------------- //
+
+AxrHeapAllocationChecker::AxrHeapAllocationChecker() = default;
+
+AxrHeapAllocationChecker::~AxrHeapAllocationChecker() {
+    IsFrameActive.store(false);
+}
+
+// ----------------------------------------- //
+// Public Functions
+// ----------------------------------------- //
+
+AxrHeapAllocationChecker& AxrHeapAllocationChecker::get() {
+    static AxrHeapAllocationChecker singleton;
+    return singleton;
+}
+
+void AxrHeapAllocationChecker::beginFrame() {
+    for (uint32_t i = 0; i < MaxStackCount; ++i) {
+        m_Stacks[i].IsReady.store(false, std::memory_order_relaxed);
+    }
+    m_StackCount.store(0, std::memory_order_relaxed);
+
+    const uint32_t threadCount = std::min(m_ThreadCount.load(std::memory_order_relaxed), MaxThreadCount);
+    for (uint32_t i = 0; i < threadCount; ++i) {
+        m_Threads[i].AllocationCount.store(0, std::memory_order_relaxed);
+        m_Threads[i].ByteCount.store(0, std::memory_order_relaxed);
+    }
+
+    IsFrameActive.store(true, std::memory_order_release);
+}
+
+AxrHeapAllocationChecker::FrameReport AxrHeapAllocationChecker::endFrame() {
+    IsFrameActive.store(false, std::memory_order_release);
+
+    FrameReport report{
+        .FrameIndex = m_FrameIndex,
+        .AllocationCount = 0,
+        .ByteCount = 0,
+        .ThreadCount = 0,
+        .IsSteadyState = m_FrameIndex >= m_WarmUpFrameCount,
+    };
+
+    const uint32_t threadCount = std::min(m_ThreadCount.load(std::memory_order_acquire), MaxThreadCount);
+    for (uint32_t i = 0; i < threadCount; ++i) {
+        const uint64_t allocationCount = m_Threads[i].AllocationCount.load(std::memory_order_relaxed);
+        if (allocationCount == 0) {
+            continue;
+        }
+
+        report.AllocationCount += allocationCount;
+        report.ByteCount += m_Threads[i].ByteCount.load(std::memory_order_relaxed);
+        ++report.ThreadCount;
+    }
+
+    if (report.IsSteadyState && report.AllocationCount > 0) [[unlikely]] {
+        logFrame(report);
+    }
+
+    ++m_FrameIndex;
+    return report;
+}
+
+bool AxrHeapAllocationChecker::isFrameActive() const {
+    return IsFrameActive.load(std::memory_order_relaxed);
+}
+
+void AxrHeapAllocationChecker::setWarmUpFrameCount(const uint32_t frameCount) {
+    m_WarmUpFrameCount = frameCount;
+}
+
+void AxrHeapAllocationChecker::reset() {
+    m_FrameIndex = 0;
+}
+
+void AxrHeapAllocationChecker::recordAllocation(const size_t size) {
+    if (IsInsideHook || !IsFrameActive.load(std::memory_order_acquire)) {
+        return;
+    }
+    IsInsideHook = true;
+
+    const uint32_t threadIndex = getThreadIndex();
+    m_Threads[threadIndex].AllocationCount.fetch_add(1, std::memory_order_relaxed);
+    m_Threads[threadIndex].ByteCount.fetch_add(size, std::memory_order_relaxed);
+
+    const uint32_t stackIndex = m_StackCount.fetch_add(1, std::memory_order_relaxed);
+    if (stackIndex < MaxStackCount) {
+        StackRecord& stack = m_Stacks[stackIndex];
+#ifdef AXR_PLATFORM_WIN32
+        stack.Depth = CaptureStackBackTrace(0, MaxStackDepth, stack.Addresses, nullptr);
+#else
+        stack.Depth = static_cast<uint32_t>(backtrace(stack.Addresses, MaxStackDepth));
+#endif
+        stack.Size = size;
+        stack.ThreadIndex = threadIndex;
+        stack.IsReady.store(true, std::memory_order_release);
+    }
+
+    IsInsideHook = false;
+}
+
+// ----------------------------------------- //
+// Private Functions
+// ----------------------------------------- //
+
+uint32_t AxrHeapAllocationChecker::getThreadIndex() {
+    if (CurrentThreadIndex == UINT32_MAX) [[unlikely]] {
+        CurrentThreadIndex = std::min(m_ThreadCount.fetch_add(1, std::memory_order_acq_rel), MaxThreadCount - 1);
+        m_Threads[CurrentThreadIndex].ThreadHash.store(std::hash<std::thread::id>{}(std::this_thread::get_id()),
+                                                       std::memory_order_relaxed);
+    }
+
+    return CurrentThreadIndex;
+}
+
+void AxrHeapAllocationChecker::logFrame(const FrameReport& report) const {
+    axrLogError("Frame {} made {} system heap allocations totalling {} bytes across {} threads.",
+                report.FrameIndex,
+                report.AllocationCount,
+                report.ByteCount,
+                report.ThreadCount);
+
+    const uint32_t threadCount = std::min(m_ThreadCount.load(std::memory_order_acquire), MaxThreadCount);
+    for (uint32_t i = 0; i < threadCount; ++i) {
+        const uint64_t allocationCount = m_Threads[i].AllocationCount.load(std::memory_order_relaxed);
+        if (allocationCount == 0) {
+            continue;
+        }
+
+        axrLogError("Thread {:#x}: {} allocations. {} bytes.",
+                    m_Threads[i].ThreadHash.load(std::memory_order_relaxed),
+                    allocationCount,
+                    m_Threads[i].ByteCount.load(std::memory_order_relaxed));
+    }
+
+    const uint32_t stackCount = std::min(m_StackCount.load(std::memory_order_relaxed), MaxStackCount);
+    for (uint32_t i = 0; i < stackCount; ++i) {
+        const StackRecord& stack = m_Stacks[i];
+        if (!stack.IsReady.load(std::memory_order_acquire)) [[unlikely]] {
+            continue;
+        }
+
+        axrLogError("Heap allocation of {} bytes on thread {:#x}:",
+                    stack.Size,
+                    m_Threads[stack.ThreadIndex].ThreadHash.load(std::memory_order_relaxed));
+
+#ifdef AXR_PLATFORM_WIN32
+        for (uint32_t depth = 0; depth < stack.Depth; ++depth) {
+            axrLogError("    {}", stack.Addresses[depth]);
+        }
+#else
+        char** symbols = backtrace_symbols(stack.Addresses, static_cast<int>(stack.Depth));
+        for (uint32_t depth = 0; depth < stack.Depth; ++depth) {
+            if (symbols != nullptr) [[likely]] {
+                axrLogError("    {}", symbols[depth]);
+            } else {
+                axrLogError("    {}", stack.Addresses[depth]);
+            }
+        }
+        free(symbols);
+#endif
+    }
+}
+
+// ----------------------------------------- //
+// Static Helper Function Definitions
+// ----------------------------------------- //
+
+#ifdef AXR_HOOK_MALLOC
+extern "C" {
+    void* __libc_malloc(size_t size);
+    void* __libc_calloc(size_t count, size_t size);
+    void* __libc_realloc(void* memory, size_t size);
+    void* __libc_memalign(size_t alignment, size_t size);
+    void __libc_free(void* memory);
+}
+#endif
+
+static void* allocateSystemMemory(const size_t size) {
+#ifdef AXR_HOOK_MALLOC
+    return __libc_malloc(size);
+#else
+    return std::malloc(size);
+#endif
+}
+
+static void* allocateAlignedSystemMemory(const size_t size, const size_t alignment) {
+#if defined(AXR_HOOK_MALLOC)
+    return __libc_memalign(alignment, size);
+#elif defined(AXR_PLATFORM_WIN32)
+    return _aligned_malloc(size, alignment);
+#else
+    // aligned_alloc() needs the size to be a multiple of the alignment
+    return std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+#endif
+}
+
+static void deallocateSystemMemory(void* memory) {
+#ifdef AXR_HOOK_MALLOC
+    __libc_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+
+static void deallocateAlignedSystemMemory(void* memory) {
+#if defined(AXR_HOOK_MALLOC)
+    __libc_free(memory);
+#elif defined(AXR_PLATFORM_WIN32)
+    _aligned_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+
+/// Allocate memory for `operator new`
+/// @param size Size in bytes
+/// @return The allocated memory. Or nullptr if it failed
+static void* allocateForNew(size_t size) {
+    recordHeapAllocation(size);
+
+    if (size == 0) [[unlikely]] {
+        size = 1;
+    }
+
+    void* memory = allocateSystemMemory(size);
+    while (memory == nullptr) [[unlikely]] {
+        const std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) {
+            return nullptr;
+        }
+
+        handler();
+        memory = allocateSystemMemory(size);
+    }
+
+    return memory;
+}
+
+/// Allocate aligned memory for `operator new`
+/// @param size Size in bytes
+/// @param alignment Alignment in bytes
+/// @return The allocated memory. Or nullptr if it failed
+static void* allocateAlignedForNew(size_t size, const std::align_val_t alignment) {
+    recordHeapAllocation(size);
+
+    if (size == 0) [[unlikely]] {
+        size = 1;
+    }
+
+    void* memory = allocateAlignedSystemMemory(size, static_cast<size_t>(alignment));
+    while (memory == nullptr) [[unlikely]] {
+        const std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) {
+            return nullptr;
+        }
+
+        handler();
+        memory = allocateAlignedSystemMemory(size, static_cast<size_t>(alignment));
+    }
+
+    return memory;
+}
+
+// ----------------------------------------- //
+// Global Allocation Hooks
+// ----------------------------------------- //
+
+void* operator new(const size_t size) {
+    void* memory = allocateForNew(size);
+    if (memory == nullptr) [[unlikely]] {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* operator new[](const size_t size) {
+    return operator new(size);
+}
+
+void* operator new(const size_t size, const std::nothrow_t&) noexcept {
+    return allocateForNew(size);
+}
+
+void* operator new[](const size_t size, const std::nothrow_t&) noexcept {
+    return allocateForNew(size);
+}
+
+void* operator new(const size_t size, const std::align_val_t alignment) {
+    void* memory = allocateAlignedForNew(size, alignment);
+    if (memory == nullptr) [[unlikely]] {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* operator new[](const size_t size, const std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void* operator new(const size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocateAlignedForNew(size, alignment);
+}
+
+void* operator new[](const size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocateAlignedForNew(size, alignment);
+}
+
+void operator delete(void* memory) noexcept {
+    deallocateSystemMemory(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    deallocateSystemMemory(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    deallocateSystemMemory(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept {
+    deallocateSystemMemory(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept {
+    deallocateSystemMemory(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept {
+    deallocateSystemMemory(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+    deallocateAlignedSystemMemory(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept {
+    deallocateAlignedSystemMemory(memory);
+}
+
+void operator delete(void* memory, size_t, std::align_val_t) noexcept {
+    deallocateAlignedSystemMemory(memory);
+}
+
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept {
+    deallocateAlignedSystemMemory(memory);
+}
+
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept {
+    deallocateAlignedSystemMemory(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept {
+    deallocateAlignedSystemMemory(memory);
+}
+
+#ifdef AXR_HOOK_MALLOC
+extern "C" {
+    void* malloc(const size_t size) noexcept {
+        recordHeapAllocation(size);
+        return __libc_malloc(size);
+    }
+
+    void* calloc(const size_t count, const size_t size) noexcept {
+        recordHeapAllocation(count * size);
+        return __libc_calloc(count, size);
+    }
+
+    void* realloc(void* memory, const size_t size) noexcept {
+        recordHeapAllocation(size);
+        return __libc_realloc(memory, size);
+    }
+
+    void* aligned_alloc(const size_t alignment, const size_t size) noexcept {
+        recordHeapAllocation(size);
+        return __libc_memalign(alignment, size);
+    }
+
+    void free(void* memory) noexcept {
+        __libc_free(memory);
+    }
+}
+#endif
+
+#endif
@@ -0,0 +1,201 @@
+#pragma once
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include <cstddef>
+#include <cstdint>
+
+#ifdef AXR_HEAP_ALLOCATION_CHECK_ENABLED
+#include <atomic>
+#endif
+
+// ----------------------------------------- //
+// Heap Allocation Frame Scope
+// ----------------------------------------- //
+
+/// Checks for system heap allocations made on any thread for as long as it's alive.
+/// When heap allocation checking is disabled, this does nothing.
+class AxrHeapAllocationFrameScope {
+public:
+    // ----------------------------------------- //
+    // Special Functions
+    // ----------------------------------------- //
+
+    // ---- Constructors ----
+
+    /// Constructor
+    AxrHeapAllocationFrameScope();
+    /// Copy Constructor
+    /// @param src Source AxrHeapAllocationFrameScope to copy from
+    AxrHeapAllocationFrameScope(const AxrHeapAllocationFrameScope& src) = delete;
+    /// Move Constructor
+    /// @param src Source AxrHeapAllocationFrameScope to move from
+    AxrHeapAllocationFrameScope(AxrHeapAllocationFrameScope&& src) noexcept = delete;
+
+    // ---- Destructor ----
+
+    /// Destructor
+    ~AxrHeapAllocationFrameScope();
+
+    // ---- Operator Overloads ----
+
+    /// Copy Assignment Operator
+    /// @param src Source AxrHeapAllocationFrameScope to copy from
+    AxrHeapAllocationFrameScope& operator=(const AxrHeapAllocationFrameScope& src) = delete;
+    /// Move Assignment Operator
+    /// @param src Source AxrHeapAllocationFrameScope to move from
+    AxrHeapAllocationFrameScope& operator=(AxrHeapAllocationFrameScope&& src) noexcept = delete;
+};
+
+#ifdef AXR_HEAP_ALLOCATION_CHECK_ENABLED
+
+// ----------------------------------------- //
+// Heap Allocation Checker
+// ----------------------------------------- //
+
+/// Counts system heap allocations made between the start and end of a frame.
+/// Frame loop work is meant to go through `AxrAllocator`, so any allocation that reaches the system heap in a steady
+/// state frame is reported along with the stacks it came from.
+///
+/// Global `operator new` is replaced while `AXR_HEAP_ALLOCATION_CHECK_ENABLED` is defined. `malloc()` and friends are
+/// only hooked on glibc, and not at all under address sanitizer since it already replaces them. On windows the
+/// replacement only applies to allocations made from within the engine library.
+class AxrHeapAllocationChecker {
+public:
+    // ----------------------------------------- //
+    // Public Constants
+    // ----------------------------------------- //
+
+    /// The max number of threads to keep separate counts for. Any more are counted under the last thread
+    static constexpr uint32_t MaxThreadCount = 64;
+    /// The max number of stacks to record each frame
+    static constexpr uint32_t MaxStackCount = 8;
+    /// The max number of return addresses to record for each stack
+    static constexpr uint32_t MaxStackDepth = 32;
+    /// Number of frames after a reset that are allowed to allocate while everything warms up
+    static constexpr uint32_t DefaultWarmUpFrameCount = 3;
+
+    // ----------------------------------------- //
+    // Public Structs
+    // ----------------------------------------- //
+
+    /// Results of a single frame
+    struct FrameReport {
+        uint64_t FrameIndex;
+        /// Number of heap allocations made on all threads
+        uint64_t AllocationCount;
+        /// Number of bytes requested by those allocations
+        uint64_t ByteCount;
+        /// Number of threads that made at least one heap allocation
+        uint32_t ThreadCount;
+        /// False if this frame was still warming up
+        bool IsSteadyState;
+    };
+
+private:
+    // ----------------------------------------- //
+    // Special Functions
+    // ----------------------------------------- //
+
+    // ---- Constructors ----
+
+    /// Constructor
+    AxrHeapAllocationChecker();
+    /// Copy Constructor
+    /// @param src Source AxrHeapAllocationChecker to copy from
+    AxrHeapAllocationChecker(const AxrHeapAllocationChecker& src) = delete;
+    /// Move Constructor
+    /// @param src Source AxrHeapAllocationChecker to move from
+    AxrHeapAllocationChecker(AxrHeapAllocationChecker&& src) noexcept = delete;
+
+    // ---- Destructor ----
+
+    /// Destructor
+    ~AxrHeapAllocationChecker();
+
+    // ---- Operator Overloads ----
+
+    /// Copy Assignment Operator
+    /// @param src Source AxrHeapAllocationChecker to copy from
+    AxrHeapAllocationChecker& operator=(const AxrHeapAllocationChecker& src) = delete;
+    /// Move Assignment Operator
+    /// @param src Source AxrHeapAllocationChecker to move from
+    AxrHeapAllocationChecker& operator=(AxrHeapAllocationChecker&& src) noexcept = delete;
+
+public:
+    // ----------------------------------------- //
+    // Public Functions
+    // ----------------------------------------- //
+
+    /// Get the AxrHeapAllocationChecker singleton
+    /// @return A reference to the AxrHeapAllocationChecker singleton
+    static AxrHeapAllocationChecker& get();
+
+    /// Start counting heap allocations for a new frame
+    void beginFrame();
+    /// Stop counting heap allocations for the current frame.
+    /// If a steady state frame allocated, the per thread counts and recorded stacks are logged.
+    /// @return The frame results
+    FrameReport endFrame();
+    /// Check if a frame is currently being checked
+    /// @return True if a frame is currently being checked
+    [[nodiscard]] bool isFrameActive() const;
+
+    /// Set the number of frames after a reset that are allowed to allocate
+    /// @param frameCount Number of warm up frames
+    void setWarmUpFrameCount(uint32_t frameCount);
+    /// Start counting frames from 0 again, so the next frames are treated as warm up frames.
+    /// Use this after anything that's expected to allocate, like loading a scene.
+    void reset();
+
+    /// Record a heap allocation. Called from the global allocation hooks
+    /// @param size Size in bytes
+    void recordAllocation(size_t size);
+
+private:
+    // ----------------------------------------- //
+    // Private Structs
+    // ----------------------------------------- //
+
+    /// Heap allocation counts for a single thread
+    struct ThreadRecord {
+        std::atomic<uint64_t> AllocationCount;
+        std::atomic<uint64_t> ByteCount;
+        /// Hash of the thread ID. Only used to tell threads apart in the log
+        std::atomic<uint64_t> ThreadHash;
+    };
+
+    /// The stack of a single heap allocation
+    struct StackRecord {
+        void* Addresses[MaxStackDepth];
+        uint64_t Size;
+        uint32_t Depth;
+        uint32_t ThreadIndex;
+        /// Set once the stack has been fully written
+        std::atomic<bool> IsReady;
+    };
+
+    // ----------------------------------------- //
+    // Private Variables
+    // ----------------------------------------- //
+    uint64_t m_FrameIndex{};
+    uint32_t m_WarmUpFrameCount = DefaultWarmUpFrameCount;
+    ThreadRecord m_Threads[MaxThreadCount]{};
+    std::atomic<uint32_t> m_ThreadCount{};
+    StackRecord m_Stacks[MaxStackCount]{};
+    std::atomic<uint32_t> m_StackCount{};
+
+    // ----------------------------------------- //
+    // Private Functions
+    // ----------------------------------------- //
+
+    /// Get the index of the calling thread's record, assigning it one if it doesn't have one yet
+    /// @return The thread record index
+    [[nodiscard]] uint32_t getThreadIndex();
+    /// Log the per thread counts and recorded stacks for the current frame
+    /// @param report Frame results
+    void logFrame(const FrameReport& report) const;
+};
+
+#endif
@@ -0,0 +1,108 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "memoryPressure.h"
+
+#include "axr/logging.h"
+
+// ----------------------------------------- //
+// Public Functions
+// ----------------------------------------- //
+
+void AxrMemoryPressureMonitor::setHighWaterMark(const size_t highWaterMark) {
+    m_HighWaterMark = highWaterMark;
+}
+
+size_t AxrMemoryPressureMonitor::getHighWaterMark() const {
+    return m_HighWaterMark;
+}
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to add memory pressure callback. "
+AxrResult AxrMemoryPressureMonitor::addCallback(const AxrMemoryPressureCallback& callback) {
+    if (!callback) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Callback isn't connected to a function.");
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    for (uint32_t i = 0; i < m_CallbackCount; ++i) {
+        if (m_Callbacks[i] == callback) [[unlikely]] {
+            axrLogError(AXR_FUNCTION_FAILED_STRING "Callback has already been added.");
+            return AXR_ERROR_DUPLICATE;
+        }
+    }
+
+    if (m_CallbackCount >= MaxCallbackCount) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Callback count has reached the max of {}.", MaxCallbackCount);
+        return AXR_ERROR_OUT_OF_MEMORY;
+    }
+
+    m_Callbacks[m_CallbackCount] = callback;
+    ++m_CallbackCount;
+
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+void AxrMemoryPressureMonitor::removeCallback(const AxrMemoryPressureCallback& callback) {
+    for (uint32_t i = 0; i < m_CallbackCount; ++i) {
+        if (m_Callbacks[i] != callback) {
+            continue;
+        }
+
+        // Keep the remaining callbacks in the order they were added
+        for (uint32_t j = i + 1; j < m_CallbackCount; ++j) {
+            m_Callbacks[j - 1] = m_Callbacks[j];
+        }
+        --m_CallbackCount;
+        m_Callbacks[m_CallbackCount].reset();
+        return;
+    }
+}
+
+void AxrMemoryPressureMonitor::removeAllCallbacks() {
+    for (uint32_t i = 0; i < m_CallbackCount; ++i) {
+        m_Callbacks[i].reset();
+    }
+    m_CallbackCount = 0;
+}
+
+uint32_t AxrMemoryPressureMonitor::callbackCount() const {
+    return m_CallbackCount;
+}
+
+bool AxrMemoryPressureMonitor::notifyCritical(const size_t size, const size_t capacity, const size_t requestedSize) {
+    return notify(AXR_MEMORY_PRESSURE_LEVEL_CRITICAL, size, capacity, requestedSize);
+}
+
+// ----------------------------------------- //
+// Private Functions
+// ----------------------------------------- //
+
+bool AxrMemoryPressureMonitor::notify(const AxrMemoryPressureLevelEnum level,
+                                      const size_t size,
+                                      const size_t capacity,
+                                      const size_t requestedSize) {
+    // Callbacks that allocate from the same allocator would otherwise notify themselves again
+    if (m_CallbackCount == 0 || m_IsNotifying) {
+        return false;
+    }
+
+    const AxrMemoryPressureEvent event{
+        .Level = level,
+        .Size = size,
+        .Capacity = capacity,
+        .HighWaterMark = m_HighWaterMark,
+        .RequestedSize = requestedSize,
+    };
+
+    m_IsNotifying = true;
+    // Newest callbacks first. Going through them in reverse also lets callbacks remove themselves
+    for (uint32_t i = m_CallbackCount; i > 0; --i) {
+        if (i - 1 < m_CallbackCount) {
+            m_Callbacks[i - 1](event);
+        }
+    }
+    m_IsNotifying = false;
+
+    return true;
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "axr/common/callback.h"
+#include "axr/common/enums.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// ----------------------------------------- //
+// Enums
+// ----------------------------------------- //
+
+/// How close an allocator is to running out of memory
+enum AxrMemoryPressureLevelEnum {
+    /// Usage has just crossed the allocator's high water mark. Allocations still succeed
+    AXR_MEMORY_PRESSURE_LEVEL_HIGH = 0,
+    /// An allocation couldn't find a free block big enough. If nothing is freed, the allocation either forces a
+    /// defragmentation or fails
+    AXR_MEMORY_PRESSURE_LEVEL_CRITICAL,
+    AXR_MEMORY_PRESSURE_LEVEL_END,
+};
+
+// ----------------------------------------- //
+// Structs
+// ----------------------------------------- //
+
+/// Details of a single memory pressure notification
+struct AxrMemoryPressureEvent {
+    AxrMemoryPressureLevelEnum Level;
+    /// Size in bytes currently in use
+    size_t Size;
+    /// Size in bytes the allocator can hold
+    size_t Capacity;
+    /// The allocator's high water mark, in bytes
+    size_t HighWaterMark;
+    /// Size in bytes of the allocation that caused this notification
+    size_t RequestedSize;
+};
+
+// ----------------------------------------- //
+// Types
+// ----------------------------------------- //
+
+/// Axr memory pressure function
+using AxrMemoryPressureCallback = AxrCallback<void(const AxrMemoryPressureEvent& event)>;
+
+// ----------------------------------------- //
+// Memory Pressure Monitor
+// ----------------------------------------- //
+
+/// Notifies registered callbacks when an allocator is running low on memory, so subsystems can evict assets, trim
+/// caches or schedule defragmentation before an allocation fails or stalls.
+/// Callbacks run inside the allocation that caused them. They may deallocate from and defragment the allocator, but
+/// must not deallocate anything that's in the middle of being reallocated. Allocations made from within a callback
+/// don't cause any further notifications.
+class AxrMemoryPressureMonitor {
+public:
+    // ----------------------------------------- //
+    // Public Constants
+    // ----------------------------------------- //
+
+    /// The max number of callbacks a single monitor can have
+    static constexpr uint32_t MaxCallbackCount = 8;
+
+    // ----------------------------------------- //
+    // Public Functions
+    // ----------------------------------------- //
+
+    /// Set the number of bytes in use that counts as high memory pressure
+    /// @param highWaterMark Size in bytes. 0 to never notify about high memory pressure
+    void setHighWaterMark(size_t highWaterMark);
+    /// Get the number of bytes in use that counts as high memory pressure
+    /// @return The high water mark in bytes. 0 if it isn't used
+    [[nodiscard]] size_t getHighWaterMark() const;
+
+    /// Add a callback to notify about memory pressure
+    /// @param callback Callback to add
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_VALIDATION_FAILED if the callback isn't connected to a function.
+    /// AXR_ERROR_DUPLICATE if the callback has already been added.
+    /// AXR_ERROR_OUT_OF_MEMORY if there's already `MaxCallbackCount` callbacks.
+    [[nodiscard]] AxrResult addCallback(const AxrMemoryPressureCallback& callback);
+    /// Remove a callback that was added with `addCallback()`. Does nothing if it was never added
+    /// @param callback Callback to remove
+    void removeCallback(const AxrMemoryPressureCallback& callback);
+    /// Remove all callbacks
+    void removeAllCallbacks();
+    /// Get the number of callbacks
+    /// @return The number of callbacks
+    [[nodiscard]] uint32_t callbackCount() const;
+
+    /// Check if an allocation has pushed the allocator over its high water mark.
+    /// Callbacks are only notified when an allocation crosses the high water mark, not on every allocation above it.
+    /// @param previousSize Size in bytes in use before the allocation
+    /// @param size Size in bytes in use after the allocation
+    /// @param capacity Size in bytes the allocator can hold
+    /// @param requestedSize Size in bytes of the allocation
+    void checkHighWaterMark(const size_t previousSize,
+                            const size_t size,
+                            const size_t capacity,
+                            const size_t requestedSize) {
+        // A high water mark of 0 is never crossed, since the previous size can't be below it
+        if (previousSize >= m_HighWaterMark || size < m_HighWaterMark) [[likely]] {
+            return;
+        }
+
+        notify(AXR_MEMORY_PRESSURE_LEVEL_HIGH, size, capacity, requestedSize);
+    }
+
+    /// Notify the callbacks that an allocation couldn't find a free block big enough
+    /// @param size Size in bytes currently in use
+    /// @param capacity Size in bytes the allocator can hold
+    /// @param requestedSize Size in bytes of the allocation
+    /// @return True if any callbacks were notified, and it's worth looking for a free block again
+    [[nodiscard]] bool notifyCritical(size_t size, size_t capacity, size_t requestedSize);
+
+private:
+    // ----------------------------------------- //
+    // Private Variables
+    // ----------------------------------------- //
+    AxrMemoryPressureCallback m_Callbacks[MaxCallbackCount]{};
+    uint32_t m_CallbackCount{};
+    size_t m_HighWaterMark{};
+    bool m_IsNotifying{};
+
+    // ----------------------------------------- //
+    // Private Functions
+    // ----------------------------------------- //
+
+    /// Notify every callback
+    /// @param level Memory pressure level
+    /// @param size Size in bytes currently in use
+    /// @param capacity Size in bytes the allocator can hold
+    /// @param requestedSize Size in bytes of the allocation
+    /// @return True if any callbacks were notified
+    bool notify(AxrMemoryPressureLevelEnum level, size_t size, size_t capacity, size_t requestedSize);
+};
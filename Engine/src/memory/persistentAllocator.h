@@ -0,0 +1,23 @@
+#pragma once
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#ifdef AXR_TLSF_ALLOCATOR_ENABLED
+#include "tlsfAllocator.h"
+#else
+#include "dynamicAllocator.h"
+#endif
+
+// ----------------------------------------- //
+// Types
+// ----------------------------------------- //
+
+/// The allocator used for persistent engine data and by all `_Dynamic` containers.
+/// `AxrTlsfAllocator` gives constant time allocations but can't be defragmented. `AxrDynamicAllocator` can be
+/// defragmented but allocations take O(log n).
+#ifdef AXR_TLSF_ALLOCATOR_ENABLED
+using AxrPersistentAllocator_T = AxrTlsfAllocator;
+#else
+using AxrPersistentAllocator_T = AxrDynamicAllocator;
+#endif
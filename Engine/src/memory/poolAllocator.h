@@ -5,6 +5,7 @@
 // ----------------------------------------- //
 #include "../utils.h"
 #include "axr/common/enums.h"
+#include "allocationTracker.h"
 #include "axr/logging.h"
 #include "subAllocatorBase.h"
 #include "types.h"
@@ -92,9 +93,12 @@ public:
     /// Allocate new memory from the pool
     /// @param memory Output allocated memory
     /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
     /// @return AXR_SUCCESS if the function succeeded.
     /// AXR_ERROR_OUT_OF_MEMORY if there isn't any free memory in the pool.
-    [[nodiscard]] AxrResult allocate(Type*& memory, const bool zeroOutMemory = false) {
+    [[nodiscard]] AxrResult allocate(Type*& memory,
+                                     const bool zeroOutMemory = false,
+                                     [[maybe_unused]] const AxrAllocationTag& tag = {}) {
         if (m_FreeChunksHead == nullptr) {
             axrLogError(AXR_FUNCTION_FAILED_STRING "Ran out of chunks to allocate.");
             return AXR_ERROR_OUT_OF_MEMORY;
@@ -115,6 +119,15 @@ public:
             m_PeakUsedChunkCount = m_UsedChunkCount;
         }
 #endif
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+        AxrAllocationTracker::get().recordAllocation(chunk, sizeof(Type), tag);
+#endif
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+        AxrSubAllocatorBase::recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_ALLOCATE,
+                                              reinterpret_cast<uintptr_t>(chunk),
+                                              sizeof(Type),
+                                              alignof(Type));
+#endif
 
         return AXR_SUCCESS;
     }
@@ -137,17 +150,127 @@ public:
 
         chunk->Next = m_FreeChunksHead;
         m_FreeChunksHead = chunk;
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+        AxrAllocationTracker::get().recordDeallocation(memory);
+#endif
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+        AxrSubAllocatorBase::recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_DEALLOCATE,
+                                              reinterpret_cast<uintptr_t>(memory));
+#endif
         memory = nullptr;
 
         m_UsedChunkCount--;
     }
 
+#define AXR_FUNCTION_FAILED_STRING "Failed to allocate memory batch for AxrPoolAllocator. "
+    /// Allocate many chunks from the pool at once.
+    /// Either all chunks are allocated, or none of them are.
+    /// @param memory Output allocated memory. Must contain `count` pointers
+    /// @param count The number of chunks to allocate
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there aren't enough free chunks in the pool.
+    [[nodiscard]] AxrResult allocateBatch(Type** memory,
+                                          const uint32_t count,
+                                          const bool zeroOutMemory = false,
+                                          [[maybe_unused]] const AxrAllocationTag& tag = {}) {
+        assert(memory != nullptr || count == 0);
+
+        if (m_ChunkCapacity - m_UsedChunkCount < count) [[unlikely]] {
+            axrLogError(AXR_FUNCTION_FAILED_STRING "Not enough chunks left for the batch.");
+            return AXR_ERROR_OUT_OF_MEMORY;
+        }
+
+        for (uint32_t i = 0; i < count; ++i) {
+            Type* chunk = reinterpret_cast<Type*>(m_FreeChunksHead);
+            m_FreeChunksHead = m_FreeChunksHead->Next;
+
+            if (zeroOutMemory) {
+                std::memset(static_cast<void*>(chunk), 0, sizeof(Type));
+            }
+
+            memory[i] = chunk;
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+            AxrAllocationTracker::get().recordAllocation(chunk, sizeof(Type), tag);
+#endif
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+            AxrSubAllocatorBase::recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_ALLOCATE,
+                                                  reinterpret_cast<uintptr_t>(chunk),
+                                                  sizeof(Type),
+                                                  alignof(Type));
+#endif
+        }
+
+        m_UsedChunkCount += count;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+        if (m_UsedChunkCount > m_PeakUsedChunkCount) {
+            m_PeakUsedChunkCount = m_UsedChunkCount;
+        }
+#endif
+
+        return AXR_SUCCESS;
+    }
+#undef AXR_FUNCTION_FAILED_STRING
+
+    /// Return many chunks back to the pool at once.
+    /// The chunks are chained together first and then added to the free chunks in one go.
+    /// @param memory Memory to return to the pool. Must contain `count` pointers
+    /// @param count The number of chunks to return
+    void deallocateBatch(Type** memory, const uint32_t count) {
+        assert(memory != nullptr || count == 0);
+
+        Chunk* batchHead = m_FreeChunksHead;
+        size_t deallocatedCount = 0;
+
+        for (uint32_t i = 0; i < count; ++i) {
+            const auto memoryAddress = reinterpret_cast<uintptr_t>(memory[i]);
+            // If the given data isn't part of the memory we manage, don't do anything with it
+            if (memoryAddress < reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory) ||
+                memoryAddress > reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory) +
+                                    AxrSubAllocatorBase::m_Capacity) [[unlikely]] {
+                axrLogWarning("Attempted to deallocate data that isn't from this pool allocator.");
+                continue;
+            }
+
+            axrCallDestructor(*memory[i]);
+            auto chunk = reinterpret_cast<Chunk*>(memory[i]);
+
+            chunk->Next = batchHead;
+            batchHead = chunk;
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+            AxrAllocationTracker::get().recordDeallocation(memory[i]);
+#endif
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+            AxrSubAllocatorBase::recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_DEALLOCATE,
+                                                  reinterpret_cast<uintptr_t>(memory[i]));
+#endif
+            memory[i] = nullptr;
+            ++deallocatedCount;
+        }
+
+        m_FreeChunksHead = batchHead;
+        m_UsedChunkCount -= deallocatedCount;
+    }
+
     /// Clear the pool and mark all chunks as free
     void clear() {
         m_UsedChunkCount = 0;
         m_FreeChunksHead = reinterpret_cast<Chunk*>(AxrSubAllocatorBase::m_Memory);
         chainAllChunks();
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+        AxrSubAllocatorBase::recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_CLEAR, 0);
+#endif
+    }
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    /// Start recording every allocation, deallocation and clear to the allocation trace.
+    /// Does nothing if no trace is being recorded
+    void startTraceRecording() {
+        AxrSubAllocatorBase::startTraceRecording_internal(AXR_ALLOCATION_TRACE_ALLOCATOR_POOL);
     }
+#endif
 
     /// Get the max number of chunks this allocator can hold
     /// @return The max number of chunks this allocator can hold
@@ -360,9 +483,12 @@ public:
     /// Allocate new memory from the pool
     /// @param memory Output allocated memory
     /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
     /// @return AXR_SUCCESS if the function succeeded.
     /// AXR_ERROR_OUT_OF_MEMORY if there isn't any free memory in the pool.
-    [[nodiscard]] AxrResult allocate(Type*& memory, const bool zeroOutMemory = false) {
+    [[nodiscard]] AxrResult allocate(Type*& memory,
+                                     const bool zeroOutMemory = false,
+                                     [[maybe_unused]] const AxrAllocationTag& tag = {}) {
         if (m_FreeChunksHeadIndex == ChunkIndexTraits::Max) {
             axrLogError(AXR_FUNCTION_FAILED_STRING "Ran out of chunks to allocate.");
             return AXR_ERROR_OUT_OF_MEMORY;
@@ -383,6 +509,15 @@ public:
             m_PeakUsedChunkCount = m_UsedChunkCount;
         }
 #endif
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+        AxrAllocationTracker::get().recordAllocation(chunk, sizeof(Type), tag);
+#endif
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+        AxrSubAllocatorBase::recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_ALLOCATE,
+                                              reinterpret_cast<uintptr_t>(chunk),
+                                              sizeof(Type),
+                                              alignof(Type));
+#endif
 
         return AXR_SUCCESS;
     }
@@ -406,17 +541,127 @@ public:
 
         at(index) = m_FreeChunksHeadIndex;
         m_FreeChunksHeadIndex = index;
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+        AxrAllocationTracker::get().recordDeallocation(memory);
+#endif
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+        AxrSubAllocatorBase::recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_DEALLOCATE,
+                                              reinterpret_cast<uintptr_t>(memory));
+#endif
         memory = nullptr;
 
         m_UsedChunkCount--;
     }
 
+#define AXR_FUNCTION_FAILED_STRING "Failed to allocate memory batch for AxrPoolAllocator. "
+    /// Allocate many chunks from the pool at once.
+    /// Either all chunks are allocated, or none of them are.
+    /// @param memory Output allocated memory. Must contain `count` pointers
+    /// @param count The number of chunks to allocate
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there aren't enough free chunks in the pool.
+    [[nodiscard]] AxrResult allocateBatch(Type** memory,
+                                          const uint32_t count,
+                                          const bool zeroOutMemory = false,
+                                          [[maybe_unused]] const AxrAllocationTag& tag = {}) {
+        assert(memory != nullptr || count == 0);
+
+        if (m_ChunkCapacity - m_UsedChunkCount < count) [[unlikely]] {
+            axrLogError(AXR_FUNCTION_FAILED_STRING "Not enough chunks left for the batch.");
+            return AXR_ERROR_OUT_OF_MEMORY;
+        }
+
+        for (uint32_t i = 0; i < count; ++i) {
+            Type* chunk = ptrAt(m_FreeChunksHeadIndex);
+            m_FreeChunksHeadIndex = at(m_FreeChunksHeadIndex);
+
+            if (zeroOutMemory) {
+                std::memset(static_cast<void*>(chunk), 0, sizeof(Type));
+            }
+
+            memory[i] = chunk;
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+            AxrAllocationTracker::get().recordAllocation(chunk, sizeof(Type), tag);
+#endif
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+            AxrSubAllocatorBase::recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_ALLOCATE,
+                                                  reinterpret_cast<uintptr_t>(chunk),
+                                                  sizeof(Type),
+                                                  alignof(Type));
+#endif
+        }
+
+        m_UsedChunkCount += count;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+        if (m_UsedChunkCount > m_PeakUsedChunkCount) {
+            m_PeakUsedChunkCount = m_UsedChunkCount;
+        }
+#endif
+
+        return AXR_SUCCESS;
+    }
+#undef AXR_FUNCTION_FAILED_STRING
+
+    /// Return many chunks back to the pool at once.
+    /// The chunks are chained together first and then added to the free chunks in one go.
+    /// @param memory Memory to return to the pool. Must contain `count` pointers
+    /// @param count The number of chunks to return
+    void deallocateBatch(Type** memory, const uint32_t count) {
+        assert(memory != nullptr || count == 0);
+
+        typename ChunkIndexTraits::Type batchHeadIndex = m_FreeChunksHeadIndex;
+        size_t deallocatedCount = 0;
+
+        for (uint32_t i = 0; i < count; ++i) {
+            const auto memoryAddress = reinterpret_cast<uintptr_t>(memory[i]);
+            // If the given data isn't part of the memory we manage, don't do anything with it
+            if (memoryAddress < reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory) ||
+                memoryAddress > reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory) +
+                                    AxrSubAllocatorBase::m_Capacity) [[unlikely]] {
+                axrLogWarning("Attempted to deallocate data that isn't from this pool allocator.");
+                continue;
+            }
+
+            const auto index = static_cast<ChunkIndexTraits::Type>(
+                (memoryAddress - reinterpret_cast<uintptr_t>(AxrSubAllocatorBase::m_Memory)) / sizeof(Type));
+
+            at(index) = batchHeadIndex;
+            batchHeadIndex = index;
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+            AxrAllocationTracker::get().recordDeallocation(memory[i]);
+#endif
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+            AxrSubAllocatorBase::recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_DEALLOCATE,
+                                                  reinterpret_cast<uintptr_t>(memory[i]));
+#endif
+            memory[i] = nullptr;
+            ++deallocatedCount;
+        }
+
+        m_FreeChunksHeadIndex = batchHeadIndex;
+        m_UsedChunkCount -= deallocatedCount;
+    }
+
     /// Clear the pool and mark all chunks as free
     void clear() {
         m_UsedChunkCount = 0;
         m_FreeChunksHeadIndex = 0;
         chainAllChunks();
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+        AxrSubAllocatorBase::recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_CLEAR, 0);
+#endif
+    }
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    /// Start recording every allocation, deallocation and clear to the allocation trace.
+    /// Does nothing if no trace is being recorded
+    void startTraceRecording() {
+        AxrSubAllocatorBase::startTraceRecording_internal(AXR_ALLOCATION_TRACE_ALLOCATOR_POOL);
     }
+#endif
 
     /// Get the max number of chunks this allocator can hold
     /// @return The max number of chunks this allocator can hold
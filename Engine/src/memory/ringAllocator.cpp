@@ -0,0 +1,164 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "ringAllocator.h"
+#include "axr/logging.h"
+#include "memoryUtils.h"
+
+#include <cstring>
+
+// ----------------------------------------- //
+// Special Functions
+// ----------------------------------------- //
+
+AxrRingAllocator::AxrRingAllocator() = default;
+
+AxrRingAllocator::AxrRingAllocator(const AxrMemoryBlock& memoryBlock) :
+    AxrSubAllocatorBase(memoryBlock) {
+}
+
+AxrRingAllocator::AxrRingAllocator(AxrRingAllocator&& src) noexcept :
+    AxrSubAllocatorBase(std::move(src)) {
+    move_internal(std::move(src), true);
+}
+
+AxrRingAllocator::~AxrRingAllocator() {
+    cleanup();
+}
+
+AxrRingAllocator& AxrRingAllocator::operator=(AxrRingAllocator&& src) noexcept {
+    if (this != &src) {
+        cleanup();
+
+        AxrSubAllocatorBase::operator=(std::move(src));
+
+        move_internal(std::move(src), false);
+    }
+    return *this;
+}
+
+// ----------------------------------------- //
+// Public Functions
+// ----------------------------------------- //
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to allocate memory block for AxrRingAllocator. "
+AxrResult AxrRingAllocator::allocateBlock(const size_t size,
+                                          const uint8_t alignment,
+                                          void*& memory,
+                                          const bool zeroOutMemory,
+                                          [[maybe_unused]] const AxrAllocationTag& tag) {
+    // This should never be null. The only time it's null is if this allocator is empty and wasn't given any data to
+    // manage. In such case, we shouldn't be calling this function
+    assert(m_Memory != nullptr);
+
+    const auto memoryAddress = reinterpret_cast<uintptr_t>(m_Memory);
+    const uintptr_t headAddress = memoryAddress + m_HeadOffset;
+    uintptr_t dataAddress = axrAlignAddress(headAddress, alignment);
+
+    // An allocation that would straddle the end starts back at the beginning instead. The space skipped over at the end
+    // stays in use until it's released along with this allocation.
+    if (dataAddress + size > memoryAddress + m_Capacity) {
+        dataAddress = axrAlignAddress(memoryAddress, alignment);
+    }
+
+    const uintptr_t dataEndAddress = dataAddress + size;
+    // When wrapped, the block also covers the space skipped over at the end
+    const size_t blockSize = dataAddress >= headAddress ? dataEndAddress - headAddress
+                                                        : m_Capacity - m_HeadOffset + (dataEndAddress - memoryAddress);
+    if (blockSize > m_Capacity - (m_Head - m_Tail)) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Ran out of memory for a block of size {} bytes and alignment of {}.",
+                    size,
+                    alignment);
+        return AXR_ERROR_OUT_OF_MEMORY;
+    }
+
+    memory = reinterpret_cast<void*>(dataAddress);
+    if (zeroOutMemory) {
+        std::memset(memory, 0, size);
+    }
+
+    m_Head += blockSize;
+    m_HeadOffset = dataEndAddress - memoryAddress;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    if (m_Head - m_Tail > m_PeakSize) {
+        m_PeakSize = m_Head - m_Tail;
+    }
+#endif
+
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+    AxrAllocationTracker::get().recordAllocation(memory, size, tag, true);
+#endif
+
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+AxrRingAllocator::Fence AxrRingAllocator::getFence() const {
+    return m_Head;
+}
+
+void AxrRingAllocator::release(const Fence fence) {
+    assert(fence <= m_Head);
+
+    if (fence <= m_Tail) {
+        return;
+    }
+
+    m_Tail = fence;
+
+    // Start back at the beginning once everything is released, so the next allocations are less likely to straddle
+    // the end
+    if (m_Tail == m_Head) {
+        m_HeadOffset = 0;
+    }
+    // Don't zero out memory
+}
+
+void AxrRingAllocator::clear() {
+    m_Tail = m_Head;
+    m_HeadOffset = 0;
+    // Don't zero out memory
+}
+
+size_t AxrRingAllocator::size() const {
+    return static_cast<size_t>(m_Head - m_Tail);
+}
+
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+size_t AxrRingAllocator::peakSize() const {
+    return m_PeakSize;
+}
+#endif
+
+bool AxrRingAllocator::empty() const {
+    return m_Head == m_Tail;
+}
+
+// ----------------------------------------- //
+// Private Functions
+// ----------------------------------------- //
+
+void AxrRingAllocator::cleanup() {
+    AxrSubAllocatorBase::cleanup();
+}
+
+void AxrRingAllocator::move_internal(AxrRingAllocator&& src, [[maybe_unused]] const bool useConstructor) {
+    // Please note that we aren't moving the base class. That should be done before calling this function.
+
+    m_Head = src.m_Head;
+    m_HeadOffset = src.m_HeadOffset;
+    m_Tail = src.m_Tail;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    m_PeakSize = src.m_PeakSize;
+#endif
+
+    // The base class already took the source's memory. Make sure it doesn't think it still has any
+    src.m_Memory = nullptr;
+    src.m_Capacity = 0;
+    src.m_Head = 0;
+    src.m_HeadOffset = 0;
+    src.m_Tail = 0;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    src.m_PeakSize = 0;
+#endif
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "allocationTracker.h"
+#include "axr/common/enums.h"
+#include "subAllocatorBase.h"
+
+#include <cstdint>
+
+/// Ring buffer allocator for data that's released in the same order it was allocated. E.g. upload staging data or
+/// network packets.
+/// Allocations are made one after the other and wrap around to the start of the memory block once they reach the end.
+/// An allocation that would straddle the end starts back at the beginning instead, so every allocation is contiguous.
+/// Memory is released with fences. A fence marks everything allocated before it, and releasing a fence releases all of
+/// that memory at once.
+class AxrRingAllocator : public AxrSubAllocatorBase {
+public:
+    // ----------------------------------------- //
+    // Types
+    // ----------------------------------------- //
+
+    /// Fence type. The total number of bytes allocated before the fence was taken
+    using Fence = uint64_t;
+
+    // ----------------------------------------- //
+    // Special Functions
+    // ----------------------------------------- //
+
+    // ---- Constructors ----
+
+    /// Default Constructor
+    AxrRingAllocator();
+    /// Constructor
+    /// @param memoryBlock Memory block to use
+    explicit AxrRingAllocator(const AxrMemoryBlock& memoryBlock);
+    /// Copy Constructor
+    /// @param src Source AxrRingAllocator to copy from
+    AxrRingAllocator(const AxrRingAllocator& src) = delete;
+    /// Move Constructor
+    /// @param src Source AxrRingAllocator to move from
+    AxrRingAllocator(AxrRingAllocator&& src) noexcept;
+
+    // ---- Destructor ----
+
+    /// Destructor
+    ~AxrRingAllocator();
+
+    // ---- Operator Overloads ----
+
+    /// Copy Assignment Operator
+    /// @param src Source AxrRingAllocator to copy from
+    AxrRingAllocator& operator=(const AxrRingAllocator& src) = delete;
+    /// Move Assignment Operator
+    /// @param src Source AxrRingAllocator to move from
+    AxrRingAllocator& operator=(AxrRingAllocator&& src) noexcept;
+
+    // ----------------------------------------- //
+    // Public Functions
+    // ----------------------------------------- //
+
+    /// Allocate a new memory block at the head of the ring
+    /// @param size Size in bytes for how much memory to allocate
+    /// @param alignment Memory alignment
+    /// @param memory Output allocated memory
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough released memory ahead of the head for the requested memory.
+    [[nodiscard]] AxrResult allocateBlock(size_t size,
+                                          uint8_t alignment,
+                                          void*& memory,
+                                          bool zeroOutMemory = false,
+                                          const AxrAllocationTag& tag = {});
+
+    /// Allocate new memory at the head of the ring
+    /// @tparam Type The memory data type
+    /// @param size The number of data items of type `Type` to store in memory
+    /// @param memory Output allocated memory
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough released memory ahead of the head for the requested memory.
+    template<typename Type>
+    [[nodiscard]] AxrResult allocate(const size_t size,
+                                     Type*& memory,
+                                     const bool zeroOutMemory = false,
+                                     const AxrAllocationTag& tag = {}) {
+        return allocateBlock(sizeof(Type) * size,
+                             alignof(Type),
+                             reinterpret_cast<void*&>(memory),
+                             zeroOutMemory,
+                             tag);
+    }
+
+    /// Get a fence for everything allocated so far.
+    /// Once the work using that memory is done, pass the fence to `release()` to give it all back.
+    /// @return A fence for everything allocated so far
+    [[nodiscard]] Fence getFence() const;
+    /// Release all memory allocated before the given fence.
+    /// Fences must be released in the order they were taken. Releasing a fence that's already been released does
+    /// nothing.
+    /// @param fence Fence to release up to
+    void release(Fence fence);
+    /// Release all memory
+    void clear();
+
+    /// Get the number of bytes currently in use. Includes the space skipped over to avoid straddling the end
+    /// @return The number of bytes currently in use
+    [[nodiscard]] size_t size() const;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    /// Get the peak number of bytes in use at one time
+    /// @return The peak number of bytes in use at one time
+    [[nodiscard]] size_t peakSize() const;
+#endif
+    /// Get the empty state of the allocator
+    /// @return True if the allocator is empty
+    [[nodiscard]] bool empty() const;
+
+private:
+    // ----------------------------------------- //
+    // Private Variables
+    // ----------------------------------------- //
+
+    /// The total number of bytes ever allocated
+    uint64_t m_Head{};
+    /// The head's offset from the start of the memory block
+    size_t m_HeadOffset{};
+    /// The total number of bytes ever released. Always less than or equal to `m_Head`
+    uint64_t m_Tail{};
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    size_t m_PeakSize{};
+#endif
+
+    // ----------------------------------------- //
+    // Private Functions
+    // ----------------------------------------- //
+
+    /// Clean up this class
+    void cleanup();
+
+    /// Move the given AxrRingAllocator to this class
+    /// @param src AxrRingAllocator to move
+    /// @param useConstructor If true, this function will use the move constructor for non-primitive objects instead of
+    /// the move assignment operator when moving variables
+    void move_internal(AxrRingAllocator&& src, bool useConstructor);
+};
@@ -0,0 +1,145 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "sceneArena.h"
+#include "axr/logging.h"
+
+#include <new>
+#include <utility>
+
+// ----------------------------------------- //
+// Special Functions
+// ----------------------------------------- //
+
+AxrSceneArena::AxrSceneArena() = default;
+
+AxrSceneArena::AxrSceneArena(const AxrMemoryBlock& memoryBlock) :
+    m_Allocator(memoryBlock) {
+}
+
+AxrSceneArena::AxrSceneArena(AxrSceneArena&& src) noexcept {
+    move_internal(std::move(src), true);
+}
+
+AxrSceneArena::~AxrSceneArena() {
+    cleanup();
+}
+
+AxrSceneArena& AxrSceneArena::operator=(AxrSceneArena&& src) noexcept {
+    if (this != &src) {
+        cleanup();
+
+        move_internal(std::move(src), false);
+    }
+    return *this;
+}
+
+// ----------------------------------------- //
+// Public Functions
+// ----------------------------------------- //
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to begin loading scene arena. "
+AxrResult AxrSceneArena::beginLoad() {
+    if (m_State != State::Unloaded) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "A scene is already loading or loaded. Unload it first.");
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    m_State = State::Loading;
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+void AxrSceneArena::endLoad() {
+    assert(m_State == State::Loading);
+
+    m_Allocator.clearUpper();
+    m_State = State::Loaded;
+}
+
+void AxrSceneArena::unload() {
+    m_Allocator.clear();
+    m_State = State::Unloaded;
+}
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to allocate scene data block for scene arena. "
+AxrResult AxrSceneArena::allocateSceneBlock(const size_t size,
+                                            const uint8_t alignment,
+                                            void*& memory,
+                                            const bool zeroOutMemory) {
+    if (m_State == State::Unloaded) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "There's no scene loading or loaded.");
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    // Scene data is only ever released all at once, so the marker isn't needed
+    AxrDoubleStackAllocator::MarkerID markerID{};
+    return m_Allocator.allocateLowerBlock(size, alignment, memory, markerID, zeroOutMemory);
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to allocate temporary block for scene arena. "
+AxrResult AxrSceneArena::allocateTemporaryBlock(const size_t size,
+                                                const uint8_t alignment,
+                                                void*& memory,
+                                                const bool zeroOutMemory) {
+    if (m_State != State::Loading) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "There's no scene loading.");
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    // Temporaries are only ever released all at once when loading finishes, so the marker isn't needed
+    AxrDoubleStackAllocator::MarkerID markerID{};
+    return m_Allocator.allocateUpperBlock(size, alignment, memory, markerID, zeroOutMemory);
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+AxrSceneArena::State AxrSceneArena::state() const {
+    return m_State;
+}
+
+size_t AxrSceneArena::size() const {
+    return m_Allocator.size();
+}
+
+size_t AxrSceneArena::sceneSize() const {
+    return m_Allocator.sizeLower();
+}
+
+size_t AxrSceneArena::temporarySize() const {
+    return m_Allocator.sizeUpper();
+}
+
+size_t AxrSceneArena::capacity() const {
+    return m_Allocator.capacity();
+}
+
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+size_t AxrSceneArena::peakSize() const {
+    return m_Allocator.peakSize();
+}
+#endif
+
+bool AxrSceneArena::empty() const {
+    return m_Allocator.empty();
+}
+
+// ----------------------------------------- //
+// Private Functions
+// ----------------------------------------- //
+
+void AxrSceneArena::cleanup() {
+    // The allocator frees its own memory
+    m_State = State::Unloaded;
+}
+
+void AxrSceneArena::move_internal(AxrSceneArena&& src, const bool useConstructor) {
+    if (useConstructor) {
+        new (&m_Allocator) AxrDoubleStackAllocator(std::move(src.m_Allocator));
+    } else {
+        m_Allocator = std::move(src.m_Allocator);
+    }
+
+    m_State = src.m_State;
+    src.m_State = State::Unloaded;
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "axr/common/enums.h"
+#include "doubleStackAllocator.h"
+#include "types.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/// Scene arena. Holds everything that lives exactly as long as a single scene.
+/// Scene data grows from the lower end of a double-ended stack, and temporaries that are only needed while the scene
+/// is loading grow from the upper end. Temporaries are all dropped in O(1) once loading finishes, and unloading the
+/// scene drops everything in O(1). So loading and unloading scenes never fragments the persistent allocators.
+/// Nothing in the arena is destructed, so only trivially destructible data, or data that's destructed by its owner
+/// before unloading, belongs here.
+class AxrSceneArena {
+public:
+    // ----------------------------------------- //
+    // Types
+    // ----------------------------------------- //
+
+    /// Scene arena state
+    enum class State : uint8_t {
+        /// Empty. Nothing can be allocated until `beginLoad()` is called
+        Unloaded,
+        /// Scene data and temporaries can be allocated
+        Loading,
+        /// Only scene data can be allocated
+        Loaded,
+    };
+
+    // ----------------------------------------- //
+    // Special Functions
+    // ----------------------------------------- //
+
+    // ---- Constructors ----
+
+    /// Default constructor
+    AxrSceneArena();
+    /// Constructor
+    /// @param memoryBlock Memory block to use
+    explicit AxrSceneArena(const AxrMemoryBlock& memoryBlock);
+    /// Copy Constructor
+    /// @param src Source AxrSceneArena to copy from
+    AxrSceneArena(const AxrSceneArena& src) = delete;
+    /// Move Constructor
+    /// @param src Source AxrSceneArena to move from
+    AxrSceneArena(AxrSceneArena&& src) noexcept;
+
+    // ---- Destructor ----
+
+    /// Destructor
+    ~AxrSceneArena();
+
+    // ---- Operator Overloads ----
+
+    /// Copy Assignment Operator
+    /// @param src Source AxrSceneArena to copy from
+    AxrSceneArena& operator=(const AxrSceneArena& src) = delete;
+    /// Move Assignment Operator
+    /// @param src Source AxrSceneArena to move from
+    AxrSceneArena& operator=(AxrSceneArena&& src) noexcept;
+
+    // ----------------------------------------- //
+    // Public Functions
+    // ----------------------------------------- //
+
+    /// Start loading a new scene. The arena must be unloaded
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_VALIDATION_FAILED if a scene is already loading or loaded.
+    [[nodiscard]] AxrResult beginLoad();
+    /// Finish loading the scene and drop every temporary allocated while loading
+    void endLoad();
+    /// Unload the scene and drop everything in the arena. Can also be used to abort a load
+    void unload();
+
+    /// Allocate new memory block for data that lives as long as the scene
+    /// @param size Size in bytes for how much memory to allocate
+    /// @param alignment Memory alignment
+    /// @param memory Output allocated memory
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_VALIDATION_FAILED if there's no scene loading or loaded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space in the arena for the requested memory.
+    [[nodiscard]] AxrResult allocateSceneBlock(size_t size,
+                                               uint8_t alignment,
+                                               void*& memory,
+                                               bool zeroOutMemory = false);
+    /// Allocate new memory block for data that's only needed while the scene is loading
+    /// @param size Size in bytes for how much memory to allocate
+    /// @param alignment Memory alignment
+    /// @param memory Output allocated memory
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_VALIDATION_FAILED if there's no scene loading.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space in the arena for the requested memory.
+    [[nodiscard]] AxrResult allocateTemporaryBlock(size_t size,
+                                                   uint8_t alignment,
+                                                   void*& memory,
+                                                   bool zeroOutMemory = false);
+
+    /// Allocate new memory for data that lives as long as the scene
+    /// @tparam Type The memory data type
+    /// @param size The number of data items of type `Type` to store in memory
+    /// @param memory Output allocated memory
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_VALIDATION_FAILED if there's no scene loading or loaded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space in the arena for the requested memory.
+    template<typename Type>
+    [[nodiscard]] AxrResult allocateScene(const size_t size, Type*& memory, const bool zeroOutMemory = false) {
+        return allocateSceneBlock(sizeof(Type) * size, alignof(Type), reinterpret_cast<void*&>(memory), zeroOutMemory);
+    }
+
+    /// Allocate new memory for data that's only needed while the scene is loading
+    /// @tparam Type The memory data type
+    /// @param size The number of data items of type `Type` to store in memory
+    /// @param memory Output allocated memory
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_VALIDATION_FAILED if there's no scene loading.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space in the arena for the requested memory.
+    template<typename Type>
+    [[nodiscard]] AxrResult allocateTemporary(const size_t size, Type*& memory, const bool zeroOutMemory = false) {
+        return allocateTemporaryBlock(sizeof(Type) * size,
+                                      alignof(Type),
+                                      reinterpret_cast<void*&>(memory),
+                                      zeroOutMemory);
+    }
+
+    /// Get the scene arena state
+    /// @return The scene arena state
+    [[nodiscard]] State state() const;
+    /// Get the size of all allocated memory, including temporaries
+    /// @return The size of all allocated memory
+    [[nodiscard]] size_t size() const;
+    /// Get the size of the memory allocated for scene data
+    /// @return The size of the memory allocated for scene data
+    [[nodiscard]] size_t sceneSize() const;
+    /// Get the size of the memory allocated for temporaries
+    /// @return The size of the memory allocated for temporaries
+    [[nodiscard]] size_t temporarySize() const;
+    /// Get the total size of the arena's memory
+    /// @return The total size of the arena's memory
+    [[nodiscard]] size_t capacity() const;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    /// Get the peak usage size of the allocated memory
+    /// @return The peak usage size of the allocated memory
+    [[nodiscard]] size_t peakSize() const;
+#endif
+    /// Get the empty state of the arena
+    /// @return True if the arena is empty
+    [[nodiscard]] bool empty() const;
+
+private:
+    // ----------------------------------------- //
+    // Private Variables
+    // ----------------------------------------- //
+    AxrDoubleStackAllocator m_Allocator{};
+    State m_State = State::Unloaded;
+
+    // ----------------------------------------- //
+    // Private Functions
+    // ----------------------------------------- //
+
+    /// Clean up this class
+    void cleanup();
+
+    /// Move the given AxrSceneArena to this class
+    /// @param src AxrSceneArena to move
+    /// @param useConstructor If true, this function will use the move constructor for non-primitive objects instead of
+    /// the move assignment operator when moving variables
+    void move_internal(AxrSceneArena&& src, bool useConstructor);
+};
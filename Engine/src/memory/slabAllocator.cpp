@@ -0,0 +1,351 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "slabAllocator.h"
+
+#include "axr/logging.h"
+#include "memoryUtils.h"
+
+#include <cstring>
+#include <iterator>
+
+// ----------------------------------------- //
+// Static Variables
+// ----------------------------------------- //
+
+/// Smallest size class index that fits each size, indexed by `(size + 7) / 8`. All size classes are multiples of 8
+struct SlabSizeClassLookupTable {
+    uint8_t Indices[AxrSlabAllocator::MaxAllocationSize / 8 + 1];
+};
+
+static constexpr SlabSizeClassLookupTable SizeClassLookup = [] {
+    SlabSizeClassLookupTable table{};
+    uint8_t sizeClassIndex = 0;
+    for (size_t i = 0; i < std::size(table.Indices); ++i) {
+        if (AxrSlabAllocator::SizeClasses[sizeClassIndex] < i * 8) {
+            ++sizeClassIndex;
+        }
+        table.Indices[i] = sizeClassIndex;
+    }
+    return table;
+}();
+
+// ----------------------------------------- //
+// Special Functions
+// ----------------------------------------- //
+
+AxrSlabAllocator::AxrSlabAllocator() = default;
+
+AxrSlabAllocator::AxrSlabAllocator(const AxrMemoryBlock& memoryBlock) :
+    AxrSubAllocatorBase(memoryBlock) {
+    const auto memoryAddress = reinterpret_cast<uintptr_t>(m_Memory);
+    const uintptr_t pagesAddress = axrAlignAddress(memoryAddress, PageAlignment);
+    const size_t alignmentPadding = pagesAddress - memoryAddress;
+    assert(m_Capacity > alignmentPadding);
+
+    m_PageCount = (m_Capacity - alignmentPadding) / (PageSize + sizeof(PageInfo));
+    assert(m_PageCount != 0);
+
+    m_Pages = reinterpret_cast<uint8_t*>(pagesAddress);
+    m_PageInfos = reinterpret_cast<PageInfo*>(m_Pages + m_PageCount * PageSize);
+
+    chainAllPages();
+}
+
+AxrSlabAllocator::AxrSlabAllocator(AxrSlabAllocator&& src) noexcept :
+    AxrSubAllocatorBase(std::move(src)) {
+    move_internal(std::move(src), true);
+}
+
+AxrSlabAllocator::~AxrSlabAllocator() {
+    cleanup();
+}
+
+AxrSlabAllocator& AxrSlabAllocator::operator=(AxrSlabAllocator&& src) noexcept {
+    if (this != &src) {
+        cleanup();
+
+        AxrSubAllocatorBase::operator=(std::move(src));
+
+        move_internal(std::move(src), false);
+    }
+    return *this;
+}
+
+// ----------------------------------------- //
+// Public Functions
+// ----------------------------------------- //
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to allocate block for slab allocator. "
+AxrResult AxrSlabAllocator::allocateBlock(const size_t size,
+                                          const uint8_t alignment,
+                                          void*& memory,
+                                          const bool zeroOutMemory,
+                                          [[maybe_unused]] const AxrAllocationTag& tag) {
+    const uint8_t sizeClassIndex = getSizeClassIndex(size, alignment);
+    if (sizeClassIndex == NoSizeClass) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "No size class fits a size of {} with an alignment of {}.",
+                    size,
+                    alignment);
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    PageInfo* pageInfo = m_PartialPagesHeads[sizeClassIndex];
+    if (pageInfo == nullptr) {
+        if (m_FreePagesHead == nullptr) [[unlikely]] {
+            axrLogError(AXR_FUNCTION_FAILED_STRING "Ran out of pages.");
+            return AXR_ERROR_OUT_OF_MEMORY;
+        }
+
+        pageInfo = m_FreePagesHead;
+        removePage(m_FreePagesHead, pageInfo);
+        *pageInfo = PageInfo{
+            .Next = nullptr,
+            .Previous = nullptr,
+            .FreeChunksHead = nullptr,
+            .UsedChunkCount = 0,
+            .CarvedChunkCount = 0,
+            .SizeClassIndex = sizeClassIndex,
+        };
+        pushPage(m_PartialPagesHeads[sizeClassIndex], pageInfo);
+        ++m_UsedPageCount;
+    }
+
+    const size_t chunkSize = SizeClasses[sizeClassIndex];
+    void* chunk;
+    if (pageInfo->FreeChunksHead != nullptr) {
+        chunk = pageInfo->FreeChunksHead;
+        pageInfo->FreeChunksHead = pageInfo->FreeChunksHead->Next;
+    } else {
+        // Carve the next untouched chunk instead of chaining all chunks up front, so taking a new page is O(1)
+        chunk = getPageMemory(pageInfo) + pageInfo->CarvedChunkCount * chunkSize;
+        ++pageInfo->CarvedChunkCount;
+    }
+    ++pageInfo->UsedChunkCount;
+
+    if (pageInfo->UsedChunkCount == PageSize / chunkSize) {
+        removePage(m_PartialPagesHeads[sizeClassIndex], pageInfo);
+    }
+
+    if (zeroOutMemory) {
+        std::memset(chunk, 0, chunkSize);
+    }
+
+    memory = chunk;
+    m_Size += chunkSize;
+
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    if (m_Size > m_PeakSize) {
+        m_PeakSize = m_Size;
+    }
+#endif
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+    AxrAllocationTracker::get().recordAllocation(chunk, chunkSize, tag);
+#endif
+
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+void AxrSlabAllocator::deallocateBlock(void*& memory) {
+    const auto memoryAddress = reinterpret_cast<uintptr_t>(memory);
+    const auto pagesAddress = reinterpret_cast<uintptr_t>(m_Pages);
+    // If the given data isn't part of the memory we manage, don't do anything with it
+    if (memoryAddress < pagesAddress || memoryAddress >= pagesAddress + m_PageCount * PageSize) [[unlikely]] {
+        axrLogWarning("Attempted to deallocate data that isn't from this slab allocator.");
+        return;
+    }
+
+    PageInfo* pageInfo = &m_PageInfos[(memoryAddress - pagesAddress) / PageSize];
+    if (pageInfo->SizeClassIndex == NoSizeClass) [[unlikely]] {
+        axrLogWarning("Attempted to deallocate data from a free slab page.");
+        return;
+    }
+
+    const size_t chunkSize = SizeClasses[pageInfo->SizeClassIndex];
+    assert((memoryAddress - pagesAddress) % PageSize % chunkSize == 0);
+
+    // A full page isn't in the partial pages list, so add it back now that it has a free chunk
+    if (pageInfo->UsedChunkCount == PageSize / chunkSize) {
+        pushPage(m_PartialPagesHeads[pageInfo->SizeClassIndex], pageInfo);
+    }
+
+    const auto chunk = static_cast<Chunk*>(memory);
+    chunk->Next = pageInfo->FreeChunksHead;
+    pageInfo->FreeChunksHead = chunk;
+    --pageInfo->UsedChunkCount;
+    m_Size -= chunkSize;
+
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+    AxrAllocationTracker::get().recordDeallocation(memory);
+#endif
+    memory = nullptr;
+
+    // Give empty pages back so any size class can use them
+    if (pageInfo->UsedChunkCount == 0) {
+        removePage(m_PartialPagesHeads[pageInfo->SizeClassIndex], pageInfo);
+        pageInfo->SizeClassIndex = NoSizeClass;
+        pushPage(m_FreePagesHead, pageInfo);
+        --m_UsedPageCount;
+    }
+}
+
+void AxrSlabAllocator::clear() {
+    for (PageInfo*& partialPagesHead : m_PartialPagesHeads) {
+        partialPagesHead = nullptr;
+    }
+    m_UsedPageCount = 0;
+    m_Size = 0;
+
+    chainAllPages();
+}
+
+bool AxrSlabAllocator::empty() const {
+    return m_Size == 0;
+}
+
+size_t AxrSlabAllocator::size() const {
+    return m_Size;
+}
+
+size_t AxrSlabAllocator::pageCount() const {
+    return m_PageCount;
+}
+
+size_t AxrSlabAllocator::usedPageCount() const {
+    return m_UsedPageCount;
+}
+
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+size_t AxrSlabAllocator::peakSize() const {
+    return m_PeakSize;
+}
+#endif
+
+size_t AxrSlabAllocator::getChunkSize(const size_t size, const uint8_t alignment) {
+    const uint8_t sizeClassIndex = getSizeClassIndex(size, alignment);
+    if (sizeClassIndex == NoSizeClass) [[unlikely]] {
+        return 0;
+    }
+
+    return SizeClasses[sizeClassIndex];
+}
+
+size_t AxrSlabAllocator::getAllocatorSize(const uint32_t pageCount) {
+    return pageCount * (PageSize + sizeof(PageInfo)) + PageAlignment;
+}
+
+// ----------------------------------------- //
+// Private Functions
+// ----------------------------------------- //
+
+void AxrSlabAllocator::cleanup() {
+    m_Pages = nullptr;
+    m_PageInfos = nullptr;
+    m_PageCount = 0;
+    m_UsedPageCount = 0;
+    m_FreePagesHead = nullptr;
+    for (PageInfo*& partialPagesHead : m_PartialPagesHeads) {
+        partialPagesHead = nullptr;
+    }
+    m_Size = 0;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    m_PeakSize = 0;
+#endif
+
+    AxrSubAllocatorBase::cleanup();
+}
+
+void AxrSlabAllocator::move_internal(AxrSlabAllocator&& src, [[maybe_unused]] const bool useConstructor) {
+    // Please note that we aren't moving the base class. That should be done before calling this function.
+
+    m_Pages = src.m_Pages;
+    m_PageInfos = src.m_PageInfos;
+    m_PageCount = src.m_PageCount;
+    m_UsedPageCount = src.m_UsedPageCount;
+    m_FreePagesHead = src.m_FreePagesHead;
+    for (uint32_t i = 0; i < SizeClassCount; ++i) {
+        m_PartialPagesHeads[i] = src.m_PartialPagesHeads[i];
+        src.m_PartialPagesHeads[i] = nullptr;
+    }
+    m_Size = src.m_Size;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    m_PeakSize = src.m_PeakSize;
+#endif
+
+    src.m_Pages = nullptr;
+    src.m_PageInfos = nullptr;
+    src.m_PageCount = 0;
+    src.m_UsedPageCount = 0;
+    src.m_FreePagesHead = nullptr;
+    src.m_Size = 0;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    src.m_PeakSize = 0;
+#endif
+}
+
+uint8_t AxrSlabAllocator::getSizeClassIndex(const size_t size, const uint8_t alignment) {
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+    if (size > MaxAllocationSize || alignment > PageAlignment) [[unlikely]] {
+        return NoSizeClass;
+    }
+
+    // Pages are aligned to `PageAlignment`, so chunks are aligned to the lowest set bit of their size.
+    // Step up to a bigger size class until the alignment fits. The scan is bounded by the size class count
+    for (uint8_t i = SizeClassLookup.Indices[(size + 7) / 8]; i < SizeClassCount; ++i) {
+        const size_t chunkAlignment = SizeClasses[i] & -SizeClasses[i];
+        if (chunkAlignment >= alignment) [[likely]] {
+            return i;
+        }
+    }
+
+    return NoSizeClass;
+}
+
+uint8_t* AxrSlabAllocator::getPageMemory(const PageInfo* pageInfo) const {
+    return m_Pages + static_cast<size_t>(pageInfo - m_PageInfos) * PageSize;
+}
+
+void AxrSlabAllocator::pushPage(PageInfo*& listHead, PageInfo* pageInfo) {
+    pageInfo->Previous = nullptr;
+    pageInfo->Next = listHead;
+    if (listHead != nullptr) {
+        listHead->Previous = pageInfo;
+    }
+    listHead = pageInfo;
+}
+
+void AxrSlabAllocator::removePage(PageInfo*& listHead, PageInfo* pageInfo) {
+    if (pageInfo->Previous != nullptr) {
+        pageInfo->Previous->Next = pageInfo->Next;
+    } else {
+        assert(listHead == pageInfo);
+        listHead = pageInfo->Next;
+    }
+
+    if (pageInfo->Next != nullptr) {
+        pageInfo->Next->Previous = pageInfo->Previous;
+    }
+
+    pageInfo->Next = nullptr;
+    pageInfo->Previous = nullptr;
+}
+
+void AxrSlabAllocator::chainAllPages() {
+    m_FreePagesHead = nullptr;
+
+    // Chain in reverse so the lowest pages get used first
+    for (size_t i = m_PageCount; i > 0; --i) {
+        PageInfo* pageInfo = &m_PageInfos[i - 1];
+        *pageInfo = PageInfo{
+            .Next = nullptr,
+            .Previous = nullptr,
+            .FreeChunksHead = nullptr,
+            .UsedChunkCount = 0,
+            .CarvedChunkCount = 0,
+            .SizeClassIndex = NoSizeClass,
+        };
+        pushPage(m_FreePagesHead, pageInfo);
+    }
+}
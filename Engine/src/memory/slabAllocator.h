@@ -0,0 +1,237 @@
+#pragma once
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "../utils.h"
+#include "allocationTracker.h"
+#include "subAllocatorBase.h"
+
+/// Slab allocator for small objects of varied sizes.
+/// The memory block is split into fixed size pages. Each page in use belongs to a single size class and is carved into
+/// chunks of that size, handed out through a free chunk list like `AxrPoolAllocator`. Page info is kept apart from the
+/// pages themselves, so chunks carry no header and allocating and deallocating are both O(1).
+/// Pages that become empty go back to the shared free page list so any size class can reuse them.
+class AxrSlabAllocator : public AxrSubAllocatorBase {
+public:
+    // ----------------------------------------- //
+    // Public Constants
+    // ----------------------------------------- //
+
+    /// Size in bytes of each slab page
+    static constexpr size_t PageSize = 4'096;
+    /// Alignment of each slab page. Chunks are aligned to the largest power of two that divides their size, up to this
+    static constexpr size_t PageAlignment = 64;
+    /// The number of size classes
+    static constexpr uint32_t SizeClassCount = 10;
+    /// Chunk size in bytes of each size class. Steps of 1.5x and 2x to keep internal fragmentation under a third
+    static constexpr uint16_t SizeClasses[SizeClassCount] = {8, 16, 24, 32, 48, 64, 96, 128, 192, 256};
+    /// The largest allocation size in bytes this allocator supports
+    static constexpr size_t MaxAllocationSize = SizeClasses[SizeClassCount - 1];
+
+    static_assert(PageSize % PageAlignment == 0);
+    static_assert(PageSize / SizeClasses[0] <= UINT16_MAX);
+
+    // ----------------------------------------- //
+    // Special Functions
+    // ----------------------------------------- //
+
+    // ---- Constructors ----
+
+    /// Default Constructor
+    AxrSlabAllocator();
+    /// Constructor
+    /// @param memoryBlock Memory block to use
+    explicit AxrSlabAllocator(const AxrMemoryBlock& memoryBlock);
+    /// Copy Constructor
+    /// @param src Source AxrSlabAllocator to copy from
+    AxrSlabAllocator(const AxrSlabAllocator& src) = delete;
+    /// Move Constructor
+    /// @param src Source AxrSlabAllocator to move from
+    AxrSlabAllocator(AxrSlabAllocator&& src) noexcept;
+
+    // ---- Destructor ----
+
+    /// Destructor
+    ~AxrSlabAllocator();
+
+    // ---- Operator Overloads ----
+
+    /// Copy Assignment Operator
+    /// @param src Source AxrSlabAllocator to copy from
+    AxrSlabAllocator& operator=(const AxrSlabAllocator& src) = delete;
+    /// Move Assignment Operator
+    /// @param src Source AxrSlabAllocator to move from
+    AxrSlabAllocator& operator=(AxrSlabAllocator&& src) noexcept;
+
+    // ----------------------------------------- //
+    // Public Functions
+    // ----------------------------------------- //
+
+    /// Allocate a new chunk of memory from the smallest size class that fits the given size and alignment
+    /// @param size Size in bytes for how much memory to allocate. Must not exceed `MaxAllocationSize`
+    /// @param alignment Memory alignment. Must not exceed `PageAlignment`
+    /// @param memory Output allocated memory
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_VALIDATION_FAILED if no size class fits the given size and alignment.
+    /// AXR_ERROR_OUT_OF_MEMORY if there are no free chunks or pages left for the size class.
+    [[nodiscard]] AxrResult allocateBlock(size_t size,
+                                          uint8_t alignment,
+                                          void*& memory,
+                                          bool zeroOutMemory = false,
+                                          const AxrAllocationTag& tag = {});
+
+    /// Allocate new memory for a single object
+    /// @tparam Type The memory data type
+    /// @param memory Output allocated memory
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there are no free chunks or pages left for the size class.
+    template<typename Type>
+        requires(sizeof(Type) <= MaxAllocationSize && alignof(Type) <= PageAlignment)
+    [[nodiscard]] AxrResult allocate(Type*& memory,
+                                     const bool zeroOutMemory = false,
+                                     const AxrAllocationTag& tag = {}) {
+        return allocateBlock(sizeof(Type), alignof(Type), reinterpret_cast<void*&>(memory), zeroOutMemory, tag);
+    }
+
+    /// Return the given memory back to its slab page
+    /// @param memory Memory to deallocate
+    void deallocateBlock(void*& memory);
+
+    /// Call the destructor and return the given memory back to its slab page
+    /// @tparam Type The memory data type
+    /// @param memory Memory to deallocate
+    template<typename Type>
+    void deallocate(Type*& memory) {
+        if (memory == nullptr) [[unlikely]] {
+            return;
+        }
+
+        axrCallDestructor(*memory);
+        deallocateBlock(reinterpret_cast<void*&>(memory));
+    }
+
+    /// Clear the allocator and mark all pages as free
+    void clear();
+
+    /// Get the empty state of the allocator
+    /// @return True if the allocator is empty
+    [[nodiscard]] bool empty() const;
+    /// Get the number of bytes currently in use. Each allocation counts as its full size class
+    /// @return The number of bytes currently in use
+    [[nodiscard]] size_t size() const;
+    /// Get the number of slab pages this allocator has
+    /// @return The number of slab pages this allocator has
+    [[nodiscard]] size_t pageCount() const;
+    /// Get the number of slab pages currently assigned to a size class
+    /// @return The number of slab pages currently in use
+    [[nodiscard]] size_t usedPageCount() const;
+
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    /// Get the peak number of bytes in use at one time
+    /// @return The peak number of bytes in use at one time
+    [[nodiscard]] size_t peakSize() const;
+#endif
+
+    /// Get the chunk size of the size class the given size and alignment would be allocated from
+    /// @param size Size in bytes
+    /// @param alignment Memory alignment
+    /// @return The chunk size in bytes. Or 0 if no size class fits
+    [[nodiscard]] static size_t getChunkSize(size_t size, uint8_t alignment);
+    /// Get the number of bytes this allocator requires for the given number of slab pages
+    /// @param pageCount Number of slab pages to allow for
+    /// @return Number of bytes required for the given number of slab pages
+    [[nodiscard]] static size_t getAllocatorSize(uint32_t pageCount);
+
+private:
+    // ----------------------------------------- //
+    // Private Constants
+    // ----------------------------------------- //
+
+    /// Size class index for pages that aren't assigned to a size class
+    static constexpr uint8_t NoSizeClass = UINT8_MAX;
+
+    // ----------------------------------------- //
+    // Private Structs
+    // ----------------------------------------- //
+
+    /// Memory layout looks like the following:
+    /// [Page1][Page2][Page3]...[PageInfo1][PageInfo2][PageInfo3]...
+    /// Pages are aligned to `PageAlignment`. Page info is kept at the end so that it doesn't break page alignment.
+
+    /// A free chunk within a page with a pointer to the next free chunk
+    struct Chunk {
+        Chunk* Next;
+    };
+
+    /// Info about a single slab page
+    struct PageInfo {
+        /// The next page in the same list. Either the size class's partial pages or the free pages
+        PageInfo* Next;
+        /// The previous page in the same list. Either the size class's partial pages or the free pages
+        PageInfo* Previous;
+        /// Head of the list of chunks that were deallocated and are free to reuse
+        Chunk* FreeChunksHead;
+        /// The number of chunks currently allocated
+        uint16_t UsedChunkCount;
+        /// The number of chunks that have been carved from the start of the page. Chunks past this have never been
+        /// used, so they aren't in the free chunk list yet
+        uint16_t CarvedChunkCount;
+        /// The size class this page belongs to. Or `NoSizeClass` if the page is free
+        uint8_t SizeClassIndex;
+    };
+
+    // ----------------------------------------- //
+    // Private Variables
+    // ----------------------------------------- //
+    uint8_t* m_Pages{};
+    PageInfo* m_PageInfos{};
+    size_t m_PageCount{};
+    size_t m_UsedPageCount{};
+    /// Pages that aren't assigned to a size class
+    PageInfo* m_FreePagesHead{};
+    /// Pages per size class that have at least one free chunk
+    PageInfo* m_PartialPagesHeads[SizeClassCount]{};
+    size_t m_Size{};
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    size_t m_PeakSize{};
+#endif
+
+    // ----------------------------------------- //
+    // Private Functions
+    // ----------------------------------------- //
+
+    /// Clean up this class
+    void cleanup();
+
+    /// Move the given AxrSlabAllocator to this class
+    /// @param src AxrSlabAllocator to move
+    /// @param useConstructor If true, this function will use the move constructor for non-primitive objects instead of
+    /// the move assignment operator when moving variables
+    void move_internal(AxrSlabAllocator&& src, bool useConstructor);
+
+    /// Get the index of the smallest size class that fits the given size and alignment
+    /// @param size Size in bytes
+    /// @param alignment Memory alignment
+    /// @return The size class index. Or `NoSizeClass` if no size class fits
+    [[nodiscard]] static uint8_t getSizeClassIndex(size_t size, uint8_t alignment);
+    /// Get the memory of the given page
+    /// @param pageInfo Page to use
+    /// @return The start of the page's memory
+    [[nodiscard]] uint8_t* getPageMemory(const PageInfo* pageInfo) const;
+
+    /// Add the given page to the front of the given list
+    /// @param listHead Head of the list to add to
+    /// @param pageInfo Page to add
+    static void pushPage(PageInfo*& listHead, PageInfo* pageInfo);
+    /// Remove the given page from the given list
+    /// @param listHead Head of the list to remove from
+    /// @param pageInfo Page to remove
+    static void removePage(PageInfo*& listHead, PageInfo* pageInfo);
+    /// Chain together all pages, marking them all as free
+    void chainAllPages();
+};
@@ -46,7 +46,8 @@ AxrResult AxrStackAllocator::allocateBlock(const size_t size,
                                            const uint8_t alignment,
                                            void*& memory,
                                            MarkerID& markerID,
-                                           const bool zeroOutMemory) {
+                                           const bool zeroOutMemory,
+                                           [[maybe_unused]] const AxrAllocationTag& tag) {
     // Make sure there's enough space for both the requested memory size and for its marker.
     const size_t blockSize = size + alignment + sizeof(Marker);
     const size_t dataSize = size + alignment;
@@ -77,6 +78,13 @@ AxrResult AxrStackAllocator::allocateBlock(const size_t size,
 
     setCurrentMarker(Marker{.Size = dataSize, .ID = markerID});
 
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+    AxrAllocationTracker::get().recordAllocation(memory, size, tag, true);
+#endif
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_ALLOCATE, markerID, size, alignment);
+#endif
+
     return AXR_SUCCESS;
 }
 #undef AXR_FUNCTION_FAILED_STRING
@@ -89,6 +97,10 @@ void AxrStackAllocator::deallocate(const MarkerID markerID) {
     for (MarkerID i = 0; i <= currentMarker.ID - markerID; ++i) {
         pop();
     }
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_DEALLOCATE, markerID);
+#endif
 }
 
 bool AxrStackAllocator::deallocateIfLast(const MarkerID markerID) {
@@ -102,8 +114,18 @@ bool AxrStackAllocator::deallocateIfLast(const MarkerID markerID) {
 void AxrStackAllocator::clear() {
     m_Size = 0;
     // Don't zero out memory
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_CLEAR, 0);
+#endif
 }
 
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+void AxrStackAllocator::startTraceRecording() {
+    startTraceRecording_internal(AXR_ALLOCATION_TRACE_ALLOCATOR_STACK);
+}
+#endif
+
 size_t AxrStackAllocator::size() const {
     return m_Size;
 }
@@ -172,3 +194,77 @@ inline void AxrStackAllocator::pop() {
     m_Size -= blockSize;
     // Don't zero out memory.
 }
+
+// ----------------------------------------- //
+// Stack Allocator Scope
+// ----------------------------------------- //
+
+AxrStackAllocator::Scope::Scope(AxrStackAllocator& allocator) :
+    m_Allocator(&allocator),
+    m_StartSize(allocator.m_Size) {
+}
+
+AxrStackAllocator::Scope::Scope(Scope&& src) noexcept :
+    m_Allocator(src.m_Allocator),
+    m_StartSize(src.m_StartSize) {
+    src.m_Allocator = nullptr;
+}
+
+AxrStackAllocator::Scope::~Scope() {
+    rewind();
+}
+
+AxrStackAllocator::Scope& AxrStackAllocator::Scope::operator=(Scope&& src) noexcept {
+    if (this != &src) {
+        rewind();
+
+        m_Allocator = src.m_Allocator;
+        m_StartSize = src.m_StartSize;
+        src.m_Allocator = nullptr;
+    }
+    return *this;
+}
+
+AxrResult AxrStackAllocator::Scope::allocateBlock(const size_t size,
+                                                  const uint8_t alignment,
+                                                  void*& memory,
+                                                  const bool zeroOutMemory,
+                                                  const AxrAllocationTag& tag) {
+    assert(m_Allocator != nullptr);
+
+    // The whole scope gets rewound at once so we can ignore the markerID
+    MarkerID markerID;
+    return m_Allocator->allocateBlock(size, alignment, memory, markerID, zeroOutMemory, tag);
+}
+
+void AxrStackAllocator::Scope::rewind() {
+    if (m_Allocator == nullptr) [[unlikely]] {
+        return;
+    }
+
+    // The stack may already be smaller if it was cleared while this scope was open. Markers live at the end of each
+    // block, so shrinking the size back is all it takes to restore the top of the stack.
+    if (m_Allocator->m_Size > m_StartSize) {
+        m_Allocator->m_Size = m_StartSize;
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+        // Rewinding is the same as deallocating the first marker that was allocated within this scope
+        m_Allocator->recordTraceEvent(AXR_ALLOCATION_TRACE_EVENT_DEALLOCATE, m_Allocator->getCurrentMarker().ID + 1);
+#endif
+    }
+    // Don't zero out memory
+}
+
+AxrStackAllocator& AxrStackAllocator::Scope::allocator() const {
+    assert(m_Allocator != nullptr);
+
+    return *m_Allocator;
+}
+
+size_t AxrStackAllocator::Scope::size() const {
+    if (m_Allocator == nullptr || m_Allocator->m_Size < m_StartSize) [[unlikely]] {
+        return 0;
+    }
+
+    return m_Allocator->m_Size - m_StartSize;
+}
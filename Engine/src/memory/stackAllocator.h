@@ -3,6 +3,7 @@
 // ----------------------------------------- //
 // Headers
 // ----------------------------------------- //
+#include "allocationTracker.h"
 #include "axr/common/enums.h"
 #include "subAllocatorBase.h"
 #include "types.h"
@@ -19,6 +20,8 @@ public:
     /// Marker ID type
     using MarkerID = uint32_t;
 
+    class Scope;
+
     // ----------------------------------------- //
     // Special Functions
     // ----------------------------------------- //
@@ -61,13 +64,15 @@ public:
     /// @param memory Output allocated memory
     /// @param markerID Output marker ID for this memory
     /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
     /// @return AXR_SUCCESS if the function succeeded.
     /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space on the stack for the requested memory.
     [[nodiscard]] AxrResult allocateBlock(size_t size,
                                           uint8_t alignment,
                                           void*& memory,
                                           MarkerID& markerID,
-                                          bool zeroOutMemory = false);
+                                          bool zeroOutMemory = false,
+                                          const AxrAllocationTag& tag = {});
 
     /// Allocate new memory to the stack
     /// @tparam Type The memory data type
@@ -75,18 +80,21 @@ public:
     /// @param memory Output allocated memory
     /// @param markerID Output marker ID for this memory
     /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
     /// @return AXR_SUCCESS if the function succeeded.
     /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space on the stack for the requested memory.
     template<typename Type>
     [[nodiscard]] AxrResult allocate(const size_t size,
                                      Type*& memory,
                                      MarkerID& markerID,
-                                     const bool zeroOutMemory = false) {
+                                     const bool zeroOutMemory = false,
+                                     const AxrAllocationTag& tag = {}) {
         return allocateBlock(sizeof(Type) * size,
                              alignof(Type),
                              reinterpret_cast<void*&>(memory),
                              markerID,
-                             zeroOutMemory);
+                             zeroOutMemory,
+                             tag);
     }
 
     /// Deallocate the memory for the given marker ID. Including all memory allocated after the given marker.
@@ -100,6 +108,12 @@ public:
     /// Clear the stack
     void clear();
 
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    /// Start recording every allocation, deallocation and clear to the allocation trace.
+    /// Does nothing if no trace is being recorded
+    void startTraceRecording();
+#endif
+
     /// Get the size of the allocated memory
     /// @return The size of the allocated memory
     [[nodiscard]] size_t size() const;
@@ -170,3 +184,101 @@ private:
     /// Pop the top of the stack
     void pop();
 };
+
+// ----------------------------------------- //
+// Stack Allocator Scope
+// ----------------------------------------- //
+
+/// Scratch scope for temporary allocations on a stack allocator.
+/// The top of the stack is captured on construction, and everything allocated after it is rewound on destruction, so
+/// function local temporaries can reuse the same memory many times per frame.
+/// Scopes nest. Open a new scope on `allocator()` to pass scratch memory into a callee. Inner scopes must end before
+/// outer scopes.
+class AxrStackAllocator::Scope {
+public:
+    // ----------------------------------------- //
+    // Special Functions
+    // ----------------------------------------- //
+
+    // ---- Constructors ----
+
+    /// Constructor
+    /// @param allocator Stack allocator to capture the top of
+    explicit Scope(AxrStackAllocator& allocator);
+    /// Copy Constructor
+    /// @param src Source Scope to copy from
+    Scope(const Scope& src) = delete;
+    /// Move Constructor
+    /// @param src Source Scope to move from
+    Scope(Scope&& src) noexcept;
+
+    // ---- Destructor ----
+
+    /// Destructor
+    ~Scope();
+
+    // ---- Operator Overloads ----
+
+    /// Copy Assignment Operator
+    /// @param src Source Scope to copy from
+    Scope& operator=(const Scope& src) = delete;
+    /// Move Assignment Operator
+    /// @param src Source Scope to move from
+    Scope& operator=(Scope&& src) noexcept;
+
+    // ----------------------------------------- //
+    // Public Functions
+    // ----------------------------------------- //
+
+    /// Allocate new memory block within this scope
+    /// @param size Size in bytes for how much memory to allocate
+    /// @param alignment Memory alignment
+    /// @param memory Output allocated memory
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space on the stack for the requested memory.
+    [[nodiscard]] AxrResult allocateBlock(size_t size,
+                                          uint8_t alignment,
+                                          void*& memory,
+                                          bool zeroOutMemory = false,
+                                          const AxrAllocationTag& tag = {});
+
+    /// Allocate new memory within this scope
+    /// @tparam Type The memory data type
+    /// @param size The number of data items of type `Type` to store in memory
+    /// @param memory Output allocated memory
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space on the stack for the requested memory.
+    template<typename Type>
+    [[nodiscard]] AxrResult allocate(const size_t size,
+                                     Type*& memory,
+                                     const bool zeroOutMemory = false,
+                                     const AxrAllocationTag& tag = {}) {
+        return allocateBlock(sizeof(Type) * size,
+                             alignof(Type),
+                             reinterpret_cast<void*&>(memory),
+                             zeroOutMemory,
+                             tag);
+    }
+
+    /// Deallocate everything allocated within this scope. The scope stays open for new allocations
+    void rewind();
+
+    /// Get the stack allocator this scope belongs to
+    /// @return The stack allocator this scope belongs to
+    [[nodiscard]] AxrStackAllocator& allocator() const;
+    /// Get the size of the memory allocated within this scope
+    /// @return The size of the memory allocated within this scope
+    [[nodiscard]] size_t size() const;
+
+private:
+    // ----------------------------------------- //
+    // Private Variables
+    // ----------------------------------------- //
+    AxrStackAllocator* m_Allocator{};
+    /// Size of the stack when this scope was opened
+    size_t m_StartSize{};
+};
@@ -41,6 +41,16 @@ size_t AxrSubAllocatorBase::capacity() const {
     return m_Capacity;
 }
 
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+bool AxrSubAllocatorBase::isRecordingTrace() const {
+    return m_TraceAllocatorIndex != AxrAllocationTraceRecorder::InvalidAllocatorIndex;
+}
+
+void AxrSubAllocatorBase::stopTraceRecording() {
+    m_TraceAllocatorIndex = AxrAllocationTraceRecorder::InvalidAllocatorIndex;
+}
+#endif
+
 // ----------------------------------------- //
 // Protected Functions
 // ----------------------------------------- //
@@ -66,6 +76,29 @@ void AxrSubAllocatorBase::move_internal(AxrSubAllocatorBase&& src, const bool us
 
     m_Memory = src.m_Memory;
     m_Capacity = src.m_Capacity;
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    m_TraceAllocatorIndex = src.m_TraceAllocatorIndex;
+    src.m_TraceAllocatorIndex = AxrAllocationTraceRecorder::InvalidAllocatorIndex;
+#endif
 
     src.m_Memory = nullptr;
 }
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+void AxrSubAllocatorBase::startTraceRecording_internal(const AxrAllocationTraceAllocatorEnum allocatorType) {
+    m_TraceAllocatorIndex = AxrAllocationTraceRecorder::get().registerAllocator(allocatorType, m_Capacity);
+}
+
+void AxrSubAllocatorBase::recordTraceEvent(const AxrAllocationTraceEventEnum type,
+                                           const uint64_t allocationID,
+                                           const uint64_t size,
+                                           const uint8_t alignment,
+                                           const uint64_t previousAllocationID) const {
+    if (m_TraceAllocatorIndex == AxrAllocationTraceRecorder::InvalidAllocatorIndex) [[likely]] {
+        return;
+    }
+
+    AxrAllocationTraceRecorder::get()
+        .recordEvent(m_TraceAllocatorIndex, type, allocationID, previousAllocationID, size, alignment);
+}
+#endif
@@ -3,6 +3,7 @@
 // ----------------------------------------- //
 // Headers
 // ----------------------------------------- //
+#include "allocationTrace.h"
 #include "memoryUtils.h"
 #include "types.h"
 
@@ -51,6 +52,14 @@ public:
     /// @return The allocator's capacity
     [[nodiscard]] size_t capacity() const;
 
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    /// Check if this allocator is recording its events to the allocation trace
+    /// @return True if this allocator is recording its events to the allocation trace
+    [[nodiscard]] bool isRecordingTrace() const;
+    /// Stop recording this allocator's events to the allocation trace
+    void stopTraceRecording();
+#endif
+
 protected:
     // ----------------------------------------- //
     // Protected Variables
@@ -58,6 +67,9 @@ protected:
     AxrDeallocateBlock m_Deallocator{};
     void* m_Memory{};
     size_t m_Capacity{};
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    uint16_t m_TraceAllocatorIndex = AxrAllocationTraceRecorder::InvalidAllocatorIndex;
+#endif
 
     // ----------------------------------------- //
     // Protected Functions
@@ -71,6 +83,23 @@ protected:
     /// @param useConstructor If true, this function will use the move constructor for non-primitive objects instead of
     /// the move assignment operator when moving variables
     void move_internal(AxrSubAllocatorBase&& src, bool useConstructor);
+
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+    /// Start recording this allocator's events to the allocation trace. Does nothing if no trace is being recorded
+    /// @param allocatorType The type of this allocator
+    void startTraceRecording_internal(AxrAllocationTraceAllocatorEnum allocatorType);
+    /// Record an event to the allocation trace if this allocator is recording
+    /// @param type Event type
+    /// @param allocationID Allocation ID
+    /// @param size Size in bytes
+    /// @param alignment Alignment in bytes
+    /// @param previousAllocationID Allocation ID before a reallocation
+    void recordTraceEvent(AxrAllocationTraceEventEnum type,
+                          uint64_t allocationID,
+                          uint64_t size = 0,
+                          uint8_t alignment = 0,
+                          uint64_t previousAllocationID = 0) const;
+#endif
 };
 
 /// Base generic sub allocator with type alignment to inherit from
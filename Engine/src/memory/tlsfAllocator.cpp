@@ -0,0 +1,461 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "tlsfAllocator.h"
+
+#include "axr/logging.h"
+#include "memoryUtils.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+
+// ----------------------------------------- //
+// Special Functions
+// ----------------------------------------- //
+
+AxrTlsfAllocator::AxrTlsfAllocator() = default;
+
+AxrTlsfAllocator::AxrTlsfAllocator(const AxrMemoryBlock& memoryBlock) :
+    AxrSubAllocatorBase_Aligned(memoryBlock) {
+    // Block sizes need to be a multiple of `BlockAlignment` so that the lowest bit can be used as the free flag
+    m_Capacity &= ~(BlockAlignment - 1);
+    if (m_Capacity < MinBlockSize || m_Capacity > MaxCapacity) [[unlikely]] {
+        axrLogError("Failed to create tlsf allocator. Capacity must be between {} and {} bytes. Got {}.",
+                    MinBlockSize,
+                    MaxCapacity,
+                    m_Capacity);
+        // Without any free blocks, every allocation fails validation instead of writing outside of the memory
+        m_Capacity = 0;
+        return;
+    }
+
+    const auto freeBlock = static_cast<FreeBlockHeader*>(m_Memory);
+    freeBlock->Block = BlockHeader{
+        .Size = m_Capacity,
+        .PreviousPhysical = nullptr,
+    };
+    insertFreeBlock(freeBlock);
+}
+
+AxrTlsfAllocator::AxrTlsfAllocator(AxrTlsfAllocator&& src) noexcept :
+    AxrSubAllocatorBase_Aligned(std::move(src)) {
+    move_internal(std::move(src), true);
+}
+
+AxrTlsfAllocator::~AxrTlsfAllocator() {
+    cleanup();
+}
+
+AxrTlsfAllocator& AxrTlsfAllocator::operator=(AxrTlsfAllocator&& src) noexcept {
+    if (this != &src) {
+        cleanup();
+
+        AxrSubAllocatorBase_Aligned::operator=(std::move(src));
+
+        move_internal(std::move(src), false);
+    }
+    return *this;
+}
+
+// ----------------------------------------- //
+// Public Functions
+// ----------------------------------------- //
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to allocate block for tlsf allocator. "
+AxrResult AxrTlsfAllocator::allocateBlock(const size_t size,
+                                          const uint8_t alignment,
+                                          AxrHandle<void>& handle,
+                                          const bool zeroOutMemory,
+                                          [[maybe_unused]] const AxrAllocationTag& tag) {
+    // This should never be null. The only time it's null is if this allocator is empty and wasn't given any data to
+    // manage. In such case, we shouldn't be calling this function
+    assert(m_Memory != nullptr);
+
+    if (m_Capacity == 0) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "The allocator was created with an invalid capacity.");
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    const size_t blockSize = getRequiredBlockSize(size, alignment);
+
+    FreeBlockHeader* freeBlock = findFreeBlock(blockSize);
+    if (freeBlock == nullptr && m_MemoryPressureMonitor.notifyCritical(m_Size, m_Capacity, size)) [[unlikely]] {
+        // Give subsystems a chance to free some memory before failing
+        freeBlock = findFreeBlock(blockSize);
+    }
+
+    if (freeBlock == nullptr) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to find a free block of memory for the requested size.");
+        return AXR_ERROR_OUT_OF_MEMORY;
+    }
+
+    removeFreeBlock(freeBlock);
+
+    const auto usedBlock = reinterpret_cast<UsedBlockHeader*>(freeBlock);
+    trimBlock(&usedBlock->Block, blockSize);
+
+    const auto blockAddress = reinterpret_cast<uintptr_t>(usedBlock);
+    const uintptr_t dataAddress = axrAlignAddress(blockAddress + sizeof(UsedBlockHeader), alignment);
+    usedBlock->Data = reinterpret_cast<void*>(dataAddress);
+
+    if (zeroOutMemory) {
+        std::memset(usedBlock->Data, 0, blockAddress + getBlockSize(&usedBlock->Block) - dataAddress);
+    }
+
+    // ---- Set handle ----
+
+    AxrHandle<void>::Deallocator_T deallocatorCallback{};
+    deallocatorCallback.connect<&AxrTlsfAllocator::deallocateHandle>(this);
+
+    handle = AxrHandle(&usedBlock->Data, deallocatorCallback);
+
+    const size_t previousSize = m_Size;
+    m_Size += getBlockSize(&usedBlock->Block);
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    if (m_Size > m_PeakSize) {
+        m_PeakSize = m_Size;
+    }
+#endif
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+    AxrAllocationTracker::get().recordAllocation(AxrAllocationTracker::getHandleKey(handle.m_Data), size, tag);
+#endif
+
+    m_MemoryPressureMonitor.checkHighWaterMark(previousSize, m_Size, m_Capacity, size);
+
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+#define AXR_FUNCTION_FAILED_STRING "Failed to reallocate block for tlsf allocator. "
+AxrResult AxrTlsfAllocator::reallocateBlock(const size_t size,
+                                            const uint8_t alignment,
+                                            AxrHandle<void>& handle,
+                                            const bool zeroOutNewMemory,
+                                            const AxrAllocationTag& tag) {
+    // This should never be null. The only time it's null is if this allocator is empty and wasn't given any data to
+    // manage. In such case, we shouldn't be calling this function
+    assert(m_Memory != nullptr);
+
+    if (handle.m_Data == nullptr) {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "The given handle is not allocated.");
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    UsedBlockHeader* usedBlock = getUsedBlock(handle);
+    if (usedBlock == nullptr) [[unlikely]] {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Attempted to reallocate data that isn't from this tlsf allocator.");
+        return AXR_ERROR_VALIDATION_FAILED;
+    }
+
+    const auto blockAddress = reinterpret_cast<uintptr_t>(usedBlock);
+    const auto dataAddress = reinterpret_cast<uintptr_t>(usedBlock->Data);
+    const size_t originalBlockSize = getBlockSize(&usedBlock->Block);
+    const size_t originalDataSize = blockAddress + originalBlockSize - dataAddress;
+    const size_t blockSize = getRequiredBlockSize(size, alignment);
+
+    // ---- Resize in place ----
+
+    // The data can only stay where it is if it's still aligned for the requested alignment
+    if (axrAlignAddress(blockAddress + sizeof(UsedBlockHeader), alignment) == dataAddress) {
+        BlockHeader* nextBlock = getNextPhysical(&usedBlock->Block);
+        const size_t nextFreeBlockSize = nextBlock != nullptr && isFree(nextBlock) ? getBlockSize(nextBlock) : 0;
+
+        if (blockSize <= originalBlockSize + nextFreeBlockSize) {
+            if (blockSize > originalBlockSize) {
+                // Grow into the free block that's directly after this one
+                removeFreeBlock(reinterpret_cast<FreeBlockHeader*>(nextBlock));
+                usedBlock->Block.Size = originalBlockSize + nextFreeBlockSize;
+
+                BlockHeader* blockAfterNext = getNextPhysical(&usedBlock->Block);
+                if (blockAfterNext != nullptr) {
+                    blockAfterNext->PreviousPhysical = &usedBlock->Block;
+                }
+            }
+
+            trimBlock(&usedBlock->Block, blockSize);
+
+            if (zeroOutNewMemory && size > originalDataSize) {
+                std::memset(reinterpret_cast<void*>(dataAddress + originalDataSize), 0, size - originalDataSize);
+            }
+
+            const size_t previousSize = m_Size;
+            m_Size = m_Size - originalBlockSize + getBlockSize(&usedBlock->Block);
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+            if (m_Size > m_PeakSize) {
+                m_PeakSize = m_Size;
+            }
+#endif
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+            AxrAllocationTracker::get().recordResize(AxrAllocationTracker::getHandleKey(handle.m_Data), size);
+#endif
+
+            m_MemoryPressureMonitor.checkHighWaterMark(previousSize, m_Size, m_Capacity, size);
+
+            return AXR_SUCCESS;
+        }
+    }
+
+    // ---- Move to a new block ----
+
+    AxrHandle<void> newHandle;
+    const AxrResult axrResult = allocateBlock(size, alignment, newHandle, zeroOutNewMemory, tag);
+    if (AXR_FAILED(axrResult)) {
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Failed to allocate new block.");
+        return AXR_ERROR_OUT_OF_MEMORY;
+    }
+
+    std::memcpy(newHandle.getDataPtr(), handle.getDataPtr(), std::min(originalDataSize, size));
+
+    deallocateHandle(handle);
+
+    handle = std::move(newHandle);
+
+    return AXR_SUCCESS;
+}
+#undef AXR_FUNCTION_FAILED_STRING
+
+void AxrTlsfAllocator::deallocateHandle(AxrHandle<void>& handle) {
+    // This should never be null. The only time it's null is if this allocator is empty and wasn't given any data to
+    // manage. In such case, we shouldn't be calling this function
+    assert(m_Memory != nullptr);
+
+    if (handle.m_Data == nullptr) {
+        return;
+    }
+
+    UsedBlockHeader* usedBlock = getUsedBlock(handle);
+    // If the given data isn't part of the memory we manage, don't do anything with it
+    if (usedBlock == nullptr) [[unlikely]] {
+        axrLogWarning("Attempted to deallocate data that isn't from this tlsf allocator.");
+        return;
+    }
+
+    m_Size -= getBlockSize(&usedBlock->Block);
+    releaseBlock(&usedBlock->Block);
+
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+    AxrAllocationTracker::get().recordDeallocation(AxrAllocationTracker::getHandleKey(handle.m_Data));
+#endif
+
+    handle.m_Data = nullptr;
+}
+
+bool AxrTlsfAllocator::empty() const {
+    return m_Size == 0;
+}
+
+size_t AxrTlsfAllocator::size() const {
+    return m_Size;
+}
+
+AxrMemoryPressureMonitor& AxrTlsfAllocator::getMemoryPressureMonitor() {
+    return m_MemoryPressureMonitor;
+}
+
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+size_t AxrTlsfAllocator::peakSize() const {
+    return m_PeakSize;
+}
+#endif
+
+// ----------------------------------------- //
+// Private Functions
+// ----------------------------------------- //
+
+void AxrTlsfAllocator::cleanup() {
+    AxrSubAllocatorBase_Aligned::cleanup();
+}
+
+void AxrTlsfAllocator::move_internal(AxrTlsfAllocator&& src, [[maybe_unused]] const bool useConstructor) {
+    // Please note that we aren't moving the base class. That should be done before calling this function.
+
+    m_FirstLevelBitmap = src.m_FirstLevelBitmap;
+    std::memcpy(m_SecondLevelBitmaps, src.m_SecondLevelBitmaps, sizeof(m_SecondLevelBitmaps));
+    std::memcpy(m_FreeBlocks, src.m_FreeBlocks, sizeof(m_FreeBlocks));
+    m_Size = src.m_Size;
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    m_PeakSize = src.m_PeakSize;
+#endif
+    m_MemoryPressureMonitor = src.m_MemoryPressureMonitor;
+}
+
+size_t AxrTlsfAllocator::getRequiredBlockSize(const size_t size, const uint8_t alignment) {
+    // The data starts straight after the header, which is already aligned to `BlockAlignment`. So only alignments
+    // greater than that need any padding.
+    const size_t alignmentPadding = alignment > BlockAlignment ? alignment - BlockAlignment : 0;
+    const size_t blockSize = axrAlignAddress(sizeof(UsedBlockHeader) + alignmentPadding + size, BlockAlignment);
+    return std::max(blockSize, MinBlockSize);
+}
+
+size_t AxrTlsfAllocator::getBlockSize(const BlockHeader* block) {
+    return block->Size & ~FreeBlockFlag;
+}
+
+bool AxrTlsfAllocator::isFree(const BlockHeader* block) {
+    return (block->Size & FreeBlockFlag) != 0;
+}
+
+AxrTlsfAllocator::BlockHeader* AxrTlsfAllocator::getNextPhysical(const BlockHeader* block) const {
+    const uintptr_t nextBlockAddress = reinterpret_cast<uintptr_t>(block) + getBlockSize(block);
+    if (nextBlockAddress >= reinterpret_cast<uintptr_t>(m_Memory) + m_Capacity) {
+        return nullptr;
+    }
+
+    return reinterpret_cast<BlockHeader*>(nextBlockAddress);
+}
+
+AxrTlsfAllocator::UsedBlockHeader* AxrTlsfAllocator::getUsedBlock(const AxrHandle<void>& handle) const {
+    // Handles point to `UsedBlockHeader::Data`, so the header is just behind it
+    const uintptr_t blockAddress = reinterpret_cast<uintptr_t>(handle.m_Data) - offsetof(UsedBlockHeader, Data);
+    if (blockAddress < reinterpret_cast<uintptr_t>(m_Memory) ||
+        blockAddress >= reinterpret_cast<uintptr_t>(m_Memory) + m_Capacity) {
+        return nullptr;
+    }
+
+    return reinterpret_cast<UsedBlockHeader*>(blockAddress);
+}
+
+void AxrTlsfAllocator::getSizeClass(const size_t size, uint32_t& firstLevel, uint32_t& secondLevel) {
+    if (size < SmallBlockSize) {
+        firstLevel = 0;
+        secondLevel = static_cast<uint32_t>(size / (SmallBlockSize / SecondLevelCount));
+        return;
+    }
+
+    const auto mostSignificantBit = static_cast<uint32_t>(std::bit_width(size) - 1);
+    secondLevel = static_cast<uint32_t>(size >> (mostSignificantBit - SecondLevelCountLog2)) ^ SecondLevelCount;
+    firstLevel = mostSignificantBit - (FirstLevelShift - 1);
+}
+
+AxrTlsfAllocator::FreeBlockHeader* AxrTlsfAllocator::findFreeBlock(const size_t size) const {
+    // This should never be null. The only time it's null is if this allocator is empty and wasn't given any data to
+    // manage. In such case, we shouldn't be calling this function
+    assert(m_Memory != nullptr);
+
+    uint32_t firstLevel;
+    uint32_t secondLevel;
+
+    // Round the size up to the next size class. Every block in that size class and above is big enough.
+    size_t roundedSize = size;
+    if (size >= SmallBlockSize) {
+        roundedSize += (size_t(1) << (std::bit_width(size) - 1 - SecondLevelCountLog2)) - 1;
+    }
+    getSizeClass(roundedSize, firstLevel, secondLevel);
+
+    if (firstLevel < FirstLevelCount) [[likely]] {
+        uint32_t secondLevelBitmap = m_SecondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+        if (secondLevelBitmap == 0) {
+            const uint32_t firstLevelBitmap = m_FirstLevelBitmap & (~0u << (firstLevel + 1));
+            if (firstLevelBitmap != 0) {
+                firstLevel = std::countr_zero(firstLevelBitmap);
+                secondLevelBitmap = m_SecondLevelBitmaps[firstLevel];
+            }
+        }
+
+        if (secondLevelBitmap != 0) [[likely]] {
+            secondLevel = std::countr_zero(secondLevelBitmap);
+            return m_FreeBlocks[firstLevel][secondLevel];
+        }
+    }
+
+    // Rounding up skips the size class that the size itself belongs to, even though some of its blocks may be big
+    // enough. Only check the head of that list so the search stays constant time.
+    getSizeClass(size, firstLevel, secondLevel);
+    if (firstLevel < FirstLevelCount) {
+        FreeBlockHeader* freeBlock = m_FreeBlocks[firstLevel][secondLevel];
+        if (freeBlock != nullptr && getBlockSize(&freeBlock->Block) >= size) {
+            return freeBlock;
+        }
+    }
+
+    return nullptr;
+}
+
+void AxrTlsfAllocator::insertFreeBlock(FreeBlockHeader* freeBlock) {
+    const size_t blockSize = getBlockSize(&freeBlock->Block);
+
+    uint32_t firstLevel;
+    uint32_t secondLevel;
+    getSizeClass(blockSize, firstLevel, secondLevel);
+
+    freeBlock->Block.Size = blockSize | FreeBlockFlag;
+    freeBlock->PreviousFree = nullptr;
+    freeBlock->NextFree = m_FreeBlocks[firstLevel][secondLevel];
+    if (freeBlock->NextFree != nullptr) {
+        freeBlock->NextFree->PreviousFree = freeBlock;
+    }
+
+    m_FreeBlocks[firstLevel][secondLevel] = freeBlock;
+    m_FirstLevelBitmap |= 1u << firstLevel;
+    m_SecondLevelBitmaps[firstLevel] |= 1u << secondLevel;
+}
+
+void AxrTlsfAllocator::removeFreeBlock(FreeBlockHeader* freeBlock) {
+    const size_t blockSize = getBlockSize(&freeBlock->Block);
+
+    uint32_t firstLevel;
+    uint32_t secondLevel;
+    getSizeClass(blockSize, firstLevel, secondLevel);
+
+    if (freeBlock->PreviousFree != nullptr) {
+        freeBlock->PreviousFree->NextFree = freeBlock->NextFree;
+    } else {
+        m_FreeBlocks[firstLevel][secondLevel] = freeBlock->NextFree;
+    }
+
+    if (freeBlock->NextFree != nullptr) {
+        freeBlock->NextFree->PreviousFree = freeBlock->PreviousFree;
+    }
+
+    if (m_FreeBlocks[firstLevel][secondLevel] == nullptr) {
+        m_SecondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+        if (m_SecondLevelBitmaps[firstLevel] == 0) {
+            m_FirstLevelBitmap &= ~(1u << firstLevel);
+        }
+    }
+
+    freeBlock->Block.Size = blockSize;
+}
+
+void AxrTlsfAllocator::trimBlock(BlockHeader* block, const size_t size) {
+    const size_t blockSize = getBlockSize(block);
+
+    // If there isn't enough space for a new `FreeBlockHeader`, then the block just keeps the extra space
+    if (blockSize - size < MinBlockSize) {
+        return;
+    }
+
+    block->Size = size;
+
+    const auto remainingBlock = reinterpret_cast<BlockHeader*>(reinterpret_cast<uintptr_t>(block) + size);
+    *remainingBlock = BlockHeader{
+        .Size = blockSize - size,
+        .PreviousPhysical = block,
+    };
+
+    releaseBlock(remainingBlock);
+}
+
+void AxrTlsfAllocator::releaseBlock(BlockHeader* block) {
+    BlockHeader* previousBlock = block->PreviousPhysical;
+    if (previousBlock != nullptr && isFree(previousBlock)) {
+        removeFreeBlock(reinterpret_cast<FreeBlockHeader*>(previousBlock));
+        previousBlock->Size += getBlockSize(block);
+        block = previousBlock;
+    }
+
+    BlockHeader* nextBlock = getNextPhysical(block);
+    if (nextBlock != nullptr && isFree(nextBlock)) {
+        removeFreeBlock(reinterpret_cast<FreeBlockHeader*>(nextBlock));
+        block->Size += getBlockSize(nextBlock);
+        nextBlock = getNextPhysical(block);
+    }
+
+    if (nextBlock != nullptr) {
+        nextBlock->PreviousPhysical = block;
+    }
+
+    insertFreeBlock(reinterpret_cast<FreeBlockHeader*>(block));
+}
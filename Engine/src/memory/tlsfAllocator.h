@@ -0,0 +1,294 @@
+#pragma once
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "../common/handle.h"
+#include "allocationTracker.h"
+#include "memoryPressure.h"
+#include "subAllocatorBase.h"
+
+/// Two level segregated fit allocator (Ref = http://www.gii.upv.es/tlsf/files/papers/ecrts04_tlsf.pdf).
+/// Free blocks are sorted into size classes. The first level splits sizes by powers of two and the second level splits
+/// each of those linearly. A bitmap per level keeps track of which size classes have free blocks, so finding a free
+/// block, allocating and deallocating are all O(1).
+///
+/// Unlike `AxrDynamicAllocator`, data is never relocated. Handles point straight at the block header's data pointer, so
+/// no handles allocator is needed. The trade-off is that this allocator can't be defragmented.
+class AxrTlsfAllocator : public AxrSubAllocatorBase_Aligned<void*> {
+public:
+    // ----------------------------------------- //
+    // Public Constants
+    // ----------------------------------------- //
+
+    /// The max size in bytes of the memory this allocator can manage. Limited by the number of first level size classes
+    static constexpr size_t MaxCapacity = (size_t(1) << 32) - 1;
+
+    // ----------------------------------------- //
+    // Special Functions
+    // ----------------------------------------- //
+
+    // ---- Constructors ----
+
+    /// Default Constructor
+    AxrTlsfAllocator();
+    /// Constructor
+    /// @param memoryBlock Memory block to use
+    explicit AxrTlsfAllocator(const AxrMemoryBlock& memoryBlock);
+    /// Copy Constructor
+    /// @param src Source AxrTlsfAllocator to copy from
+    AxrTlsfAllocator(const AxrTlsfAllocator& src) = delete;
+    /// Move Constructor
+    /// @param src Source AxrTlsfAllocator to move from
+    AxrTlsfAllocator(AxrTlsfAllocator&& src) noexcept;
+
+    // ---- Destructor ----
+
+    /// Destructor
+    ~AxrTlsfAllocator();
+
+    // ---- Operator Overloads ----
+
+    /// Copy Assignment Operator
+    /// @param src Source AxrTlsfAllocator to copy from
+    AxrTlsfAllocator& operator=(const AxrTlsfAllocator& src) = delete;
+    /// Move Assignment Operator
+    /// @param src Source AxrTlsfAllocator to move from
+    AxrTlsfAllocator& operator=(AxrTlsfAllocator&& src) noexcept;
+
+    // ----------------------------------------- //
+    // Public Functions
+    // ----------------------------------------- //
+
+    /// Allocate a new memory block
+    /// @param size Size in bytes for how much memory to allocate
+    /// @param alignment Memory alignment
+    /// @param handle Output allocated memory handle
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space for the requested memory.
+    [[nodiscard]] AxrResult allocateBlock(size_t size,
+                                          uint8_t alignment,
+                                          AxrHandle<void>& handle,
+                                          bool zeroOutMemory = false,
+                                          const AxrAllocationTag& tag = {});
+
+    /// Allocate new memory
+    /// @tparam Type The memory data type
+    /// @param size The number of data items of type `Type` to store in memory
+    /// @param handle Output allocated memory handle
+    /// @param zeroOutMemory If true, the allocated memory will be zeroed out
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space for the requested memory.
+    template<typename Type>
+    [[nodiscard]] AxrResult allocate(const size_t size,
+                                     AxrHandle<Type>& handle,
+                                     const bool zeroOutMemory = false,
+                                     const AxrAllocationTag& tag = {}) {
+        return allocateBlock(sizeof(Type) * size,
+                             alignof(Type),
+                             reinterpret_cast<AxrHandle<void>&>(handle),
+                             zeroOutMemory,
+                             tag);
+    }
+
+    /// Reallocate an existing memory block.
+    /// The block is grown or shrunk in place when possible. Otherwise, it's moved to a new block.
+    /// @param size The new size in bytes for how much memory to reallocate for
+    /// @param alignment Memory alignment
+    /// @param handle Input/Output allocated memory handle
+    /// @param zeroOutNewMemory If true, all newly allocated memory will be zeroed out. This doesn't affect memory from
+    /// the existing allocation.
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space for the requested memory.
+    [[nodiscard]] AxrResult reallocateBlock(size_t size,
+                                            uint8_t alignment,
+                                            AxrHandle<void>& handle,
+                                            bool zeroOutNewMemory = false,
+                                            const AxrAllocationTag& tag = {});
+    /// Reallocate an existing memory block
+    /// @tparam Type The memory data type
+    /// @param size The new number of data items of type `Type` to store in memory
+    /// @param handle Input/Output allocated memory handle
+    /// @param zeroOutNewMemory If true, all newly allocated memory will be zeroed out. This doesn't affect memory from
+    /// the existing allocation.
+    /// @param tag Allocation tag. Only used when allocation tracking is enabled
+    /// @return AXR_SUCCESS if the function succeeded.
+    /// AXR_ERROR_OUT_OF_MEMORY if there isn't enough space for the requested memory.
+    template<typename Type>
+    [[nodiscard]] AxrResult reallocate(const size_t size,
+                                       AxrHandle<Type>& handle,
+                                       const bool zeroOutNewMemory = false,
+                                       const AxrAllocationTag& tag = {}) {
+        return reallocateBlock(sizeof(Type) * size,
+                               alignof(Type),
+                               reinterpret_cast<AxrHandle<void>&>(handle),
+                               zeroOutNewMemory,
+                               tag);
+    }
+
+    /// Deallocate the given handle
+    /// @param handle Handle to deallocate
+    void deallocateHandle(AxrHandle<void>& handle);
+
+    /// Deallocate the given handle
+    /// @param handle Handle to deallocate
+    template<typename Type>
+    void deallocate(AxrHandle<Type>& handle) {
+        deallocateHandle(reinterpret_cast<AxrHandle<void>&>(handle));
+    }
+
+    /// Get the empty state of the allocator
+    /// @return True if the allocator is empty
+    [[nodiscard]] bool empty() const;
+    /// Get the number of bytes currently in use
+    /// @return The number of bytes currently in use
+    [[nodiscard]] size_t size() const;
+
+    /// Get the number of bytes a block takes up when holding data of the given size. This includes the block header.
+    /// @param size Size of the data in bytes
+    /// @param alignment Data alignment
+    /// @return The number of bytes a block takes up
+    [[nodiscard]] static size_t getRequiredBlockSize(size_t size, uint8_t alignment);
+
+    /// Get the monitor that notifies subsystems when this allocator is running low on memory.
+    /// Critical memory pressure is notified before an allocation fails.
+    /// @return The memory pressure monitor
+    [[nodiscard]] AxrMemoryPressureMonitor& getMemoryPressureMonitor();
+
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    /// Get the peak number of bytes in use at one time
+    /// @return The peak number of bytes in use at one time
+    [[nodiscard]] size_t peakSize() const;
+#endif
+
+private:
+    // ----------------------------------------- //
+    // Private Structs
+    // ----------------------------------------- //
+
+    /// Memory layout looks like the following:
+    /// [UsedBlockHeader][Item1][--FreeBlockHeader--][UsedBlockHeader][Item2][UsedBlockHeader][Item3][FreeBlockHeader]
+    /// Two free blocks are never next to each other. They're merged as soon as one of them is freed.
+
+    /// Header at the start of every block, free or used
+    struct BlockHeader {
+        /// The size of the block, including this header. Block sizes are always a multiple of `BlockAlignment`, so the
+        /// lowest bit is used for the `FreeBlockFlag`.
+        size_t Size;
+        /// The block physically before this one. Or nullptr if this is the first block
+        BlockHeader* PreviousPhysical;
+    };
+
+    /// Header for a block that's in use
+    struct UsedBlockHeader {
+        BlockHeader Block;
+        /// Pointer to the aligned data within this block. Handles point to this variable.
+        void* Data;
+    };
+
+    /// Header for a block that's free
+    struct FreeBlockHeader {
+        BlockHeader Block;
+        /// The next free block within the same size class
+        FreeBlockHeader* NextFree;
+        /// The previous free block within the same size class
+        FreeBlockHeader* PreviousFree;
+    };
+
+    // ----------------------------------------- //
+    // Private Variables
+    // ----------------------------------------- //
+
+    /// All block addresses and sizes are a multiple of this
+    static constexpr size_t BlockAlignment = alignof(FreeBlockHeader);
+    /// Set on `BlockHeader::Size` when the block is free
+    static constexpr size_t FreeBlockFlag = 1;
+    /// Every block needs to fit a `FreeBlockHeader` for when it gets freed
+    static constexpr size_t MinBlockSize = sizeof(FreeBlockHeader);
+
+    /// Log2 of the number of second level size classes per first level size class
+    static constexpr uint32_t SecondLevelCountLog2 = 4;
+    static constexpr uint32_t SecondLevelCount = 1 << SecondLevelCountLog2;
+    /// Sizes below `SmallBlockSize` all share the first first level size class, split linearly by `BlockAlignment`
+    static constexpr uint32_t FirstLevelShift = SecondLevelCountLog2 + 3;
+    static constexpr size_t SmallBlockSize = size_t(1) << FirstLevelShift;
+    /// Blocks must be smaller than 2^FirstLevelMax bytes
+    static constexpr uint32_t FirstLevelMax = 32;
+    static constexpr uint32_t FirstLevelCount = FirstLevelMax - FirstLevelShift + 1;
+
+    static_assert(BlockAlignment == 8, "FirstLevelShift assumes blocks are 8 byte aligned.");
+    static_assert(SmallBlockSize / SecondLevelCount == BlockAlignment);
+    static_assert(MaxCapacity < size_t(1) << FirstLevelMax);
+
+    /// One bit per first level size class. Set if any of its second level size classes has a free block
+    uint32_t m_FirstLevelBitmap{};
+    /// One bit per second level size class. Set if the size class has a free block
+    uint32_t m_SecondLevelBitmaps[FirstLevelCount]{};
+    /// Head of the free block list for each size class
+    FreeBlockHeader* m_FreeBlocks[FirstLevelCount][SecondLevelCount]{};
+    size_t m_Size{};
+#ifdef AXR_TRACK_ALLOCATOR_PEAK_USAGE
+    size_t m_PeakSize{};
+#endif
+    AxrMemoryPressureMonitor m_MemoryPressureMonitor{};
+
+    // ----------------------------------------- //
+    // Private Functions
+    // ----------------------------------------- //
+
+    /// Clean up this class
+    void cleanup();
+
+    /// Move the given AxrTlsfAllocator to this class
+    /// @param src AxrTlsfAllocator to move
+    /// @param useConstructor If true, this function will use the move constructor for non-primitive objects instead of
+    /// the move assignment operator when moving variables
+    void move_internal(AxrTlsfAllocator&& src, bool useConstructor);
+
+    /// Get the size of the given block, without any flags
+    /// @param block Block to use
+    /// @return The size of the given block, including the header
+    [[nodiscard]] static size_t getBlockSize(const BlockHeader* block);
+    /// Check if the given block is free
+    /// @param block Block to check
+    /// @return True if the given block is free
+    [[nodiscard]] static bool isFree(const BlockHeader* block);
+    /// Get the block physically after the given block
+    /// @param block Block to use
+    /// @return The next block. Or nullptr if the given block is the last one
+    [[nodiscard]] BlockHeader* getNextPhysical(const BlockHeader* block) const;
+    /// Get the used block header that owns the given handle
+    /// @param handle Handle to use. Must not be null
+    /// @return The used block header. Or nullptr if the handle isn't from this allocator
+    [[nodiscard]] UsedBlockHeader* getUsedBlock(const AxrHandle<void>& handle) const;
+
+    /// Get the size class the given block size belongs to
+    /// @param size Block size
+    /// @param firstLevel Output first level index
+    /// @param secondLevel Output second level index
+    static void getSizeClass(size_t size, uint32_t& firstLevel, uint32_t& secondLevel);
+    /// Find a free block that's guaranteed to have enough space for the given size.
+    /// The search starts at the size class above the given size, so any block found is big enough without having to
+    /// walk the free list.
+    /// @param size Block size needed
+    /// @return A free block with enough space. Or nullptr if none was found
+    [[nodiscard]] FreeBlockHeader* findFreeBlock(size_t size) const;
+    /// Insert the given free block into the free lists and mark it as free
+    /// @param freeBlock Free block to insert. Its size must already be set
+    void insertFreeBlock(FreeBlockHeader* freeBlock);
+    /// Remove the given free block from the free lists
+    /// @param freeBlock Free block to remove
+    void removeFreeBlock(FreeBlockHeader* freeBlock);
+
+    /// Shrink the given used block down to the given size, if the leftover space is big enough for a free block
+    /// @param block Used block to shrink
+    /// @param size New block size
+    void trimBlock(BlockHeader* block, size_t size);
+    /// Release the given block. Merging it with any neighbouring free blocks.
+    /// @param block Block to release
+    void releaseBlock(BlockHeader* block);
+};
@@ -0,0 +1,97 @@
+#ifdef AXR_VIRTUAL_MEMORY_ENABLED
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include "virtualMemory.h"
+#include "axr/logging.h"
+#include "memoryUtils.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+// ----------------------------------------- //
+// Internal Function Definitions
+// ----------------------------------------- //
+
+size_t axrGetPageSize() {
+    static const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+}
+
+size_t axrGetHugePageSize() {
+    // 2 Mebibytes. The only transparent huge page size on x86-64 and the default on arm64
+    return 2'097'152;
+}
+
+void* axrReserveVirtualMemory(const size_t size, const size_t alignment) {
+    assert(size % axrGetPageSize() == 0);
+    assert(alignment % axrGetPageSize() == 0);
+
+    // Over reserve so there's an aligned address within the range, then give back the unaligned ends
+    const size_t reserveSize = size + alignment - axrGetPageSize();
+    void* memory = mmap(nullptr, reserveSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (memory == MAP_FAILED) [[unlikely]] {
+        axrLogError("Failed to reserve {} bytes of virtual memory.", reserveSize);
+        return nullptr;
+    }
+
+    const auto reservedAddress = reinterpret_cast<uintptr_t>(memory);
+    const uintptr_t alignedAddress = axrAlignAddress(reservedAddress, alignment);
+    const size_t headSize = alignedAddress - reservedAddress;
+    const size_t tailSize = reserveSize - headSize - size;
+
+    if (headSize != 0) {
+        munmap(memory, headSize);
+    }
+    if (tailSize != 0) {
+        munmap(reinterpret_cast<void*>(alignedAddress + size), tailSize);
+    }
+
+    return reinterpret_cast<void*>(alignedAddress);
+}
+
+bool axrCommitVirtualMemory(void* memory, const size_t size) {
+    if (mprotect(memory, size, PROT_READ | PROT_WRITE) != 0) [[unlikely]] {
+        axrLogError("Failed to commit {} bytes of virtual memory.", size);
+        return false;
+    }
+
+    return true;
+}
+
+void axrReleaseVirtualMemory(void* memory, const size_t size) {
+    if (memory == nullptr) {
+        return;
+    }
+
+    munmap(memory, size);
+}
+
+void axrAdviseHugePages(void* memory, const size_t size) {
+#ifdef MADV_HUGEPAGE
+    if (madvise(memory, size, MADV_HUGEPAGE) != 0) {
+        axrLogWarning("Transparent huge pages aren't available. Falling back to regular pages.");
+    }
+#endif
+}
+
+void axrPrefaultVirtualMemory(void* memory, const size_t size) {
+#ifdef MADV_POPULATE_WRITE
+    const uintptr_t pageMask = axrGetPageSize() - 1;
+    const uintptr_t pageAddress = reinterpret_cast<uintptr_t>(memory) & ~pageMask;
+    const size_t pageRangeSize = size + (reinterpret_cast<uintptr_t>(memory) - pageAddress);
+    if (madvise(reinterpret_cast<void*>(pageAddress), pageRangeSize, MADV_POPULATE_WRITE) == 0) {
+        return;
+    }
+#endif
+
+    // Older kernels don't support MADV_POPULATE_WRITE, so touch every page ourselves instead.
+    // The memory is freshly mapped, so it's already zeroed and writing a zero doesn't change it.
+    auto bytes = static_cast<volatile uint8_t*>(memory);
+    for (size_t offset = 0; offset < size; offset += axrGetPageSize()) {
+        bytes[offset] = 0;
+    }
+}
+
+#endif
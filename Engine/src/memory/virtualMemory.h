@@ -0,0 +1,47 @@
+#pragma once
+
+#ifdef AXR_VIRTUAL_MEMORY_ENABLED
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include <cstddef>
+
+// ----------------------------------------- //
+// Internal Functions
+// ----------------------------------------- //
+
+/// Get the size of a regular memory page
+/// @return The page size in bytes
+[[nodiscard]] size_t axrGetPageSize();
+/// Get the size of a huge memory page
+/// @return The huge page size in bytes
+[[nodiscard]] size_t axrGetHugePageSize();
+
+/// Reserve a range of virtual address space without backing it with any memory.
+/// The memory can't be accessed until it's been committed with `axrCommitVirtualMemory()`.
+/// @param size Size in bytes to reserve. Must be a multiple of the page size
+/// @param alignment Alignment of the returned address. Must be a power of two and a multiple of the page size
+/// @return The reserved memory. Or nullptr if it failed
+[[nodiscard]] void* axrReserveVirtualMemory(size_t size, size_t alignment);
+/// Make the given reserved memory readable and writable.
+/// Physical pages are only allocated by the OS the first time each page is touched.
+/// @param memory Reserved memory to commit. Must be page aligned
+/// @param size Size in bytes to commit. Must be a multiple of the page size
+/// @return True if the memory was committed successfully
+[[nodiscard]] bool axrCommitVirtualMemory(void* memory, size_t size);
+/// Release the given reserved memory back to the OS
+/// @param memory Memory returned by `axrReserveVirtualMemory()`
+/// @param size Size in bytes that was reserved
+void axrReleaseVirtualMemory(void* memory, size_t size);
+
+/// Ask the OS to back the given committed memory with transparent huge pages where it can
+/// @param memory Committed memory to use. Must be page aligned
+/// @param size Size in bytes. Must be a multiple of the page size
+void axrAdviseHugePages(void* memory, size_t size);
+/// Fault in all pages of the given committed memory now, so they don't page fault on first use later
+/// @param memory Committed memory to use
+/// @param size Size in bytes
+void axrPrefaultVirtualMemory(void* memory, size_t size);
+
+#endif
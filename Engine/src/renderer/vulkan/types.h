@@ -42,6 +42,7 @@ struct AxrVulkanRendererDesktopSwapchainContext {
 /// Vulkan renderer desktop environment context
 struct AxrVulkanRendererDesktopContext {
     const AxrVulkanQueueFamilies* QueueFamilies = nullptr;
+    AxrPersistentAllocator_T* Allocator = nullptr;
     AxrVector_Dynamic<VkSemaphore> ImageAvailableSemaphores = AxrVector_Dynamic<VkSemaphore>();
     AxrVector_Dynamic<VkSemaphore> RenderingFinishedSemaphores = AxrVector_Dynamic<VkSemaphore>();
     AxrVector_Dynamic<VkFence> RenderingFences = AxrVector_Dynamic<VkFence>();
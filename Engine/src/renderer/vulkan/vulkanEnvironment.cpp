@@ -24,6 +24,15 @@ AxrResult AxrVulkanEnvironment::setupDesktopContext(const SetupConfig& config,
     context.GraphicsCommandPool = config.GraphicsCommandPool;
     context.SwapchainContext.PreferredPresentationMode = config.DesktopConfig->PreferredPresentationMode;
 
+    // Swapchain resources are recreated whenever the window is resized, so they live in the renderer arena instead of
+    // fragmenting the engine data allocator
+    context.Allocator = AxrAllocator::get().getPersistentArena(AxrAllocator::getArenaID(u8"Renderer"));
+    if (context.Allocator == nullptr) [[unlikely]] {
+        destroyDesktopContext(context);
+        axrLogError(AXR_FUNCTION_FAILED_STRING "Renderer arena isn't a persistent arena.");
+        return AXR_ERROR_NOT_FOUND;
+    }
+
     AxrResult axrResult = AXR_SUCCESS;
 
     axrResult = AxrPlatform::get().createVulkanSurface(config.Instance, context.Surface);
@@ -59,6 +68,7 @@ AxrResult AxrVulkanEnvironment::setupDesktopContext(const SetupConfig& config,
 
     axrResult = createDesktopSyncObjects(context.Device,
                                          config.MaxFramesInFlight,
+                                         *context.Allocator,
                                          context.ImageAvailableSemaphores,
                                          context.RenderingFinishedSemaphores,
                                          context.RenderingFences);
@@ -71,6 +81,7 @@ AxrResult AxrVulkanEnvironment::setupDesktopContext(const SetupConfig& config,
     axrResult = createCommandBuffers(context.Device,
                                      context.GraphicsCommandPool,
                                      config.MaxFramesInFlight,
+                                     *context.Allocator,
                                      context.RenderingCommandBuffers);
     if (AXR_FAILED(axrResult)) [[unlikely]] {
         destroyDesktopContext(context);
@@ -85,6 +96,7 @@ AxrResult AxrVulkanEnvironment::setupDesktopContext(const SetupConfig& config,
                                       config.GraphicsCommandPool,
                                       *context.QueueFamilies,
                                       context.MsaaSampleCount,
+                                      *context.Allocator,
                                       context.SwapchainContext,
                                       context.Framebuffers);
     if (AXR_FAILED(axrResult)) [[unlikely]] {
@@ -119,6 +131,7 @@ void AxrVulkanEnvironment::destroyDesktopContext(AxrVulkanRendererDesktopContext
     AxrPlatform::get().destroyVulkanSurface(context.Instance, context.Surface);
 
     context.QueueFamilies = nullptr;
+    context.Allocator = nullptr;
     context.Instance = VK_NULL_HANDLE;
     context.PhysicalDevice = VK_NULL_HANDLE;
     context.Device = VK_NULL_HANDLE;
@@ -462,6 +475,7 @@ void AxrVulkanEnvironment::destroyRenderPass(const VkDevice& device, VkRenderPas
 #define AXR_FUNCTION_FAILED_STRING "Failed to create desktop sync objects. "
 AxrResult AxrVulkanEnvironment::createDesktopSyncObjects(const VkDevice& device,
                                                          const uint32_t maxFramesInFlight,
+                                                         AxrPersistentAllocator_T& allocator,
                                                          AxrVector_Dynamic<VkSemaphore>& imageAvailableSemaphores,
                                                          AxrVector_Dynamic<VkSemaphore>& renderingFinishedSemaphores,
                                                          AxrVector_Dynamic<VkFence>& renderingFences) {
@@ -489,11 +503,9 @@ AxrResult AxrVulkanEnvironment::createDesktopSyncObjects(const VkDevice& device,
     // ----------------------------------------- //
     AxrResult axrResult = AXR_SUCCESS;
 
-    imageAvailableSemaphores = AxrVector_Dynamic<VkSemaphore>(maxFramesInFlight,
-                                                              &AxrAllocator::get().EngineDataAllocator);
-    renderingFinishedSemaphores = AxrVector_Dynamic<VkSemaphore>(maxFramesInFlight,
-                                                                 &AxrAllocator::get().EngineDataAllocator);
-    renderingFences = AxrVector_Dynamic<VkFence>(maxFramesInFlight, &AxrAllocator::get().EngineDataAllocator);
+    imageAvailableSemaphores = AxrVector_Dynamic<VkSemaphore>(maxFramesInFlight, &allocator);
+    renderingFinishedSemaphores = AxrVector_Dynamic<VkSemaphore>(maxFramesInFlight, &allocator);
+    renderingFences = AxrVector_Dynamic<VkFence>(maxFramesInFlight, &allocator);
 
     axrResult = createSemaphores(device, imageAvailableSemaphores);
     if (AXR_FAILED(axrResult)) {
@@ -644,6 +656,7 @@ void AxrVulkanEnvironment::destroyFences(const VkDevice& device, AxrVector_Dynam
 AxrResult AxrVulkanEnvironment::createCommandBuffers(const VkDevice& device,
                                                      const VkCommandPool& commandPool,
                                                      const uint32_t maxFramesInFlight,
+                                                     AxrPersistentAllocator_T& allocator,
                                                      AxrVector_Dynamic<VkCommandBuffer>& commandBuffers) {
     assert(device != VK_NULL_HANDLE);
     assert(commandPool != VK_NULL_HANDLE);
@@ -653,7 +666,7 @@ AxrResult AxrVulkanEnvironment::createCommandBuffers(const VkDevice& device,
         return AXR_SUCCESS;
     }
 
-    commandBuffers = AxrVector_Dynamic<VkCommandBuffer>(maxFramesInFlight, &AxrAllocator::get().EngineDataAllocator);
+    commandBuffers = AxrVector_Dynamic<VkCommandBuffer>(maxFramesInFlight, &allocator);
     commandBuffers.prefillData(VK_NULL_HANDLE);
 
     const VkCommandBufferAllocateInfo commandBufferAllocateInfo{
@@ -696,6 +709,7 @@ AxrResult AxrVulkanEnvironment::setupDesktopSwapchain(const VkPhysicalDevice& ph
                                                       const VkCommandPool& graphicsCommandPool,
                                                       const AxrVulkanQueueFamilies& queueFamilies,
                                                       const VkSampleCountFlagBits msaaSampleCount,
+                                                      AxrPersistentAllocator_T& allocator,
                                                       AxrVulkanRendererDesktopSwapchainContext& swapchainContext,
                                                       AxrVector_Dynamic<VkFramebuffer>& framebuffers) {
     AxrResult axrResult = AXR_SUCCESS;
@@ -727,6 +741,7 @@ AxrResult AxrVulkanEnvironment::setupDesktopSwapchain(const VkPhysicalDevice& ph
     axrResult = getDesktopSwapchainImages(device,
                                           swapchainContext.Swapchain,
                                           swapchainContext.ColorFormat,
+                                          allocator,
                                           swapchainContext.ColorImages,
                                           swapchainContext.ColorImageViews);
     if (AXR_FAILED(axrResult)) [[unlikely]] {
@@ -743,6 +758,7 @@ AxrResult AxrVulkanEnvironment::setupDesktopSwapchain(const VkPhysicalDevice& ph
                                            swapchainContext.ColorImages.size(),
                                            msaaSampleCount,
                                            swapchainContext.DepthFormat,
+                                           allocator,
                                            swapchainContext.DepthImages);
     if (AXR_FAILED(axrResult)) [[unlikely]] {
         resetSetupDesktopSwapchain(device, swapchainContext, framebuffers);
@@ -760,6 +776,7 @@ AxrResult AxrVulkanEnvironment::setupDesktopSwapchain(const VkPhysicalDevice& ph
                                           swapchainImageCount,
                                           msaaSampleCount,
                                           swapchainContext.ColorFormat,
+                                          allocator,
                                           swapchainContext.MsaaImages);
     if (AXR_FAILED(axrResult)) [[unlikely]] {
         resetSetupDesktopSwapchain(device, swapchainContext, framebuffers);
@@ -787,6 +804,7 @@ AxrResult AxrVulkanEnvironment::setupDesktopSwapchain(const VkPhysicalDevice& ph
                                    tempSwapchainMsaaImageViews.data(),
                                    swapchainContext.Extent,
                                    msaaSampleCount,
+                                   allocator,
                                    framebuffers);
     if (AXR_FAILED(axrResult)) [[unlikely]] {
         resetSetupDesktopSwapchain(device, swapchainContext, framebuffers);
@@ -1039,6 +1057,7 @@ void AxrVulkanEnvironment::destroyDesktopSwapchain(const VkDevice& device, VkSwa
 AxrResult AxrVulkanEnvironment::getDesktopSwapchainImages(const VkDevice& device,
                                                           const VkSwapchainKHR& swapchain,
                                                           const VkFormat swapchainColorFormat,
+                                                          AxrPersistentAllocator_T& allocator,
                                                           AxrVector_Dynamic<VkImage>& images,
                                                           AxrVector_Dynamic<VkImageView>& imageViews) {
     assert(device != VK_NULL_HANDLE);
@@ -1060,7 +1079,7 @@ AxrResult AxrVulkanEnvironment::getDesktopSwapchainImages(const VkDevice& device
     if (VK_FAILED(vkResult)) [[unlikely]]
         return AXR_ERROR_VULKAN_ERROR;
 
-    AxrVector_Dynamic<VkImage> swapchainImages(imageCount, &AxrAllocator::get().EngineDataAllocator);
+    AxrVector_Dynamic<VkImage> swapchainImages(imageCount, &allocator);
     swapchainImages.prefillData(VK_NULL_HANDLE);
 
     vkResult = vkGetSwapchainImagesKHR(device, swapchain, &imageCount, swapchainImages.data());
@@ -1068,7 +1087,7 @@ AxrResult AxrVulkanEnvironment::getDesktopSwapchainImages(const VkDevice& device
     if (VK_FAILED(vkResult)) [[unlikely]]
         return AXR_ERROR_VULKAN_ERROR;
 
-    AxrVector_Dynamic<VkImageView> swapchainImageViews(imageCount, &AxrAllocator::get().EngineDataAllocator);
+    AxrVector_Dynamic<VkImageView> swapchainImageViews(imageCount, &allocator);
     swapchainImageViews.prefillData(VK_NULL_HANDLE);
 
     AxrResult axrResult = AXR_SUCCESS;
@@ -1117,6 +1136,7 @@ AxrResult AxrVulkanEnvironment::createSwapchainDepthImages(const VkPhysicalDevic
                                                            const uint32_t imageCount,
                                                            const VkSampleCountFlagBits msaaSampleCount,
                                                            const VkFormat imageFormat,
+                                                           AxrPersistentAllocator_T& allocator,
                                                            AxrVector_Dynamic<AxrVulkanImage>& images) {
     assert(physicalDevice != VK_NULL_HANDLE);
     assert(device != VK_NULL_HANDLE);
@@ -1135,7 +1155,7 @@ AxrResult AxrVulkanEnvironment::createSwapchainDepthImages(const VkPhysicalDevic
         imageAspectFlags |= VK_IMAGE_ASPECT_STENCIL_BIT;
     }
 
-    AxrVector_Dynamic<AxrVulkanImage> depthImages(imageCount, &AxrAllocator::get().EngineDataAllocator);
+    AxrVector_Dynamic<AxrVulkanImage> depthImages(imageCount, &allocator);
     depthImages.prefillEmplaceData(AxrVulkanImage(AxrVulkanImage::Config{
         .PhysicalDevice = physicalDevice,
         .Device = device,
@@ -1185,6 +1205,7 @@ AxrResult AxrVulkanEnvironment::createSwapchainMsaaImages(const VkPhysicalDevice
                                                           const uint32_t imageCount,
                                                           const VkSampleCountFlagBits msaaSampleCount,
                                                           const VkFormat imageFormat,
+                                                          AxrPersistentAllocator_T& allocator,
                                                           AxrVector_Dynamic<AxrVulkanImage>& images) {
     const bool isMsaaEnabled = msaaSampleCount != VK_SAMPLE_COUNT_1_BIT;
 
@@ -1205,7 +1226,7 @@ AxrResult AxrVulkanEnvironment::createSwapchainMsaaImages(const VkPhysicalDevice
 
     AxrResult axrResult = AXR_SUCCESS;
 
-    AxrVector_Dynamic<AxrVulkanImage> msaaImages(imageCount, &AxrAllocator::get().EngineDataAllocator);
+    AxrVector_Dynamic<AxrVulkanImage> msaaImages(imageCount, &allocator);
     msaaImages.prefillEmplaceData(AxrVulkanImage(AxrVulkanImage::Config{
         .PhysicalDevice = physicalDevice,
         .Device = device,
@@ -1250,6 +1271,7 @@ AxrResult AxrVulkanEnvironment::recreateDesktopSwapchain(const VkPhysicalDevice&
                                                          const VkCommandPool& graphicsCommandPool,
                                                          const AxrVulkanQueueFamilies& queueFamilies,
                                                          const VkSampleCountFlagBits msaaSampleCount,
+                                                         AxrPersistentAllocator_T& allocator,
                                                          AxrVulkanRendererDesktopSwapchainContext& swapchainContext,
                                                          AxrVector_Dynamic<VkFramebuffer>& framebuffers) {
     assert(device != VK_NULL_HANDLE);
@@ -1284,6 +1306,7 @@ AxrResult AxrVulkanEnvironment::recreateDesktopSwapchain(const VkPhysicalDevice&
                                       graphicsCommandPool,
                                       queueFamilies,
                                       msaaSampleCount,
+                                      allocator,
                                       swapchainContext,
                                       framebuffers);
     if (AXR_FAILED(axrResult)) [[unlikely]] {
@@ -1305,6 +1328,7 @@ AxrResult AxrVulkanEnvironment::createFramebuffers(const VkDevice& device,
                                                    const VkImageView* swapchainMsaaImageViews,
                                                    const VkExtent2D swapchainExtent,
                                                    const VkSampleCountFlagBits msaaSampleCount,
+                                                   AxrPersistentAllocator_T& allocator,
                                                    AxrVector_Dynamic<VkFramebuffer>& framebuffers) {
     assert(device != VK_NULL_HANDLE);
     assert(renderPass != VK_NULL_HANDLE);
@@ -1322,7 +1346,7 @@ AxrResult AxrVulkanEnvironment::createFramebuffers(const VkDevice& device,
         return AXR_ERROR_VALIDATION_FAILED;
     }
 
-    AxrVector_Dynamic<VkFramebuffer> tempFramebuffers(swapchainImageCount, &AxrAllocator::get().EngineDataAllocator);
+    AxrVector_Dynamic<VkFramebuffer> tempFramebuffers(swapchainImageCount, &allocator);
     tempFramebuffers.prefillData(VK_NULL_HANDLE);
 
     for (uint32_t i = 0; i < swapchainImageCount; ++i) {
@@ -1388,6 +1412,7 @@ void AxrVulkanEnvironment::onWindowResizedCallback(AxrVulkanRendererDesktopConte
                                                          context.GraphicsCommandPool,
                                                          *context.QueueFamilies,
                                                          context.MsaaSampleCount,
+                                                         *context.Allocator,
                                                          context.SwapchainContext,
                                                          context.Framebuffers);
     if (axrResult == AXR_DONT_RENDER) {
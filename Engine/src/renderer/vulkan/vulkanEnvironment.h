@@ -168,12 +168,14 @@ private:
     /// Create the rendering sync objects for the desktop environment
     /// @param device Device to use
     /// @param maxFramesInFlight The max frames in flight
+    /// @param allocator Allocator to use for the created vectors
     /// @param imageAvailableSemaphores Output image available semaphores
     /// @param renderingFinishedSemaphores Output rendering finished semaphores
     /// @param renderingFences Output rendering fences
     /// @return AXR_SUCCESS if the function succeeded
     [[nodiscard]] static AxrResult createDesktopSyncObjects(const VkDevice& device,
                                                             uint32_t maxFramesInFlight,
+                                                            AxrPersistentAllocator_T& allocator,
                                                             AxrVector_Dynamic<VkSemaphore>& imageAvailableSemaphores,
                                                             AxrVector_Dynamic<VkSemaphore>& renderingFinishedSemaphores,
                                                             AxrVector_Dynamic<VkFence>& renderingFences);
@@ -218,11 +220,13 @@ private:
     /// @param device Device to use
     /// @param commandPool Command pool to use
     /// @param maxFramesInFlight The max frames in flight
+    /// @param allocator Allocator to use for the created vectors
     /// @param commandBuffers Output created command buffers
     /// @returns AXR_SUCCESS if the function succeeded
     [[nodiscard]] static AxrResult createCommandBuffers(const VkDevice& device,
                                                         const VkCommandPool& commandPool,
                                                         uint32_t maxFramesInFlight,
+                                                        AxrPersistentAllocator_T& allocator,
                                                         AxrVector_Dynamic<VkCommandBuffer>& commandBuffers);
     /// Destroy the given command buffers
     /// @param device Device to use
@@ -244,6 +248,7 @@ private:
     /// @param graphicsCommandPool Graphics command pool to use
     /// @param queueFamilies Queue families to use
     /// @param msaaSampleCount Msaa sample count to use
+    /// @param allocator Allocator to use for the created vectors
     /// @param swapchainContext Input/Output swapchain context
     /// @param framebuffers Output Framebuffers to create
     /// @returns AXR_SUCCESS if the function succeeded
@@ -254,6 +259,7 @@ private:
                                                          const VkCommandPool& graphicsCommandPool,
                                                          const AxrVulkanQueueFamilies& queueFamilies,
                                                          VkSampleCountFlagBits msaaSampleCount,
+                                                         AxrPersistentAllocator_T& allocator,
                                                          AxrVulkanRendererDesktopSwapchainContext& swapchainContext,
                                                          AxrVector_Dynamic<VkFramebuffer>& framebuffers);
     /// Reset the swapchain and all objects that depend on it for the desktop environment.
@@ -334,12 +340,14 @@ private:
     /// @param device Device to use
     /// @param swapchain Swapchain to get the images of
     /// @param swapchainColorFormat Swapchain color format to use
+    /// @param allocator Allocator to use for the created vectors
     /// @param images Output swapchain images
     /// @param imageViews Output swapchain image views
     /// @returns AXR_SUCCESS if the function succeeded
     [[nodiscard]] static AxrResult getDesktopSwapchainImages(const VkDevice& device,
                                                              const VkSwapchainKHR& swapchain,
                                                              VkFormat swapchainColorFormat,
+                                                             AxrPersistentAllocator_T& allocator,
                                                              AxrVector_Dynamic<VkImage>& images,
                                                              AxrVector_Dynamic<VkImageView>& imageViews);
     /// Reset the swapchain color images for the desktop environment
@@ -359,6 +367,7 @@ private:
     /// @param imageCount Number of depth images to create
     /// @param msaaSampleCount Msaa sample count
     /// @param imageFormat Swapchain depth image format
+    /// @param allocator Allocator to use for the created vectors
     /// @param images Output created swapchain depth images
     [[nodiscard]] static AxrResult createSwapchainDepthImages(const VkPhysicalDevice& physicalDevice,
                                                               const VkDevice& device,
@@ -368,6 +377,7 @@ private:
                                                               uint32_t imageCount,
                                                               VkSampleCountFlagBits msaaSampleCount,
                                                               VkFormat imageFormat,
+                                                              AxrPersistentAllocator_T& allocator,
                                                               AxrVector_Dynamic<AxrVulkanImage>& images);
     /// Create swapchain msaa images
     /// @param physicalDevice Physical device to use
@@ -378,6 +388,7 @@ private:
     /// @param imageCount Number of msaa images to create
     /// @param msaaSampleCount Msaa sample count
     /// @param imageFormat Swapchain msaa image format
+    /// @param allocator Allocator to use for the created vectors
     /// @param images Output created swapchain msaa images
     [[nodiscard]] static AxrResult createSwapchainMsaaImages(const VkPhysicalDevice& physicalDevice,
                                                              const VkDevice& device,
@@ -387,6 +398,7 @@ private:
                                                              uint32_t imageCount,
                                                              VkSampleCountFlagBits msaaSampleCount,
                                                              VkFormat imageFormat,
+                                                             AxrPersistentAllocator_T& allocator,
                                                              AxrVector_Dynamic<AxrVulkanImage>& images);
 
     /// Destroy the given vulkan images
@@ -401,6 +413,7 @@ private:
     /// @param graphicsCommandPool Graphics command pool to use
     /// @param queueFamilies Queue families to use
     /// @param msaaSampleCount Msaa sample count to use
+    /// @param allocator Allocator to use for the created vectors
     /// @param swapchainContext Input/Output swapchain context
     /// @param framebuffers Output Framebuffers to create
     /// @returns AXR_SUCCESS if the function succeeded.
@@ -412,6 +425,7 @@ private:
                                                             const VkCommandPool& graphicsCommandPool,
                                                             const AxrVulkanQueueFamilies& queueFamilies,
                                                             VkSampleCountFlagBits msaaSampleCount,
+                                                            AxrPersistentAllocator_T& allocator,
                                                             AxrVulkanRendererDesktopSwapchainContext& swapchainContext,
                                                             AxrVector_Dynamic<VkFramebuffer>& framebuffers);
 
@@ -426,6 +440,7 @@ private:
     /// @param swapchainMsaaImageViews Swapchain msaa image views array
     /// @param swapchainExtent Swapchain extent
     /// @param msaaSampleCount Msaa sample count
+    /// @param allocator Allocator to use for the created vectors
     /// @param framebuffers Output created framebuffers
     /// @return AXR_SUCCESS if the function succeeded
     [[nodiscard]] static AxrResult createFramebuffers(const VkDevice& device,
@@ -436,6 +451,7 @@ private:
                                                       const VkImageView* swapchainMsaaImageViews,
                                                       VkExtent2D swapchainExtent,
                                                       VkSampleCountFlagBits msaaSampleCount,
+                                                      AxrPersistentAllocator_T& allocator,
                                                       AxrVector_Dynamic<VkFramebuffer>& framebuffers);
     /// Destroy the given framebuffers
     /// @param device Device to use
@@ -5,6 +5,7 @@
 // ----------------------------------------- //
 #include <concepts>
 #include <cstddef>
+#include <type_traits>
 
 // ----------------------------------------- //
 // Concepts
@@ -75,3 +76,21 @@ void axrCallDestructor(Type& item) {
         item.~Type();
     }
 }
+
+/// Visit every pointer slot within the given item, so the pointers can be updated in place.
+/// Pointers are visited directly, and arithmetic and enum types don't hold any. Every other type must have a
+/// `forEachPointerSlot()` function that visits its own pointers and passes the visitor on to its members.
+/// @param item Item to visit
+/// @param visitor Function to call with the address of each pointer slot, as a `void*`
+template<typename Type, typename Visitor_T>
+void axrForEachPointerSlot(Type& item, Visitor_T& visitor) {
+    if constexpr (std::is_array_v<Type>) {
+        for (size_t i = 0; i < axrGetArrayLength<Type>(); ++i) {
+            axrForEachPointerSlot(item[i], visitor);
+        }
+    } else if constexpr (std::is_pointer_v<Type>) {
+        visitor(static_cast<void*>(&item));
+    } else if constexpr (!std::is_arithmetic_v<Type> && !std::is_enum_v<Type>) {
+        item.forEachPointerSlot(visitor);
+    }
+}
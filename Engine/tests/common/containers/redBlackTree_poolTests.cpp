@@ -1363,3 +1363,36 @@ TEST(AxrRedBlackTree_Pool, OutOfScopeCleanup) {
 
     ASSERT_TRUE(allocator.empty());
 }
+
+TEST(AxrRedBlackTree_Pool, Release) {
+    using TestData_T = uint32_t;
+    using Tree_T = AxrRedBlackTree_Pool<TestData_T>;
+    constexpr uint32_t capacity = 10;
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t allocatorSize = (Tree_T::getItemSize() * capacity) + Tree_T::getItemAlignment();
+    void* memory = malloc(allocatorSize);
+    AxrPoolAllocator<Tree_T::Node> allocator(AxrMemoryBlock{
+        .Memory = memory,
+        .Size = allocatorSize,
+        .Deallocator = callback,
+    });
+
+    {
+        Tree_T tree(&allocator);
+
+        for (TestData_T i = 0; i < capacity; ++i) {
+            tree.insert(i);
+        }
+
+        tree.release();
+
+        ASSERT_TRUE(tree.size() == 0);
+        ASSERT_TRUE(tree.empty());
+    }
+
+    // The nodes are left for the pool allocator to free as a whole
+    ASSERT_TRUE(allocator.size() == capacity);
+}
@@ -11,7 +11,7 @@
 // Shared Data
 // ----------------------------------------- //
 
-static AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node> HandlesAllocator;
+static AxrHandleTable HandleTable;
 
 // ----------------------------------------- //
 // Shared Functions
@@ -22,20 +22,19 @@ static void deallocateCallback(void*& memory) {
     memory = nullptr;
 };
 
-static void initializeHandlesAllocator(const uint32_t maxHandleCount) {
-    AxrDeallocateBlock handlesDeallocator;
-    handlesDeallocator.connect<deallocateCallback>();
+static void initializeHandleTable(const uint32_t maxHandleCount) {
+    AxrDeallocateBlock handleTableDeallocator;
+    handleTableDeallocator.connect<deallocateCallback>();
 
-    const size_t allocatorSize = AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node>::getAllocatorSize(
-        maxHandleCount);
+    const size_t allocatorSize = AxrHandleTable::getAllocatorSize(maxHandleCount);
 
     const AxrMemoryBlock memoryBlock{
         .Memory = malloc(allocatorSize),
         .Size = allocatorSize,
-        .Deallocator = handlesDeallocator,
+        .Deallocator = handleTableDeallocator,
     };
 
-    HandlesAllocator = AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node>(memoryBlock);
+    HandleTable = AxrHandleTable(memoryBlock);
 }
 
 // ----------------------------------------- //
@@ -43,7 +42,7 @@ static void initializeHandlesAllocator(const uint32_t maxHandleCount) {
 // ----------------------------------------- //
 
 TEST(AxrUnorderedMap_Dynamic, Initialization) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -54,8 +53,9 @@ TEST(AxrUnorderedMap_Dynamic, Initialization) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (Map_T::getItemSize() * capacity) + Map_T::getItemAlignment() +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(Map_T::getItemSize() * capacity, Map_T::getItemAlignment()) +
+        alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -63,7 +63,7 @@ TEST(AxrUnorderedMap_Dynamic, Initialization) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     const Map_T map(capacity, &allocator);
     ASSERT_TRUE(map.capacity() == capacity);
@@ -72,7 +72,7 @@ TEST(AxrUnorderedMap_Dynamic, Initialization) {
 }
 
 TEST(AxrUnorderedMap_Dynamic, Insert_One) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -83,8 +83,9 @@ TEST(AxrUnorderedMap_Dynamic, Insert_One) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (Map_T::getItemSize() * capacity) + Map_T::getItemAlignment() +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(Map_T::getItemSize() * capacity, Map_T::getItemAlignment()) +
+        alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -92,7 +93,7 @@ TEST(AxrUnorderedMap_Dynamic, Insert_One) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     constexpr TestData testData{.value = 43};
 
@@ -107,7 +108,7 @@ TEST(AxrUnorderedMap_Dynamic, Insert_One) {
 }
 
 TEST(AxrUnorderedMap_Dynamic, Insert_ConstCharPtr) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     using TestData = const char*;
     using Map_T = AxrUnorderedMap_Dynamic<const char*, TestData>;
@@ -116,8 +117,9 @@ TEST(AxrUnorderedMap_Dynamic, Insert_ConstCharPtr) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (Map_T::getItemSize() * capacity) + Map_T::getItemAlignment() +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(Map_T::getItemSize() * capacity, Map_T::getItemAlignment()) +
+        alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -125,7 +127,7 @@ TEST(AxrUnorderedMap_Dynamic, Insert_ConstCharPtr) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     Map_T map(capacity, &allocator);
     ASSERT_TRUE(map.empty());
@@ -138,7 +140,7 @@ TEST(AxrUnorderedMap_Dynamic, Insert_ConstCharPtr) {
 }
 
 TEST(AxrUnorderedMap_Dynamic, Insert_Duplicate) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -149,8 +151,9 @@ TEST(AxrUnorderedMap_Dynamic, Insert_Duplicate) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (Map_T::getItemSize() * capacity) + Map_T::getItemAlignment() +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(Map_T::getItemSize() * capacity, Map_T::getItemAlignment()) +
+        alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -158,7 +161,7 @@ TEST(AxrUnorderedMap_Dynamic, Insert_Duplicate) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     constexpr TestData testData{.value = 43};
 
@@ -175,7 +178,7 @@ TEST(AxrUnorderedMap_Dynamic, Insert_Duplicate) {
 }
 
 TEST(AxrUnorderedMap_Dynamic, Insert_All) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -206,8 +209,9 @@ TEST(AxrUnorderedMap_Dynamic, Insert_All) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (Map_T::getItemSize() * capacity) + Map_T::getItemAlignment() +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(Map_T::getItemSize() * capacity, Map_T::getItemAlignment()) +
+        alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -215,7 +219,7 @@ TEST(AxrUnorderedMap_Dynamic, Insert_All) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     Map_T map(capacity, &allocator);
     ASSERT_TRUE(map.empty());
@@ -230,7 +234,7 @@ TEST(AxrUnorderedMap_Dynamic, Insert_All) {
 }
 
 TEST(AxrUnorderedMap_Dynamic, Insert_TooMany) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -261,8 +265,9 @@ TEST(AxrUnorderedMap_Dynamic, Insert_TooMany) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (Map_T::getItemSize() * capacity) + Map_T::getItemAlignment() +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(Map_T::getItemSize() * capacity, Map_T::getItemAlignment()) +
+        alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -270,7 +275,7 @@ TEST(AxrUnorderedMap_Dynamic, Insert_TooMany) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     Map_T map(capacity, &allocator);
     ASSERT_TRUE(map.empty());
@@ -289,7 +294,7 @@ TEST(AxrUnorderedMap_Dynamic, Insert_TooMany) {
 }
 
 TEST(AxrUnorderedMap_Dynamic, AutoDeallocation) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -300,8 +305,9 @@ TEST(AxrUnorderedMap_Dynamic, AutoDeallocation) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (Map_T::getItemSize() * capacity) + Map_T::getItemAlignment() +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(Map_T::getItemSize() * capacity, Map_T::getItemAlignment()) +
+        alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -309,7 +315,7 @@ TEST(AxrUnorderedMap_Dynamic, AutoDeallocation) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
     ASSERT_TRUE(allocator.empty());
 
     {
@@ -321,7 +327,7 @@ TEST(AxrUnorderedMap_Dynamic, AutoDeallocation) {
 }
 
 TEST(AxrUnorderedMap_Dynamic, Remove1) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -334,8 +340,9 @@ TEST(AxrUnorderedMap_Dynamic, Remove1) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (Map_T::getItemSize() * capacity) + Map_T::getItemAlignment() +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(Map_T::getItemSize() * capacity, Map_T::getItemAlignment()) +
+        alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -343,7 +350,7 @@ TEST(AxrUnorderedMap_Dynamic, Remove1) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     Map_T map(capacity, &allocator);
     ASSERT_TRUE(map.empty());
@@ -358,7 +365,7 @@ TEST(AxrUnorderedMap_Dynamic, Remove1) {
 }
 
 TEST(AxrUnorderedMap_Dynamic, Remove2) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -371,8 +378,9 @@ TEST(AxrUnorderedMap_Dynamic, Remove2) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (Map_T::getItemSize() * capacity) + Map_T::getItemAlignment() +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(Map_T::getItemSize() * capacity, Map_T::getItemAlignment()) +
+        alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -380,7 +388,7 @@ TEST(AxrUnorderedMap_Dynamic, Remove2) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     Map_T map(capacity, &allocator);
     ASSERT_TRUE(map.empty());
@@ -410,7 +418,7 @@ TEST(AxrUnorderedMap_Dynamic, Remove2) {
 }
 
 TEST(AxrUnorderedMap_Dynamic, Clear) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -441,8 +449,9 @@ TEST(AxrUnorderedMap_Dynamic, Clear) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (Map_T::getItemSize() * capacity) + Map_T::getItemAlignment() +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(Map_T::getItemSize() * capacity, Map_T::getItemAlignment()) +
+        alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -450,7 +459,7 @@ TEST(AxrUnorderedMap_Dynamic, Clear) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     Map_T map(capacity, &allocator);
     ASSERT_TRUE(map.empty());
@@ -467,7 +476,7 @@ TEST(AxrUnorderedMap_Dynamic, Clear) {
 }
 
 TEST(AxrUnorderedMap_Dynamic, Find_Exists) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -483,8 +492,9 @@ TEST(AxrUnorderedMap_Dynamic, Find_Exists) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (Map_T::getItemSize() * capacity) + Map_T::getItemAlignment() +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(Map_T::getItemSize() * capacity, Map_T::getItemAlignment()) +
+        alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -492,7 +502,7 @@ TEST(AxrUnorderedMap_Dynamic, Find_Exists) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     Map_T map(capacity, &allocator);
 
@@ -511,7 +521,7 @@ TEST(AxrUnorderedMap_Dynamic, Find_Exists) {
 }
 
 TEST(AxrUnorderedMap_Dynamic, Find_DoesntExist) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -526,8 +536,9 @@ TEST(AxrUnorderedMap_Dynamic, Find_DoesntExist) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (Map_T::getItemSize() * capacity) + Map_T::getItemAlignment() +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(Map_T::getItemSize() * capacity, Map_T::getItemAlignment()) +
+        alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -535,7 +546,7 @@ TEST(AxrUnorderedMap_Dynamic, Find_DoesntExist) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     Map_T map(capacity, &allocator);
 
@@ -551,7 +562,7 @@ TEST(AxrUnorderedMap_Dynamic, Find_DoesntExist) {
 }
 
 TEST(AxrUnorderedMap_Dynamic, FindAfterDelete_Exists) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -567,8 +578,9 @@ TEST(AxrUnorderedMap_Dynamic, FindAfterDelete_Exists) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (Map_T::getItemSize() * capacity) + Map_T::getItemAlignment() +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(Map_T::getItemSize() * capacity, Map_T::getItemAlignment()) +
+        alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -576,7 +588,7 @@ TEST(AxrUnorderedMap_Dynamic, FindAfterDelete_Exists) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     Map_T map(capacity, &allocator);
 
@@ -619,7 +631,7 @@ TEST(AxrUnorderedMap_Dynamic, FindAfterDelete_Exists) {
 }
 
 TEST(AxrUnorderedMap_Dynamic, FindAfterDelete_DoesntExist) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -634,8 +646,9 @@ TEST(AxrUnorderedMap_Dynamic, FindAfterDelete_DoesntExist) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (Map_T::getItemSize() * capacity) + Map_T::getItemAlignment() +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(Map_T::getItemSize() * capacity, Map_T::getItemAlignment()) +
+        alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -643,7 +656,7 @@ TEST(AxrUnorderedMap_Dynamic, FindAfterDelete_DoesntExist) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     Map_T map(capacity, &allocator);
 
@@ -11,7 +11,7 @@
 // Shared Data
 // ----------------------------------------- //
 
-static AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node> HandlesAllocator;
+static AxrHandleTable HandleTable;
 
 // ----------------------------------------- //
 // Shared Functions
@@ -22,20 +22,19 @@ static void deallocateCallback(void*& memory) {
     memory = nullptr;
 };
 
-static void initializeHandlesAllocator(const uint32_t maxHandleCount) {
-    AxrDeallocateBlock handlesDeallocator;
-    handlesDeallocator.connect<deallocateCallback>();
+static void initializeHandleTable(const uint32_t maxHandleCount) {
+    AxrDeallocateBlock handleTableDeallocator;
+    handleTableDeallocator.connect<deallocateCallback>();
 
-    const size_t allocatorSize = AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node>::getAllocatorSize(
-        maxHandleCount);
+    const size_t allocatorSize = AxrHandleTable::getAllocatorSize(maxHandleCount);
 
     const AxrMemoryBlock memoryBlock{
         .Memory = malloc(allocatorSize),
         .Size = allocatorSize,
-        .Deallocator = handlesDeallocator,
+        .Deallocator = handleTableDeallocator,
     };
 
-    HandlesAllocator = AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node>(memoryBlock);
+    HandleTable = AxrHandleTable(memoryBlock);
 }
 
 // ----------------------------------------- //
@@ -43,7 +42,7 @@ static void initializeHandlesAllocator(const uint32_t maxHandleCount) {
 // ----------------------------------------- //
 
 TEST(AxrVector_Dynamic, Initialization) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -53,8 +52,8 @@ TEST(AxrVector_Dynamic, Initialization) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(TestData) * capacity) + alignof(TestData) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData) * capacity, alignof(TestData)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -62,7 +61,7 @@ TEST(AxrVector_Dynamic, Initialization) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     const AxrVector_Dynamic<TestData> vector(capacity, &allocator);
     ASSERT_TRUE(vector.capacity() == capacity);
@@ -71,7 +70,7 @@ TEST(AxrVector_Dynamic, Initialization) {
 }
 
 TEST(AxrVector_Dynamic, PushBackOne) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -81,8 +80,8 @@ TEST(AxrVector_Dynamic, PushBackOne) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(TestData) * capacity) + alignof(TestData) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData) * capacity, alignof(TestData)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -90,7 +89,7 @@ TEST(AxrVector_Dynamic, PushBackOne) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     constexpr TestData testData{.value = 43};
 
@@ -104,7 +103,7 @@ TEST(AxrVector_Dynamic, PushBackOne) {
 }
 
 TEST(AxrVector_Dynamic, PushBackCharArray) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     using TestData = char[8];
     constexpr uint32_t capacity = 16;
@@ -112,8 +111,8 @@ TEST(AxrVector_Dynamic, PushBackCharArray) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(TestData) * capacity) + alignof(TestData) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData) * capacity, alignof(TestData)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -121,7 +120,7 @@ TEST(AxrVector_Dynamic, PushBackCharArray) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrVector_Dynamic<TestData> vector(capacity, &allocator);
     ASSERT_TRUE(vector.empty());
@@ -134,7 +133,7 @@ TEST(AxrVector_Dynamic, PushBackCharArray) {
 }
 
 TEST(AxrVector_Dynamic, PushBackConstCharPtr) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     using TestData = const char*;
     constexpr uint32_t capacity = 16;
@@ -142,8 +141,8 @@ TEST(AxrVector_Dynamic, PushBackConstCharPtr) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(TestData) * capacity) + alignof(TestData) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData) * capacity, alignof(TestData)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -151,7 +150,7 @@ TEST(AxrVector_Dynamic, PushBackConstCharPtr) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrVector_Dynamic<TestData> vector(capacity, &allocator);
     ASSERT_TRUE(vector.empty());
@@ -163,7 +162,7 @@ TEST(AxrVector_Dynamic, PushBackConstCharPtr) {
 }
 
 TEST(AxrVector_Dynamic, PushBackAll) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -193,8 +192,8 @@ TEST(AxrVector_Dynamic, PushBackAll) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(TestData) * capacity) + alignof(TestData) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData) * capacity, alignof(TestData)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -202,7 +201,7 @@ TEST(AxrVector_Dynamic, PushBackAll) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrVector_Dynamic<TestData> vector(capacity, &allocator);
     ASSERT_TRUE(vector.empty());
@@ -219,7 +218,7 @@ TEST(AxrVector_Dynamic, PushBackAll) {
 }
 
 TEST(AxrVector_Dynamic, PushBackTooMany) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -249,8 +248,8 @@ TEST(AxrVector_Dynamic, PushBackTooMany) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(TestData) * capacity) + alignof(TestData) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData) * capacity, alignof(TestData)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -258,7 +257,7 @@ TEST(AxrVector_Dynamic, PushBackTooMany) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrVector_Dynamic<TestData> vector(capacity, &allocator);
     ASSERT_TRUE(vector.empty());
@@ -277,7 +276,7 @@ TEST(AxrVector_Dynamic, PushBackTooMany) {
 }
 
 TEST(AxrVector_Dynamic, EmplaceBackOne) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -287,8 +286,8 @@ TEST(AxrVector_Dynamic, EmplaceBackOne) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(TestData) * capacity) + alignof(TestData) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData) * capacity, alignof(TestData)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -296,7 +295,7 @@ TEST(AxrVector_Dynamic, EmplaceBackOne) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     constexpr TestData testData{.value = 43};
 
@@ -310,7 +309,7 @@ TEST(AxrVector_Dynamic, EmplaceBackOne) {
 }
 
 TEST(AxrVector_Dynamic, EmplaceBackAll) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -340,8 +339,8 @@ TEST(AxrVector_Dynamic, EmplaceBackAll) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(TestData) * capacity) + alignof(TestData) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData) * capacity, alignof(TestData)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -349,7 +348,7 @@ TEST(AxrVector_Dynamic, EmplaceBackAll) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrVector_Dynamic<TestData> vector(capacity, &allocator);
     ASSERT_TRUE(vector.empty());
@@ -366,7 +365,7 @@ TEST(AxrVector_Dynamic, EmplaceBackAll) {
 }
 
 TEST(AxrVector_Dynamic, EmplaceBackTooMany) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -396,8 +395,8 @@ TEST(AxrVector_Dynamic, EmplaceBackTooMany) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(TestData) * capacity) + alignof(TestData) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData) * capacity, alignof(TestData)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -405,7 +404,7 @@ TEST(AxrVector_Dynamic, EmplaceBackTooMany) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrVector_Dynamic<TestData> vector(capacity, &allocator);
     ASSERT_TRUE(vector.empty());
@@ -424,7 +423,7 @@ TEST(AxrVector_Dynamic, EmplaceBackTooMany) {
 }
 
 TEST(AxrVector_Dynamic, AutoDeallocation) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -434,8 +433,8 @@ TEST(AxrVector_Dynamic, AutoDeallocation) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(TestData) * capacity) + alignof(TestData) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData) * capacity, alignof(TestData)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -443,7 +442,7 @@ TEST(AxrVector_Dynamic, AutoDeallocation) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
     ASSERT_TRUE(allocator.empty());
 
     {
@@ -455,7 +454,7 @@ TEST(AxrVector_Dynamic, AutoDeallocation) {
 }
 
 TEST(AxrVector_Dynamic, PopBack_1) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -467,8 +466,8 @@ TEST(AxrVector_Dynamic, PopBack_1) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(TestData) * capacity) + alignof(TestData) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData) * capacity, alignof(TestData)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -476,7 +475,7 @@ TEST(AxrVector_Dynamic, PopBack_1) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrVector_Dynamic<TestData> vector(capacity, &allocator);
     ASSERT_TRUE(vector.empty());
@@ -491,7 +490,7 @@ TEST(AxrVector_Dynamic, PopBack_1) {
 }
 
 TEST(AxrVector_Dynamic, PopBack_2) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -503,8 +502,8 @@ TEST(AxrVector_Dynamic, PopBack_2) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(TestData) * capacity) + alignof(TestData) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData) * capacity, alignof(TestData)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -512,7 +511,7 @@ TEST(AxrVector_Dynamic, PopBack_2) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrVector_Dynamic<TestData> vector(capacity, &allocator);
     ASSERT_TRUE(vector.empty());
@@ -529,7 +528,7 @@ TEST(AxrVector_Dynamic, PopBack_2) {
 }
 
 TEST(AxrVector_Dynamic, Clear) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -559,8 +558,8 @@ TEST(AxrVector_Dynamic, Clear) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(TestData) * capacity) + alignof(TestData) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData) * capacity, alignof(TestData)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -568,7 +567,7 @@ TEST(AxrVector_Dynamic, Clear) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrVector_Dynamic<TestData> vector(capacity, &allocator);
     ASSERT_TRUE(vector.empty());
@@ -585,7 +584,7 @@ TEST(AxrVector_Dynamic, Clear) {
 }
 
 TEST(AxrVector_Dynamic, GetAt_InBounds) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -615,8 +614,8 @@ TEST(AxrVector_Dynamic, GetAt_InBounds) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(TestData) * capacity) + alignof(TestData) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData) * capacity, alignof(TestData)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -624,7 +623,7 @@ TEST(AxrVector_Dynamic, GetAt_InBounds) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrVector_Dynamic<TestData> vector(capacity, &allocator);
     ASSERT_TRUE(vector.empty());
@@ -645,7 +644,7 @@ TEST(AxrVector_Dynamic, GetAt_InBounds) {
 }
 
 TEST(AxrVector_Dynamic, GetAt_OutBounds) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -675,8 +674,8 @@ TEST(AxrVector_Dynamic, GetAt_OutBounds) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(TestData) * capacity) + alignof(TestData) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData) * capacity, alignof(TestData)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -684,7 +683,7 @@ TEST(AxrVector_Dynamic, GetAt_OutBounds) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrVector_Dynamic<TestData> vector(capacity, &allocator);
     ASSERT_TRUE(vector.empty());
@@ -699,7 +698,7 @@ TEST(AxrVector_Dynamic, GetAt_OutBounds) {
 }
 
 TEST(AxrVector_Dynamic, FindFirst_Exists) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -714,8 +713,8 @@ TEST(AxrVector_Dynamic, FindFirst_Exists) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(TestData) * capacity) + alignof(TestData) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData) * capacity, alignof(TestData)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -723,7 +722,7 @@ TEST(AxrVector_Dynamic, FindFirst_Exists) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrVector_Dynamic<TestData> vector(capacity, &allocator);
 
@@ -746,7 +745,7 @@ TEST(AxrVector_Dynamic, FindFirst_Exists) {
 }
 
 TEST(AxrVector_Dynamic, FindFirst_DoesntExist) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     struct TestData {
         uint32_t value;
@@ -761,8 +760,8 @@ TEST(AxrVector_Dynamic, FindFirst_DoesntExist) {
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(TestData) * capacity) + alignof(TestData) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData) * capacity, alignof(TestData)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -770,7 +769,7 @@ TEST(AxrVector_Dynamic, FindFirst_DoesntExist) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrVector_Dynamic<TestData> vector(capacity, &allocator);
 
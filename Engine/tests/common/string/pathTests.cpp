@@ -21,7 +21,7 @@
 // Shared Data
 // ----------------------------------------- //
 
-static AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node> HandlesAllocator;
+static AxrHandleTable HandleTable;
 
 // ----------------------------------------- //
 // Shared Functions
@@ -32,20 +32,19 @@ static void deallocateCallback(void*& memory) {
     memory = nullptr;
 };
 
-static void initializeHandlesAllocator(const uint32_t maxHandleCount) {
-    AxrDeallocateBlock handlesDeallocator;
-    handlesDeallocator.connect<deallocateCallback>();
+static void initializeHandleTable(const uint32_t maxHandleCount) {
+    AxrDeallocateBlock handleTableDeallocator;
+    handleTableDeallocator.connect<deallocateCallback>();
 
-    const size_t allocatorSize = AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node>::getAllocatorSize(
-        maxHandleCount);
+    const size_t allocatorSize = AxrHandleTable::getAllocatorSize(maxHandleCount);
 
     const AxrMemoryBlock memoryBlock{
         .Memory = malloc(allocatorSize),
         .Size = allocatorSize,
-        .Deallocator = handlesDeallocator,
+        .Deallocator = handleTableDeallocator,
     };
 
-    HandlesAllocator = AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node>(memoryBlock);
+    HandleTable = AxrHandleTable(memoryBlock);
 }
 
 // ----------------------------------------- //
@@ -53,15 +52,15 @@ static void initializeHandlesAllocator(const uint32_t maxHandleCount) {
 // ----------------------------------------- //
 
 TEST(AxrPath, Initialization) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -69,7 +68,7 @@ TEST(AxrPath, Initialization) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     constexpr char testArray[]{"シ Hello"};
     const auto testCharPtr = "シ Hello";
@@ -88,15 +87,15 @@ TEST(AxrPath, Initialization) {
 }
 
 TEST(AxrPath, Append_AxrPath) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -104,7 +103,7 @@ TEST(AxrPath, Append_AxrPath) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrPath path1(u8"Hello/", &allocator);
     const AxrPath path2(u8"World.txt", &allocator);
@@ -114,15 +113,15 @@ TEST(AxrPath, Append_AxrPath) {
 }
 
 TEST(AxrPath, AppendString_AxrString) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -130,7 +129,7 @@ TEST(AxrPath, AppendString_AxrString) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrPath path(u8"Hello/", &allocator);
     const AxrString string(u8"World", &allocator);
@@ -140,15 +139,15 @@ TEST(AxrPath, AppendString_AxrString) {
 }
 
 TEST(AxrPath, AppendString_Array) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -156,7 +155,7 @@ TEST(AxrPath, AppendString_Array) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrPath path(u8"Hello/", &allocator);
     constexpr char8_t string[]{u8"World"};
@@ -166,15 +165,15 @@ TEST(AxrPath, AppendString_Array) {
 }
 
 TEST(AxrPath, AppendString_Char8Ptr) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -182,7 +181,7 @@ TEST(AxrPath, AppendString_Char8Ptr) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrPath path(u8"Hello/", &allocator);
     const auto string = u8"World";
@@ -192,15 +191,15 @@ TEST(AxrPath, AppendString_Char8Ptr) {
 }
 
 TEST(AxrPath, AppendString_CharPtr) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -208,7 +207,7 @@ TEST(AxrPath, AppendString_CharPtr) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrPath path(u8"Hello/", &allocator);
     const auto string = "World";
@@ -218,15 +217,15 @@ TEST(AxrPath, AppendString_CharPtr) {
 }
 
 TEST(AxrPath, AppendPath_Array) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -234,7 +233,7 @@ TEST(AxrPath, AppendPath_Array) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrPath path1(u8"Hello/", &allocator);
     constexpr char8_t path2[]{u8"World.txt"};
@@ -244,15 +243,15 @@ TEST(AxrPath, AppendPath_Array) {
 }
 
 TEST(AxrPath, AppendPath_Char8Ptr) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -260,7 +259,7 @@ TEST(AxrPath, AppendPath_Char8Ptr) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrPath path1(u8"Hello/", &allocator);
     const auto path2 = u8"World.txt";
@@ -270,15 +269,15 @@ TEST(AxrPath, AppendPath_Char8Ptr) {
 }
 
 TEST(AxrPath, AppendPath_CharPtr) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -286,7 +285,7 @@ TEST(AxrPath, AppendPath_CharPtr) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrPath path1(u8"Hello/", &allocator);
     const auto path2 = "World.txt";
@@ -11,7 +11,7 @@
 // Shared Data
 // ----------------------------------------- //
 
-static AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node> HandlesAllocator;
+static AxrHandleTable HandleTable;
 
 // ----------------------------------------- //
 // Shared Functions
@@ -22,20 +22,19 @@ static void deallocateCallback(void*& memory) {
     memory = nullptr;
 };
 
-static void initializeHandlesAllocator(const uint32_t maxHandleCount) {
-    AxrDeallocateBlock handlesDeallocator;
-    handlesDeallocator.connect<deallocateCallback>();
+static void initializeHandleTable(const uint32_t maxHandleCount) {
+    AxrDeallocateBlock handleTableDeallocator;
+    handleTableDeallocator.connect<deallocateCallback>();
 
-    const size_t allocatorSize = AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node>::getAllocatorSize(
-        maxHandleCount);
+    const size_t allocatorSize = AxrHandleTable::getAllocatorSize(maxHandleCount);
 
     const AxrMemoryBlock memoryBlock{
         .Memory = malloc(allocatorSize),
         .Size = allocatorSize,
-        .Deallocator = handlesDeallocator,
+        .Deallocator = handleTableDeallocator,
     };
 
-    HandlesAllocator = AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node>(memoryBlock);
+    HandleTable = AxrHandleTable(memoryBlock);
 }
 
 static bool testStringIsInHeapMemory(const AxrString& string) {
@@ -47,15 +46,15 @@ static bool testStringIsInHeapMemory(const AxrString& string) {
 // ----------------------------------------- //
 
 TEST(AxrString, Initialization) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -63,7 +62,7 @@ TEST(AxrString, Initialization) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     constexpr char8_t testArray[]{u8"シ Hello"};
     const auto testChar8Ptr = u8"シ Hello";
@@ -82,15 +81,15 @@ TEST(AxrString, Initialization) {
 }
 
 TEST(AxrString, CopyAxrString) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -98,7 +97,7 @@ TEST(AxrString, CopyAxrString) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrString string1(&allocator);
     const AxrString string2(u8"Hello World! シ", &allocator);
@@ -109,15 +108,15 @@ TEST(AxrString, CopyAxrString) {
 }
 
 TEST(AxrString, Assignment_Array) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -125,7 +124,7 @@ TEST(AxrString, Assignment_Array) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrString string(&allocator);
     constexpr char8_t testData[] = u8"Hello World! シ";
@@ -136,15 +135,15 @@ TEST(AxrString, Assignment_Array) {
 }
 
 TEST(AxrString, Assignment_Char8Ptr) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -152,7 +151,7 @@ TEST(AxrString, Assignment_Char8Ptr) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrString string(&allocator);
     const auto testData = u8"Hello World! シ";
@@ -163,15 +162,15 @@ TEST(AxrString, Assignment_Char8Ptr) {
 }
 
 TEST(AxrString, Assignment_StackMemory) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -179,7 +178,7 @@ TEST(AxrString, Assignment_StackMemory) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrString string(&allocator);
     const auto testData = u8"シ";
@@ -191,15 +190,15 @@ TEST(AxrString, Assignment_StackMemory) {
 }
 
 TEST(AxrString, Assignment_HeapMemory) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -207,7 +206,7 @@ TEST(AxrString, Assignment_HeapMemory) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrString string(&allocator);
     const auto testData = u8"Hello World! Testing large string シベㄯㆨ㉄ 😃🙉🗸🕪😺🙏🚓🛑🠵🢆";
@@ -219,15 +218,15 @@ TEST(AxrString, Assignment_HeapMemory) {
 }
 
 TEST(AxrString, BuildString) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -235,7 +234,7 @@ TEST(AxrString, BuildString) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrString string(&allocator);
     auto char8PtrString = u8"Hello ";
@@ -247,15 +246,15 @@ TEST(AxrString, BuildString) {
 }
 
 TEST(AxrString, Reallocate_Assignment_StackToStack) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -263,7 +262,7 @@ TEST(AxrString, Reallocate_Assignment_StackToStack) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     const auto testData1 = u8"Hello";
     AxrString string(testData1, &allocator);
@@ -277,15 +276,15 @@ TEST(AxrString, Reallocate_Assignment_StackToStack) {
 }
 
 TEST(AxrString, Reallocate_Assignment_StackToHeap) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -293,7 +292,7 @@ TEST(AxrString, Reallocate_Assignment_StackToHeap) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     const auto testData1 = u8"Hello";
     AxrString string(testData1, &allocator);
@@ -307,15 +306,15 @@ TEST(AxrString, Reallocate_Assignment_StackToHeap) {
 }
 
 TEST(AxrString, Reallocate_Assignment_HeapToStack) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -323,7 +322,7 @@ TEST(AxrString, Reallocate_Assignment_HeapToStack) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     const auto testData1 = u8"Hello World! Testing large string シベㄯㆨ㉄ 😃🙉🗸🕪😺🙏🚓🛑🠵🢆";
     AxrString string(testData1, &allocator);
@@ -339,15 +338,15 @@ TEST(AxrString, Reallocate_Assignment_HeapToStack) {
 }
 
 TEST(AxrString, Reallocate_Assignment_HeapToHeap) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -355,7 +354,7 @@ TEST(AxrString, Reallocate_Assignment_HeapToHeap) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     const auto testData1 = u8"Hello World! Testing large string シベㄯㆨ㉄ 😃🙉🗸🕪😺🙏🚓🛑🠵🢆";
     AxrString string(testData1, &allocator);
@@ -369,15 +368,15 @@ TEST(AxrString, Reallocate_Assignment_HeapToHeap) {
 }
 
 TEST(AxrString, Reallocate_BuildString_StackToStack) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -385,7 +384,7 @@ TEST(AxrString, Reallocate_BuildString_StackToStack) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrString string(&allocator);
     const auto testData1 = u8"Hello";
@@ -400,15 +399,15 @@ TEST(AxrString, Reallocate_BuildString_StackToStack) {
 }
 
 TEST(AxrString, Reallocate_BuildString_StackToHeap) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -416,7 +415,7 @@ TEST(AxrString, Reallocate_BuildString_StackToHeap) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrString string(&allocator);
     const auto testData1 = u8"Hello";
@@ -431,15 +430,15 @@ TEST(AxrString, Reallocate_BuildString_StackToHeap) {
 }
 
 TEST(AxrString, Reallocate_BuildString_HeapToStack) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -447,7 +446,7 @@ TEST(AxrString, Reallocate_BuildString_HeapToStack) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrString string(&allocator);
     const auto testData1 = u8"Hello World! Testing large string シベㄯㆨ㉄ 😃🙉🗸🕪😺🙏🚓🛑🠵🢆";
@@ -464,15 +463,15 @@ TEST(AxrString, Reallocate_BuildString_HeapToStack) {
 }
 
 TEST(AxrString, Reallocate_BuildString_HeapToHeap) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -480,7 +479,7 @@ TEST(AxrString, Reallocate_BuildString_HeapToHeap) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrString string(&allocator);
     const auto testData1 = u8"Hello World! Testing large string シベㄯㆨ㉄ 😃🙉🗸🕪😺🙏🚓🛑🠵🢆";
@@ -495,15 +494,15 @@ TEST(AxrString, Reallocate_BuildString_HeapToHeap) {
 }
 
 TEST(AxrString, Append_AxrString) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -511,7 +510,7 @@ TEST(AxrString, Append_AxrString) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrString string1(u8"Hello", &allocator);
     const AxrString string2(u8" World!", &allocator);
@@ -521,15 +520,15 @@ TEST(AxrString, Append_AxrString) {
 }
 
 TEST(AxrString, Append_Array) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -537,7 +536,7 @@ TEST(AxrString, Append_Array) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrString string1(u8"Hello", &allocator);
     constexpr char8_t string2[]{u8" World!"};
@@ -547,15 +546,15 @@ TEST(AxrString, Append_Array) {
 }
 
 TEST(AxrString, Append_Char8Ptr) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -563,7 +562,7 @@ TEST(AxrString, Append_Char8Ptr) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrString string1(u8"Hello", &allocator);
     const auto string2 = u8" World!";
@@ -573,15 +572,15 @@ TEST(AxrString, Append_Char8Ptr) {
 }
 
 TEST(AxrString, ForLoop_Increment) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -589,7 +588,7 @@ TEST(AxrString, ForLoop_Increment) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     const auto testData = u8"シ Hello 🗸 😃";
     const AxrString string(testData, &allocator);
@@ -655,15 +654,15 @@ TEST(AxrString, ForLoop_Increment) {
 }
 
 TEST(AxrString, ForLoop_Decrement) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -671,7 +670,7 @@ TEST(AxrString, ForLoop_Decrement) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     const auto testData = u8"シ Hello 🗸 😃";
     const AxrString string(testData, &allocator);
@@ -740,15 +739,15 @@ TEST(AxrString, ForLoop_Decrement) {
 }
 
 TEST(AxrString, Substring_Index) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -756,7 +755,7 @@ TEST(AxrString, Substring_Index) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     const AxrString string(u8"Hello World!", &allocator);
     const AxrStringView substring = string.substring(0, 5);
@@ -765,15 +764,15 @@ TEST(AxrString, Substring_Index) {
 }
 
 TEST(AxrString, Substring_Iterator) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -781,7 +780,7 @@ TEST(AxrString, Substring_Iterator) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     const AxrString string(u8"Hello World!", &allocator);
 
@@ -802,15 +801,15 @@ TEST(AxrString, Substring_Iterator) {
 }
 
 TEST(AxrString, AutoDeallocation) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -818,7 +817,7 @@ TEST(AxrString, AutoDeallocation) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
     ASSERT_TRUE(allocator.empty());
 
     {
@@ -830,15 +829,15 @@ TEST(AxrString, AutoDeallocation) {
 }
 
 TEST(AxrString, Pop_CharacterCount) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -846,7 +845,7 @@ TEST(AxrString, Pop_CharacterCount) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrString string(u8"Hello World!", &allocator);
     string.pop(7);
@@ -854,15 +853,15 @@ TEST(AxrString, Pop_CharacterCount) {
 }
 
 TEST(AxrString, Pop_Iterator) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -870,7 +869,7 @@ TEST(AxrString, Pop_Iterator) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrString string(u8"Hello World!", &allocator);
 
@@ -889,15 +888,15 @@ TEST(AxrString, Pop_Iterator) {
 }
 
 TEST(AxrString, Clear) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     constexpr uint32_t capacity = 256;
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize = (sizeof(char8_t) * capacity) + alignof(char8_t) +
-                                     sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t allocatorSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(char8_t) * capacity, alignof(char8_t)) + alignof(void*);
     void* memory = malloc(allocatorSize);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
@@ -905,7 +904,7 @@ TEST(AxrString, Clear) {
             .Size = allocatorSize,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrString string(u8"Hello World! シ", &allocator);
     ASSERT_TRUE(!string.empty());
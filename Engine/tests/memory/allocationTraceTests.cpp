@@ -0,0 +1,200 @@
+#ifdef AXR_ALLOCATION_TRACE_ENABLED
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include <gtest/gtest.h>
+
+#include "memory/allocationTrace.h"
+#include "memory/dynamicAllocator.h"
+#include "memory/poolAllocator.h"
+#include "memory/stackAllocator.h"
+
+#include <cstdio>
+#include <vector>
+
+// ----------------------------------------- //
+// Shared Types
+// ----------------------------------------- //
+
+namespace {
+    struct TestData {
+        uint32_t ID{};
+        uint32_t Data[7]{};
+    };
+} // namespace
+
+// ----------------------------------------- //
+// Shared Functions
+// ----------------------------------------- //
+
+static void deallocateCallback(void*& memory) {
+    free(memory);
+    memory = nullptr;
+};
+
+static AxrMemoryBlock createMemoryBlock(const size_t size) {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    return AxrMemoryBlock{
+        .Memory = malloc(size),
+        .Size = size,
+        .Deallocator = callback,
+    };
+}
+
+static std::vector<AxrAllocationTraceEvent> readTrace(const char* filePath) {
+    std::vector<AxrAllocationTraceEvent> events;
+
+    std::FILE* file = std::fopen(filePath, "rb");
+    if (file == nullptr) {
+        return events;
+    }
+
+    AxrAllocationTraceHeader header{};
+    if (std::fread(&header, sizeof(header), 1, file) == 1 && header.Magic == AxrAllocationTraceHeader::MagicNumber &&
+        header.Version == AxrAllocationTraceHeader::CurrentVersion) {
+        AxrAllocationTraceEvent event{};
+        while (std::fread(&event, sizeof(event), 1, file) == 1) {
+            events.push_back(event);
+        }
+    }
+
+    std::fclose(file);
+    return events;
+}
+
+// ----------------------------------------- //
+// Tests
+// ----------------------------------------- //
+
+TEST(AllocationTrace, StackAllocator) {
+    const char* filePath = "testAllocationTrace_Stack.bin";
+    AxrStackAllocator allocator(createMemoryBlock(1'024));
+
+    ASSERT_TRUE(AXR_SUCCEEDED(AxrAllocationTraceRecorder::get().start(filePath)));
+    allocator.startTraceRecording();
+    ASSERT_TRUE(allocator.isRecordingTrace());
+
+    TestData* memory = nullptr;
+    AxrStackAllocator::MarkerID markerID1{};
+    AxrStackAllocator::MarkerID markerID2{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, memory, markerID1)));
+    AxrAllocationTraceRecorder::get().nextFrame();
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(2, memory, markerID2)));
+    allocator.deallocate(markerID1);
+    allocator.clear();
+
+    ASSERT_TRUE(AXR_SUCCEEDED(AxrAllocationTraceRecorder::get().stop()));
+
+    const std::vector<AxrAllocationTraceEvent> events = readTrace(filePath);
+    ASSERT_EQ(events.size(), 5);
+
+    ASSERT_EQ(events[0].Type, AXR_ALLOCATION_TRACE_EVENT_CREATE);
+    ASSERT_EQ(events[0].AllocationID, AXR_ALLOCATION_TRACE_ALLOCATOR_STACK);
+    ASSERT_EQ(events[0].Size, allocator.capacity());
+
+    ASSERT_EQ(events[1].Type, AXR_ALLOCATION_TRACE_EVENT_ALLOCATE);
+    ASSERT_EQ(events[1].AllocationID, markerID1);
+    ASSERT_EQ(events[1].Size, sizeof(TestData));
+    ASSERT_EQ(events[1].Alignment, alignof(TestData));
+    ASSERT_EQ(events[1].FrameIndex, 0);
+
+    ASSERT_EQ(events[2].Type, AXR_ALLOCATION_TRACE_EVENT_ALLOCATE);
+    ASSERT_EQ(events[2].AllocationID, markerID2);
+    ASSERT_EQ(events[2].Size, sizeof(TestData) * 2);
+    ASSERT_EQ(events[2].FrameIndex, 1);
+
+    ASSERT_EQ(events[3].Type, AXR_ALLOCATION_TRACE_EVENT_DEALLOCATE);
+    ASSERT_EQ(events[3].AllocationID, markerID1);
+    ASSERT_EQ(events[4].Type, AXR_ALLOCATION_TRACE_EVENT_CLEAR);
+
+    for (const AxrAllocationTraceEvent& event : events) {
+        ASSERT_EQ(event.AllocatorIndex, events[0].AllocatorIndex);
+    }
+
+    std::remove(filePath);
+}
+
+TEST(AllocationTrace, DynamicAllocator_Reallocate) {
+    const char* filePath = "testAllocationTrace_Dynamic.bin";
+    AxrHandleTable handleTable(createMemoryBlock(AxrHandleTable::getAllocatorSize(8)));
+    AxrDynamicAllocator allocator(createMemoryBlock(1'024), &handleTable);
+
+    ASSERT_TRUE(AXR_SUCCEEDED(AxrAllocationTraceRecorder::get().start(filePath)));
+    allocator.startTraceRecording();
+
+    AxrHandle<TestData> handle1;
+    AxrHandle<TestData> handle2;
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, handle1)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, handle2)));
+    // `handle2` is in the way of growing in place, so this moves to a new block
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.reallocate(4, handle1)));
+    allocator.deallocate(handle2);
+    allocator.defragment(1);
+    allocator.deallocate(handle1);
+
+    ASSERT_TRUE(AXR_SUCCEEDED(AxrAllocationTraceRecorder::get().stop()));
+
+    const std::vector<AxrAllocationTraceEvent> events = readTrace(filePath);
+    ASSERT_EQ(events.size(), 7);
+
+    ASSERT_EQ(events[0].Type, AXR_ALLOCATION_TRACE_EVENT_CREATE);
+    ASSERT_EQ(events[0].AllocationID, AXR_ALLOCATION_TRACE_ALLOCATOR_DYNAMIC);
+    ASSERT_EQ(events[1].Type, AXR_ALLOCATION_TRACE_EVENT_ALLOCATE);
+    ASSERT_EQ(events[2].Type, AXR_ALLOCATION_TRACE_EVENT_ALLOCATE);
+
+    // The move is a single reallocation rather than an allocation and a deallocation
+    ASSERT_EQ(events[3].Type, AXR_ALLOCATION_TRACE_EVENT_REALLOCATE);
+    ASSERT_EQ(events[3].PreviousAllocationID, events[1].AllocationID);
+    ASSERT_EQ(events[3].Size, sizeof(TestData) * 4);
+
+    ASSERT_EQ(events[4].Type, AXR_ALLOCATION_TRACE_EVENT_DEALLOCATE);
+    ASSERT_EQ(events[4].AllocationID, events[2].AllocationID);
+    ASSERT_EQ(events[5].Type, AXR_ALLOCATION_TRACE_EVENT_DEFRAGMENT);
+    ASSERT_EQ(events[5].Size, 1);
+    ASSERT_EQ(events[6].Type, AXR_ALLOCATION_TRACE_EVENT_DEALLOCATE);
+    ASSERT_EQ(events[6].AllocationID, events[3].AllocationID);
+
+    std::remove(filePath);
+}
+
+TEST(AllocationTrace, PoolAllocator_StaleRecording) {
+    const char* filePath = "testAllocationTrace_Pool.bin";
+    AxrPoolAllocator<TestData> allocator(createMemoryBlock(AxrPoolAllocator<TestData>::getAllocatorSize(4)));
+
+    // Not recording a trace yet, so there's nothing to register with
+    allocator.startTraceRecording();
+    ASSERT_FALSE(allocator.isRecordingTrace());
+
+    ASSERT_TRUE(AXR_SUCCEEDED(AxrAllocationTraceRecorder::get().start(filePath)));
+    allocator.startTraceRecording();
+    ASSERT_TRUE(AXR_SUCCEEDED(AxrAllocationTraceRecorder::get().stop()));
+
+    // The allocator is still registered with the first trace, so it doesn't end up in the second one
+    ASSERT_TRUE(AXR_SUCCEEDED(AxrAllocationTraceRecorder::get().start(filePath)));
+    TestData* memory = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(memory)));
+    allocator.deallocate(memory);
+    ASSERT_EQ(AxrAllocationTraceRecorder::get().getEventCount(), 0);
+
+    allocator.startTraceRecording();
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(memory)));
+    const auto chunkAddress = reinterpret_cast<uintptr_t>(memory);
+    allocator.deallocate(memory);
+    ASSERT_TRUE(AXR_SUCCEEDED(AxrAllocationTraceRecorder::get().stop()));
+
+    const std::vector<AxrAllocationTraceEvent> events = readTrace(filePath);
+    ASSERT_EQ(events.size(), 3);
+    ASSERT_EQ(events[0].AllocationID, AXR_ALLOCATION_TRACE_ALLOCATOR_POOL);
+    ASSERT_EQ(events[1].Type, AXR_ALLOCATION_TRACE_EVENT_ALLOCATE);
+    ASSERT_EQ(events[1].AllocationID, chunkAddress);
+    ASSERT_EQ(events[1].Size, sizeof(TestData));
+    ASSERT_EQ(events[2].Type, AXR_ALLOCATION_TRACE_EVENT_DEALLOCATE);
+    ASSERT_EQ(events[2].AllocationID, events[1].AllocationID);
+
+    std::remove(filePath);
+}
+
+#endif
@@ -0,0 +1,121 @@
+#ifdef AXR_ALLOCATION_TRACKING_ENABLED
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include <gtest/gtest.h>
+
+#include "memory/allocationTracker.h"
+#include "memory/poolAllocator.h"
+#include "memory/stackAllocator.h"
+
+// ----------------------------------------- //
+// Shared Types
+// ----------------------------------------- //
+
+namespace {
+    struct TestData {
+        uint32_t ID{};
+        uint32_t Data[7]{};
+    };
+} // namespace
+
+// ----------------------------------------- //
+// Shared Functions
+// ----------------------------------------- //
+
+static void deallocateCallback(void*& memory) {
+    free(memory);
+    memory = nullptr;
+};
+
+// ----------------------------------------- //
+// Tests
+// ----------------------------------------- //
+
+TEST(AllocationTracker, TaggedAllocation) {
+    AxrAllocationTracker::get().reset();
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t chunkCount = 4;
+    constexpr size_t allocatorSize = (chunkCount * sizeof(TestData)) + alignof(TestData);
+    AxrPoolAllocator<TestData> allocator(AxrMemoryBlock{
+        .Memory = malloc(allocatorSize),
+        .Size = allocatorSize,
+        .Deallocator = callback,
+    });
+
+    TestData* memory = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(memory, false, AxrAllocationTag(AXR_ALLOCATION_SUBSYSTEM_ASSETS))));
+
+    AxrAllocationTracker::Stats stats = AxrAllocationTracker::get().getSubsystemStats(AXR_ALLOCATION_SUBSYSTEM_ASSETS);
+    ASSERT_EQ(stats.AllocationCount, 1);
+    ASSERT_EQ(stats.LiveBytes, sizeof(TestData));
+    ASSERT_EQ(AxrAllocationTracker::get().getCallSiteCount(), 1);
+
+    allocator.deallocate(memory);
+
+    stats = AxrAllocationTracker::get().getSubsystemStats(AXR_ALLOCATION_SUBSYSTEM_ASSETS);
+    ASSERT_EQ(stats.DeallocationCount, 1);
+    ASSERT_EQ(stats.LiveBytes, 0);
+    ASSERT_EQ(stats.PeakLiveBytes, sizeof(TestData));
+    ASSERT_EQ(stats.TotalBytes, sizeof(TestData));
+}
+
+TEST(AllocationTracker, SubsystemScope) {
+    AxrAllocationTracker::get().reset();
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t chunkCount = 4;
+    constexpr size_t allocatorSize = (chunkCount * sizeof(TestData)) + alignof(TestData);
+    AxrPoolAllocator<TestData> allocator(AxrMemoryBlock{
+        .Memory = malloc(allocatorSize),
+        .Size = allocatorSize,
+        .Deallocator = callback,
+    });
+
+    TestData* memory1 = nullptr;
+    TestData* memory2 = nullptr;
+    {
+        const AxrAllocationSubsystemScope allocationSubsystemScope(AXR_ALLOCATION_SUBSYSTEM_RENDERER);
+        ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(memory1)));
+    }
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(memory2)));
+
+    ASSERT_EQ(AxrAllocationTracker::get().getSubsystemStats(AXR_ALLOCATION_SUBSYSTEM_RENDERER).AllocationCount, 1);
+    ASSERT_EQ(AxrAllocationTracker::get().getSubsystemStats(AXR_ALLOCATION_SUBSYSTEM_UNKNOWN).AllocationCount, 1);
+
+    allocator.deallocate(memory1);
+    allocator.deallocate(memory2);
+}
+
+TEST(AllocationTracker, StackAllocationsAreTransient) {
+    AxrAllocationTracker::get().reset();
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t allocatorSize = 256;
+    AxrStackAllocator allocator(AxrMemoryBlock{
+        .Memory = malloc(allocatorSize),
+        .Size = allocatorSize,
+        .Deallocator = callback,
+    });
+
+    TestData* memory = nullptr;
+    AxrStackAllocator::MarkerID markerID{};
+    ASSERT_TRUE(AXR_SUCCEEDED(
+        allocator.allocate(1, memory, markerID, false, AxrAllocationTag(AXR_ALLOCATION_SUBSYSTEM_SERVER))));
+
+    const AxrAllocationTracker::Stats stats =
+        AxrAllocationTracker::get().getSubsystemStats(AXR_ALLOCATION_SUBSYSTEM_SERVER);
+    ASSERT_EQ(stats.AllocationCount, 1);
+    ASSERT_EQ(stats.TotalBytes, sizeof(TestData));
+    ASSERT_EQ(stats.LiveBytes, 0);
+}
+
+#endif
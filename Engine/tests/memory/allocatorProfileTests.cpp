@@ -0,0 +1,165 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include <gtest/gtest.h>
+
+#include "axr/common/defines.h"
+#include "memory/allocatorProfile.h"
+
+#include <cstdio>
+
+// ----------------------------------------- //
+// Shared Functions
+// ----------------------------------------- //
+
+static AxrAllocator::Config createDefaultConfig() {
+    return AxrAllocator::Config{
+        .FrameAllocatorSize = 131'072,
+        .WorkerThreadCount = 4,
+        .WorkerFrameAllocatorSize = 32'768,
+        .FramesInFlight = 2,
+        .FrameInFlightAllocatorSize = 65'536,
+        .MaxHandleCount = 10'000,
+        .EngineDataAllocatorMainMemorySize = 1'048'576,
+        .MaxDebugHandleCount = 100,
+        .DebugInfoAllocatorMainMemorySize = 2'097'152,
+        .DefragmentMicrosecondsPerFrame = 100,
+        .DefragmentBytesPerFrame = 65'536,
+        .UseHugePages = true,
+        .PrefaultFrameAllocators = true,
+        .Arenas = nullptr,
+        .ArenaCount = 0,
+    };
+}
+
+static void writeFile(const char* filePath, const char* contents) {
+    std::FILE* file = std::fopen(filePath, "w");
+    ASSERT_TRUE(file != nullptr);
+    std::fputs(contents, file);
+    std::fclose(file);
+}
+
+// ----------------------------------------- //
+// Tests
+// ----------------------------------------- //
+
+TEST(AllocatorProfile, Apply) {
+    AxrAllocator::Config config = createDefaultConfig();
+    const AxrAllocator::UsageProfile profile{
+        .FrameAllocatorPeakSize = 40'000,
+        .WorkerFrameAllocatorPeakSize = 0,
+        .FrameInFlightAllocatorPeakSize = 100,
+        .PeakHandleCount = 2'000,
+        .EngineDataAllocatorPeakSize = 2'000'000,
+        .PeakDebugHandleCount = 10,
+        .DebugInfoAllocatorPeakSize = 0,
+    };
+
+    axrApplyAllocatorProfile(profile, 25, config);
+
+    ASSERT_TRUE(config.FrameAllocatorSize == 50'000);
+    // No recorded peak keeps the current budget
+    ASSERT_TRUE(config.WorkerFrameAllocatorSize == 32'768);
+    ASSERT_TRUE(config.DebugInfoAllocatorMainMemorySize == 2'097'152);
+    // Tiny peaks are clamped to the minimum budget
+    ASSERT_TRUE(config.FrameInFlightAllocatorSize == AxrAllocatorProfileMinBudgetSize);
+    ASSERT_TRUE(config.MaxDebugHandleCount == AxrAllocatorProfileMinHandleCount);
+    ASSERT_TRUE(config.MaxHandleCount == 2'500);
+    ASSERT_TRUE(config.EngineDataAllocatorMainMemorySize == 2'500'000);
+}
+
+TEST(AllocatorProfile, UseSnapshotBudgets) {
+    AxrAllocator::Config snapshotConfig = createDefaultConfig();
+    snapshotConfig.EngineDataAllocatorMainMemorySize = 2'000'000;
+
+    // Smaller budgets fit in the snapshot, so they're raised to match it
+    AxrAllocator::Config config = createDefaultConfig();
+    config.FrameAllocatorSize = 100'000;
+    ASSERT_TRUE(axrUseSnapshotAllocatorBudgets(snapshotConfig, config));
+    ASSERT_TRUE(config.FrameAllocatorSize == 131'072);
+    ASSERT_TRUE(config.EngineDataAllocatorMainMemorySize == 2'000'000);
+
+    // A larger budget doesn't fit
+    config = createDefaultConfig();
+    config.MaxHandleCount = 20'000;
+    ASSERT_FALSE(axrUseSnapshotAllocatorBudgets(snapshotConfig, config));
+    ASSERT_TRUE(config.MaxHandleCount == 20'000);
+    ASSERT_TRUE(config.EngineDataAllocatorMainMemorySize == 1'048'576);
+
+    // Settings that aren't budgets but change the memory layout must match
+    config = createDefaultConfig();
+    config.FramesInFlight = 3;
+    ASSERT_FALSE(axrUseSnapshotAllocatorBudgets(snapshotConfig, config));
+
+    // Settings that don't change the memory layout keep their current values
+    config = createDefaultConfig();
+    config.DefragmentBytesPerFrame = 1'024;
+    config.EngineDataAllocatorHighWaterMark = 0.5f;
+    config.UseHugePages = !snapshotConfig.UseHugePages;
+    ASSERT_TRUE(axrUseSnapshotAllocatorBudgets(snapshotConfig, config));
+    ASSERT_TRUE(config.DefragmentBytesPerFrame == 1'024);
+    ASSERT_TRUE(config.EngineDataAllocatorHighWaterMark == 0.5f);
+    ASSERT_TRUE(config.UseHugePages != snapshotConfig.UseHugePages);
+}
+
+TEST(AllocatorProfile, SaveLoad_MergesPeaks) {
+    const char* filePath = "allocatorProfileTest.toml";
+    std::remove(filePath);
+
+    AxrAllocator::UsageProfile profile{};
+    ASSERT_TRUE(axrLoadAllocatorProfile(filePath, profile) == AXR_ERROR_NOT_FOUND);
+
+    ASSERT_TRUE(AXR_SUCCEEDED(axrSaveAllocatorProfile(filePath,
+                                                      AxrAllocator::UsageProfile{
+                                                          .FrameAllocatorPeakSize = 1'000,
+                                                          .WorkerFrameAllocatorPeakSize = 2'000,
+                                                          .FrameInFlightAllocatorPeakSize = 3'000,
+                                                          .PeakHandleCount = 40,
+                                                          .EngineDataAllocatorPeakSize = 5'000,
+                                                          .PeakDebugHandleCount = 6,
+                                                          .DebugInfoAllocatorPeakSize = 7'000,
+                                                      })));
+    ASSERT_TRUE(AXR_SUCCEEDED(axrSaveAllocatorProfile(filePath,
+                                                      AxrAllocator::UsageProfile{
+                                                          .FrameAllocatorPeakSize = 500,
+                                                          .WorkerFrameAllocatorPeakSize = 4'000,
+                                                          .FrameInFlightAllocatorPeakSize = 0,
+                                                          .PeakHandleCount = 80,
+                                                          .EngineDataAllocatorPeakSize = 0,
+                                                          .PeakDebugHandleCount = 0,
+                                                          .DebugInfoAllocatorPeakSize = 0,
+                                                      })));
+
+    ASSERT_TRUE(AXR_SUCCEEDED(axrLoadAllocatorProfile(filePath, profile)));
+    ASSERT_TRUE(profile.FrameAllocatorPeakSize == 1'000);
+    ASSERT_TRUE(profile.WorkerFrameAllocatorPeakSize == 4'000);
+    ASSERT_TRUE(profile.FrameInFlightAllocatorPeakSize == 3'000);
+    ASSERT_TRUE(profile.PeakHandleCount == 80);
+    ASSERT_TRUE(profile.EngineDataAllocatorPeakSize == 5'000);
+    ASSERT_TRUE(profile.PeakDebugHandleCount == 6);
+    ASSERT_TRUE(profile.DebugInfoAllocatorPeakSize == 7'000);
+
+    std::remove(filePath);
+}
+
+TEST(AllocatorProfile, LoadConfigOverrides) {
+    const char* filePath = "allocatorConfigTest.toml";
+    writeFile(filePath,
+              "[Allocator]\n"
+              "FrameAllocatorSize = 262144\n"
+              "WorkerThreadCount = 8\n"
+              "MaxHandleCount = -1\n"
+              "UseHugePages = false\n");
+
+    AxrAllocator::Config config = createDefaultConfig();
+    ASSERT_TRUE(AXR_SUCCEEDED(axrLoadAllocatorConfigOverrides(filePath, config)));
+    std::remove(filePath);
+
+    ASSERT_TRUE(config.FrameAllocatorSize == 262'144);
+    ASSERT_TRUE(config.WorkerThreadCount == 8);
+    // Out of range values are ignored
+    ASSERT_TRUE(config.MaxHandleCount == 10'000);
+    ASSERT_FALSE(config.UseHugePages);
+    ASSERT_TRUE(config.PrefaultFrameAllocators);
+    ASSERT_TRUE(config.EngineDataAllocatorMainMemorySize == 1'048'576);
+}
@@ -0,0 +1,238 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include <gtest/gtest.h>
+
+#include "axr/common/defines.h"
+#include "common/containers/unorderedMap_dynamic.h"
+#include "common/containers/vector_dynamic.h"
+#include "common/id.h"
+#include "common/string/string.h"
+#include "memory/allocator.h"
+#include "memory/allocatorSnapshot.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+
+// ----------------------------------------- //
+// Shared Functions
+// ----------------------------------------- //
+
+static AxrAllocator::Config createConfig() {
+    return AxrAllocator::Config{
+        .FrameAllocatorSize = 4'096,
+        .WorkerThreadCount = 0,
+        .WorkerFrameAllocatorSize = 0,
+        .FramesInFlight = 1,
+        .FrameInFlightAllocatorSize = 4'096,
+        .MaxHandleCount = 64,
+        .EngineDataAllocatorMainMemorySize = 16'384,
+        .MaxDebugHandleCount = 64,
+        .DebugInfoAllocatorMainMemorySize = 16'384,
+        .DefragmentMicrosecondsPerFrame = 0,
+        .DefragmentBytesPerFrame = 0,
+        .UseHugePages = false,
+        .PrefaultFrameAllocators = false,
+        .Arenas = nullptr,
+        .ArenaCount = 0,
+    };
+}
+
+// ----------------------------------------- //
+// Tests
+// ----------------------------------------- //
+
+TEST(AllocatorSnapshot, RebasePointer) {
+    const AxrSnapshotRebase rebase{
+        .Arena =
+            AxrSnapshotAddressRange{
+                .OldAddress = 0x10'0000,
+                .NewAddress = 0x50'0000,
+                .Size = 0x1000,
+            },
+        .Image =
+            AxrSnapshotAddressRange{
+                .OldAddress = 0x20'0000,
+                .NewAddress = 0x30'0000,
+                .Size = 0x1000,
+            },
+    };
+    ASSERT_TRUE(axrIsSnapshotRebaseNeeded(rebase));
+
+    uintptr_t values[] = {0x10'0010, 0x20'0ff8, 0x10'1000, 0x1234, 0};
+    for (uintptr_t& value : values) {
+        axrRebaseSnapshotPointer(rebase, &value);
+    }
+
+    ASSERT_TRUE(values[0] == 0x50'0010);
+    ASSERT_TRUE(values[1] == 0x30'0ff8);
+    // Just past the end of the old arena
+    ASSERT_TRUE(values[2] == 0x10'1000);
+    ASSERT_TRUE(values[3] == 0x1234);
+    ASSERT_TRUE(values[4] == 0);
+}
+
+TEST(AllocatorSnapshot, ImageAddressRange) {
+    uintptr_t imageAddress = 0;
+    size_t imageSize = 0;
+    ASSERT_TRUE(axrGetImageAddressRange(&AxrAllocator::get(), imageAddress, imageSize));
+
+    const auto anchorAddress = reinterpret_cast<uintptr_t>(&AxrAllocator::get());
+    ASSERT_TRUE(anchorAddress >= imageAddress && anchorAddress < imageAddress + imageSize);
+}
+
+TEST(AllocatorSnapshot, ImageBuildID) {
+    AxrImageBuildID buildID{};
+    ASSERT_TRUE(axrGetImageBuildID(&AxrAllocator::get(), buildID));
+    ASSERT_TRUE(buildID.Size != 0 && buildID.Size <= AxrMaxImageBuildIDSize);
+
+    // Every address within the image gives the same build ID
+    AxrImageBuildID functionBuildID{};
+    ASSERT_TRUE(axrGetImageBuildID(reinterpret_cast<const void*>(&axrGetImageBuildID), functionBuildID));
+    ASSERT_TRUE(functionBuildID.Size == buildID.Size);
+    ASSERT_TRUE(std::memcmp(functionBuildID.Data, buildID.Data, buildID.Size) == 0);
+}
+
+#ifndef AXR_TLSF_ALLOCATOR_ENABLED
+TEST(AllocatorSnapshot, SaveRestore) {
+    const char* filePath = "testAllocatorSnapshot.bin";
+    AxrAllocator& allocator = AxrAllocator::get();
+    const AxrAllocator::Config config = createConfig();
+
+    const uint64_t* savedData = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.setup(config)));
+    {
+        AxrVector_Dynamic<uint64_t> values(8, &allocator.EngineDataAllocator);
+        AxrVector_Dynamic<const uint64_t*> valuePointers(8, &allocator.EngineDataAllocator);
+        ASSERT_FALSE(allocator.registerSnapshotRoot(AXR_SNAPSHOT_ROOT_SHADER_REGISTRY, values));
+        ASSERT_FALSE(allocator.registerSnapshotRoot(AXR_SNAPSHOT_ROOT_DEBUG_ID_NAMES, valuePointers));
+
+        for (uint64_t i = 0; i < 5; ++i) {
+            values.pushBack(i * 10);
+        }
+        for (uint32_t i = 0; i < 5; ++i) {
+            valuePointers.pushBack(&values[i]);
+        }
+
+        savedData = values.data();
+        // Plain data that happens to look like an address within the allocator memory
+        values.pushBack(reinterpret_cast<uint64_t>(savedData));
+        ASSERT_TRUE(AXR_SUCCEEDED(allocator.saveSnapshot(filePath)));
+    }
+    allocator.shutDown();
+
+    // Take the old memory so the snapshot is restored at a different address
+    void* blocker = malloc(65'536);
+
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.restoreSnapshot(filePath, config)));
+    ASSERT_TRUE(allocator.isRestoredFromSnapshot());
+    {
+        AxrVector_Dynamic<uint64_t> values;
+        AxrVector_Dynamic<const uint64_t*> valuePointers;
+        ASSERT_TRUE(allocator.registerSnapshotRoot(AXR_SNAPSHOT_ROOT_SHADER_REGISTRY, values));
+        ASSERT_TRUE(allocator.registerSnapshotRoot(AXR_SNAPSHOT_ROOT_DEBUG_ID_NAMES, valuePointers));
+
+#ifndef AXR_VIRTUAL_MEMORY_ENABLED
+        // Reserved virtual memory doesn't come from the heap, so the blocker can't keep it from being reused
+        ASSERT_TRUE(values.data() != savedData);
+#endif
+        ASSERT_TRUE(values.size() == 6);
+        ASSERT_TRUE(valuePointers.size() == 5);
+        for (uint32_t i = 0; i < 5; ++i) {
+            ASSERT_TRUE(values[i] == i * 10);
+            ASSERT_TRUE(valuePointers[i] == &values[i]);
+        }
+        // Only known pointers are rebased
+        ASSERT_TRUE(values[5] == reinterpret_cast<uint64_t>(savedData));
+
+        values.pushBack(60);
+        ASSERT_TRUE(values[6] == 60);
+    }
+    // Restored handles deallocate through the restored allocator like any other handle
+    ASSERT_TRUE(allocator.EngineDataAllocator.empty());
+    ASSERT_TRUE(allocator.HandleTable.empty());
+    allocator.shutDown();
+
+    free(blocker);
+    std::remove(filePath);
+}
+
+TEST(AllocatorSnapshot, SaveRestore_StringMap) {
+    const char* filePath = "testAllocatorSnapshot_StringMap.bin";
+    AxrAllocator& allocator = AxrAllocator::get();
+    const AxrAllocator::Config config = createConfig();
+    constexpr char8_t shortName[] = u8"Short";
+    constexpr char8_t longName[] = u8"A name that's too long to fit in the string's own storage";
+
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.setup(config)));
+    {
+        AxrUnorderedMap_Dynamic<AxrID, AxrString> names(16, &allocator.EngineDataAllocator);
+        ASSERT_FALSE(allocator.registerSnapshotRoot(AXR_SNAPSHOT_ROOT_DEBUG_ID_NAMES, names));
+
+        names.insert(AxrID(1), AxrString(shortName, &allocator.EngineDataAllocator));
+        names.insert(AxrID(2), AxrString(longName, &allocator.EngineDataAllocator));
+        ASSERT_TRUE(AXR_SUCCEEDED(allocator.saveSnapshot(filePath)));
+    }
+    allocator.shutDown();
+
+    // Take the old memory so the snapshot is restored at a different address
+    void* blocker = malloc(65'536);
+
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.restoreSnapshot(filePath, config)));
+    {
+        AxrUnorderedMap_Dynamic<AxrID, AxrString> names;
+        ASSERT_TRUE(allocator.registerSnapshotRoot(AXR_SNAPSHOT_ROOT_DEBUG_ID_NAMES, names));
+
+        ASSERT_TRUE(names.size() == 2);
+        AxrString& shortString = (*names.find(AxrID(1))).second;
+        ASSERT_TRUE(shortString == shortName);
+        ASSERT_TRUE((*names.find(AxrID(2))).second == longName);
+
+        // The short string grows onto the heap through its restored allocator pointer
+        ASSERT_TRUE(AXR_SUCCEEDED(shortString.append(longName)));
+        ASSERT_TRUE(shortString.size() == std::size(shortName) + std::size(longName) - 2);
+    }
+    ASSERT_TRUE(allocator.EngineDataAllocator.empty());
+    ASSERT_TRUE(allocator.HandleTable.empty());
+    allocator.shutDown();
+
+    free(blocker);
+    std::remove(filePath);
+}
+
+TEST(AllocatorSnapshot, Restore_Invalid) {
+    const char* filePath = "testAllocatorSnapshot_Invalid.bin";
+    AxrAllocator& allocator = AxrAllocator::get();
+    AxrAllocator::Config config = createConfig();
+
+    ASSERT_TRUE(allocator.restoreSnapshot(filePath, config) == AXR_ERROR_NOT_FOUND);
+    ASSERT_FALSE(allocator.isSetup());
+    AxrAllocator::Config savedConfig{};
+    ASSERT_TRUE(allocator.readSnapshotConfig(filePath, savedConfig) == AXR_ERROR_NOT_FOUND);
+
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.setup(config)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.saveSnapshot(filePath)));
+    allocator.shutDown();
+
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.readSnapshotConfig(filePath, savedConfig)));
+    ASSERT_TRUE(savedConfig.MaxHandleCount == config.MaxHandleCount);
+    ASSERT_TRUE(savedConfig.EngineDataAllocatorMainMemorySize == config.EngineDataAllocatorMainMemorySize);
+
+    // Settings that don't change the memory layout come from the restoring config
+    config.DefragmentBytesPerFrame = 1'024;
+    config.EngineDataAllocatorHighWaterMark = 0.5f;
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.restoreSnapshot(filePath, config)));
+    ASSERT_TRUE(allocator.EngineDataAllocator.getMemoryPressureMonitor().getHighWaterMark() ==
+                allocator.EngineDataAllocator.capacity() / 2);
+    allocator.shutDown();
+
+    // A different config means a different memory layout
+    config.MaxHandleCount = 128;
+    ASSERT_TRUE(allocator.restoreSnapshot(filePath, config) == AXR_ERROR_VALIDATION_FAILED);
+    ASSERT_FALSE(allocator.isSetup());
+    ASSERT_FALSE(allocator.isRestoredFromSnapshot());
+
+    std::remove(filePath);
+}
+#endif
@@ -0,0 +1,307 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include <gtest/gtest.h>
+
+#include "axr/common/defines.h"
+#include "common/containers/unorderedMap_dynamic.h"
+#include "common/containers/vector_dynamic.h"
+#include "memory/allocator.h"
+
+#include <iterator>
+
+// ----------------------------------------- //
+// Shared Functions
+// ----------------------------------------- //
+
+static AxrAllocator::Config createConfig(const AxrAllocator::ArenaConfig* arenas, const uint32_t arenaCount) {
+    return AxrAllocator::Config{
+        .FrameAllocatorSize = 4'096,
+        .WorkerThreadCount = 0,
+        .WorkerFrameAllocatorSize = 0,
+        .FramesInFlight = 1,
+        .FrameInFlightAllocatorSize = 4'096,
+        .MaxHandleCount = 64,
+        .EngineDataAllocatorMainMemorySize = 16'384,
+        .MaxDebugHandleCount = 64,
+        .DebugInfoAllocatorMainMemorySize = 16'384,
+        .DefragmentMicrosecondsPerFrame = 0,
+        .DefragmentBytesPerFrame = 0,
+        .UseHugePages = false,
+        .PrefaultFrameAllocators = false,
+        .Arenas = arenas,
+        .ArenaCount = arenaCount,
+    };
+}
+
+// ----------------------------------------- //
+// Tests
+// ----------------------------------------- //
+
+TEST(Allocator, NamedArenas) {
+    constexpr AxrAllocator::ArenaConfig arenas[] = {
+        AxrAllocator::ArenaConfig{
+            .Name = u8"Renderer",
+            .Type = AXR_ARENA_TYPE_PERSISTENT,
+            .Size = 8'192,
+            .MaxHandleCount = 16,
+        },
+        AxrAllocator::ArenaConfig{
+            .Name = u8"Scratch",
+            .Type = AXR_ARENA_TYPE_STACK,
+            .Size = 1'024,
+            .MaxHandleCount = 0,
+        },
+    };
+
+    AxrAllocator& allocator = AxrAllocator::get();
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.setup(createConfig(arenas, static_cast<uint32_t>(std::size(arenas))))));
+
+    const AxrID_T rendererArenaID = AxrAllocator::getArenaID(u8"Renderer");
+    const AxrID_T scratchArenaID = AxrAllocator::getArenaID(u8"Scratch");
+    {
+        AxrPersistentAllocator_T* rendererArena = allocator.getPersistentArena(rendererArenaID);
+        ASSERT_TRUE(rendererArena != nullptr);
+        ASSERT_TRUE(rendererArena != &allocator.EngineDataAllocator);
+
+        AxrVector_Dynamic<uint32_t> values(32, rendererArena);
+        values.pushBack(1);
+        // Allocations in the arena don't touch the engine data allocator
+        ASSERT_TRUE(allocator.EngineDataAllocator.empty());
+        ASSERT_TRUE(allocator.HandleTable.empty());
+
+        AxrAllocator::ArenaUsage usage{};
+        ASSERT_TRUE(AXR_SUCCEEDED(allocator.getArenaUsage(rendererArenaID, usage)));
+        ASSERT_TRUE(usage.Type == AXR_ARENA_TYPE_PERSISTENT);
+        ASSERT_TRUE(usage.Size >= sizeof(uint32_t) * 32);
+        ASSERT_TRUE(usage.Capacity == rendererArena->capacity());
+        ASSERT_TRUE(usage.HandleCount == 1);
+        ASSERT_TRUE(usage.HandleCapacity == 16);
+    }
+
+    AxrStackAllocator* scratchArena = allocator.getStackArena(scratchArenaID);
+    ASSERT_TRUE(scratchArena != nullptr);
+    uint32_t* scratchData = nullptr;
+    AxrStackAllocator::MarkerID scratchMarkerID{};
+    ASSERT_TRUE(AXR_SUCCEEDED(scratchArena->allocate(16, scratchData, scratchMarkerID)));
+
+    AxrAllocator::ArenaUsage usage{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.getArenaUsage(scratchArenaID, usage)));
+    ASSERT_TRUE(usage.Type == AXR_ARENA_TYPE_STACK);
+    ASSERT_TRUE(usage.Size >= sizeof(uint32_t) * 16);
+    ASSERT_TRUE(usage.Capacity == 1'024);
+    ASSERT_TRUE(usage.HandleCount == 0);
+
+    // Stack arenas are only cleared by their owner
+    allocator.clearFrameAllocators();
+    ASSERT_FALSE(scratchArena->empty());
+
+    allocator.shutDown();
+}
+
+TEST(Allocator, NamedArenas_Scene) {
+    constexpr AxrAllocator::ArenaConfig arenas[] = {
+        AxrAllocator::ArenaConfig{
+            .Name = u8"Scene",
+            .Type = AXR_ARENA_TYPE_SCENE,
+            .Size = 4'096,
+            .MaxHandleCount = 0,
+        },
+    };
+
+    AxrAllocator& allocator = AxrAllocator::get();
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.setup(createConfig(arenas, static_cast<uint32_t>(std::size(arenas))))));
+
+    const AxrID_T sceneArenaID = AxrAllocator::getArenaID(u8"Scene");
+    ASSERT_TRUE(allocator.getStackArena(sceneArenaID) == nullptr);
+    ASSERT_TRUE(allocator.getPersistentArena(sceneArenaID) == nullptr);
+
+    AxrSceneArena* sceneArena = allocator.getSceneArena(sceneArenaID);
+    ASSERT_TRUE(sceneArena != nullptr);
+    ASSERT_TRUE(AXR_SUCCEEDED(sceneArena->beginLoad()));
+    uint32_t* sceneData = nullptr;
+    uint32_t* temporaryData = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(sceneArena->allocateScene(16, sceneData)));
+    ASSERT_TRUE(AXR_SUCCEEDED(sceneArena->allocateTemporary(64, temporaryData)));
+    // Loading a scene doesn't touch the engine data allocator
+    ASSERT_TRUE(allocator.EngineDataAllocator.empty());
+
+    AxrAllocator::ArenaUsage usage{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.getArenaUsage(sceneArenaID, usage)));
+    ASSERT_TRUE(usage.Type == AXR_ARENA_TYPE_SCENE);
+    ASSERT_TRUE(usage.Size >= sizeof(uint32_t) * 80);
+    ASSERT_TRUE(usage.Capacity == 4'096);
+    ASSERT_TRUE(usage.HandleCount == 0);
+
+    sceneArena->endLoad();
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.getArenaUsage(sceneArenaID, usage)));
+    ASSERT_TRUE(usage.Size == sceneArena->sceneSize());
+
+    sceneArena->unload();
+    ASSERT_TRUE(sceneArena->empty());
+
+    allocator.shutDown();
+}
+
+TEST(Allocator, NamedArenas_NotFound) {
+    constexpr AxrAllocator::ArenaConfig arenas[] = {
+        AxrAllocator::ArenaConfig{
+            .Name = u8"Scratch",
+            .Type = AXR_ARENA_TYPE_STACK,
+            .Size = 1'024,
+            .MaxHandleCount = 0,
+        },
+    };
+
+    AxrAllocator& allocator = AxrAllocator::get();
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.setup(createConfig(arenas, static_cast<uint32_t>(std::size(arenas))))));
+
+    // Unknown arenas and arenas of a different type aren't found
+    const AxrID_T unknownArenaID = AxrAllocator::getArenaID(u8"Unknown");
+    const AxrID_T scratchArenaID = AxrAllocator::getArenaID(u8"Scratch");
+    ASSERT_TRUE(allocator.getPersistentArena(unknownArenaID) == nullptr);
+    ASSERT_TRUE(allocator.getPersistentArena(scratchArenaID) == nullptr);
+    ASSERT_TRUE(allocator.getStackArena(unknownArenaID) == nullptr);
+
+    AxrAllocator::ArenaUsage usage{};
+    ASSERT_TRUE(allocator.getArenaUsage(unknownArenaID, usage) == AXR_ERROR_NOT_FOUND);
+
+    allocator.shutDown();
+
+    // Arenas don't outlive the setup they were declared in
+    ASSERT_TRUE(allocator.getArenaUsage(scratchArenaID, usage) == AXR_ERROR_NOT_FOUND);
+}
+
+TEST(Allocator, NamedArenas_Invalid) {
+    AxrAllocator& allocator = AxrAllocator::get();
+
+    constexpr AxrAllocator::ArenaConfig duplicateArenas[] = {
+        AxrAllocator::ArenaConfig{
+            .Name = u8"Scratch",
+            .Type = AXR_ARENA_TYPE_STACK,
+            .Size = 1'024,
+            .MaxHandleCount = 0,
+        },
+        AxrAllocator::ArenaConfig{
+            .Name = u8"Scratch",
+            .Type = AXR_ARENA_TYPE_PERSISTENT,
+            .Size = 1'024,
+            .MaxHandleCount = 16,
+        },
+    };
+    ASSERT_TRUE(allocator.setup(createConfig(duplicateArenas, static_cast<uint32_t>(std::size(duplicateArenas)))) ==
+                AXR_ERROR_DUPLICATE);
+    ASSERT_FALSE(allocator.isSetup());
+
+    constexpr AxrAllocator::ArenaConfig longNameArenas[] = {
+        AxrAllocator::ArenaConfig{
+            .Name = u8"An arena name that's far too long to fit",
+            .Type = AXR_ARENA_TYPE_STACK,
+            .Size = 1'024,
+            .MaxHandleCount = 0,
+        },
+    };
+    ASSERT_TRUE(allocator.setup(createConfig(longNameArenas, static_cast<uint32_t>(std::size(longNameArenas)))) ==
+                AXR_ERROR_VALIDATION_FAILED);
+
+    ASSERT_TRUE(allocator.setup(createConfig(duplicateArenas, AxrAllocator::MaxArenaCount + 1)) ==
+                AXR_ERROR_VALIDATION_FAILED);
+    ASSERT_FALSE(allocator.isSetup());
+
+    constexpr AxrAllocator::ArenaConfig oversizedArenas[] = {
+        AxrAllocator::ArenaConfig{
+            .Name = u8"Oversized",
+            .Type = AXR_ARENA_TYPE_PERSISTENT,
+            .Size = AxrPersistentAllocator_T::MaxCapacity + 1,
+            .MaxHandleCount = 16,
+        },
+    };
+    ASSERT_TRUE(allocator.setup(createConfig(oversizedArenas, static_cast<uint32_t>(std::size(oversizedArenas)))) ==
+                AXR_ERROR_VALIDATION_FAILED);
+    ASSERT_FALSE(allocator.isSetup());
+
+    constexpr AxrAllocator::ArenaConfig tooManyHandlesArenas[] = {
+        AxrAllocator::ArenaConfig{
+            .Name = u8"TooManyHandles",
+            .Type = AXR_ARENA_TYPE_PERSISTENT,
+            .Size = 1'024,
+            .MaxHandleCount = AxrDynamicAllocator::MaxHandleCount + 1,
+        },
+    };
+    ASSERT_TRUE(allocator.setup(createConfig(tooManyHandlesArenas,
+                                             static_cast<uint32_t>(std::size(tooManyHandlesArenas)))) ==
+                AXR_ERROR_VALIDATION_FAILED);
+    ASSERT_FALSE(allocator.isSetup());
+}
+
+TEST(Allocator, Setup_OversizedPersistentAllocator) {
+    AxrAllocator& allocator = AxrAllocator::get();
+
+    AxrAllocator::Config config = createConfig(nullptr, 0);
+    config.EngineDataAllocatorMainMemorySize = AxrPersistentAllocator_T::MaxCapacity + 1;
+    ASSERT_TRUE(allocator.setup(config) == AXR_ERROR_VALIDATION_FAILED);
+    ASSERT_FALSE(allocator.isSetup());
+
+    config = createConfig(nullptr, 0);
+    config.DebugInfoAllocatorMainMemorySize = AxrPersistentAllocator_T::MaxCapacity + 1;
+    ASSERT_TRUE(allocator.setup(config) == AXR_ERROR_VALIDATION_FAILED);
+    ASSERT_FALSE(allocator.isSetup());
+}
+
+TEST(Allocator, Setup_TooManyHandles) {
+    AxrAllocator& allocator = AxrAllocator::get();
+
+    AxrAllocator::Config config = createConfig(nullptr, 0);
+    config.MaxHandleCount = AxrDynamicAllocator::MaxHandleCount + 1;
+    ASSERT_TRUE(allocator.setup(config) == AXR_ERROR_VALIDATION_FAILED);
+    ASSERT_FALSE(allocator.isSetup());
+
+    config = createConfig(nullptr, 0);
+    config.MaxDebugHandleCount = AxrDynamicAllocator::MaxHandleCount + 1;
+    ASSERT_TRUE(allocator.setup(config) == AXR_ERROR_VALIDATION_FAILED);
+    ASSERT_FALSE(allocator.isSetup());
+}
+
+TEST(Allocator, ShutDownFast) {
+    constexpr AxrAllocator::ArenaConfig arenas[] = {
+        AxrAllocator::ArenaConfig{
+            .Name = u8"Renderer",
+            .Type = AXR_ARENA_TYPE_PERSISTENT,
+            .Size = 8'192,
+            .MaxHandleCount = 16,
+        },
+    };
+    const AxrAllocator::Config config = createConfig(arenas, static_cast<uint32_t>(std::size(arenas)));
+    const AxrID_T rendererArenaID = AxrAllocator::getArenaID(u8"Renderer");
+
+    AxrAllocator& allocator = AxrAllocator::get();
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.setup(config)));
+    {
+        AxrUnorderedMap_Dynamic<uint32_t, uint32_t> map(16, &allocator.EngineDataAllocator);
+        AxrVector_Dynamic<uint32_t> values(16, allocator.getPersistentArena(rendererArenaID));
+        for (uint32_t i = 0; i < 8; ++i) {
+            map.insert(i, i * 10);
+            values.pushBack(i);
+        }
+
+        // Nothing gets deallocated. The allocator memory is freed as a whole instead
+        map.release();
+        values.release();
+        ASSERT_FALSE(map.allocated());
+        ASSERT_FALSE(allocator.EngineDataAllocator.empty());
+
+        allocator.shutDownFast();
+    }
+    ASSERT_FALSE(allocator.isSetup());
+
+    AxrAllocator::ArenaUsage usage{};
+    ASSERT_TRUE(allocator.getArenaUsage(rendererArenaID, usage) == AXR_ERROR_NOT_FOUND);
+
+    // Everything starts empty again on the next setup
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.setup(config)));
+    ASSERT_TRUE(allocator.EngineDataAllocator.empty());
+    ASSERT_TRUE(allocator.HandleTable.empty());
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.getArenaUsage(rendererArenaID, usage)));
+    ASSERT_TRUE(usage.HandleCount == 0);
+    allocator.shutDown();
+}
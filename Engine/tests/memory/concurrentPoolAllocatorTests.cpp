@@ -0,0 +1,197 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include <gtest/gtest.h>
+
+#include "axr/common/defines.h"
+#include "memory/concurrentPoolAllocator.h"
+
+#include <thread>
+
+// ----------------------------------------- //
+// Shared Types
+// ----------------------------------------- //
+
+namespace {
+    struct TestData {
+        uint32_t ID{};
+        uint32_t Data[7]{};
+
+        bool operator==(const TestData& src) const {
+            return ID == src.ID && std::equal(std::begin(Data), std::end(Data), std::begin(src.Data));
+        }
+    };
+} // namespace
+
+// ----------------------------------------- //
+// Shared Functions
+// ----------------------------------------- //
+
+static void deallocateCallback(void*& memory) {
+    free(memory);
+    memory = nullptr;
+};
+
+template<typename DataType>
+static AxrConcurrentPoolAllocator<DataType> createAllocator(const uint32_t chunkCount) {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    const size_t allocatorSize = AxrConcurrentPoolAllocator<DataType>::getAllocatorSize(chunkCount);
+    return AxrConcurrentPoolAllocator<DataType>(AxrMemoryBlock{
+        .Memory = malloc(allocatorSize),
+        .Size = allocatorSize,
+        .Deallocator = callback,
+    });
+}
+
+// ----------------------------------------- //
+// Tests
+// ----------------------------------------- //
+
+TEST(ConcurrentPoolAllocator, DeallocatorCallback) {
+    bool wasDeallocated = false;
+    {
+        auto deallocateCallback = [](bool* wasDeallocated, void*& memory) -> void {
+            free(memory);
+            memory = nullptr;
+            *wasDeallocated = true;
+        };
+
+        AxrDeallocateBlock callback;
+        callback.connect<deallocateCallback>(&wasDeallocated);
+
+        const size_t allocatorSize = AxrConcurrentPoolAllocator<TestData>::getAllocatorSize(10);
+        AxrConcurrentPoolAllocator<TestData> allocator(AxrMemoryBlock{
+            .Memory = malloc(allocatorSize),
+            .Size = allocatorSize,
+            .Deallocator = callback,
+        });
+    }
+    ASSERT_TRUE(wasDeallocated);
+}
+
+TEST(ConcurrentPoolAllocator, AllocateAll_ThenTooMuch) {
+    constexpr uint32_t chunkCount = 10;
+    AxrConcurrentPoolAllocator<TestData> allocator = createAllocator<TestData>(chunkCount);
+
+    TestData* outTestDatas[chunkCount]{};
+    for (uint32_t i = 0; i < chunkCount; ++i) {
+        ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(outTestDatas[i], true)));
+        ASSERT_TRUE(*outTestDatas[i] == TestData{});
+        outTestDatas[i]->ID = i;
+    }
+
+    // Check that there are no overlaps in memory
+    for (uint32_t i = 0; i < chunkCount; ++i) {
+        ASSERT_TRUE(outTestDatas[i]->ID == i);
+    }
+    ASSERT_TRUE(allocator.size() == allocator.chunkCapacity());
+
+    TestData* outTestData = nullptr;
+    ASSERT_TRUE(allocator.allocate(outTestData) == AXR_ERROR_OUT_OF_MEMORY);
+
+    allocator.deallocate(outTestDatas[3]);
+    ASSERT_TRUE(outTestDatas[3] == nullptr);
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(outTestData)));
+    ASSERT_TRUE(allocator.size() == chunkCount);
+}
+
+TEST(ConcurrentPoolAllocator, SmallType) {
+    constexpr uint32_t chunkCount = 4;
+    AxrConcurrentPoolAllocator<uint8_t> allocator = createAllocator<uint8_t>(chunkCount);
+
+    uint8_t* outTestDatas[chunkCount]{};
+    for (uint32_t i = 0; i < chunkCount; ++i) {
+        ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(outTestDatas[i])));
+        *outTestDatas[i] = static_cast<uint8_t>(i + 1);
+    }
+
+    for (uint32_t i = 0; i < chunkCount; ++i) {
+        ASSERT_TRUE(*outTestDatas[i] == i + 1);
+        allocator.deallocate(outTestDatas[i]);
+    }
+    ASSERT_TRUE(allocator.empty());
+}
+
+TEST(ConcurrentPoolAllocator, Magazine) {
+    constexpr uint32_t chunkCount = AxrConcurrentPoolAllocator<TestData>::Magazine::Capacity * 2;
+    AxrConcurrentPoolAllocator<TestData> allocator = createAllocator<TestData>(chunkCount);
+
+    {
+        AxrConcurrentPoolAllocator<TestData>::Magazine magazine(&allocator);
+
+        // The first allocation refills half a magazine worth of chunks
+        TestData* outTestData = nullptr;
+        ASSERT_TRUE(AXR_SUCCEEDED(magazine.allocate(outTestData)));
+        ASSERT_TRUE(magazine.size() == AxrConcurrentPoolAllocator<TestData>::Magazine::Capacity / 2 - 1);
+        ASSERT_TRUE(allocator.size() == AxrConcurrentPoolAllocator<TestData>::Magazine::Capacity / 2);
+
+        magazine.deallocate(outTestData);
+        ASSERT_TRUE(magazine.size() == AxrConcurrentPoolAllocator<TestData>::Magazine::Capacity / 2);
+
+        // Allocate everything through the magazine
+        TestData* outTestDatas[chunkCount]{};
+        for (uint32_t i = 0; i < chunkCount; ++i) {
+            ASSERT_TRUE(AXR_SUCCEEDED(magazine.allocate(outTestDatas[i])));
+            outTestDatas[i]->ID = i;
+        }
+        ASSERT_TRUE(magazine.allocate(outTestData) == AXR_ERROR_OUT_OF_MEMORY);
+
+        for (uint32_t i = 0; i < chunkCount; ++i) {
+            ASSERT_TRUE(outTestDatas[i]->ID == i);
+            magazine.deallocate(outTestDatas[i]);
+        }
+        ASSERT_TRUE(magazine.size() <= AxrConcurrentPoolAllocator<TestData>::Magazine::Capacity);
+    }
+
+    // The magazine gives back all of its chunks when it's destroyed
+    ASSERT_TRUE(allocator.empty());
+}
+
+TEST(ConcurrentPoolAllocator, MultipleThreads) {
+    constexpr uint32_t threadCount = 4;
+    constexpr uint32_t chunksPerThread = 64;
+    constexpr uint32_t iterationCount = 2'000;
+    AxrConcurrentPoolAllocator<TestData> allocator = createAllocator<TestData>(threadCount * chunksPerThread);
+
+    auto threadFunction = [&allocator](const uint32_t threadIndex, const bool useMagazine, bool* succeeded) {
+        AxrConcurrentPoolAllocator<TestData>::Magazine magazine(&allocator);
+        TestData* outTestDatas[chunksPerThread]{};
+
+        for (uint32_t iteration = 0; iteration < iterationCount; ++iteration) {
+            for (uint32_t i = 0; i < chunksPerThread; ++i) {
+                const AxrResult axrResult = useMagazine ? magazine.allocate(outTestDatas[i])
+                                                        : allocator.allocate(outTestDatas[i]);
+                if (AXR_FAILED(axrResult)) {
+                    return;
+                }
+                outTestDatas[i]->ID = threadIndex;
+            }
+
+            // If any chunk was handed out twice, another thread will have overwritten the ID
+            for (uint32_t i = 0; i < chunksPerThread; ++i) {
+                if (outTestDatas[i]->ID != threadIndex) {
+                    return;
+                }
+                useMagazine ? magazine.deallocate(outTestDatas[i]) : allocator.deallocate(outTestDatas[i]);
+            }
+        }
+
+        *succeeded = true;
+    };
+
+    bool succeeded[threadCount]{};
+    std::thread threads[threadCount];
+    for (uint32_t i = 0; i < threadCount; ++i) {
+        threads[i] = std::thread(threadFunction, i, i % 2 == 0, &succeeded[i]);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (const bool threadSucceeded : succeeded) {
+        ASSERT_TRUE(threadSucceeded);
+    }
+    ASSERT_TRUE(allocator.empty());
+}
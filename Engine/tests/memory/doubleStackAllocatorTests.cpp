@@ -430,3 +430,76 @@ TEST(DoubleStackAllocator, DeallocateIfLast_Failure_Lower_Aligned) {
 TEST(DoubleStackAllocator, DeallocateIfLast_Failure_Upper_Aligned) {
     DeallocateIfLast_Failure_Test(true);
 }
+
+TEST(DoubleStackAllocator, Scope_RewindOneEnd) {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t testDataMemSize =
+        sizeof(TestData_Small) + alignof(TestData_Small) + AxrDoubleStackAllocator::getMarkerSize();
+    constexpr size_t allocatorSize = testDataMemSize * 4;
+    AxrDoubleStackAllocator allocator(AxrMemoryBlock{
+        .Memory = malloc(allocatorSize),
+        .Size = allocatorSize,
+        .Deallocator = callback,
+    });
+
+    TestData_Small* outTestData = nullptr;
+    AxrDoubleStackAllocator::MarkerID markerID{};
+    {
+        AxrDoubleStackAllocator::Scope lowerScope(allocator, AxrDoubleStackAllocator::End::Lower);
+        ASSERT_TRUE(AXR_SUCCEEDED(lowerScope.allocate(1, outTestData)));
+
+        // Long lived data on the other end isn't touched by the scope
+        ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateUpper(1, outTestData, markerID)));
+
+        {
+            AxrDoubleStackAllocator::Scope upperScope(allocator, AxrDoubleStackAllocator::End::Upper);
+            ASSERT_TRUE(AXR_SUCCEEDED(upperScope.allocate(1, outTestData, true)));
+            ASSERT_TRUE(*outTestData == TestData_Small{});
+            ASSERT_TRUE(upperScope.size() == testDataMemSize);
+            ASSERT_TRUE(allocator.sizeUpper() == testDataMemSize * 2);
+        }
+        ASSERT_TRUE(allocator.sizeUpper() == testDataMemSize);
+
+        ASSERT_TRUE(AXR_SUCCEEDED(lowerScope.allocate(1, outTestData)));
+        ASSERT_TRUE(lowerScope.size() == testDataMemSize * 2);
+    }
+    ASSERT_TRUE(allocator.emptyLower());
+    ASSERT_TRUE(allocator.sizeUpper() == testDataMemSize);
+    ASSERT_TRUE(allocator.deallocateIfLastUpper(markerID));
+}
+
+TEST(DoubleStackAllocator, Scope_Nested) {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t testDataMemSize =
+        sizeof(TestData_Small) + alignof(TestData_Small) + AxrDoubleStackAllocator::getMarkerSize();
+    constexpr size_t allocatorSize = testDataMemSize * 2;
+    AxrDoubleStackAllocator allocator(AxrMemoryBlock{
+        .Memory = malloc(allocatorSize),
+        .Size = allocatorSize,
+        .Deallocator = callback,
+    });
+
+    auto callee = [](AxrDoubleStackAllocator::Scope& parentScope) {
+        AxrDoubleStackAllocator::Scope scope(parentScope.allocator(), parentScope.end());
+        TestData_Small* outTestData = nullptr;
+        ASSERT_TRUE(AXR_SUCCEEDED(scope.allocate(1, outTestData)));
+        ASSERT_TRUE(parentScope.allocator().sizeUpper() == testDataMemSize * 2);
+    };
+
+    AxrDoubleStackAllocator::Scope scope(allocator, AxrDoubleStackAllocator::End::Upper);
+    TestData_Small* outTestData = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(scope.allocate(1, outTestData)));
+
+    // The callee's memory gets reused on every call
+    for (uint32_t i = 0; i < 4; ++i) {
+        callee(scope);
+        ASSERT_TRUE(scope.size() == testDataMemSize);
+    }
+
+    scope.rewind();
+    ASSERT_TRUE(allocator.empty());
+}
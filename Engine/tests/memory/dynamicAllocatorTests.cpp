@@ -6,6 +6,10 @@
 #include "axr/common/defines.h"
 #include "memory/dynamicAllocator.h"
 
+#include <algorithm>
+#include <cstring>
+#include <random>
+
 // ----------------------------------------- //
 // Shared Structs
 // ----------------------------------------- //
@@ -32,11 +36,48 @@ namespace {
     };
 } // namespace
 
+namespace {
+    struct alignas(64) TestData_Aligned {
+        uint32_t ID{};
+    };
+} // namespace
+
+namespace {
+    struct MemoryPressureRecorder {
+        uint32_t HighCount{};
+        uint32_t CriticalCount{};
+        AxrMemoryPressureEvent LastEvent{};
+        AxrDynamicAllocator* Allocator{};
+        /// Deallocated on critical memory pressure, if set
+        AxrHandle<TestData_Small>* HandleToFree{};
+
+        void onMemoryPressure(const AxrMemoryPressureEvent& event) {
+            LastEvent = event;
+            if (event.Level == AXR_MEMORY_PRESSURE_LEVEL_HIGH) {
+                ++HighCount;
+                return;
+            }
+
+            ++CriticalCount;
+            if (HandleToFree != nullptr) {
+                Allocator->deallocate(*HandleToFree);
+            }
+        }
+    };
+} // namespace
+
 // ----------------------------------------- //
 // Shared Data
 // ----------------------------------------- //
 
-static AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node> HandlesAllocator;
+static AxrHandleTable HandleTable;
+
+constexpr size_t SmallBlockSize =
+    AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData_Small), alignof(TestData_Small));
+constexpr size_t LargeBlockSize =
+    AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData_Large), alignof(TestData_Large));
+/// The allocator aligns its memory block, which costs up to `alignof(void*)` bytes
+constexpr size_t AlignmentSpace = alignof(void*);
 
 // ----------------------------------------- //
 // Shared Functions
@@ -47,20 +88,19 @@ static void deallocateCallback(void*& memory) {
     memory = nullptr;
 };
 
-static void initializeHandlesAllocator(const uint32_t maxHandleCount) {
-    AxrDeallocateBlock handlesDeallocator;
-    handlesDeallocator.connect<deallocateCallback>();
+static void initializeHandleTable(const uint32_t maxHandleCount) {
+    AxrDeallocateBlock handleTableDeallocator;
+    handleTableDeallocator.connect<deallocateCallback>();
 
-    const size_t allocatorSize =
-        AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node>::getAllocatorSize(maxHandleCount);
+    const size_t allocatorSize = AxrHandleTable::getAllocatorSize(maxHandleCount);
 
     const AxrMemoryBlock memoryBlock{
         .Memory = malloc(allocatorSize),
         .Size = allocatorSize,
-        .Deallocator = handlesDeallocator,
+        .Deallocator = handleTableDeallocator,
     };
 
-    HandlesAllocator = AxrPoolAllocator<AxrDynamicAllocator::HandlesTree_T::Node>(memoryBlock);
+    HandleTable = AxrHandleTable(memoryBlock);
 }
 
 // ----------------------------------------- //
@@ -70,7 +110,7 @@ static void initializeHandlesAllocator(const uint32_t maxHandleCount) {
 TEST(DynamicAllocator, DeallocatorCallback) {
     bool wasDeallocated = false;
     {
-        initializeHandlesAllocator(16);
+        initializeHandleTable(16);
 
         auto deallocateCallback = [](bool* wasDeallocated, void*& memory) -> void {
             free(memory);
@@ -82,34 +122,33 @@ TEST(DynamicAllocator, DeallocatorCallback) {
         callback.connect<deallocateCallback>(&wasDeallocated);
 
         constexpr size_t allocatorSize = 128;
-        void* memory = malloc(allocatorSize);
+        void* memory = malloc(allocatorSize + AlignmentSpace);
         AxrDynamicAllocator allocator(
             AxrMemoryBlock{
                 .Memory = memory,
-                .Size = allocatorSize,
+                .Size = allocatorSize + AlignmentSpace,
                 .Deallocator = callback,
             },
-            &HandlesAllocator);
+            &HandleTable);
     }
     ASSERT_TRUE(wasDeallocated);
 }
 
 TEST(DynamicAllocator, Allocate_One) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t allocatorSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
-    void* memory = malloc(allocatorSize);
+    constexpr size_t allocatorSize = SmallBlockSize;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
             .Memory = memory,
-            .Size = allocatorSize,
+            .Size = allocatorSize + AlignmentSpace,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrHandle<TestData_Small> outTestDataHandle{};
     const AxrResult axrResult = allocator.allocate(1, outTestDataHandle, true);
@@ -129,23 +168,21 @@ TEST(DynamicAllocator, Allocate_One) {
 }
 
 TEST(DynamicAllocator, Allocate_Two) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
-    constexpr size_t testData1MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
-    constexpr size_t testData2MemSize =
-        sizeof(TestData_Large) + alignof(TestData_Large) + sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t testData1MemSize = SmallBlockSize;
+    constexpr size_t testData2MemSize = LargeBlockSize;
     constexpr size_t allocatorSize = testData1MemSize + testData2MemSize;
-    void* memory = malloc(allocatorSize);
+    void* memory = malloc(allocatorSize + AlignmentSpace);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
             .Memory = memory,
-            .Size = allocatorSize,
+            .Size = allocatorSize + AlignmentSpace,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrHandle<TestData_Small> outTestData1Handle{};
     AxrHandle<TestData_Large> outTestData2Handle{};
@@ -171,23 +208,22 @@ TEST(DynamicAllocator, Allocate_Two) {
 }
 
 TEST(DynamicAllocator, Allocate_TooMuch) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
     // Make sure there's enough space for 2 handles, just not enough for 2 blocks of memory
-    constexpr size_t testData1MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t testData1MemSize = SmallBlockSize;
     constexpr size_t allocatorSize = testData1MemSize;
-    void* memory = malloc(allocatorSize);
+    void* memory = malloc(allocatorSize + AlignmentSpace);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
             .Memory = memory,
-            .Size = allocatorSize,
+            .Size = allocatorSize + AlignmentSpace,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrHandle<TestData_Small> outTestData1Handle{};
     AxrResult axrResult = allocator.allocate(1, outTestData1Handle);
@@ -201,23 +237,22 @@ TEST(DynamicAllocator, Allocate_TooMuch) {
 }
 
 TEST(DynamicAllocator, Allocate_FailedToCreateHandle) {
-    initializeHandlesAllocator(1);
+    initializeHandleTable(1);
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t testData1MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t testData1MemSize = SmallBlockSize;
     // * 2 to make sure there is enough space for another block to be allocated, there's just not enough handles.
     constexpr size_t allocatorSize = (testData1MemSize * 2);
-    void* memory = malloc(allocatorSize);
+    void* memory = malloc(allocatorSize + AlignmentSpace);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
             .Memory = memory,
-            .Size = allocatorSize,
+            .Size = allocatorSize + AlignmentSpace,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrHandle<TestData_Small> outTestData1Handle{};
     AxrResult axrResult = allocator.allocate(1, outTestData1Handle);
@@ -231,24 +266,22 @@ TEST(DynamicAllocator, Allocate_FailedToCreateHandle) {
 }
 
 TEST(DynamicAllocator, AllocateTwo_DeallocateOne) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t testData1MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
-    constexpr size_t testData2MemSize =
-        sizeof(TestData_Large) + alignof(TestData_Large) + sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t testData1MemSize = SmallBlockSize;
+    constexpr size_t testData2MemSize = LargeBlockSize;
     constexpr size_t allocatorSize = testData1MemSize + testData2MemSize;
-    void* memory = malloc(allocatorSize);
+    void* memory = malloc(allocatorSize + AlignmentSpace);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
             .Memory = memory,
-            .Size = allocatorSize,
+            .Size = allocatorSize + AlignmentSpace,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrHandle<TestData_Small> outTestData1Handle{};
     AxrHandle<TestData_Large> outTestData2Handle{};
@@ -266,24 +299,22 @@ TEST(DynamicAllocator, AllocateTwo_DeallocateOne) {
 }
 
 TEST(DynamicAllocator, AutoDeallocate) {
-    initializeHandlesAllocator(2);
+    initializeHandleTable(2);
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t testData1MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
-    constexpr size_t testData2MemSize =
-        sizeof(TestData_Large) + alignof(TestData_Large) + sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t testData1MemSize = SmallBlockSize;
+    constexpr size_t testData2MemSize = LargeBlockSize;
     constexpr size_t allocatorSize = testData1MemSize + testData2MemSize;
-    void* memory = malloc(allocatorSize);
+    void* memory = malloc(allocatorSize + AlignmentSpace);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
             .Memory = memory,
-            .Size = allocatorSize,
+            .Size = allocatorSize + AlignmentSpace,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrHandle<TestData_Small> outTestData1Handle{};
     AxrResult axrResult = allocator.allocate(1, outTestData1Handle);
@@ -303,26 +334,23 @@ TEST(DynamicAllocator, AutoDeallocate) {
 }
 
 TEST(DynamicAllocator, Deallocate_CausingFragmentation) {
-    initializeHandlesAllocator(3);
+    initializeHandleTable(3);
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t testData1MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
-    constexpr size_t testData2MemSize =
-        sizeof(TestData_Large) + alignof(TestData_Large) + sizeof(AxrDynamicAllocator::DataHeader);
-    constexpr size_t testData3MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t testData1MemSize = SmallBlockSize;
+    constexpr size_t testData2MemSize = LargeBlockSize;
+    constexpr size_t testData3MemSize = SmallBlockSize;
     constexpr size_t allocatorSize = testData1MemSize + testData2MemSize + testData3MemSize;
-    void* memory = malloc(allocatorSize);
+    void* memory = malloc(allocatorSize + AlignmentSpace);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
             .Memory = memory,
-            .Size = allocatorSize,
+            .Size = allocatorSize + AlignmentSpace,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrHandle<TestData_Small> outTestData1Handle{};
     AxrResult axrResult = allocator.allocate(1, outTestData1Handle);
@@ -372,31 +400,26 @@ TEST(DynamicAllocator, Deallocate_CausingFragmentation) {
 // sure there isn't room at the end (after 5) for the new block. We're testing that blocks [ 2-3-4 ] join up to make
 // one big free space
 TEST(DynamicAllocator, Deallocate_CausingFragmentationAndMerging_ThenAllocate) {
-    initializeHandlesAllocator(5);
+    initializeHandleTable(5);
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t testData1MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
-    constexpr size_t testData2MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
-    constexpr size_t testData3MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
-    constexpr size_t testData4MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
-    constexpr size_t testData5MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t testData1MemSize = SmallBlockSize;
+    constexpr size_t testData2MemSize = SmallBlockSize;
+    constexpr size_t testData3MemSize = SmallBlockSize;
+    constexpr size_t testData4MemSize = SmallBlockSize;
+    constexpr size_t testData5MemSize = SmallBlockSize;
     constexpr size_t allocatorSize =
         testData1MemSize + testData2MemSize + testData3MemSize + testData4MemSize + testData5MemSize;
-    void* memory = malloc(allocatorSize);
+    void* memory = malloc(allocatorSize + AlignmentSpace);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
             .Memory = memory,
-            .Size = allocatorSize,
+            .Size = allocatorSize + AlignmentSpace,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrHandle<TestData_Small> outTestData1Handle{};
     AxrResult axrResult = allocator.allocate(1, outTestData1Handle);
@@ -469,8 +492,7 @@ TEST(DynamicAllocator, Deallocate_CausingFragmentationAndMerging_ThenAllocate) {
     // To make sure slot 2, 3 and 4 combine to make one free block, we allocate a large block that wouldn't fit anywhere
     // unless they combined
 
-    constexpr size_t testDataLargeMemSize =
-        sizeof(TestData_Large) + alignof(TestData_Large) + sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t testDataLargeMemSize = LargeBlockSize;
 
     AxrHandle<TestData_Large> outTestDataLargeHandle{};
     axrResult = allocator.allocate(1, outTestDataLargeHandle);
@@ -491,31 +513,26 @@ TEST(DynamicAllocator, Deallocate_CausingFragmentationAndMerging_ThenAllocate) {
 }
 
 TEST(DynamicAllocator, Defragmentation) {
-    initializeHandlesAllocator(5);
+    initializeHandleTable(5);
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t testData1MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
-    constexpr size_t testData2MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
-    constexpr size_t testData3MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
-    constexpr size_t testData4MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
-    constexpr size_t testData5MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t testData1MemSize = SmallBlockSize;
+    constexpr size_t testData2MemSize = SmallBlockSize;
+    constexpr size_t testData3MemSize = SmallBlockSize;
+    constexpr size_t testData4MemSize = SmallBlockSize;
+    constexpr size_t testData5MemSize = SmallBlockSize;
     constexpr size_t allocatorSize =
         testData1MemSize + testData2MemSize + testData3MemSize + testData4MemSize + testData5MemSize;
-    void* memory = malloc(allocatorSize);
+    void* memory = malloc(allocatorSize + AlignmentSpace);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
             .Memory = memory,
-            .Size = allocatorSize,
+            .Size = allocatorSize + AlignmentSpace,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrHandle<TestData_Small> outTestData1Handle{};
     AxrResult axrResult = allocator.allocate(1, outTestData1Handle);
@@ -601,8 +618,7 @@ TEST(DynamicAllocator, Defragmentation) {
     // To make sure slots 1, 3 and 5 combine to make one free block, we allocate a large block that wouldn't fit
     // anywhere unless they combined
 
-    constexpr size_t testDataLargeMemSize =
-        sizeof(TestData_Large) + alignof(TestData_Large) + sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t testDataLargeMemSize = LargeBlockSize;
 
     AxrHandle<TestData_Large> outTestDataLargeHandle{};
     axrResult = allocator.allocate(1, outTestDataLargeHandle);
@@ -624,31 +640,26 @@ TEST(DynamicAllocator, Defragmentation) {
 
 /// Test allocating when there is enough memory, it's just defragmented. so we need to defragment during the allocation
 TEST(DynamicAllocator, Allocate_RequiresDefragmentation) {
-    initializeHandlesAllocator(5);
+    initializeHandleTable(5);
 
     AxrDeallocateBlock callback;
     callback.connect<deallocateCallback>();
 
-    constexpr size_t testData1MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
-    constexpr size_t testData2MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
-    constexpr size_t testData3MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
-    constexpr size_t testData4MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
-    constexpr size_t testData5MemSize =
-        sizeof(TestData_Small) + alignof(TestData_Small) + sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t testData1MemSize = SmallBlockSize;
+    constexpr size_t testData2MemSize = SmallBlockSize;
+    constexpr size_t testData3MemSize = SmallBlockSize;
+    constexpr size_t testData4MemSize = SmallBlockSize;
+    constexpr size_t testData5MemSize = SmallBlockSize;
     constexpr size_t allocatorSize =
         testData1MemSize + testData2MemSize + testData3MemSize + testData4MemSize + testData5MemSize;
-    void* memory = malloc(allocatorSize);
+    void* memory = malloc(allocatorSize + AlignmentSpace);
     AxrDynamicAllocator allocator(
         AxrMemoryBlock{
             .Memory = memory,
-            .Size = allocatorSize,
+            .Size = allocatorSize + AlignmentSpace,
             .Deallocator = callback,
         },
-        &HandlesAllocator);
+        &HandleTable);
 
     AxrHandle<TestData_Small> outTestData1Handle{};
     AxrResult axrResult = allocator.allocate(1, outTestData1Handle);
@@ -730,8 +741,7 @@ TEST(DynamicAllocator, Allocate_RequiresDefragmentation) {
     // To make sure slots 1, 3 and 5 combine to make one free block, we allocate a large block that wouldn't fit
     // anywhere unless they combined
 
-    constexpr size_t testDataLargeMemSize =
-        sizeof(TestData_Large) + alignof(TestData_Large) + sizeof(AxrDynamicAllocator::DataHeader);
+    constexpr size_t testDataLargeMemSize = LargeBlockSize;
 
     AxrHandle<TestData_Large> outTestDataLargeHandle{};
     axrResult = allocator.allocate(1, outTestDataLargeHandle);
@@ -747,6 +757,859 @@ TEST(DynamicAllocator, Allocate_RequiresDefragmentation) {
     ASSERT_TRUE(*outTestData4Handle == exampleTestData4);
     ASSERT_TRUE(*outTestDataLargeHandle == exampleTestDataLarge);
 
+    // Only slots 1 and 3 get merged to make room for the large block. The space left over after the large block is too
+    // small to fit a free block header, so the large block takes all of it.
+    ASSERT_TRUE(testData1MemSize + testData3MemSize - testDataLargeMemSize < SmallBlockSize);
+    ASSERT_TRUE(allocator.size() == allocatorSize - testData5MemSize);
+}
+
+/// Test that the smallest free block which fits is used, instead of the first free block which fits
+TEST(DynamicAllocator, Allocate_BestFit) {
+    initializeHandleTable(4);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t testDataLargeMemSize = LargeBlockSize;
+    constexpr size_t testDataSmallMemSize = SmallBlockSize;
+    constexpr size_t allocatorSize = testDataLargeMemSize + (testDataSmallMemSize * 3);
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    // [ Large1 ][ Small2 ][ Small3 ][ Small4 ]
+    AxrHandle<TestData_Large> outTestData1Handle{};
+    AxrResult axrResult = allocator.allocate(1, outTestData1Handle);
+    ASSERT_TRUE(AXR_SUCCEEDED(axrResult));
+
+    AxrHandle<TestData_Small> outTestData2Handle{};
+    axrResult = allocator.allocate(1, outTestData2Handle);
+    ASSERT_TRUE(AXR_SUCCEEDED(axrResult));
+
+    AxrHandle<TestData_Small> outTestData3Handle{};
+    axrResult = allocator.allocate(1, outTestData3Handle);
+    ASSERT_TRUE(AXR_SUCCEEDED(axrResult));
+
+    AxrHandle<TestData_Small> outTestData4Handle{};
+    axrResult = allocator.allocate(1, outTestData4Handle);
+    ASSERT_TRUE(AXR_SUCCEEDED(axrResult));
+
+    ASSERT_TRUE(allocator.size() == allocatorSize);
+
+    constexpr TestData_Small exampleTestData2{
+        .ID = 76,
+        .Data = {7, 12, 90, 51, 23, 65, 1},
+    };
+    *outTestData2Handle = exampleTestData2;
+
+    constexpr TestData_Small exampleTestData4{
+        .ID = 9,
+        .Data = {1, 1, 6, 6, 6, 4, 8},
+    };
+    *outTestData4Handle = exampleTestData4;
+
+    // [ -Free- ][ Small2 ][ Free ][ Small4 ]
+    const void* smallSlotAddress = outTestData3Handle.getDataPtr();
+    allocator.deallocate(outTestData1Handle);
+    allocator.deallocate(outTestData3Handle);
+
+    // The small block should go into the small gap, even though the large gap has a lower address
+    AxrHandle<TestData_Small> outTestDataSmallHandle{};
+    axrResult = allocator.allocate(1, outTestDataSmallHandle);
+    ASSERT_TRUE(AXR_SUCCEEDED(axrResult));
+    ASSERT_TRUE(outTestDataSmallHandle.getDataPtr() == smallSlotAddress);
+
+    // Which leaves the large gap free for a large block, without needing to defragment
+    AxrHandle<TestData_Large> outTestDataLargeHandle{};
+    axrResult = allocator.allocate(1, outTestDataLargeHandle);
+    ASSERT_TRUE(AXR_SUCCEEDED(axrResult));
+
+    ASSERT_TRUE(*outTestData2Handle == exampleTestData2);
+    ASSERT_TRUE(*outTestData4Handle == exampleTestData4);
+    ASSERT_TRUE(allocator.size() == allocatorSize);
+}
+
+TEST(DynamicAllocator, FreeBlockTrees_RandomOperations) {
+    constexpr uint32_t slotCount = 128;
+    initializeHandleTable(slotCount);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    // Small enough that the allocator regularly fills up and has to defragment
+    constexpr size_t allocatorSize = 16'384;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    constexpr uint8_t alignments[]{1, 4, 8, 16, 64};
+    AxrHandle<void> handles[slotCount]{};
+    size_t sizes[slotCount]{};
+    uint8_t slotAlignments[slotCount]{};
+    uint8_t fillValues[slotCount]{};
+    bool isPinned[slotCount]{};
+
+    const auto hasData = [&](const uint32_t slot, const size_t size) -> bool {
+        const auto* data = static_cast<const uint8_t*>(handles[slot].getDataPtr());
+        return reinterpret_cast<uintptr_t>(data) % slotAlignments[slot] == 0 &&
+               std::all_of(data, data + size, [&](const uint8_t value) { return value == fillValues[slot]; });
+    };
+    const auto fillData = [&](const uint32_t slot) {
+        fillValues[slot] = static_cast<uint8_t>(slot + fillValues[slot] + 1);
+        std::memset(handles[slot].getDataPtr(), fillValues[slot], sizes[slot]);
+    };
+
+    // Fixed seed so any failure can be reproduced
+    std::mt19937 random(7);
+    for (uint32_t step = 0; step < 4'000; ++step) {
+        const uint32_t slot = random() % slotCount;
+        const uint32_t action = random() % 10;
+
+        if (handles[slot].getDataPtr() == nullptr) {
+            const size_t size = 1 + random() % 192;
+            const uint8_t alignment = alignments[random() % std::size(alignments)];
+            // Only allocate when it can fit, so the test isn't flooded with out of memory errors
+            if (AxrDynamicAllocator::getRequiredBlockSize(size, alignment) <= allocator.capacity() - allocator.size()) {
+                const AxrResult axrResult = action == 0
+                                                ? allocator.allocatePinnedBlock(size, alignment, handles[slot])
+                                                : allocator.allocateBlock(size, alignment, handles[slot]);
+                if (AXR_SUCCEEDED(axrResult)) {
+                    sizes[slot] = size;
+                    slotAlignments[slot] = alignment;
+                    isPinned[slot] = action == 0;
+                    fillData(slot);
+                }
+            }
+        } else if (action < 5) {
+            ASSERT_TRUE(hasData(slot, sizes[slot]));
+            allocator.deallocateHandle(handles[slot]);
+            ASSERT_TRUE(handles[slot].getDataPtr() == nullptr);
+        } else if (action < 8) {
+            const size_t size = 1 + random() % 192;
+            const size_t growSize = size > sizes[slot] ? size - sizes[slot] : 0;
+            if (AxrDynamicAllocator::getRequiredBlockSize(growSize, slotAlignments[slot]) <=
+                allocator.capacity() - allocator.size()) {
+                if (AXR_SUCCEEDED(allocator.reallocateBlock(size, slotAlignments[slot], handles[slot]))) {
+                    ASSERT_TRUE(hasData(slot, std::min(size, sizes[slot])));
+                    sizes[slot] = size;
+                    fillData(slot);
+                }
+            }
+        } else if (action == 8) {
+            if (isPinned[slot]) {
+                allocator.unpinHandle(handles[slot]);
+            } else {
+                ASSERT_TRUE(AXR_SUCCEEDED(allocator.pinHandle(handles[slot])));
+            }
+            isPinned[slot] = !isPinned[slot];
+        } else {
+            allocator.defragment(1);
+        }
+
+        ASSERT_TRUE(allocator.validateFreeBlockTrees());
+    }
+
+    for (uint32_t slot = 0; slot < slotCount; ++slot) {
+        if (handles[slot].getDataPtr() != nullptr) {
+            ASSERT_TRUE(hasData(slot, sizes[slot]));
+        }
+    }
+
+    // Everything coalesces back into a single free block
+    allocator.deallocateHandleBatch(handles, slotCount);
+    ASSERT_TRUE(allocator.empty());
+    ASSERT_TRUE(allocator.validateFreeBlockTrees());
+}
+
+TEST(DynamicAllocator, Defragment_Budget) {
+    initializeHandleTable(5);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t testDataMemSize = SmallBlockSize;
+    constexpr size_t allocatorSize = testDataMemSize * 5;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    AxrHandle<TestData_Small> outTestData1Handle{};
+    AxrHandle<TestData_Small> outTestData2Handle{};
+    AxrHandle<TestData_Small> outTestData3Handle{};
+    AxrHandle<TestData_Small> outTestData4Handle{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData1Handle)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData2Handle)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData3Handle)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData4Handle)));
+    AxrHandle<TestData_Small> outTestData5Handle{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData5Handle)));
+
+    constexpr TestData_Small exampleTestData2{
+        .ID = 76,
+        .Data = {7, 12, 90, 51, 23, 65, 1},
+    };
+    constexpr TestData_Small exampleTestData4{
+        .ID = 9,
+        .Data = {1, 1, 6, 6, 6, 4, 8},
+    };
+    *outTestData2Handle = exampleTestData2;
+    *outTestData4Handle = exampleTestData4;
+
+    // [ Free ][ 2 ][ Free ][ 4 ][ Free ]
+    allocator.deallocate(outTestData1Handle);
+    allocator.deallocate(outTestData3Handle);
+    allocator.deallocate(outTestData5Handle);
+    ASSERT_TRUE(allocator.getFragmentationRatio() ==
+                1.0f - static_cast<float>(testDataMemSize) / static_cast<float>(testDataMemSize * 3));
+
+    // A budget of a single byte still moves one block. [ 2 ][ Free ][ Free ][ 4 ][ Free ]
+    AxrDynamicAllocator::DefragmentProgress progress = allocator.defragment(AxrDynamicAllocator::DefragmentBudget{
+        .MaxMicroseconds = 0,
+        .MaxBytes = 1,
+    });
+    ASSERT_TRUE(progress.BlocksMoved == 1);
+    ASSERT_TRUE(progress.BytesMoved == testDataMemSize);
+    ASSERT_FALSE(progress.IsComplete);
+    ASSERT_TRUE(progress.FragmentationRatio ==
+                1.0f - static_cast<float>(testDataMemSize * 2) / static_cast<float>(testDataMemSize * 3));
+    ASSERT_TRUE(*outTestData2Handle == exampleTestData2);
+
+    // No limits, so keep going until there's nothing left to defragment
+    progress = allocator.defragment(AxrDynamicAllocator::DefragmentBudget{
+        .MaxMicroseconds = 0,
+        .MaxBytes = 0,
+    });
+    ASSERT_TRUE(progress.BlocksMoved == 1);
+    ASSERT_TRUE(progress.IsComplete);
+    ASSERT_TRUE(progress.FragmentationRatio == 0.0f);
+    ASSERT_TRUE(*outTestData2Handle == exampleTestData2);
+    ASSERT_TRUE(*outTestData4Handle == exampleTestData4);
+
+    // Nothing left to do
+    progress = allocator.defragment(AxrDynamicAllocator::DefragmentBudget{
+        .MaxMicroseconds = 100,
+        .MaxBytes = 0,
+    });
+    ASSERT_TRUE(progress.BlocksMoved == 0);
+    ASSERT_TRUE(progress.IsComplete);
+
+    // The moved blocks must still deallocate cleanly
+    allocator.deallocate(outTestData2Handle);
+    allocator.deallocate(outTestData4Handle);
+    ASSERT_TRUE(allocator.empty());
+}
+
+TEST(DynamicAllocator, Reallocate_GrowInPlace) {
+    initializeHandleTable(1);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t allocatorSize = 1024;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    AxrHandle<TestData_Small> outTestDataHandle{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestDataHandle)));
+
+    constexpr TestData_Small exampleTestData{
+        .ID = 3,
+        .Data = {5, 2, 8, 1, 9, 3, 7},
+    };
+    *outTestDataHandle = exampleTestData;
+    const TestData_Small* originalData = outTestDataHandle.getDataPtr();
+
+    // The rest of the allocator is free, so the block can grow without moving
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.reallocate(4, outTestDataHandle, true)));
+    ASSERT_TRUE(outTestDataHandle.getDataPtr() == originalData);
+    ASSERT_TRUE(outTestDataHandle[0] == exampleTestData);
+    ASSERT_TRUE(outTestDataHandle[1] == TestData_Small{});
+    ASSERT_TRUE(outTestDataHandle[3] == TestData_Small{});
     ASSERT_TRUE(allocator.size() ==
-                allocatorSize - testData1MemSize - testData3MemSize - testData5MemSize + testDataLargeMemSize);
+                AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData_Small) * 4, alignof(TestData_Small)));
+}
+
+TEST(DynamicAllocator, Reallocate_ShrinkInPlace) {
+    initializeHandleTable(3);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t testData1MemSize =
+        AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData_Small) * 4, alignof(TestData_Small));
+    constexpr size_t testData2MemSize = SmallBlockSize;
+    constexpr size_t allocatorSize = testData1MemSize + testData2MemSize;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    AxrHandle<TestData_Small> outTestData1Handle{};
+    AxrHandle<TestData_Small> outTestData2Handle{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(4, outTestData1Handle)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData2Handle)));
+
+    constexpr TestData_Small exampleTestData{
+        .ID = 3,
+        .Data = {5, 2, 8, 1, 9, 3, 7},
+    };
+    outTestData1Handle[0] = exampleTestData;
+    const TestData_Small* originalData = outTestData1Handle.getDataPtr();
+
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.reallocate(1, outTestData1Handle)));
+    ASSERT_TRUE(outTestData1Handle.getDataPtr() == originalData);
+    ASSERT_TRUE(*outTestData1Handle == exampleTestData);
+    ASSERT_TRUE(allocator.size() == testData2MemSize * 2);
+
+    // The space freed by shrinking can be used straight away
+    AxrHandle<TestData_Small> outTestData3Handle{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(2, outTestData3Handle)));
+    ASSERT_TRUE(*outTestData1Handle == exampleTestData);
+}
+
+TEST(DynamicAllocator, Reallocate_Move) {
+    initializeHandleTable(3);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t allocatorSize = 1024;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    AxrHandle<TestData_Small> outTestData1Handle{};
+    AxrHandle<TestData_Small> outTestData2Handle{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData1Handle)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData2Handle)));
+
+    constexpr TestData_Small exampleTestData{
+        .ID = 3,
+        .Data = {5, 2, 8, 1, 9, 3, 7},
+    };
+    *outTestData1Handle = exampleTestData;
+    const TestData_Small* originalData = outTestData1Handle.getDataPtr();
+
+    // Block 2 is in the way, so block 1 can't grow in place
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.reallocate(4, outTestData1Handle)));
+    ASSERT_TRUE(outTestData1Handle.getDataPtr() != originalData);
+    ASSERT_TRUE(outTestData1Handle[0] == exampleTestData);
+    ASSERT_TRUE(allocator.size() ==
+                AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData_Small) * 4, alignof(TestData_Small)) +
+                    SmallBlockSize);
+}
+
+TEST(DynamicAllocator, AllocateBatch_Contiguous) {
+    initializeHandleTable(4);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t allocatorSize = 1024;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    AxrHandle<TestData_Small> outTestDataHandles[4]{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBatch(1, outTestDataHandles, 4, true)));
+
+    constexpr size_t blockSize = SmallBlockSize;
+    for (uint32_t i = 0; i < 4; ++i) {
+        ASSERT_TRUE(*outTestDataHandles[i] == TestData_Small{});
+        outTestDataHandles[i]->ID = i + 1;
+    }
+    // The blocks are carved out one after the other
+    for (uint32_t i = 1; i < 4; ++i) {
+        ASSERT_TRUE(reinterpret_cast<uintptr_t>(outTestDataHandles[i].getDataPtr()) -
+                        reinterpret_cast<uintptr_t>(outTestDataHandles[i - 1].getDataPtr()) ==
+                    blockSize);
+        ASSERT_TRUE(outTestDataHandles[i]->ID == i + 1);
+    }
+    ASSERT_TRUE(allocator.size() == blockSize * 4);
+
+    // Each block can still be deallocated on its own
+    allocator.deallocate(outTestDataHandles[1]);
+    ASSERT_TRUE(allocator.size() == blockSize * 3);
+
+    allocator.deallocateBatch(outTestDataHandles, 4);
+    ASSERT_TRUE(allocator.empty());
+    ASSERT_TRUE(allocator.size() == 0);
+    ASSERT_TRUE(allocator.getFragmentationRatio() == 0.0f);
+}
+
+TEST(DynamicAllocator, AllocateBatch_DifferentSizes) {
+    initializeHandleTable(3);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t allocatorSize = 1024;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    constexpr size_t sizes[3]{sizeof(TestData_Small), sizeof(TestData_Large), sizeof(TestData_Small) * 2};
+    AxrHandle<void> outHandles[3]{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlockBatch(sizes, alignof(TestData_Small), outHandles, 3)));
+    ASSERT_TRUE(allocator.size() == AxrDynamicAllocator::getRequiredBlockSize(sizes[0], alignof(TestData_Small)) +
+                                        AxrDynamicAllocator::getRequiredBlockSize(sizes[1], alignof(TestData_Small)) +
+                                        AxrDynamicAllocator::getRequiredBlockSize(sizes[2], alignof(TestData_Small)));
+
+    allocator.deallocateHandleBatch(outHandles, 3);
+    ASSERT_TRUE(allocator.empty());
+}
+
+TEST(DynamicAllocator, AllocateBatch_NotEnoughHandles) {
+    initializeHandleTable(2);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t allocatorSize = 1024;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    AxrHandle<TestData_Small> outTestDataHandles[3]{};
+    ASSERT_TRUE(allocator.allocateBatch(1, outTestDataHandles, 3) == AXR_ERROR_OUT_OF_MEMORY);
+    ASSERT_TRUE(allocator.empty());
+    ASSERT_TRUE(outTestDataHandles[0].getDataPtr() == nullptr);
+}
+
+TEST(DynamicAllocator, Allocate_HeadersAligned) {
+    initializeHandleTable(3);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t allocatorSize = 1024;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    ASSERT_TRUE(sizeof(AxrDynamicAllocator::DataHeader) == AxrDynamicAllocator::BlockAlignment);
+
+    // Odd sizes with no alignment requirements still keep every header, and the data after it, aligned
+    constexpr size_t sizes[3]{1, 3, 77};
+    AxrHandle<uint8_t> outHandles[3]{};
+    for (uint32_t i = 0; i < 3; ++i) {
+        ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(sizes[i], outHandles[i])));
+        ASSERT_TRUE(reinterpret_cast<uintptr_t>(outHandles[i].getDataPtr()) % AxrDynamicAllocator::BlockAlignment ==
+                    0);
+    }
+
+    // No alignment padding is needed, so each block is only as big as its header and data
+    ASSERT_TRUE(allocator.size() == AxrDynamicAllocator::getRequiredBlockSize(sizes[0], 1) +
+                                        AxrDynamicAllocator::getRequiredBlockSize(sizes[1], 1) +
+                                        AxrDynamicAllocator::getRequiredBlockSize(sizes[2], 1));
+
+    allocator.deallocateBatch(outHandles, 3);
+    ASSERT_TRUE(allocator.empty());
+}
+
+TEST(DynamicAllocator, Allocate_MinBlockSize) {
+    initializeHandleTable(3);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t allocatorSize = 1024;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    // Every block has to fit a free block header once it's freed, so small data rounds up to 32 byte blocks
+    ASSERT_TRUE(AxrDynamicAllocator::getRequiredBlockSize(sizeof(uint8_t), alignof(uint8_t)) == 32);
+    ASSERT_TRUE(AxrDynamicAllocator::getRequiredBlockSize(sizeof(uint64_t), alignof(uint64_t)) == 32);
+    ASSERT_TRUE(AxrDynamicAllocator::getRequiredBlockSize(sizeof(uint64_t) * 3, alignof(uint64_t)) == 32);
+    ASSERT_TRUE(AxrDynamicAllocator::getRequiredBlockSize(sizeof(uint64_t) * 4, alignof(uint64_t)) == 40);
+
+    AxrHandle<uint64_t> outHandles[3]{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outHandles[0])));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(3, outHandles[1])));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(4, outHandles[2])));
+    ASSERT_TRUE(allocator.size() == 32 + 32 + 40);
+
+    // Freeing the smallest block in between two data blocks still leaves room for its free block header
+    allocator.deallocate(outHandles[1]);
+    ASSERT_TRUE(allocator.size() == 32 + 40);
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(2, outHandles[1])));
+    ASSERT_TRUE(allocator.size() == 32 + 32 + 40);
+
+    allocator.deallocateBatch(outHandles, 3);
+    ASSERT_TRUE(allocator.empty());
+}
+
+TEST(DynamicAllocator, Defragment_OverAligned) {
+    initializeHandleTable(4);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t allocatorSize = 1024;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    AxrHandle<TestData_Small> outTestData1Handle{};
+    AxrHandle<TestData_Aligned> outTestData2Handle{};
+    AxrHandle<TestData_Small> outTestData3Handle{};
+    AxrHandle<TestData_Aligned> outTestData4Handle{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData1Handle)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData2Handle)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData3Handle)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData4Handle)));
+
+    outTestData2Handle->ID = 2;
+    outTestData3Handle->ID = 3;
+    outTestData4Handle->ID = 4;
+
+    // Over aligned blocks only take as much padding as their address needs
+    ASSERT_TRUE(allocator.size() <=
+                SmallBlockSize * 2 +
+                    AxrDynamicAllocator::getRequiredBlockSize(sizeof(TestData_Aligned), alignof(TestData_Aligned)) * 2);
+
+    allocator.deallocate(outTestData1Handle);
+
+    const AxrDynamicAllocator::DefragmentProgress progress = allocator.defragment(
+        AxrDynamicAllocator::DefragmentBudget{
+            .MaxMicroseconds = 0,
+            .MaxBytes = 0,
+        });
+    ASSERT_TRUE(progress.IsComplete);
+
+    // The data is still aligned after being moved
+    ASSERT_TRUE(reinterpret_cast<uintptr_t>(outTestData2Handle.getDataPtr()) % alignof(TestData_Aligned) == 0);
+    ASSERT_TRUE(reinterpret_cast<uintptr_t>(outTestData4Handle.getDataPtr()) % alignof(TestData_Aligned) == 0);
+    ASSERT_TRUE(outTestData2Handle->ID == 2);
+    ASSERT_TRUE(outTestData3Handle->ID == 3);
+    ASSERT_TRUE(outTestData4Handle->ID == 4);
+
+    allocator.deallocate(outTestData2Handle);
+    allocator.deallocate(outTestData3Handle);
+    allocator.deallocate(outTestData4Handle);
+    ASSERT_TRUE(allocator.empty());
+    ASSERT_TRUE(allocator.size() == 0);
+}
+
+TEST(DynamicAllocator, Pin_DefragmentSkipsPinnedBlocks) {
+    initializeHandleTable(4);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t allocatorSize = SmallBlockSize * 5;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    // [ Small1 ][ Small2 (Pinned) ][ Small3 ][ Small4 ][ Free ]
+    AxrHandle<TestData_Small> outHandles[4]{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBatch(1, outHandles, 4)));
+    for (uint32_t i = 0; i < 4; ++i) {
+        outHandles[i]->ID = i;
+    }
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.pin(outHandles[1])));
+    const TestData_Small* pinnedData = outHandles[1].getDataPtr();
+    const TestData_Small* movableData = outHandles[3].getDataPtr();
+
+    // [ Free ][ Small2 (Pinned) ][ Free ][ Small4 ][ Free ]
+    allocator.deallocate(outHandles[0]);
+    allocator.deallocate(outHandles[2]);
+
+    const AxrDynamicAllocator::DefragmentProgress progress = allocator.defragment(
+        AxrDynamicAllocator::DefragmentBudget{
+            .MaxMicroseconds = 0,
+            .MaxBytes = 0,
+        });
+    // The gap before the pinned block can never be closed, so that's as good as it gets
+    ASSERT_TRUE(progress.BlocksMoved == 1);
+    ASSERT_TRUE(progress.IsComplete);
+    ASSERT_TRUE(outHandles[1].getDataPtr() == pinnedData);
+    ASSERT_TRUE(outHandles[3].getDataPtr() != movableData);
+    ASSERT_TRUE(outHandles[1]->ID == 1);
+    ASSERT_TRUE(outHandles[3]->ID == 3);
+
+    // Once unpinned, it can be moved again
+    allocator.unpin(outHandles[1]);
+    allocator.defragment(2);
+    ASSERT_TRUE(outHandles[1].getDataPtr() != pinnedData);
+    ASSERT_TRUE(outHandles[1]->ID == 1);
+    ASSERT_TRUE(outHandles[3]->ID == 3);
+}
+
+TEST(DynamicAllocator, Pin_StaleHandle) {
+    initializeHandleTable(1);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t allocatorSize = SmallBlockSize;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    AxrHandle<TestData_Small> outTestDataHandle{};
+    ASSERT_TRUE(allocator.pin(outTestDataHandle) == AXR_ERROR_VALIDATION_FAILED);
+}
+
+TEST(DynamicAllocator, AllocatePinned_PlacedAtTop) {
+    initializeHandleTable(3);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t allocatorSize = 1024;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    AxrHandle<TestData_Small> outTestData1Handle{};
+    AxrHandle<TestData_Aligned> outTestData2Handle{};
+    AxrHandle<TestData_Small> outTestData3Handle{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData1Handle)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocatePinned(1, outTestData2Handle, true)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData3Handle)));
+
+    // Pinned data goes as high up as it can, out of the way of everything else
+    const auto pinnedAddress = reinterpret_cast<uintptr_t>(outTestData2Handle.getDataPtr());
+    ASSERT_TRUE(pinnedAddress % alignof(TestData_Aligned) == 0);
+    ASSERT_TRUE(pinnedAddress > reinterpret_cast<uintptr_t>(outTestData3Handle.getDataPtr()));
+    ASSERT_TRUE(pinnedAddress + sizeof(TestData_Aligned) >
+                reinterpret_cast<uintptr_t>(outTestData1Handle.getDataPtr()) + allocatorSize -
+                    alignof(TestData_Aligned) - SmallBlockSize);
+    ASSERT_TRUE(outTestData2Handle->ID == 0);
+
+    // Growing a pinned block that can't grow in place moves it, but it stays pinned
+    allocator.deallocate(outTestData1Handle);
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.reallocate(4, outTestData2Handle)));
+    const TestData_Aligned* pinnedData = outTestData2Handle.getDataPtr();
+    allocator.defragment(4);
+    ASSERT_TRUE(outTestData2Handle.getDataPtr() == pinnedData);
+
+    allocator.deallocate(outTestData2Handle);
+    allocator.deallocate(outTestData3Handle);
+    ASSERT_TRUE(allocator.empty());
+}
+
+TEST(DynamicAllocator, LockRelocation) {
+    initializeHandleTable(4);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t allocatorSize = SmallBlockSize * 3;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    // [ Free ][ Small2 ][ Free ]
+    AxrHandle<TestData_Small> outHandles[3]{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBatch(1, outHandles, 3)));
+    allocator.deallocate(outHandles[0]);
+    allocator.deallocate(outHandles[2]);
+    const TestData_Small* data = outHandles[1].getDataPtr();
+
+    allocator.lockRelocation();
+    allocator.lockRelocation();
+    ASSERT_TRUE(allocator.isRelocationLocked());
+
+    const AxrDynamicAllocator::DefragmentProgress progress = allocator.defragment(
+        AxrDynamicAllocator::DefragmentBudget{
+            .MaxMicroseconds = 0,
+            .MaxBytes = 0,
+        });
+    ASSERT_TRUE(progress.BlocksMoved == 0);
+    ASSERT_FALSE(progress.IsComplete);
+
+    // Allocations that need to defragment to fit fail instead
+    AxrHandle<TestData_Small> outTestDataHandle{};
+    ASSERT_TRUE(allocator.allocate(2, outTestDataHandle) == AXR_ERROR_OUT_OF_MEMORY);
+    ASSERT_TRUE(outHandles[1].getDataPtr() == data);
+
+    // Locks nest
+    allocator.unlockRelocation();
+    ASSERT_TRUE(allocator.isRelocationLocked());
+    allocator.unlockRelocation();
+    ASSERT_FALSE(allocator.isRelocationLocked());
+
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(2, outTestDataHandle)));
+    ASSERT_TRUE(outHandles[1].getDataPtr() != data);
+}
+
+TEST(DynamicAllocator, MemoryPressure_HighWaterMark) {
+    initializeHandleTable(4);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t allocatorSize = SmallBlockSize * 4;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    MemoryPressureRecorder recorder;
+    AxrMemoryPressureCallback memoryPressureCallback;
+    memoryPressureCallback.connect<&MemoryPressureRecorder::onMemoryPressure>(recorder);
+    AxrMemoryPressureMonitor& monitor = allocator.getMemoryPressureMonitor();
+    monitor.setHighWaterMark(SmallBlockSize * 2);
+    ASSERT_TRUE(AXR_SUCCEEDED(monitor.addCallback(memoryPressureCallback)));
+    ASSERT_TRUE(monitor.addCallback(memoryPressureCallback) == AXR_ERROR_DUPLICATE);
+
+    AxrHandle<TestData_Small> outHandles[3]{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outHandles[0])));
+    ASSERT_TRUE(recorder.HighCount == 0);
+
+    // Crossing the high water mark notifies once
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outHandles[1])));
+    ASSERT_TRUE(recorder.HighCount == 1);
+    ASSERT_TRUE(recorder.LastEvent.Level == AXR_MEMORY_PRESSURE_LEVEL_HIGH);
+    ASSERT_TRUE(recorder.LastEvent.Size == SmallBlockSize * 2);
+    ASSERT_TRUE(recorder.LastEvent.Capacity == allocator.capacity());
+    ASSERT_TRUE(recorder.LastEvent.HighWaterMark == SmallBlockSize * 2);
+    ASSERT_TRUE(recorder.LastEvent.RequestedSize == sizeof(TestData_Small));
+
+    // Staying above it doesn't
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outHandles[2])));
+    ASSERT_TRUE(recorder.HighCount == 1);
+
+    // Dropping below it and crossing it again does
+    allocator.deallocate(outHandles[1]);
+    allocator.deallocate(outHandles[2]);
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outHandles[1])));
+    ASSERT_TRUE(recorder.HighCount == 2);
+
+    monitor.removeCallback(memoryPressureCallback);
+    ASSERT_TRUE(monitor.callbackCount() == 0);
+    allocator.deallocate(outHandles[1]);
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outHandles[1])));
+    ASSERT_TRUE(recorder.HighCount == 2);
+
+    allocator.deallocate(outHandles[0]);
+    allocator.deallocate(outHandles[1]);
+}
+
+TEST(DynamicAllocator, MemoryPressure_Critical) {
+    initializeHandleTable(3);
+
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t allocatorSize = SmallBlockSize * 2;
+    void* memory = malloc(allocatorSize + AlignmentSpace);
+    AxrDynamicAllocator allocator(
+        AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize + AlignmentSpace,
+            .Deallocator = callback,
+        },
+        &HandleTable);
+
+    AxrHandle<TestData_Small> outHandles[3]{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outHandles[0])));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outHandles[1])));
+    ASSERT_TRUE(allocator.allocate(1, outHandles[2]) == AXR_ERROR_OUT_OF_MEMORY);
+
+    // Freeing memory on critical memory pressure lets the allocation go through
+    MemoryPressureRecorder recorder{
+        .Allocator = &allocator,
+        .HandleToFree = &outHandles[0],
+    };
+    AxrMemoryPressureCallback memoryPressureCallback;
+    memoryPressureCallback.connect<&MemoryPressureRecorder::onMemoryPressure>(recorder);
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.getMemoryPressureMonitor().addCallback(memoryPressureCallback)));
+
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outHandles[2])));
+    ASSERT_TRUE(recorder.CriticalCount == 1);
+    ASSERT_TRUE(recorder.LastEvent.Level == AXR_MEMORY_PRESSURE_LEVEL_CRITICAL);
+    ASSERT_TRUE(recorder.LastEvent.RequestedSize == sizeof(TestData_Small));
+    ASSERT_TRUE(outHandles[0].getDataPtr() == nullptr);
+
+    allocator.deallocate(outHandles[1]);
+    allocator.deallocate(outHandles[2]);
 }
@@ -0,0 +1,178 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include <gtest/gtest.h>
+
+#include "axr/common/defines.h"
+#include "memory/handleTable.h"
+
+#include <cstring>
+
+// ----------------------------------------- //
+// Shared Functions
+// ----------------------------------------- //
+
+static void deallocateCallback(void*& memory) {
+    free(memory);
+    memory = nullptr;
+};
+
+static AxrMemoryBlock createMemoryBlock(const uint32_t handleCount) {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    const size_t allocatorSize = AxrHandleTable::getAllocatorSize(handleCount);
+    return AxrMemoryBlock{
+        .Memory = malloc(allocatorSize),
+        .Size = allocatorSize,
+        .Deallocator = callback,
+    };
+}
+
+// ----------------------------------------- //
+// Tests
+// ----------------------------------------- //
+
+TEST(HandleTable, DeallocatorCallback) {
+    bool wasDeallocated = false;
+    {
+        auto deallocateCallback = [](bool* wasDeallocated, void*& memory) -> void {
+            free(memory);
+            memory = nullptr;
+            *wasDeallocated = true;
+        };
+
+        AxrDeallocateBlock callback;
+        callback.connect<deallocateCallback>(&wasDeallocated);
+
+        const size_t allocatorSize = AxrHandleTable::getAllocatorSize(4);
+        AxrHandleTable handleTable(AxrMemoryBlock{
+            .Memory = malloc(allocatorSize),
+            .Size = allocatorSize,
+            .Deallocator = callback,
+        });
+    }
+    ASSERT_TRUE(wasDeallocated);
+}
+
+TEST(HandleTable, Create_Full) {
+    AxrHandleTable handleTable(createMemoryBlock(2));
+    ASSERT_TRUE(handleTable.handleCapacity() == 2);
+
+    int data[3]{};
+    uint32_t index1;
+    uint32_t index2;
+    uint32_t index3;
+    ASSERT_TRUE(AXR_SUCCEEDED(handleTable.create(&data[0], index1)));
+    ASSERT_TRUE(AXR_SUCCEEDED(handleTable.create(&data[1], index2)));
+    ASSERT_TRUE(handleTable.create(&data[2], index3) == AXR_ERROR_OUT_OF_MEMORY);
+
+    ASSERT_TRUE(index1 != index2);
+    ASSERT_TRUE(handleTable.getData(index1) == &data[0]);
+    ASSERT_TRUE(handleTable.getData(index2) == &data[1]);
+    ASSERT_TRUE(handleTable.size() == 2);
+}
+
+TEST(HandleTable, Destroy_StaleHandle) {
+    AxrHandleTable handleTable(createMemoryBlock(1));
+
+    int data[2]{};
+    uint32_t index;
+    ASSERT_TRUE(AXR_SUCCEEDED(handleTable.create(&data[0], index)));
+    void* const* dataPtr = handleTable.getDataPtr(index);
+    const uint32_t generation = handleTable.getGeneration(index);
+    ASSERT_TRUE(handleTable.isValid(dataPtr, generation));
+
+    handleTable.destroy(index);
+    ASSERT_TRUE(handleTable.empty());
+    ASSERT_FALSE(handleTable.isValid(dataPtr, generation));
+
+    // The slot gets reused, but the old handle must still be detected as stale
+    uint32_t newIndex;
+    ASSERT_TRUE(AXR_SUCCEEDED(handleTable.create(&data[1], newIndex)));
+    ASSERT_TRUE(newIndex == index);
+    ASSERT_TRUE(handleTable.getDataPtr(newIndex) == dataPtr);
+    ASSERT_FALSE(handleTable.isValid(dataPtr, generation));
+    ASSERT_TRUE(handleTable.isValid(dataPtr, handleTable.getGeneration(newIndex)));
+}
+
+TEST(HandleTable, Relocate) {
+    AxrHandleTable handleTable(createMemoryBlock(1));
+
+    int data[2]{};
+    uint32_t index;
+    ASSERT_TRUE(AXR_SUCCEEDED(handleTable.create(&data[0], index)));
+    void* const* dataPtr = handleTable.getDataPtr(index);
+    const uint32_t generation = handleTable.getGeneration(index);
+
+    handleTable.relocate(index, &data[1]);
+    ASSERT_TRUE(*dataPtr == &data[1]);
+    ASSERT_TRUE(handleTable.isValid(dataPtr, generation));
+}
+
+TEST(HandleTable, GetIndex_ForeignPointer) {
+    AxrHandleTable handleTable(createMemoryBlock(2));
+
+    int data{};
+    void* foreignData = &data;
+    ASSERT_TRUE(handleTable.getIndex(&foreignData) == AxrHandleTable::InvalidIndex);
+    ASSERT_FALSE(handleTable.isValid(&foreignData, 0));
+}
+
+TEST(HandleTable, Clear) {
+    AxrHandleTable handleTable(createMemoryBlock(2));
+
+    int data[2]{};
+    uint32_t index1;
+    uint32_t index2;
+    ASSERT_TRUE(AXR_SUCCEEDED(handleTable.create(&data[0], index1)));
+    ASSERT_TRUE(AXR_SUCCEEDED(handleTable.create(&data[1], index2)));
+    void* const* dataPtr = handleTable.getDataPtr(index1);
+    const uint32_t generation = handleTable.getGeneration(index1);
+
+    handleTable.clear();
+    ASSERT_TRUE(handleTable.empty());
+    ASSERT_FALSE(handleTable.isValid(dataPtr, generation));
+    ASSERT_TRUE(AXR_SUCCEEDED(handleTable.create(&data[0], index1)));
+    ASSERT_TRUE(AXR_SUCCEEDED(handleTable.create(&data[1], index2)));
+}
+
+TEST(HandleTable, OffsetAllData) {
+    AxrHandleTable handleTable(createMemoryBlock(3));
+
+    int data[4]{};
+    uint32_t index1;
+    uint32_t index2;
+    ASSERT_TRUE(AXR_SUCCEEDED(handleTable.create(&data[0], index1)));
+    ASSERT_TRUE(AXR_SUCCEEDED(handleTable.create(&data[1], index2)));
+
+    handleTable.offsetAllData(sizeof(int) * 2);
+    ASSERT_TRUE(handleTable.getData(index1) == &data[2]);
+    ASSERT_TRUE(handleTable.getData(index2) == &data[3]);
+    ASSERT_TRUE(handleTable.size() == 2);
+}
+
+TEST(HandleTable, SnapshotState) {
+    AxrHandleTable handleTable(createMemoryBlock(3));
+    AxrHandleTable restoredHandleTable(createMemoryBlock(3));
+
+    int data[2]{};
+    uint32_t index;
+    ASSERT_TRUE(AXR_SUCCEEDED(handleTable.create(&data[0], index)));
+    ASSERT_TRUE(AXR_SUCCEEDED(handleTable.create(&data[1], index)));
+    handleTable.destroy(index);
+
+    // Copy the slots over like a snapshot would, then restore the rest of the state
+    std::memcpy(const_cast<void**>(restoredHandleTable.getDataPtr(0)),
+                handleTable.getDataPtr(0),
+                sizeof(AxrHandleTableSlot) * 3);
+    restoredHandleTable.restoreSnapshotState(handleTable.getSnapshotState());
+    ASSERT_TRUE(restoredHandleTable.size() == 1);
+    ASSERT_TRUE(restoredHandleTable.getData(0) == &data[0]);
+
+    // The freed slot is reused first
+    uint32_t restoredIndex;
+    ASSERT_TRUE(AXR_SUCCEEDED(restoredHandleTable.create(&data[1], restoredIndex)));
+    ASSERT_TRUE(restoredIndex == index);
+    ASSERT_TRUE(restoredHandleTable.getGeneration(restoredIndex) == 1);
+}
@@ -0,0 +1,135 @@
+#ifdef AXR_HEAP_ALLOCATION_CHECK_ENABLED
+
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include <gtest/gtest.h>
+
+#include "memory/heapAllocationChecker.h"
+#include "memory/stackAllocator.h"
+
+#include <atomic>
+#include <thread>
+
+// ----------------------------------------- //
+// Shared Variables
+// ----------------------------------------- //
+
+/// Keeps the compiler from optimizing the test allocations away
+static int* volatile AllocatedValue = nullptr;
+
+// ----------------------------------------- //
+// Shared Functions
+// ----------------------------------------- //
+
+static void deallocateCallback(void*& memory) {
+    free(memory);
+    memory = nullptr;
+};
+
+static AxrMemoryBlock createMemoryBlock(const size_t size) {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    return AxrMemoryBlock{
+        .Memory = malloc(size),
+        .Size = size,
+        .Deallocator = callback,
+    };
+}
+
+// ----------------------------------------- //
+// Tests
+// ----------------------------------------- //
+
+TEST(HeapAllocationChecker, SteadyStateFrame) {
+    AxrHeapAllocationChecker& checker = AxrHeapAllocationChecker::get();
+    checker.setWarmUpFrameCount(0);
+    checker.reset();
+
+    AxrStackAllocator allocator(createMemoryBlock(1'024));
+
+    checker.beginFrame();
+    uint32_t* memory = nullptr;
+    AxrStackAllocator::MarkerID markerID{};
+    const AxrResult axrResult = allocator.allocate(4, memory, markerID);
+    allocator.clear();
+    const AxrHeapAllocationChecker::FrameReport report = checker.endFrame();
+
+    ASSERT_TRUE(AXR_SUCCEEDED(axrResult));
+    ASSERT_TRUE(report.IsSteadyState);
+    ASSERT_EQ(report.AllocationCount, 0);
+    ASSERT_EQ(report.ThreadCount, 0);
+}
+
+TEST(HeapAllocationChecker, AllocatingFrame) {
+    AxrHeapAllocationChecker& checker = AxrHeapAllocationChecker::get();
+    checker.setWarmUpFrameCount(1);
+    checker.reset();
+
+    // Warm up frames are allowed to allocate
+    checker.beginFrame();
+    AllocatedValue = new int(1);
+    AxrHeapAllocationChecker::FrameReport report = checker.endFrame();
+    delete AllocatedValue;
+
+    ASSERT_FALSE(report.IsSteadyState);
+    ASSERT_EQ(report.AllocationCount, 1);
+
+    checker.beginFrame();
+    AllocatedValue = new int(2);
+    report = checker.endFrame();
+    delete AllocatedValue;
+
+    ASSERT_TRUE(report.IsSteadyState);
+    ASSERT_EQ(report.FrameIndex, 1);
+    ASSERT_EQ(report.AllocationCount, 1);
+    ASSERT_EQ(report.ByteCount, sizeof(int));
+    ASSERT_EQ(report.ThreadCount, 1);
+
+    // Allocations outside a frame aren't counted
+    AllocatedValue = new int(3);
+    delete AllocatedValue;
+    checker.beginFrame();
+    report = checker.endFrame();
+    ASSERT_EQ(report.AllocationCount, 0);
+
+    checker.setWarmUpFrameCount(AxrHeapAllocationChecker::DefaultWarmUpFrameCount);
+}
+
+TEST(HeapAllocationChecker, PerThread) {
+    AxrHeapAllocationChecker& checker = AxrHeapAllocationChecker::get();
+    checker.setWarmUpFrameCount(0);
+    checker.reset();
+
+    std::atomic<bool> shouldAllocate = false;
+    std::atomic<bool> hasAllocated = false;
+    int* threadValue = nullptr;
+    std::thread thread([&] {
+        while (!shouldAllocate.load()) {
+            std::this_thread::yield();
+        }
+        threadValue = new int[4];
+        hasAllocated.store(true);
+    });
+
+    checker.beginFrame();
+    shouldAllocate.store(true);
+    while (!hasAllocated.load()) {
+        std::this_thread::yield();
+    }
+    AllocatedValue = new int(1);
+    const AxrHeapAllocationChecker::FrameReport report = checker.endFrame();
+
+    thread.join();
+    delete[] threadValue;
+    delete AllocatedValue;
+
+    ASSERT_EQ(report.AllocationCount, 2);
+    ASSERT_EQ(report.ByteCount, sizeof(int) * 5);
+    ASSERT_EQ(report.ThreadCount, 2);
+
+    checker.setWarmUpFrameCount(AxrHeapAllocationChecker::DefaultWarmUpFrameCount);
+}
+
+#endif
@@ -184,6 +184,44 @@ static void allocateAllDeallocateTwoAllocateTwo_Test() {
     ASSERT_TRUE(allocator.size() == allocator.chunkCapacity());
 }
 
+template<typename DataType>
+    requires std::equality_comparable<DataType>
+static void allocateBatchDeallocateBatch_Test() {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t chunkCount = 10;
+    constexpr size_t allocatorSize = (chunkCount * sizeof(DataType)) + alignof(DataType);
+    void* memory = malloc(allocatorSize);
+    AxrPoolAllocator<DataType> allocator(AxrMemoryBlock{
+        .Memory = memory,
+        .Size = allocatorSize,
+        .Deallocator = callback,
+    });
+
+    DataType* outTestDatas[chunkCount]{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBatch(outTestDatas, 6, true)));
+    for (size_t i = 0; i < 6; i++) {
+        ASSERT_TRUE(outTestDatas[i] != nullptr);
+        ASSERT_TRUE(*outTestDatas[i] == DataType{});
+    }
+    ASSERT_TRUE(allocator.size() == 6);
+
+    // Not enough chunks left. Nothing should be allocated
+    DataType* outExtraTestDatas[chunkCount]{};
+    ASSERT_TRUE(allocator.allocateBatch(outExtraTestDatas, 5) == AXR_ERROR_OUT_OF_MEMORY);
+    ASSERT_TRUE(allocator.size() == 6);
+    ASSERT_TRUE(outExtraTestDatas[0] == nullptr);
+
+    allocator.deallocateBatch(outTestDatas, 6);
+    ASSERT_TRUE(allocator.empty());
+    ASSERT_TRUE(outTestDatas[0] == nullptr);
+
+    // All chunks are free again
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBatch(outTestDatas, chunkCount)));
+    ASSERT_TRUE(allocator.size() == allocator.chunkCapacity());
+}
+
 // ----------------------------------------- //
 // PoolAllocator Tests
 // ----------------------------------------- //
@@ -245,3 +283,11 @@ TEST(PoolAllocator_TypeFitsPointer, AllocateAllDeallocateTwoAllocateTwo) {
 TEST(PoolAllocator_TypeSmallerThanPointer, AllocateAllDeallocateTwoAllocateTwo) {
     allocateAllDeallocateTwoAllocateTwo_Test<TestData_Small>();
 }
+
+TEST(PoolAllocator_TypeFitsPointer, AllocateBatchDeallocateBatch) {
+    allocateBatchDeallocateBatch_Test<TestData_Large>();
+}
+
+TEST(PoolAllocator_TypeSmallerThanPointer, AllocateBatchDeallocateBatch) {
+    allocateBatchDeallocateBatch_Test<TestData_Small>();
+}
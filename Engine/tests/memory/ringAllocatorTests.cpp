@@ -0,0 +1,215 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include <gtest/gtest.h>
+
+#include "axr/common/defines.h"
+#include "memory/ringAllocator.h"
+
+// ----------------------------------------- //
+// Shared Structs
+// ----------------------------------------- //
+
+namespace {
+    struct TestData_Small {
+        uint32_t ID{};
+        uint32_t Data[7]{};
+
+        bool operator==(const TestData_Small& src) const {
+            return ID == src.ID && std::equal(std::begin(Data), std::end(Data), std::begin(src.Data));
+        }
+    };
+} // namespace
+
+namespace {
+    struct alignas(64) TestData_Aligned {
+        uint32_t ID{};
+    };
+} // namespace
+
+// ----------------------------------------- //
+// Shared Functions
+// ----------------------------------------- //
+
+static void deallocateCallback(void*& memory) {
+    free(memory);
+    memory = nullptr;
+};
+
+static AxrRingAllocator createAllocator(const size_t allocatorSize) {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    return AxrRingAllocator(AxrMemoryBlock{
+        // Aligned so the tests can rely on exact offsets
+        .Memory = std::aligned_alloc(64, allocatorSize),
+        .Size = allocatorSize,
+        .Deallocator = callback,
+    });
+}
+
+// ----------------------------------------- //
+// Tests
+// ----------------------------------------- //
+
+TEST(RingAllocator, DeallocatorCallback) {
+    bool wasDeallocated = false;
+    {
+        auto deallocateCallback = [](bool* wasDeallocated, void*& memory) -> void {
+            free(memory);
+            memory = nullptr;
+            *wasDeallocated = true;
+        };
+
+        AxrDeallocateBlock callback;
+        callback.connect<deallocateCallback>(&wasDeallocated);
+
+        constexpr size_t allocatorSize = 128;
+        AxrRingAllocator allocator(AxrMemoryBlock{
+            .Memory = malloc(allocatorSize),
+            .Size = allocatorSize,
+            .Deallocator = callback,
+        });
+    }
+    ASSERT_TRUE(wasDeallocated);
+}
+
+TEST(RingAllocator, Allocate_One) {
+    AxrRingAllocator allocator = createAllocator(128);
+
+    TestData_Small* testData = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, testData, true)));
+    ASSERT_TRUE(testData != nullptr);
+    ASSERT_TRUE(*testData == TestData_Small{});
+    ASSERT_TRUE(allocator.size() == sizeof(TestData_Small));
+
+    allocator.release(allocator.getFence());
+    ASSERT_TRUE(allocator.empty());
+}
+
+TEST(RingAllocator, Allocate_Aligned) {
+    AxrRingAllocator allocator = createAllocator(512);
+
+    uint8_t* padding = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, padding)));
+
+    TestData_Aligned* testData = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(2, testData)));
+    ASSERT_TRUE(reinterpret_cast<uintptr_t>(testData) % alignof(TestData_Aligned) == 0);
+    // The alignment padding counts as used
+    ASSERT_TRUE(allocator.size() == 64 + sizeof(TestData_Aligned) * 2);
+}
+
+TEST(RingAllocator, Release_Fences) {
+    AxrRingAllocator allocator = createAllocator(256);
+
+    void* memory = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlock(64, 8, memory)));
+    const AxrRingAllocator::Fence fence1 = allocator.getFence();
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlock(32, 8, memory)));
+    const AxrRingAllocator::Fence fence2 = allocator.getFence();
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlock(16, 8, memory)));
+    ASSERT_TRUE(allocator.size() == 112);
+
+    allocator.release(fence1);
+    ASSERT_TRUE(allocator.size() == 48);
+
+    // Releasing an older fence does nothing
+    allocator.release(fence1);
+    ASSERT_TRUE(allocator.size() == 48);
+
+    allocator.release(fence2);
+    ASSERT_TRUE(allocator.size() == 16);
+
+    allocator.release(allocator.getFence());
+    ASSERT_TRUE(allocator.empty());
+}
+
+TEST(RingAllocator, Allocate_WrapAround) {
+    AxrRingAllocator allocator = createAllocator(256);
+
+    void* memory = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlock(96, 8, memory)));
+    const auto start = reinterpret_cast<uintptr_t>(memory);
+    const AxrRingAllocator::Fence fence = allocator.getFence();
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlock(96, 8, memory)));
+    ASSERT_TRUE(reinterpret_cast<uintptr_t>(memory) == start + 96);
+
+    // Not enough room until the first block is released
+    ASSERT_TRUE(allocator.allocateBlock(96, 8, memory) == AXR_ERROR_OUT_OF_MEMORY);
+
+    allocator.release(fence);
+    // Straddles the end, so it starts back at the beginning. The 64 bytes skipped over at the end stay in use
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlock(96, 8, memory)));
+    ASSERT_TRUE(reinterpret_cast<uintptr_t>(memory) == start);
+    ASSERT_TRUE(allocator.size() == 96 + 64 + 96);
+
+    // The next block follows on from the wrapped one
+    allocator.release(allocator.getFence());
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlock(32, 8, memory)));
+    ASSERT_TRUE(reinterpret_cast<uintptr_t>(memory) == start);
+}
+
+TEST(RingAllocator, Allocate_WrapAround_Continuous) {
+    AxrRingAllocator allocator = createAllocator(1024);
+
+    uint8_t* start = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, start)));
+    allocator.clear();
+
+    AxrRingAllocator::Fence fences[3]{};
+    for (uint32_t frame = 0; frame < 100; ++frame) {
+        // Keep the last few frames in use, like a GPU upload queue would
+        allocator.release(fences[frame % 3]);
+
+        const size_t size = 40 + (frame * 37) % 200;
+        uint8_t* memory = nullptr;
+        ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(size, memory)));
+        memory[0] = static_cast<uint8_t>(frame);
+        memory[size - 1] = static_cast<uint8_t>(frame);
+        ASSERT_TRUE(memory >= start);
+        ASSERT_TRUE(memory + size <= start + 1024);
+
+        fences[frame % 3] = allocator.getFence();
+    }
+}
+
+TEST(RingAllocator, Allocate_OutOfMemory) {
+    AxrRingAllocator allocator = createAllocator(128);
+
+    void* memory = nullptr;
+    ASSERT_TRUE(allocator.allocateBlock(129, 8, memory) == AXR_ERROR_OUT_OF_MEMORY);
+    ASSERT_TRUE(memory == nullptr);
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlock(128, 8, memory)));
+    ASSERT_TRUE(allocator.allocateBlock(1, 1, memory) == AXR_ERROR_OUT_OF_MEMORY);
+}
+
+TEST(RingAllocator, Clear) {
+    AxrRingAllocator allocator = createAllocator(128);
+
+    void* memory = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlock(100, 8, memory)));
+    void* start = memory;
+    allocator.clear();
+    ASSERT_TRUE(allocator.empty());
+
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlock(128, 8, memory)));
+    ASSERT_TRUE(memory == start);
+}
+
+TEST(RingAllocator, Move) {
+    AxrRingAllocator allocator = createAllocator(128);
+
+    TestData_Small* testData = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, testData)));
+
+    AxrRingAllocator movedAllocator = std::move(allocator);
+    ASSERT_TRUE(movedAllocator.size() == sizeof(TestData_Small));
+    ASSERT_TRUE(movedAllocator.capacity() == 128);
+
+    // The moved from allocator doesn't hold on to anything
+    ASSERT_TRUE(allocator.empty());
+    ASSERT_TRUE(allocator.size() == 0);
+    ASSERT_TRUE(allocator.capacity() == 0);
+    ASSERT_TRUE(allocator.getFence() == 0);
+}
@@ -0,0 +1,128 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include <gtest/gtest.h>
+
+#include "axr/common/defines.h"
+#include "memory/sceneArena.h"
+
+#include <utility>
+
+// ----------------------------------------- //
+// Shared Structs
+// ----------------------------------------- //
+
+namespace {
+    struct TestData {
+        uint32_t ID{};
+        uint32_t Data[7]{};
+    };
+} // namespace
+
+// ----------------------------------------- //
+// Shared Functions
+// ----------------------------------------- //
+
+static void deallocateCallback(void*& memory) {
+    free(memory);
+    memory = nullptr;
+};
+
+static AxrSceneArena createSceneArena(const size_t size) {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    return AxrSceneArena(AxrMemoryBlock{
+        .Memory = malloc(size),
+        .Size = size,
+        .Deallocator = callback,
+    });
+}
+
+// ----------------------------------------- //
+// Tests
+// ----------------------------------------- //
+
+TEST(SceneArena, Load) {
+    AxrSceneArena arena = createSceneArena(1'024);
+    ASSERT_TRUE(arena.state() == AxrSceneArena::State::Unloaded);
+
+    ASSERT_TRUE(AXR_SUCCEEDED(arena.beginLoad()));
+    ASSERT_TRUE(arena.state() == AxrSceneArena::State::Loading);
+
+    TestData* sceneData = nullptr;
+    TestData* temporaryData = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(arena.allocateScene(2, sceneData)));
+    ASSERT_TRUE(AXR_SUCCEEDED(arena.allocateTemporary(4, temporaryData, true)));
+    sceneData[1].ID = 5;
+
+    ASSERT_TRUE(arena.sceneSize() >= sizeof(TestData) * 2);
+    ASSERT_TRUE(arena.temporarySize() >= sizeof(TestData) * 4);
+    ASSERT_TRUE(temporaryData[3].ID == 0);
+    // Scene data and temporaries grow from opposite ends
+    ASSERT_TRUE(sceneData < temporaryData);
+
+    // Temporaries are dropped once loading finishes, the scene data stays
+    const size_t sceneSize = arena.sceneSize();
+    arena.endLoad();
+    ASSERT_TRUE(arena.state() == AxrSceneArena::State::Loaded);
+    ASSERT_TRUE(arena.temporarySize() == 0);
+    ASSERT_TRUE(arena.sceneSize() == sceneSize);
+    ASSERT_TRUE(sceneData[1].ID == 5);
+
+    // Scene data can still grow after loading
+    TestData* lateSceneData = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(arena.allocateScene(1, lateSceneData)));
+    ASSERT_TRUE(arena.sceneSize() > sceneSize);
+
+    arena.unload();
+    ASSERT_TRUE(arena.state() == AxrSceneArena::State::Unloaded);
+    ASSERT_TRUE(arena.empty());
+}
+
+TEST(SceneArena, InvalidState) {
+    AxrSceneArena arena = createSceneArena(1'024);
+
+    TestData* data = nullptr;
+    ASSERT_TRUE(arena.allocateScene(1, data) == AXR_ERROR_VALIDATION_FAILED);
+    ASSERT_TRUE(arena.allocateTemporary(1, data) == AXR_ERROR_VALIDATION_FAILED);
+
+    ASSERT_TRUE(AXR_SUCCEEDED(arena.beginLoad()));
+    ASSERT_TRUE(arena.beginLoad() == AXR_ERROR_VALIDATION_FAILED);
+    arena.endLoad();
+
+    // Temporaries can only be allocated while loading
+    ASSERT_TRUE(arena.allocateTemporary(1, data) == AXR_ERROR_VALIDATION_FAILED);
+    ASSERT_TRUE(arena.beginLoad() == AXR_ERROR_VALIDATION_FAILED);
+
+    arena.unload();
+    ASSERT_TRUE(AXR_SUCCEEDED(arena.beginLoad()));
+}
+
+TEST(SceneArena, OutOfMemory) {
+    AxrSceneArena arena = createSceneArena(sizeof(TestData) * 4);
+    ASSERT_TRUE(AXR_SUCCEEDED(arena.beginLoad()));
+
+    TestData* data = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(arena.allocateScene(2, data)));
+    // The scene data and temporaries share the same budget
+    ASSERT_TRUE(arena.allocateTemporary(2, data) == AXR_ERROR_OUT_OF_MEMORY);
+
+    // Aborting the load frees everything
+    arena.unload();
+    ASSERT_TRUE(AXR_SUCCEEDED(arena.beginLoad()));
+    ASSERT_TRUE(AXR_SUCCEEDED(arena.allocateTemporary(2, data)));
+}
+
+TEST(SceneArena, Move) {
+    AxrSceneArena arena = createSceneArena(1'024);
+    ASSERT_TRUE(AXR_SUCCEEDED(arena.beginLoad()));
+    TestData* data = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(arena.allocateScene(1, data)));
+
+    AxrSceneArena movedArena(std::move(arena));
+    ASSERT_TRUE(movedArena.state() == AxrSceneArena::State::Loading);
+    ASSERT_TRUE(movedArena.sceneSize() >= sizeof(TestData));
+    ASSERT_TRUE(movedArena.capacity() == 1'024);
+    ASSERT_TRUE(arena.state() == AxrSceneArena::State::Unloaded);
+}
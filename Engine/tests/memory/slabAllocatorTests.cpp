@@ -0,0 +1,199 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include <gtest/gtest.h>
+
+#include "axr/common/defines.h"
+#include "memory/slabAllocator.h"
+
+// ----------------------------------------- //
+// Shared Structs
+// ----------------------------------------- //
+
+namespace {
+    struct TestData_Small {
+        uint32_t ID{};
+        uint32_t Data[7]{};
+
+        bool operator==(const TestData_Small& src) const {
+            return ID == src.ID && std::equal(std::begin(Data), std::end(Data), std::begin(src.Data));
+        }
+    };
+} // namespace
+
+namespace {
+    struct alignas(64) TestData_Aligned {
+        uint32_t ID{};
+    };
+} // namespace
+
+// ----------------------------------------- //
+// Shared Functions
+// ----------------------------------------- //
+
+static void deallocateCallback(void*& memory) {
+    free(memory);
+    memory = nullptr;
+};
+
+static AxrSlabAllocator createAllocator(const uint32_t pageCount) {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    const size_t allocatorSize = AxrSlabAllocator::getAllocatorSize(pageCount);
+    return AxrSlabAllocator(AxrMemoryBlock{
+        .Memory = malloc(allocatorSize),
+        .Size = allocatorSize,
+        .Deallocator = callback,
+    });
+}
+
+// ----------------------------------------- //
+// Tests
+// ----------------------------------------- //
+
+TEST(SlabAllocator, DeallocatorCallback) {
+    bool wasDeallocated = false;
+    {
+        auto deallocateCallback = [](bool* wasDeallocated, void*& memory) -> void {
+            free(memory);
+            memory = nullptr;
+            *wasDeallocated = true;
+        };
+
+        AxrDeallocateBlock callback;
+        callback.connect<deallocateCallback>(&wasDeallocated);
+
+        const size_t allocatorSize = AxrSlabAllocator::getAllocatorSize(1);
+        AxrSlabAllocator allocator(AxrMemoryBlock{
+            .Memory = malloc(allocatorSize),
+            .Size = allocatorSize,
+            .Deallocator = callback,
+        });
+    }
+    ASSERT_TRUE(wasDeallocated);
+}
+
+TEST(SlabAllocator, ChunkSize) {
+    ASSERT_TRUE(AxrSlabAllocator::getChunkSize(1, 1) == 8);
+    ASSERT_TRUE(AxrSlabAllocator::getChunkSize(17, 8) == 24);
+    // 24 byte chunks are only 8 byte aligned
+    ASSERT_TRUE(AxrSlabAllocator::getChunkSize(17, 16) == 32);
+    ASSERT_TRUE(AxrSlabAllocator::getChunkSize(sizeof(TestData_Small), alignof(TestData_Small)) == 32);
+    ASSERT_TRUE(AxrSlabAllocator::getChunkSize(sizeof(TestData_Aligned), alignof(TestData_Aligned)) == 64);
+    ASSERT_TRUE(AxrSlabAllocator::getChunkSize(AxrSlabAllocator::MaxAllocationSize + 1, 1) == 0);
+}
+
+TEST(SlabAllocator, Allocate_One) {
+    AxrSlabAllocator allocator = createAllocator(1);
+
+    TestData_Small* testData = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(testData, true)));
+    ASSERT_TRUE(testData != nullptr);
+    ASSERT_TRUE(*testData == TestData_Small{});
+    ASSERT_TRUE(allocator.size() == 32);
+    ASSERT_TRUE(allocator.usedPageCount() == 1);
+
+    allocator.deallocate(testData);
+    ASSERT_TRUE(testData == nullptr);
+    ASSERT_TRUE(allocator.empty());
+    ASSERT_TRUE(allocator.usedPageCount() == 0);
+}
+
+TEST(SlabAllocator, Allocate_Aligned) {
+    AxrSlabAllocator allocator = createAllocator(1);
+
+    TestData_Aligned* testData[4]{};
+    for (TestData_Aligned*& data : testData) {
+        ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(data)));
+        ASSERT_TRUE(reinterpret_cast<uintptr_t>(data) % alignof(TestData_Aligned) == 0);
+    }
+    for (TestData_Aligned*& data : testData) {
+        allocator.deallocate(data);
+    }
+}
+
+TEST(SlabAllocator, Allocate_TooLarge) {
+    AxrSlabAllocator allocator = createAllocator(1);
+
+    void* memory = nullptr;
+    ASSERT_TRUE(allocator.allocateBlock(AxrSlabAllocator::MaxAllocationSize + 1, 1, memory) ==
+                AXR_ERROR_VALIDATION_FAILED);
+    ASSERT_TRUE(memory == nullptr);
+}
+
+TEST(SlabAllocator, Allocate_FullPage_ThenReuse) {
+    AxrSlabAllocator allocator = createAllocator(1);
+
+    constexpr uint32_t chunkCount = AxrSlabAllocator::PageSize / 256;
+    void* memory[chunkCount]{};
+    for (void*& chunk : memory) {
+        ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlock(256, 8, chunk)));
+    }
+
+    // The only page belongs to the 256 byte size class, so no other size class can get a page
+    void* otherMemory = nullptr;
+    ASSERT_TRUE(allocator.allocateBlock(256, 8, otherMemory) == AXR_ERROR_OUT_OF_MEMORY);
+    ASSERT_TRUE(allocator.allocateBlock(8, 8, otherMemory) == AXR_ERROR_OUT_OF_MEMORY);
+
+    // Freeing a chunk of a full page makes it available again
+    void* freedChunk = memory[3];
+    allocator.deallocateBlock(memory[3]);
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlock(200, 8, memory[3])));
+    ASSERT_TRUE(memory[3] == freedChunk);
+
+    // Once the page is empty, another size class can use it
+    for (void*& chunk : memory) {
+        allocator.deallocateBlock(chunk);
+    }
+    ASSERT_TRUE(allocator.empty());
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlock(8, 8, otherMemory)));
+    allocator.deallocateBlock(otherMemory);
+}
+
+TEST(SlabAllocator, Allocate_DifferentSizeClasses) {
+    AxrSlabAllocator allocator = createAllocator(4);
+
+    uint8_t* small = nullptr;
+    TestData_Small* medium = nullptr;
+    void* large = nullptr;
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(small)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(medium)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlock(150, 8, large)));
+    ASSERT_TRUE(allocator.usedPageCount() == 3);
+    ASSERT_TRUE(allocator.size() == 8 + 32 + 192);
+
+    // Each size class gets its own page
+    const auto smallPage = reinterpret_cast<uintptr_t>(small) / AxrSlabAllocator::PageSize;
+    const auto mediumPage = reinterpret_cast<uintptr_t>(medium) / AxrSlabAllocator::PageSize;
+    ASSERT_TRUE(smallPage != mediumPage);
+
+    allocator.deallocate(small);
+    allocator.deallocate(medium);
+    allocator.deallocateBlock(large);
+    ASSERT_TRUE(allocator.empty());
+    ASSERT_TRUE(allocator.usedPageCount() == 0);
+}
+
+TEST(SlabAllocator, Deallocate_Foreign) {
+    AxrSlabAllocator allocator = createAllocator(1);
+
+    uint64_t data{};
+    void* memory = &data;
+    allocator.deallocateBlock(memory);
+    ASSERT_TRUE(memory == &data);
+}
+
+TEST(SlabAllocator, Clear) {
+    AxrSlabAllocator allocator = createAllocator(2);
+
+    void* memory[3]{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlock(8, 8, memory[0])));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlock(64, 8, memory[1])));
+    ASSERT_TRUE(allocator.allocateBlock(128, 8, memory[2]) == AXR_ERROR_OUT_OF_MEMORY);
+
+    allocator.clear();
+    ASSERT_TRUE(allocator.empty());
+    ASSERT_TRUE(allocator.usedPageCount() == 0);
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocateBlock(128, 8, memory[2])));
+}
@@ -293,3 +293,126 @@ TEST(StackAllocator, DeallocateIfLast_Failure) {
     // Check that the allocator still holds everything
     ASSERT_TRUE(allocator.size() == allocatorSize);
 }
+
+TEST(StackAllocator, Scope_Rewind) {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t testDataMemSize =
+        sizeof(TestData_Large) + alignof(TestData_Large) + AxrStackAllocator::getMarkerSize();
+    constexpr size_t allocatorSize = testDataMemSize * 2;
+    AxrStackAllocator allocator(AxrMemoryBlock{
+        .Memory = malloc(allocatorSize),
+        .Size = allocatorSize,
+        .Deallocator = callback,
+    });
+
+    TestData_Large* outTestData1 = nullptr;
+    AxrStackAllocator::MarkerID testData1MarkerID{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData1, testData1MarkerID)));
+
+    // The same memory gets reused every time the scope ends
+    for (uint32_t i = 0; i < 4; ++i) {
+        AxrStackAllocator::Scope scope(allocator);
+        TestData_Large* outTestData2 = nullptr;
+        ASSERT_TRUE(AXR_SUCCEEDED(scope.allocate(1, outTestData2)));
+        ASSERT_TRUE(scope.size() == testDataMemSize);
+        ASSERT_TRUE(allocator.size() == allocatorSize);
+    }
+    ASSERT_TRUE(allocator.size() == testDataMemSize);
+
+    // Memory from before the scope is still usable
+    ASSERT_TRUE(allocator.deallocateIfLast(testData1MarkerID));
+    ASSERT_TRUE(allocator.empty());
+}
+
+TEST(StackAllocator, Scope_Nested) {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t testDataMemSize =
+        sizeof(TestData_Small) + alignof(TestData_Small) + AxrStackAllocator::getMarkerSize();
+    constexpr size_t allocatorSize = testDataMemSize * 3;
+    AxrStackAllocator allocator(AxrMemoryBlock{
+        .Memory = malloc(allocatorSize),
+        .Size = allocatorSize,
+        .Deallocator = callback,
+    });
+
+    // Callees take the outer scope and open their own scope on its allocator
+    auto callee = [](AxrStackAllocator::Scope& parentScope) {
+        AxrStackAllocator::Scope scope(parentScope.allocator());
+        TestData_Small* outTestData = nullptr;
+        ASSERT_TRUE(AXR_SUCCEEDED(scope.allocate(1, outTestData, true)));
+        ASSERT_TRUE(*outTestData == TestData_Small{});
+        ASSERT_TRUE(parentScope.size() == testDataMemSize * 2);
+    };
+
+    {
+        AxrStackAllocator::Scope scope(allocator);
+        TestData_Small* outTestData = nullptr;
+        ASSERT_TRUE(AXR_SUCCEEDED(scope.allocate(1, outTestData)));
+
+        callee(scope);
+        ASSERT_TRUE(scope.size() == testDataMemSize);
+
+        scope.rewind();
+        ASSERT_TRUE(allocator.empty());
+
+        ASSERT_TRUE(AXR_SUCCEEDED(scope.allocate(1, outTestData)));
+        ASSERT_TRUE(allocator.size() == testDataMemSize);
+    }
+    ASSERT_TRUE(allocator.empty());
+}
+
+TEST(StackAllocator, Scope_Move) {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t allocatorSize =
+        sizeof(TestData_Small) + alignof(TestData_Small) + AxrStackAllocator::getMarkerSize();
+    AxrStackAllocator allocator(AxrMemoryBlock{
+        .Memory = malloc(allocatorSize),
+        .Size = allocatorSize,
+        .Deallocator = callback,
+    });
+
+    TestData_Small* outTestData = nullptr;
+    AxrStackAllocator::MarkerID markerID{};
+    {
+        AxrStackAllocator::Scope scope(allocator);
+        {
+            AxrStackAllocator::Scope movedScope(std::move(scope));
+            ASSERT_TRUE(AXR_SUCCEEDED(movedScope.allocate(1, outTestData)));
+        }
+        ASSERT_TRUE(allocator.empty());
+
+        // The moved from scope doesn't rewind anything
+        ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData, markerID)));
+    }
+    ASSERT_TRUE(allocator.size() == allocatorSize);
+}
+
+TEST(StackAllocator, Scope_ClearedWhileOpen) {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    constexpr size_t testDataMemSize =
+        sizeof(TestData_Small) + alignof(TestData_Small) + AxrStackAllocator::getMarkerSize();
+    constexpr size_t allocatorSize = testDataMemSize * 2;
+    AxrStackAllocator allocator(AxrMemoryBlock{
+        .Memory = malloc(allocatorSize),
+        .Size = allocatorSize,
+        .Deallocator = callback,
+    });
+
+    TestData_Small* outTestData = nullptr;
+    AxrStackAllocator::MarkerID markerID{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData, markerID)));
+    {
+        AxrStackAllocator::Scope scope(allocator);
+        allocator.clear();
+    }
+    // Rewinding must never grow the stack back
+    ASSERT_TRUE(allocator.empty());
+}
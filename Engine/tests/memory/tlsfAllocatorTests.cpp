@@ -0,0 +1,327 @@
+// ----------------------------------------- //
+// Headers
+// ----------------------------------------- //
+#include <gtest/gtest.h>
+
+#include "axr/common/defines.h"
+#include "memory/tlsfAllocator.h"
+
+// ----------------------------------------- //
+// Shared Structs
+// ----------------------------------------- //
+
+namespace {
+    struct TestData_Small {
+        uint32_t ID{};
+        uint32_t Data[7]{};
+
+        bool operator==(const TestData_Small& src) const {
+            return ID == src.ID && std::equal(std::begin(Data), std::end(Data), std::begin(src.Data));
+        }
+    };
+} // namespace
+
+namespace {
+    struct TestData_Large {
+        uint32_t ID{};
+        uint32_t Data[15]{};
+
+        bool operator==(const TestData_Large& src) const {
+            return ID == src.ID && std::equal(std::begin(Data), std::end(Data), std::begin(src.Data));
+        }
+    };
+} // namespace
+
+namespace {
+    struct alignas(64) TestData_Aligned {
+        uint32_t ID{};
+    };
+} // namespace
+
+namespace {
+    struct MemoryPressureRecorder {
+        uint32_t HighCount{};
+        uint32_t CriticalCount{};
+        AxrTlsfAllocator* Allocator{};
+        /// Deallocated on critical memory pressure, if set
+        AxrHandle<TestData_Small>* HandleToFree{};
+
+        void onMemoryPressure(const AxrMemoryPressureEvent& event) {
+            if (event.Level == AXR_MEMORY_PRESSURE_LEVEL_HIGH) {
+                ++HighCount;
+                return;
+            }
+
+            ++CriticalCount;
+            if (HandleToFree != nullptr) {
+                Allocator->deallocate(*HandleToFree);
+            }
+        }
+    };
+} // namespace
+
+// ----------------------------------------- //
+// Shared Data
+// ----------------------------------------- //
+
+constexpr size_t SmallBlockSize = sizeof(TestData_Small) + sizeof(void*) * 3;
+constexpr size_t LargeBlockSize = sizeof(TestData_Large) + sizeof(void*) * 3;
+/// The allocator aligns its memory block, which costs up to `alignof(void*)` bytes
+constexpr size_t AlignmentSpace = alignof(void*);
+
+// ----------------------------------------- //
+// Shared Functions
+// ----------------------------------------- //
+
+static void deallocateCallback(void*& memory) {
+    free(memory);
+    memory = nullptr;
+};
+
+static AxrTlsfAllocator createAllocator(const size_t allocatorSize) {
+    AxrDeallocateBlock callback;
+    callback.connect<deallocateCallback>();
+
+    return AxrTlsfAllocator(AxrMemoryBlock{
+        .Memory = malloc(allocatorSize),
+        .Size = allocatorSize,
+        .Deallocator = callback,
+    });
+}
+
+// ----------------------------------------- //
+// Tests
+// ----------------------------------------- //
+
+TEST(TlsfAllocator, DeallocatorCallback) {
+    bool wasDeallocated = false;
+    {
+        auto deallocateCallback = [](bool* wasDeallocated, void*& memory) -> void {
+            free(memory);
+            memory = nullptr;
+            *wasDeallocated = true;
+        };
+
+        AxrDeallocateBlock callback;
+        callback.connect<deallocateCallback>(&wasDeallocated);
+
+        constexpr size_t allocatorSize = 128;
+        void* memory = malloc(allocatorSize);
+        AxrTlsfAllocator allocator(AxrMemoryBlock{
+            .Memory = memory,
+            .Size = allocatorSize,
+            .Deallocator = callback,
+        });
+    }
+    ASSERT_TRUE(wasDeallocated);
+}
+
+TEST(TlsfAllocator, RequiredBlockSize) {
+    ASSERT_TRUE(AxrTlsfAllocator::getRequiredBlockSize(sizeof(TestData_Small), alignof(TestData_Small)) ==
+                SmallBlockSize);
+    ASSERT_TRUE(AxrTlsfAllocator::getRequiredBlockSize(sizeof(TestData_Large), alignof(TestData_Large)) ==
+                LargeBlockSize);
+}
+
+TEST(TlsfAllocator, InvalidCapacity) {
+    // Too small to fit a single free block
+    AxrTlsfAllocator allocator = createAllocator(sizeof(void*) + AlignmentSpace);
+
+    AxrHandle<TestData_Small> outTestDataHandle{};
+    const AxrResult axrResult = allocator.allocate(1, outTestDataHandle);
+    ASSERT_TRUE(axrResult == AXR_ERROR_VALIDATION_FAILED);
+    ASSERT_TRUE(outTestDataHandle == nullptr);
+    ASSERT_TRUE(allocator.empty());
+}
+
+TEST(TlsfAllocator, Allocate_One) {
+    AxrTlsfAllocator allocator = createAllocator(SmallBlockSize + AlignmentSpace);
+
+    AxrHandle<TestData_Small> outTestDataHandle{};
+    const AxrResult axrResult = allocator.allocate(1, outTestDataHandle, true);
+    ASSERT_TRUE(AXR_SUCCEEDED(axrResult));
+    ASSERT_TRUE(outTestDataHandle != nullptr);
+
+    // Check that the data is empty and zeroed out
+    ASSERT_TRUE(*outTestDataHandle == TestData_Small{});
+
+    constexpr TestData_Small testData{
+        .ID = 5,
+        .Data = {1, 2, 3, 4, 5, 6, 7},
+    };
+    *outTestDataHandle = testData;
+
+    ASSERT_TRUE(*outTestDataHandle == testData);
+    ASSERT_TRUE(allocator.size() == SmallBlockSize);
+}
+
+TEST(TlsfAllocator, Allocate_TooMuch) {
+    AxrTlsfAllocator allocator = createAllocator(SmallBlockSize + AlignmentSpace);
+
+    AxrHandle<TestData_Small> outTestData1Handle{};
+    AxrResult axrResult = allocator.allocate(1, outTestData1Handle);
+    ASSERT_TRUE(AXR_SUCCEEDED(axrResult));
+
+    AxrHandle<TestData_Small> outTestData2Handle{};
+    axrResult = allocator.allocate(1, outTestData2Handle);
+    ASSERT_TRUE(axrResult == AXR_ERROR_OUT_OF_MEMORY);
+
+    ASSERT_TRUE(allocator.size() == SmallBlockSize);
+}
+
+TEST(TlsfAllocator, Allocate_Aligned) {
+    AxrTlsfAllocator allocator = createAllocator(1024);
+
+    AxrHandle<TestData_Small> outTestData1Handle{};
+    AxrResult axrResult = allocator.allocate(1, outTestData1Handle);
+    ASSERT_TRUE(AXR_SUCCEEDED(axrResult));
+
+    AxrHandle<TestData_Aligned> outTestData2Handle{};
+    axrResult = allocator.allocate(3, outTestData2Handle);
+    ASSERT_TRUE(AXR_SUCCEEDED(axrResult));
+
+    ASSERT_TRUE(reinterpret_cast<uintptr_t>(outTestData2Handle.getDataPtr()) % alignof(TestData_Aligned) == 0);
+}
+
+TEST(TlsfAllocator, Deallocate_Merging_ThenAllocate) {
+    constexpr size_t allocatorSize = SmallBlockSize * 4 + AlignmentSpace;
+    AxrTlsfAllocator allocator = createAllocator(allocatorSize);
+
+    AxrHandle<TestData_Small> outTestData1Handle{};
+    AxrHandle<TestData_Small> outTestData2Handle{};
+    AxrHandle<TestData_Small> outTestData3Handle{};
+    AxrHandle<TestData_Small> outTestData4Handle{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData1Handle)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData2Handle)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData3Handle)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData4Handle)));
+
+    constexpr TestData_Small exampleTestData1{
+        .ID = 1,
+        .Data = {9, 1, 5, 6, 123, 867, 2},
+    };
+    constexpr TestData_Small exampleTestData4{
+        .ID = 4,
+        .Data = {7, 54, 15, 97, 12, 867, 35},
+    };
+    *outTestData1Handle = exampleTestData1;
+    *outTestData4Handle = exampleTestData4;
+
+    // Free the 2 blocks in the middle in an order that requires merging with both the previous and next block
+    allocator.deallocate(outTestData3Handle);
+    allocator.deallocate(outTestData2Handle);
+    ASSERT_TRUE(allocator.size() == SmallBlockSize * 2);
+
+    // The merged space is the only place a large block can fit
+    AxrHandle<TestData_Large> outTestData5Handle{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData5Handle)));
+
+    ASSERT_TRUE(*outTestData1Handle == exampleTestData1);
+    ASSERT_TRUE(*outTestData4Handle == exampleTestData4);
+
+    allocator.deallocate(outTestData1Handle);
+    allocator.deallocate(outTestData4Handle);
+    allocator.deallocate(outTestData5Handle);
+    ASSERT_TRUE(allocator.empty());
+
+    // Everything should have merged back into a single free block
+    AxrHandle<uint8_t> outTestData6Handle{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(allocator.capacity() - sizeof(void*) * 3, outTestData6Handle)));
+    ASSERT_TRUE(allocator.size() == allocator.capacity());
+}
+
+TEST(TlsfAllocator, Reallocate_InPlace) {
+    AxrTlsfAllocator allocator = createAllocator(1024);
+
+    AxrHandle<TestData_Small> outTestDataHandle{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestDataHandle)));
+
+    constexpr TestData_Small exampleTestData{
+        .ID = 3,
+        .Data = {5, 2, 8, 1, 9, 3, 7},
+    };
+    *outTestDataHandle = exampleTestData;
+    const TestData_Small* originalData = outTestDataHandle.getDataPtr();
+
+    // Grow into the free space after the block
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.reallocate(4, outTestDataHandle, true)));
+    ASSERT_TRUE(outTestDataHandle.getDataPtr() == originalData);
+    ASSERT_TRUE(outTestDataHandle[0] == exampleTestData);
+    ASSERT_TRUE(outTestDataHandle[3] == TestData_Small{});
+    ASSERT_TRUE(allocator.size() == AxrTlsfAllocator::getRequiredBlockSize(sizeof(TestData_Small) * 4, 4));
+
+    // Shrink it back down
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.reallocate(1, outTestDataHandle)));
+    ASSERT_TRUE(outTestDataHandle.getDataPtr() == originalData);
+    ASSERT_TRUE(*outTestDataHandle == exampleTestData);
+    ASSERT_TRUE(allocator.size() == SmallBlockSize);
+}
+
+TEST(TlsfAllocator, Reallocate_Move) {
+    AxrTlsfAllocator allocator = createAllocator(1024);
+
+    AxrHandle<TestData_Small> outTestData1Handle{};
+    AxrHandle<TestData_Small> outTestData2Handle{};
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData1Handle)));
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outTestData2Handle)));
+
+    constexpr TestData_Small exampleTestData{
+        .ID = 3,
+        .Data = {5, 2, 8, 1, 9, 3, 7},
+    };
+    *outTestData1Handle = exampleTestData;
+    const TestData_Small* originalData = outTestData1Handle.getDataPtr();
+
+    // Block 2 is in the way, so block 1 can't grow in place
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.reallocate(4, outTestData1Handle)));
+    ASSERT_TRUE(outTestData1Handle.getDataPtr() != originalData);
+    ASSERT_TRUE(outTestData1Handle[0] == exampleTestData);
+    ASSERT_TRUE(allocator.size() ==
+                SmallBlockSize + AxrTlsfAllocator::getRequiredBlockSize(sizeof(TestData_Small) * 4, 4));
+}
+
+TEST(TlsfAllocator, AutoDeallocate) {
+    AxrTlsfAllocator allocator = createAllocator(SmallBlockSize + LargeBlockSize + AlignmentSpace);
+
+    AxrHandle<TestData_Small> outTestData1Handle{};
+    AxrResult axrResult = allocator.allocate(1, outTestData1Handle);
+    ASSERT_TRUE(AXR_SUCCEEDED(axrResult));
+
+    {
+        AxrHandle<TestData_Large> outTestData2Handle{};
+        axrResult = allocator.allocate(1, outTestData2Handle);
+        ASSERT_TRUE(AXR_SUCCEEDED(axrResult));
+
+        // Check allocator is full first.
+        ASSERT_TRUE(allocator.size() == allocator.capacity());
+    }
+
+    // Check that the allocator now only holds data item 1
+    ASSERT_TRUE(allocator.size() == SmallBlockSize);
+}
+
+TEST(TlsfAllocator, MemoryPressure) {
+    AxrTlsfAllocator allocator = createAllocator(SmallBlockSize * 2 + AlignmentSpace);
+
+    AxrHandle<TestData_Small> outHandles[3]{};
+    MemoryPressureRecorder recorder{
+        .Allocator = &allocator,
+        .HandleToFree = &outHandles[0],
+    };
+    AxrMemoryPressureCallback memoryPressureCallback;
+    memoryPressureCallback.connect<&MemoryPressureRecorder::onMemoryPressure>(recorder);
+    allocator.getMemoryPressureMonitor().setHighWaterMark(SmallBlockSize * 2);
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.getMemoryPressureMonitor().addCallback(memoryPressureCallback)));
+
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outHandles[0])));
+    ASSERT_TRUE(recorder.HighCount == 0);
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outHandles[1])));
+    ASSERT_TRUE(recorder.HighCount == 1);
+
+    // The allocator is full, so the callback frees up the first block
+    ASSERT_TRUE(AXR_SUCCEEDED(allocator.allocate(1, outHandles[2])));
+    ASSERT_TRUE(recorder.CriticalCount == 1);
+    ASSERT_TRUE(outHandles[0].getDataPtr() == nullptr);
+    // Going from below the high water mark back to it notifies again
+    ASSERT_TRUE(recorder.HighCount == 2);
+}
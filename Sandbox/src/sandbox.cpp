@@ -72,6 +72,7 @@ int start() {
                 .VulkanConfig = vulkanConfig,
                 .ApiType = AXR_RENDERER_API_TYPE_VULKAN,
             },
+        .AllocatorSnapshotFilePath = nullptr,
     };
     axrSetup(&axrEngineConfig);
 
@@ -87,6 +88,6 @@ int start() {
         }
     }
 
-    axrShutdown();
+    axrShutdownFast();
     return 0;
 }